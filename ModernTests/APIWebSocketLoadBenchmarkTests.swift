@@ -0,0 +1,295 @@
+//
+//  APIWebSocketLoadBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Drives a websocket connection like the API server's with a local client that sends frames as
+// fast as it can. The server end echoes each frame, so these measure the round trip through
+// frame parsing, the delegate queue, and the write path. The connection's statistics show how
+// many writes the echoes took.
+final class APIWebSocketLoadBenchmarkTests: XCTestCase {
+    private var server: iTermWebSocketConnection!
+    private var echo: EchoingDelegate!
+    private var client: LoadGeneratorClient!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        var fds: [Int32] = [-1, -1]
+        XCTAssertEqual(socketpair(AF_UNIX, SOCK_STREAM, 0, &fds), 0)
+        client = LoadGeneratorClient(fd: fds[1])
+        echo = EchoingDelegate()
+
+        // The server's end is closed by the connection.
+        let connection = iTermHTTPConnection(fileDescriptor: fds[0], clientAddress: nil, euid: nil)
+        client.sendUpgradeRequest()
+        var request: URLRequest?
+        connection.queue.sync {
+            request = connection.readRequest()
+        }
+        var reason: NSString?
+        server = try XCTUnwrap(iTermWebSocketConnection.newWebSocketConnection(for: XCTUnwrap(request),
+                                                                             connection: connection,
+                                                                             reason: &reason),
+                               reason as String? ?? "")
+        server.delegate = echo
+        server.delegateQueue = echo.queue
+        server.handleRequest(request!) {}
+        XCTAssertTrue(client.readUpgradeResponse())
+    }
+
+    override func tearDown() {
+        let group = DispatchGroup()
+        group.enter()
+        server.abort {
+            group.leave()
+        }
+        // The completion block runs on the main queue.
+        while group.wait(timeout: .now()) != .success {
+            RunLoop.current.run(until: Date(timeIntervalSinceNow: 0.01))
+        }
+        client.close()
+        server = nil
+        echo = nil
+        client = nil
+        super.tearDown()
+    }
+
+    private func payload(_ i: Int, length: Int) -> [UInt8] {
+        var result = [UInt8](repeating: UInt8(truncatingIfNeeded: i), count: length)
+        withUnsafeBytes(of: UInt32(i).bigEndian) {
+            for (j, byte) in $0.enumerated() where j < length {
+                result[j] = byte
+            }
+        }
+        return result
+    }
+
+    // Sends `count` frames from another thread while reading the echoes on this one.
+    private func sendAndReceive(count: Int, length: Int) -> [[UInt8]] {
+        let frames = (0..<count).map { LoadGeneratorClient.maskedBinaryFrame(payload($0, length: length)) }
+        let client = self.client!
+        DispatchQueue.global().async {
+            for frame in frames {
+                client.write(frame)
+            }
+        }
+        var received = [[UInt8]]()
+        while received.count < count, let frame = client.readPayload() {
+            received.append(frame)
+        }
+        return received
+    }
+
+    func testEchoesEveryFrameInOrder() {
+        var total = 0
+        for length in [1, 125, 126, 70_000] {
+            let count = length > 1000 ? 20 : 500
+            let received = sendAndReceive(count: count, length: length)
+            XCTAssertEqual(received, (0..<count).map { payload($0, length: length) }, "length=\(length)")
+            total += count
+        }
+        XCTAssertTrue(echo.receivedDecodedObjects)
+
+        let stats = server.statistics
+        XCTAssertEqual(stats.framesReceived, UInt64(total))
+        XCTAssertEqual(stats.framesSent, stats.framesReceived)
+        XCTAssertLessThanOrEqual(stats.writes, stats.framesSent)
+    }
+
+    func testFramesSentWhileWritingAreCoalesced() {
+        // Make sure the connection is open and done writing before holding its queue.
+        client.write(LoadGeneratorClient.maskedBinaryFrame(payload(0, length: 1)))
+        XCTAssertEqual(client.readPayload(), payload(0, length: 1))
+        let deadline = Date(timeIntervalSinceNow: 10)
+        while server.unsentByteCount > 0 && Date() < deadline {
+            usleep(1000)
+        }
+        XCTAssertEqual(server.unsentByteCount, 0)
+        let before = server.statistics
+
+        // The first send starts a write. Its completion can't run until the queue has gotten
+        // through the other sends, so they all go out together in one more write.
+        let hold = DispatchSemaphore(value: 0)
+        server.testOnlyQueue.async {
+            hold.wait()
+        }
+        let count = 100
+        for i in 0..<count {
+            server.sendBinary(Data(payload(i, length: 10)), completion: nil)
+        }
+        hold.signal()
+        for i in 0..<count {
+            XCTAssertEqual(client.readPayload(), payload(i, length: 10))
+        }
+
+        let after = server.statistics
+        XCTAssertEqual(after.framesSent - before.framesSent, UInt64(count))
+        XCTAssertEqual(after.writes - before.writes, 2)
+    }
+
+    // Benchmarks like this one are skipped in ModernTests.xctestplan.
+    func testThroughputOfSmallFrames() {
+        measure {
+            XCTAssertEqual(sendAndReceive(count: 20_000, length: 100).count, 20_000)
+        }
+    }
+
+    func testRoundTripLatency() {
+        measure {
+            for i in 0..<1000 {
+                client.write(LoadGeneratorClient.maskedBinaryFrame(payload(i, length: 32)))
+                XCTAssertNotNil(client.readPayload())
+            }
+        }
+    }
+}
+
+private final class EchoingDelegate: NSObject, iTermWebSocketConnectionDelegate {
+    let queue = DispatchQueue(label: "com.iterm2.websocket-load-test")
+    private(set) var receivedDecodedObjects = false
+
+    func webSocketConnectionDidTerminate(_ webSocketConnection: iTermWebSocketConnection!) {
+    }
+
+    func webSocketConnection(_ webSocketConnection: iTermWebSocketConnection!,
+                             decodeFrame frame: iTermWebSocketFrame!) -> Any! {
+        return frame.payload
+    }
+
+    func webSocketConnection(_ webSocketConnection: iTermWebSocketConnection!,
+                             didReadFrame frame: iTermWebSocketFrame!,
+                             decodedObject: Any!) {
+        if decodedObject as? Data == frame.payload {
+            receivedDecodedObjects = true
+        }
+        webSocketConnection.sendBinary(frame.payload, completion: nil)
+    }
+}
+
+// The client half of a websocket: masks what it sends and reads unmasked frames.
+private final class LoadGeneratorClient {
+    private let fd: Int32
+    private var buffer = [UInt8]()
+    private var offset = 0
+
+    init(fd: Int32) {
+        self.fd = fd
+    }
+
+    func close() {
+        Darwin.close(fd)
+    }
+
+    static func maskedBinaryFrame(_ payload: [UInt8]) -> [UInt8] {
+        let mask: [UInt8] = [0x12, 0x34, 0x56, 0x78]
+        var frame: [UInt8] = [0x82]
+        if payload.count < 126 {
+            frame.append(0x80 | UInt8(payload.count))
+        } else if payload.count <= 0xffff {
+            frame += [0x80 | 126, UInt8(payload.count >> 8), UInt8(payload.count & 0xff)]
+        } else {
+            frame.append(0x80 | 127)
+            for shift in stride(from: 56, through: 0, by: -8) {
+                frame.append(UInt8((payload.count >> shift) & 0xff))
+            }
+        }
+        frame += mask
+        frame += payload.enumerated().map { $0.element ^ mask[$0.offset & 3] }
+        return frame
+    }
+
+    func sendUpgradeRequest() {
+        let request = [
+            "GET / HTTP/1.1",
+            "Host: localhost",
+            "Origin: http://localhost/",
+            "Upgrade: websocket",
+            "Connection: Upgrade",
+            "Sec-WebSocket-Protocol: api.iterm2.com",
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==",
+            "Sec-WebSocket-Version: 13",
+            "X-iTerm2-Library-Version: python 9.99",
+            "", ""].joined(separator: "\r\n")
+        write(Array(request.utf8))
+    }
+
+    func readUpgradeResponse() -> Bool {
+        let terminator = Array("\r\n\r\n".utf8)
+        while true {
+            if buffer.count - offset >= terminator.count,
+               let end = (offset...(buffer.count - terminator.count)).first(where: {
+                   Array(buffer[$0..<($0 + terminator.count)]) == terminator
+               }) {
+                let response = String(decoding: buffer[offset..<end], as: UTF8.self)
+                offset = end + terminator.count
+                return response.hasPrefix("HTTP/1.1 101")
+            }
+            guard fill() else {
+                return false
+            }
+        }
+    }
+
+    func write(_ bytes: [UInt8]) {
+        var written = 0
+        bytes.withUnsafeBytes { pointer in
+            while written < bytes.count {
+                let n = Darwin.write(fd, pointer.baseAddress! + written, bytes.count - written)
+                if n <= 0 {
+                    return
+                }
+                written += n
+            }
+        }
+    }
+
+    // Returns the payload of the next frame from the server, which doesn't mask.
+    func readPayload() -> [UInt8]? {
+        guard let header = take(2) else {
+            return nil
+        }
+        var length = Int(header[1] & 0x7f)
+        if length == 126 {
+            guard let bytes = take(2) else {
+                return nil
+            }
+            length = bytes.reduce(0) { $0 << 8 | Int($1) }
+        } else if length == 127 {
+            guard let bytes = take(8) else {
+                return nil
+            }
+            length = bytes.reduce(0) { $0 << 8 | Int($1) }
+        }
+        return take(length)
+    }
+
+    private func take(_ count: Int) -> [UInt8]? {
+        while buffer.count - offset < count {
+            guard fill() else {
+                return nil
+            }
+        }
+        let result = Array(buffer[offset..<(offset + count)])
+        offset += count
+        return result
+    }
+
+    private func fill() -> Bool {
+        if offset > 0 {
+            buffer.removeFirst(offset)
+            offset = 0
+        }
+        var chunk = [UInt8](repeating: 0, count: 65536)
+        let n = read(fd, &chunk, chunk.count)
+        guard n > 0 else {
+            return false
+        }
+        buffer += chunk[0..<n]
+        return true
+    }
+}
@@ -0,0 +1,93 @@
+//
+//  LineBlockMetadataArrayTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class LineBlockMetadataArrayTests: XCTestCase {
+    private func metadata(timestamp: TimeInterval, rtl: Bool = false) -> iTermImmutableMetadata {
+        var result = iTermImmutableMetadataDefault()
+        result.timestamp = timestamp
+        result.rtlFound = ObjCBool(rtl)
+        return result
+    }
+
+    private func continuation<T: BinaryInteger>(_ code: T) -> screen_char_t {
+        var result = screen_char_t()
+        result.code = unichar(truncatingIfNeeded: code)
+        return result
+    }
+
+    private func makeArray(count: Int) -> LineBlockMetadataArray {
+        let array = LineBlockMetadataArray(capacity: 2, useDWCCache: true)
+        for i in 0..<count {
+            array.increaseCapacity(to: Int32(i + 1))
+            array.append(metadata(timestamp: TimeInterval(i), rtl: i % 3 == 0),
+                         continuation: continuation(i % 2 == 0 ? EOL_HARD : EOL_SOFT))
+        }
+        return array
+    }
+
+    func testAppendedValuesSurviveGrowth() {
+        let array = makeArray(count: 100)
+        XCTAssertEqual(array.numEntries, 100)
+        for i in 0..<100 {
+            let index = Int32(i)
+            XCTAssertEqual(array.immutableLineMetadata(at: index).timestamp, TimeInterval(i))
+            XCTAssertEqual(array.rtlFound(at: index), i % 3 == 0)
+            XCTAssertEqual(array.continuation(at: index).code, unichar(i % 2 == 0 ? EOL_HARD : EOL_SOFT))
+            XCTAssertNil(array.bidiDisplayInfo(at: index))
+            XCTAssertNil(array.doubleWidthCharacterCache(at: index))
+            XCTAssertEqual(array.wrappedLineCount(at: index).width, 0)
+        }
+        XCTAssertEqual(array.lastContinuation().code, unichar(EOL_SOFT))
+    }
+
+    func testAppendingToLastLineClearsCaches() {
+        let array = makeArray(count: 2)
+        array.setWrappedLineCount(LineBlockWrappedLineCount(width: 80, count: 3), at: 1)
+        XCTAssertEqual(array.wrappedLineCount(at: 1).count, 3)
+
+        var more = metadata(timestamp: 10, rtl: true)
+        XCTAssertTrue(array.append(toLastLine: &more,
+                                   originalLength: 5,
+                                   additionalLength: 5,
+                                   continuation: continuation(EOL_HARD)))
+        XCTAssertEqual(array.wrappedLineCount(at: 1).width, 0)
+        XCTAssertEqual(array.immutableLineMetadata(at: 1).timestamp, 10)
+        XCTAssertEqual(array.lastContinuation().code, unichar(EOL_HARD))
+    }
+
+    func testCopyOnWriteKeepsValuesButNotCaches() {
+        let array = makeArray(count: 3)
+        array.setWrappedLineCount(LineBlockWrappedLineCount(width: 80, count: 2), at: 0)
+        let copy = array.cowCopy()
+
+        copy.setRTLFound(true, at: 1)
+        XCTAssertFalse(array.rtlFound(at: 1))
+        XCTAssertTrue(copy.rtlFound(at: 1))
+        XCTAssertEqual(array.wrappedLineCount(at: 0).count, 2)
+        XCTAssertEqual(copy.wrappedLineCount(at: 0).width, 0)
+        XCTAssertEqual(copy.immutableLineMetadata(at: 2).timestamp, 2)
+    }
+
+    func testRemoveFirstAndLast() {
+        let array = makeArray(count: 4)
+        array.setWrappedLineCount(LineBlockWrappedLineCount(width: 10, count: 1), at: 0)
+        array.removeFirst(2)
+        XCTAssertEqual(array.first, 2)
+        XCTAssertEqual(array.wrappedLineCount(at: 0).width, 0)
+
+        array.removeLast()
+        XCTAssertEqual(array.numEntries, 3)
+        XCTAssertEqual(array.lastContinuation().code, unichar(EOL_HARD))
+
+        array.reset()
+        XCTAssertEqual(array.numEntries, 0)
+        XCTAssertEqual(array.first, 0)
+    }
+}
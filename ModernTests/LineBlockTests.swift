@@ -1032,6 +1032,125 @@ class LineBlockTests: XCTestCase {
         }
     }
 
+    // MARK: - Packing
+
+    // Makes a line whose foreground color changes every `runLength` characters.
+    private func makeStyledLineString(_ string: String, runLength: Int) -> iTermLineString {
+        var chars = string.utf16.enumerated().map { (i, code) -> screen_char_t in
+            var c = screen_char_t()
+            c.code = code
+            c.foregroundColor = UInt32((i / runLength) % 8)
+            c.foregroundColorMode = UInt32(ColorModeNormal.rawValue)
+            c.bold = UInt32((i / runLength) % 2)
+            return c
+        }
+        let content = chars.withUnsafeMutableBufferPointer { umbp in
+            iTermLegacyStyleString(chars: umbp.baseAddress!, count: umbp.count, eaIndex: nil)
+        }
+        var continuation = screen_char_t()
+        continuation.code = unichar(EOL_HARD)
+        return iTermLineString(content: content,
+                               eol: EOL_HARD,
+                               continuation: continuation,
+                               metadata: iTermLineStringMetadata(timestamp: 0, rtlFound: false),
+                               bidi: nil,
+                               dirty: false)
+    }
+
+    private func rawLineData(_ block: LineBlock) -> [Data] {
+        return (0..<block.numRawLines()).map { i in
+            let sca = block.screenCharArray(forRawLine: i)
+            return Data(bytes: sca.line, count: Int(sca.length) * MemoryLayout<screen_char_t>.stride)
+        }
+    }
+
+    func testPackedBlockMaterializesIdenticalCharacters() {
+        let block = LineBlock(rawBufferSize: 1000, absoluteBlockNumber: 0)!
+        let text = String(repeating: "The quick brown fox jumps over the lazy dog. ", count: 4)
+        for runLength in [8, 16, 1000] {
+            XCTAssertTrue(block.appendLineString(makeStyledLineString(text, runLength: runLength),
+                                                 width: 80))
+        }
+        block.shrinkToFit()
+        let expected = rawLineData(block)
+
+        block.packCharacterBuffer()
+
+        XCTAssertTrue(block.characterBufferIsPacked)
+        XCTAssertEqual(rawLineData(block), expected)
+        XCTAssertFalse(block.characterBufferIsPacked, "Reading should have materialized the characters")
+    }
+
+    func testReadingPackedBlockKeepsPackedForm() {
+        let block = LineBlock(rawBufferSize: 200, absoluteBlockNumber: 0)!
+        XCTAssertTrue(block.appendLineString(makeStyledLineString("Packed line one", runLength: 100), width: 80))
+        block.shrinkToFit()
+        let expected = rawLineData(block)
+        block.packCharacterBuffer()
+        let copy = block.copy(withAbsoluteBlockNumber: 0)!
+
+        // The copy shares the packed buffer, so reading it is seen by both.
+        XCTAssertEqual(rawLineData(copy), expected)
+        XCTAssertFalse(block.characterBufferIsPacked)
+
+        // Repacking drops what reading expanded without packing again, and leaves the copy alone.
+        XCTAssertTrue(block.packCharacterBuffer())
+        XCTAssertTrue(block.characterBufferIsPacked)
+        XCTAssertFalse(copy.characterBufferIsPacked)
+        XCTAssertTrue(copy.adoptCompactCharacterBuffer())
+        XCTAssertTrue(copy.characterBufferIsPacked)
+        XCTAssertEqual(rawLineData(block), expected)
+        XCTAssertEqual(rawLineData(copy), expected)
+    }
+
+    func testCountingLinesOfPackedBlockKeepsPackedForm() {
+        let block = LineBlock(rawBufferSize: 1000, absoluteBlockNumber: 0)!
+        block.mayHaveDoubleWidthCharacter = true
+        XCTAssertTrue(block.appendLineString(makeLineString(String(repeating: "AB中DEF", count: 20),
+                                                            eol: EOL_HARD),
+                                             width: 80))
+        block.shrinkToFit()
+        let widths: [Int32] = [3, 7, 13]
+        let expected = widths.map { block.totallyUncachedNumLines(withWrapWidth: $0) }
+        XCTAssertTrue(block.packCharacterBuffer())
+
+        // Counting at a new width, as after a resize, has to look for double-width characters.
+        XCTAssertEqual(widths.map { block.getNumLines(withWrapWidth: $0) }, expected)
+        XCTAssertTrue(block.characterBufferIsPacked)
+    }
+
+    func testPackingIsSkippedWhenStyleChangesTooOften() {
+        let block = LineBlock(rawBufferSize: 100, absoluteBlockNumber: 0)!
+        XCTAssertTrue(block.appendLineString(makeStyledLineString("abcdefghijklmnopqrstuvwxyz", runLength: 1),
+                                             width: 80))
+        block.shrinkToFit()
+
+        block.packCharacterBuffer()
+
+        XCTAssertFalse(block.characterBufferIsPacked)
+    }
+
+    func testPackedBlockSurvivesMutationAndSerialization() {
+        let block = LineBlock(rawBufferSize: 200, absoluteBlockNumber: 0)!
+        XCTAssertTrue(block.appendLineString(makeStyledLineString("Packed line one", runLength: 100), width: 80))
+        XCTAssertTrue(block.appendLineString(makeStyledLineString("Packed line two", runLength: 100), width: 80))
+        let unpacked = block.copy(withAbsoluteBlockNumber: 0)!
+        block.packCharacterBuffer()
+
+        // Serializing doesn't materialize.
+        let dict = block.dictionary()
+        XCTAssertTrue(block.characterBufferIsPacked)
+        let restored = LineBlock(dictionary: dict, absoluteBlockNumber: 0)!
+        XCTAssertTrue(restored.isEqual(unpacked))
+
+        // Appending materializes and then behaves as usual.
+        XCTAssertTrue(block.appendLineString(makeStyledLineString("Three", runLength: 100), width: 80))
+        XCTAssertFalse(block.characterBufferIsPacked)
+        XCTAssertEqual(block.numRawLines(), 3)
+        XCTAssertEqual(block.screenCharArray(forRawLine: 0).stringValue, "Packed line one")
+        XCTAssertEqual(block.screenCharArray(forRawLine: 2).stringValue, "Three")
+    }
+
     // MARK: - Empty Line Counts
 
     func testNumberOfLeadingEmptyLines() {
@@ -2132,6 +2251,48 @@ class LineBlockTests: XCTestCase {
                        "includesPartialLastLine should be false for a single hard-EOL line")
     }
 
+    private func findPositions(_ needle: String,
+                               in text: String,
+                               mode: iTermFindMode,
+                               backwards: Bool) -> [Int32] {
+        let block = LineBlock(rawBufferSize: 100, absoluteBlockNumber: 0)!
+        XCTAssertTrue(block.appendLineString(makeLineString(text, eol: EOL_HARD), width: 80))
+        var options = FindOptions.multipleResults
+        if backwards {
+            options.insert(.optBackwards)
+        }
+        let results = NSMutableArray()
+        var includesPartialLastLine = ObjCBool(false)
+        block.findSubstring(needle,
+                            options: options,
+                            mode: mode,
+                            atOffset: backwards ? Int32(block.rawSpaceUsed() - 1) : 0,
+                            results: results,
+                            multipleResults: true,
+                            includesPartialLastLine: &includesPartialLastLine)
+        return results.map { ($0 as! ResultRange).position }
+    }
+
+    func testFindSubstringInASCIILineMatchesStringSearch() {
+        // ASCII lines are searched cell by cell; these must agree with NSString's semantics.
+        // Matches don't overlap, and backwards searches find them from the end.
+        XCTAssertEqual(findPositions("aa", in: "aaaaa", mode: .caseSensitiveSubstring, backwards: false), [0, 2])
+        XCTAssertEqual(findPositions("aa", in: "aaaaa", mode: .caseSensitiveSubstring, backwards: true), [3, 1])
+
+        // Smart case is insensitive only when the query has no capitals.
+        XCTAssertEqual(findPositions("hello", in: "HELLO world Hello", mode: .smartCaseSensitivity, backwards: false), [0, 12])
+        XCTAssertEqual(findPositions("Hello", in: "HELLO world Hello", mode: .smartCaseSensitivity, backwards: false), [12])
+        XCTAssertEqual(findPositions("WORLD", in: "HELLO world Hello", mode: .caseInsensitiveSubstring, backwards: true), [6])
+        XCTAssertEqual(findPositions("xyz", in: "HELLO world Hello", mode: .caseInsensitiveSubstring, backwards: false), [])
+    }
+
+    func testFindSubstringInNonASCIILineFoldsDiacritics() {
+        // A line with non-ASCII characters falls back to string search, which ignores diacritics
+        // when case-insensitive.
+        XCTAssertEqual(findPositions("cafe", in: "Café cafe", mode: .smartCaseSensitivity, backwards: false), [0, 5])
+        XCTAssertEqual(findPositions("cafe", in: "Café cafe", mode: .caseSensitiveSubstring, backwards: false), [5])
+    }
+
     func testFindSubstringMultiLineMode() {
         // Split needle on \n, search multi-line within a single raw line; verify combined matching logic.
 
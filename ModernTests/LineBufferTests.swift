@@ -650,6 +650,197 @@ class LineBufferTests: XCTestCase {
             XCTAssertEqual(count, 1)
         }
     }
+
+    // MARK: - Packing idle blocks
+
+    private func makeBufferWithSeveralBlocks(width: Int32, spillsToDisk: Bool = false) -> LineBuffer {
+        let buffer = LineBuffer(blockSize: 140)
+        buffer.spillsToDisk = spillsToDisk
+        for i in 0..<16 {
+            buffer.append(screenCharArrayWithDefaultStyle("Line \(i) is long enough that a few of them fill a block",
+                                                          eol: EOL_HARD),
+                          width: width)
+        }
+        return buffer
+    }
+
+    private func numberOfPackedBlocks(_ buffer: LineBuffer) -> Int {
+        return (0..<buffer.largestAbsoluteBlockNumber).filter {
+            buffer.testOnlyBlock(at: $0).characterBufferIsPacked
+        }.count
+    }
+
+    private func numberOfSpilledBlocks(_ buffer: LineBuffer) -> Int {
+        return (0..<buffer.largestAbsoluteBlockNumber).filter {
+            buffer.testOnlyBlock(at: $0).characterBufferIsSpilled
+        }.count
+    }
+
+    func testPackingIdleBlocksKeepsMostRecentlyReadBlocks() {
+        let width = Int32(30)
+        let buffer = makeBufferWithSeveralBlocks(width: width)
+        let blockCount = Int(buffer.largestAbsoluteBlockNumber)
+        XCTAssertGreaterThan(blockCount, 4)
+
+        // Reading unpacks everything.
+        let expected = buffer.allWrappedLinesAsStrings(width: width)
+        XCTAssertEqual(numberOfPackedBlocks(buffer), 0)
+
+        // Nothing has been idle that long.
+        XCTAssertEqual(buffer.packBlocksIdle(for: 1000, keepingMostRecent: 0, limit: 100), 0)
+
+        XCTAssertEqual(buffer.packBlocksIdle(for: 0, keepingMostRecent: 2, limit: 1), 1)
+        XCTAssertEqual(buffer.packBlocksIdle(for: 0, keepingMostRecent: 2, limit: 100), blockCount - 4)
+
+        // The last block and the two kept blocks remain unpacked.
+        XCTAssertEqual(numberOfPackedBlocks(buffer), blockCount - 3)
+        XCTAssertFalse(buffer.testOnlyBlock(at: Int32(blockCount - 1)).characterBufferIsPacked)
+        XCTAssertEqual(buffer.allWrappedLinesAsStrings(width: width), expected)
+    }
+
+    func testCopyAdoptsPackedBlocksWhenMerging() {
+        let width = Int32(30)
+        let buffer = makeBufferWithSeveralBlocks(width: width)
+        let expected = buffer.allWrappedLinesAsStrings(width: width)
+        let copy = buffer.copy()
+
+        XCTAssertGreaterThan(buffer.packBlocksIdle(for: 0, keepingMostRecent: 0, limit: 100), 0)
+        XCTAssertEqual(numberOfPackedBlocks(copy), 0)
+
+        // Packing doesn't make the buffer dirty, but merging still picks up the packed blocks.
+        buffer.dirty = false
+        copy.merge(from: buffer)
+        XCTAssertEqual(numberOfPackedBlocks(copy), numberOfPackedBlocks(buffer))
+        XCTAssertEqual(copy.allWrappedLinesAsStrings(width: width), expected)
+    }
+
+    // MARK: - Spilling to disk
+
+    func testSealedBlocksSpillAndReadBackIdentically() {
+        let width = Int32(30)
+        let reference = makeBufferWithSeveralBlocks(width: width)
+        let buffer = makeBufferWithSeveralBlocks(width: width, spillsToDisk: true)
+        let blockCount = Int(buffer.largestAbsoluteBlockNumber)
+        XCTAssertGreaterThan(blockCount, 2)
+
+        // Everything but the tail goes to disk as soon as it's sealed.
+        XCTAssertEqual(numberOfSpilledBlocks(buffer), blockCount - 1)
+
+        // Saving a spilled block reads the file without mapping it back in.
+        let restored = LineBlock(dictionary: buffer.testOnlyBlock(at: 0).dictionary(), absoluteBlockNumber: 0)!
+        XCTAssertTrue(buffer.testOnlyBlock(at: 0).characterBufferIsSpilled)
+        XCTAssertTrue(restored.isEqual(reference.testOnlyBlock(at: 0)))
+
+        XCTAssertEqual(buffer.allWrappedLinesAsStrings(width: width),
+                       reference.allWrappedLinesAsStrings(width: width))
+        XCTAssertEqual(numberOfSpilledBlocks(buffer), 0)
+
+        // Unchanged blocks go back to their existing records.
+        XCTAssertEqual(buffer.packBlocksIdle(for: 0, keepingMostRecent: 0, limit: 100), blockCount - 1)
+        XCTAssertEqual(numberOfSpilledBlocks(buffer), blockCount - 1)
+        XCTAssertEqual(buffer.allWrappedLinesAsStrings(width: width),
+                       reference.allWrappedLinesAsStrings(width: width))
+    }
+
+    func testCountingLinesForNewWidthAcrossManyBlocks() {
+        // Enough blocks to count in parallel, with double-width characters so each one is scanned.
+        let many = LineBuffer(blockSize: 140)
+        let one = LineBuffer(blockSize: 1_000_000)
+        for i in 0..<400 {
+            let sca = screenCharArrayWithDefaultStyle("Line \(i) has W-i-d-e characters in it",
+                                                      eol: EOL_HARD)
+            many.append(sca, width: 80)
+            one.append(sca, width: 80)
+        }
+        XCTAssertGreaterThan(many.largestAbsoluteBlockNumber, 64)
+        for width in [Int32(7), 13, 30] {
+            XCTAssertEqual(many.numLines(withWidth: width), one.numLines(withWidth: width))
+            XCTAssertEqual(many.allWrappedLinesAsStrings(width: width),
+                           one.allWrappedLinesAsStrings(width: width))
+        }
+    }
+
+    func testCopyAdoptsSpilledBlocks() {
+        let width = Int32(30)
+        let buffer = makeBufferWithSeveralBlocks(width: width, spillsToDisk: true)
+        let expected = buffer.allWrappedLinesAsStrings(width: width)
+        let copy = buffer.copy()
+        XCTAssertFalse(copy.spillsToDisk)
+        XCTAssertEqual(numberOfSpilledBlocks(copy), 0)
+
+        XCTAssertGreaterThan(buffer.packBlocksIdle(for: 0, keepingMostRecent: 0, limit: 100), 0)
+        copy.adoptCompactBlocks(from: buffer)
+
+        XCTAssertEqual(numberOfSpilledBlocks(copy), numberOfSpilledBlocks(buffer))
+        XCTAssertEqual(copy.allWrappedLinesAsStrings(width: width), expected)
+    }
+
+    // MARK: - Enumerating raw lines in chunks
+
+    private func export(_ buffer: LineBuffer,
+                        from start: LineBufferPosition,
+                        maxCells: Int32) -> (text: String, continuations: [Bool]) {
+        var text = ""
+        var continuations = [Bool]()
+        var position = start
+        while true {
+            var cells = Int32(0)
+            var first = true
+            position = buffer.enumerateRawLines(from: position, maxCells: maxCells) { chars, continuesLine, endsLine in
+                if first {
+                    continuations.append(continuesLine)
+                    first = false
+                }
+                text += chars.stringValue + (endsLine ? "\n" : "")
+                cells += max(1, chars.length)
+            }
+            if cells < maxCells {
+                return (text, continuations)
+            }
+        }
+    }
+
+    func testEnumerateRawLinesInChunks() {
+        let buffer = LineBuffer()
+        for string in ["Hello world", "", "", "Goodbye cruel world", ""] {
+            buffer.append(screenCharArrayWithDefaultStyle(string, eol: EOL_HARD), width: 80)
+        }
+        let expected = "Hello world\n\n\nGoodbye cruel world\n\n"
+        for maxCells in Int32(1)...Int32(40) {
+            XCTAssertEqual(export(buffer, from: buffer.firstPosition(), maxCells: maxCells).text,
+                           expected,
+                           "maxCells=\(maxCells)")
+        }
+
+        // Chunks that start mid-line say so.
+        let continuations = export(buffer, from: buffer.firstPosition(), maxCells: 4).continuations
+        XCTAssertEqual(Array(continuations.prefix(4)), [false, true, true, false])
+    }
+
+    func testEnumerateRawLinesResumesAfterDroppingLines() {
+        for blockSize in [Int32(16), 1000] {
+            let buffer = LineBuffer(blockSize: blockSize)
+            let strings = (0..<6).map { "Line number \($0)" }
+            for string in strings {
+                buffer.append(screenCharArrayWithDefaultStyle(string, eol: EOL_HARD), width: 80)
+            }
+            let next = buffer.enumerateRawLines(from: buffer.firstPosition(),
+                                                maxCells: Int32(strings[0].count + strings[1].count)) { _, _, _ in }
+
+            buffer.setMaxLines(5)
+            buffer.dropExcessLines(withWidth: 80)
+            XCTAssertEqual(export(buffer, from: next, maxCells: 5).text,
+                           strings[2...].map { $0 + "\n" }.joined(),
+                           "blockSize=\(blockSize)")
+
+            // Positions that were dropped resume from the first line that remains.
+            buffer.setMaxLines(2)
+            buffer.dropExcessLines(withWidth: 80)
+            XCTAssertEqual(export(buffer, from: next, maxCells: 5).text,
+                           strings[4...].map { $0 + "\n" }.joined(),
+                           "blockSize=\(blockSize)")
+        }
+    }
 }
 
 extension LineBuffer {
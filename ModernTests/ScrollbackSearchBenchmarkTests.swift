@@ -0,0 +1,92 @@
+//
+//  ScrollbackSearchBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Compares searching a large scrollback with and without the trigram index (see
+// iTermScrollbackSearchIndex). The needle occurs a few times near the end, so a linear scan has to
+// look at almost every block before its first result.
+final class ScrollbackSearchBenchmarkTests: XCTestCase {
+    private static let lineCount = 100_000
+    private static let needle = "qzxv_needle"
+    private static let needleLines: Set<Int> = [75_000, 85_000, 95_000, 99_000]
+
+    private static func makeBuffer(indexed: Bool) -> LineBuffer {
+        let buffer = LineBuffer()
+        buffer.indexesForSearch = indexed
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        let words = ["build", "error", "warning", "compiling", "linking", "src/main.c", "ok",
+                     "test", "passed", "failed", "0x1f3a", "retrying", "connection", "timeout"]
+        for i in 0..<lineCount {
+            var parts = (0..<8).map { _ in words[Int(generator.next() % UInt64(words.count))] }
+            if needleLines.contains(i) {
+                parts.insert(needle, at: 3)
+            }
+            buffer.append(screenCharArrayWithDefaultStyle(parts.joined(separator: " "), eol: EOL_HARD),
+                          width: 80)
+        }
+        return buffer
+    }
+
+    private static let linear = makeBuffer(indexed: false)
+    private static let indexed = makeBuffer(indexed: true)
+
+    // Returns the number of results found. Stops after the first block with a result if
+    // `firstOnly` is set.
+    private func search(_ buffer: LineBuffer, firstOnly: Bool) -> Int {
+        let context = FindContext()
+        buffer.prepareToSearch(for: Self.needle,
+                               startingAt: buffer.firstPosition(),
+                               options: [.multipleResults],
+                               mode: .smartCaseSensitivity,
+                               with: context)
+        var count = 0
+        while context.status != .NotFound {
+            buffer.findSubstring(context, stopAt: buffer.lastPosition())
+            count += context.results?.count ?? 0
+            context.results?.removeAllObjects()
+            if firstOnly && count > 0 {
+                break
+            }
+        }
+        return count
+    }
+
+    func testBothFindEveryResult() {
+        XCTAssertEqual(search(Self.linear, firstOnly: false), Self.needleLines.count)
+        XCTAssertEqual(search(Self.indexed, firstOnly: false), Self.needleLines.count)
+    }
+
+    func testTimeToFirstResultLinearScan() {
+        let buffer = Self.linear
+        measure {
+            XCTAssertEqual(search(buffer, firstOnly: true), 1)
+        }
+    }
+
+    func testTimeToFirstResultIndexed() {
+        let buffer = Self.indexed
+        measure {
+            XCTAssertEqual(search(buffer, firstOnly: true), 1)
+        }
+    }
+
+    func testTimeToAllResultsLinearScan() {
+        let buffer = Self.linear
+        measure {
+            XCTAssertEqual(search(buffer, firstOnly: false), Self.needleLines.count)
+        }
+    }
+
+    func testTimeToAllResultsIndexed() {
+        let buffer = Self.indexed
+        measure {
+            XCTAssertEqual(search(buffer, firstOnly: false), Self.needleLines.count)
+        }
+    }
+}
@@ -0,0 +1,166 @@
+//
+//  TaskNotifierBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Measures how long TaskNotifier takes to notice output when many sessions are open but only a
+// few are producing output. Set the useKqueueForTaskNotifier advanced setting to compare the
+// kqueue and select() monitors; it takes effect when TaskNotifier is first used.
+final class TaskNotifierBenchmarkTests: XCTestCase {
+    private var tasks = [NotifyLatencyTask]()
+
+    override func tearDown() {
+        for task in tasks {
+            TaskNotifier.sharedInstance().deregisterTask(task)
+            task.close()
+        }
+        tasks = []
+        super.tearDown()
+    }
+
+    private func openTasks(_ count: Int) throws {
+        for _ in 0..<count {
+            let task = try XCTUnwrap(NotifyLatencyTask.make())
+            tasks.append(task)
+            TaskNotifier.sharedInstance().registerTask(task)
+        }
+    }
+
+    // Writes a byte to the slave side of each task in `indexes` and waits until every one of
+    // them has been read.
+    private func notify(_ indexes: [Int]) -> Bool {
+        let group = DispatchGroup()
+        for i in indexes {
+            group.enter()
+            tasks[i].expectRead {
+                group.leave()
+            }
+        }
+        for i in indexes {
+            tasks[i].writeToSlave()
+        }
+        return group.wait(timeout: .now() + 10) == .success
+    }
+
+    func testEveryWrittenTaskIsNotified() throws {
+        try openTasks(32)
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        for _ in 0..<20 {
+            let indexes = Array((0..<tasks.count).shuffled(using: &generator).prefix(5))
+            XCTAssertTrue(notify(indexes))
+        }
+        for i in 0..<tasks.count {
+            XCTAssertTrue(notify([i]))
+        }
+    }
+
+    func testNotifyLatencyWithManyIdleSessions() throws {
+        try openTasks(256)
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        let rounds = (0..<200).map { _ in
+            Array((0..<tasks.count).shuffled(using: &generator).prefix(4))
+        }
+        measure {
+            for indexes in rounds {
+                XCTAssertTrue(notify(indexes))
+            }
+        }
+    }
+}
+
+// A task backed by a pty that isn't attached to any process. Writing to the slave side makes
+// the master side readable, just like output from a shell.
+private final class NotifyLatencyTask: NSObject, iTermTask {
+    let fd: Int32
+    private let slave: Int32
+    private let lock = NSLock()
+    private var pendingRead: (() -> Void)?
+
+    static func make() -> NotifyLatencyTask? {
+        let master = posix_openpt(O_RDWR | O_NOCTTY)
+        guard master >= 0 else {
+            return nil
+        }
+        guard grantpt(master) == 0, unlockpt(master) == 0, let name = ptsname(master) else {
+            Darwin.close(master)
+            return nil
+        }
+        let slave = open(name, O_RDWR | O_NOCTTY)
+        guard slave >= 0 else {
+            Darwin.close(master)
+            return nil
+        }
+        _ = fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK)
+        return NotifyLatencyTask(master: master, slave: slave)
+    }
+
+    private init(master: Int32, slave: Int32) {
+        fd = master
+        self.slave = slave
+        super.init()
+    }
+
+    func close() {
+        Darwin.close(slave)
+        Darwin.close(fd)
+    }
+
+    // `completion` is called on an arbitrary thread the next time a read returns data.
+    func expectRead(_ completion: @escaping () -> Void) {
+        lock.lock()
+        pendingRead = completion
+        lock.unlock()
+    }
+
+    func writeToSlave() {
+        var byte = UInt8(ascii: "x")
+        _ = write(slave, &byte, 1)
+    }
+
+    var pid: pid_t { -1 }
+    var pidToWaitOn: pid_t { -1 }
+    var hasCoprocess: Bool { false }
+    var coprocess: Coprocess! = nil
+    var wantsRead: Bool { true }
+    var wantsWrite: Bool { false }
+    var writeBufferHasRoom: Bool { true }
+    var hasBrokenPipe: Bool { false }
+    var sshIntegrationActive: Bool { false }
+
+    func processRead() {
+        var buffer = [UInt8](repeating: 0, count: 1024)
+        var total = 0
+        while true {
+            let n = read(fd, &buffer, buffer.count)
+            if n <= 0 {
+                break
+            }
+            total += n
+        }
+        guard total > 0 else {
+            return
+        }
+        lock.lock()
+        let completion = pendingRead
+        pendingRead = nil
+        lock.unlock()
+        completion?()
+    }
+
+    func processWrite() {
+    }
+
+    func brokenPipe() {
+    }
+
+    func writeTask(_ data: Data!, coprocess: Bool) {
+    }
+
+    func didRegister() {
+    }
+}
@@ -0,0 +1,107 @@
+//
+//  TriggerPrefilterBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Compares running every trigger's regex on every line with running only the ones that
+// iTermTriggerPrefilter says might match. Uses NSRegularExpression directly, as Trigger does when
+// fastTriggerRegexes is on, so session and action overhead isn't measured.
+final class TriggerPrefilterBenchmarkTests: XCTestCase {
+    private static let triggerCounts = [1, 10, 30, 60, 120]
+
+    // Output that looks like a build log. About one line in a hundred matches some trigger.
+    private static let lines: [String] = {
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        let words = ["build", "error", "warning", "compiling", "linking", "src/main.c", "ok",
+                     "test", "passed", "failed", "0x1f3a", "retrying", "connection", "timeout"]
+        return (0..<20_000).map { _ in
+            var parts = (0..<10).map { _ in words[Int(generator.next() % UInt64(words.count))] }
+            if generator.next() % 100 == 0 {
+                parts.insert("failed with code 2 in step\(generator.next() % 60)", at: 0)
+            }
+            return parts.joined(separator: " ")
+        }
+    }()
+
+    private static func patterns(count: Int) -> [String] {
+        return (0..<count).map { i in
+            switch i % 4 {
+            case 0:
+                return "^error\(i): (.*)$"
+            case 1:
+                return "\\[warn\(i)\\] (\\w+)"
+            case 2:
+                return "failed with code (\\d+) in step\(i)\\b"
+            default:
+                return "user\(i)@[a-z]+\\.example\\.com"
+            }
+        }
+    }
+
+    // Returns the number of lines matched by some regex.
+    private func matchCount(_ regexes: [NSRegularExpression], prefilter: iTermTriggerPrefilter?) -> Int {
+        var count = 0
+        for line in Self.lines {
+            let range = NSRange(location: 0, length: line.utf16.count)
+            let candidates = prefilter?.indexesOfPatternsThatMayMatch(line)
+            for (i, regex) in regexes.enumerated() {
+                if let candidates, !candidates.contains(i) {
+                    continue
+                }
+                if regex.firstMatch(in: line, range: range) != nil {
+                    count += 1
+                    break
+                }
+            }
+        }
+        return count
+    }
+
+    private func linesPerSecond(_ closure: () -> ()) -> Double {
+        let start = Date()
+        closure()
+        return Double(Self.lines.count) / Date().timeIntervalSince(start)
+    }
+
+    func testLinesPerSecondByTriggerCount() {
+        for count in Self.triggerCounts {
+            let patterns = Self.patterns(count: count)
+            let regexes = patterns.map { try! NSRegularExpression(pattern: $0) }
+            let prefilter = iTermTriggerPrefilter(patterns: patterns)
+            XCTAssertEqual(prefilter.numberOfUnfilteredPatterns, 0)
+
+            var expected = 0
+            var actual = 0
+            let unfiltered = linesPerSecond {
+                expected = matchCount(regexes, prefilter: nil)
+            }
+            let prefiltered = linesPerSecond {
+                actual = matchCount(regexes, prefilter: prefilter)
+            }
+            XCTAssertEqual(actual, expected)
+            print(String(format: "%4d triggers: %10.0f lines/sec each regex, %10.0f lines/sec prefiltered",
+                         count, unfiltered, prefiltered))
+        }
+    }
+
+    func testSixtyTriggersEachRegexPerformance() {
+        let regexes = Self.patterns(count: 60).map { try! NSRegularExpression(pattern: $0) }
+        measure {
+            _ = matchCount(regexes, prefilter: nil)
+        }
+    }
+
+    func testSixtyTriggersPrefilteredPerformance() {
+        let patterns = Self.patterns(count: 60)
+        let regexes = patterns.map { try! NSRegularExpression(pattern: $0) }
+        let prefilter = iTermTriggerPrefilter(patterns: patterns)
+        measure {
+            _ = matchCount(regexes, prefilter: prefilter)
+        }
+    }
+}
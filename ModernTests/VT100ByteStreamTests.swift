@@ -0,0 +1,67 @@
+//
+//  VT100ByteStreamTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class VT100ByteStreamTests: XCTestCase {
+    private var stream = VT100ByteStream()
+
+    override func setUp() {
+        super.setUp()
+        VT100ByteStreamInit(&stream)
+    }
+
+    override func tearDown() {
+        VT100ByteStreamFree(&stream)
+        super.tearDown()
+    }
+
+    private func append(_ string: String) {
+        let bytes = Array(string.utf8)
+        VT100ByteStreamAppend(&stream, bytes, Int32(bytes.count))
+    }
+
+    private var contents: String {
+        return String(data: VT100ByteStreamMakeData(&stream), encoding: .utf8)!
+    }
+
+    // Simulates read() filling reserved space.
+    private func fill(_ buffer: UnsafeMutablePointer<UInt8>, with string: String) -> Int32 {
+        let bytes = Array(string.utf8)
+        buffer.update(from: bytes, count: bytes.count)
+        return Int32(bytes.count)
+    }
+
+    func testAppendDuringReservationFollowsCommittedBytes() {
+        append("a")
+        var available = Int32(0)
+        let buffer = VT100ByteStreamGetWritableSpace(&stream, 1024, &available)!
+        XCTAssertGreaterThanOrEqual(available, 1024)
+
+        append("c")
+        let length = fill(buffer, with: "b")
+        XCTAssertEqual(contents, "a")
+
+        VT100ByteStreamCommitReservation(&stream, length)
+        XCTAssertEqual(contents, "abc")
+    }
+
+    func testReservedSpaceSurvivesConsumingEverything() {
+        append("xyz")
+        var available = Int32(0)
+        let buffer = VT100ByteStreamGetWritableSpace(&stream, 16, &available)!
+
+        // This is what the parser does once it has consumed everything.
+        VT100ByteStreamConsumeAll(&stream)
+        VT100ByteStreamReset(&stream)
+        append(String(repeating: "d", count: Int(kDefaultStreamSize) * 2))
+
+        VT100ByteStreamCommitReservation(&stream, fill(buffer, with: "abc"))
+        XCTAssertEqual(contents, "abc" + String(repeating: "d", count: Int(kDefaultStreamSize) * 2))
+    }
+}
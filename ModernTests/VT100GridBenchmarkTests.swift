@@ -0,0 +1,132 @@
+//
+//  VT100GridBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Measures VT100Grid on its own (no parser, token executor, or screen) for the kinds of output
+// full-screen programs produce at 300x100: htop repaints every row in place, a log tail scrolls the
+// whole screen, and vim scrolls a region that excludes its status line. Each frame ends by syncing
+// a second grid from it and cleaning it, as happens when the main thread syncs.
+final class VT100GridBenchmarkTests: XCTestCase {
+    private static let size = VT100GridSize(width: 300, height: 100)
+    private static let frames = 50
+
+    // One line per row with different contents each frame so the copies can't be skipped.
+    private static let lines: [ScreenCharArray] = {
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        return (0..<Int(size.height) * 2).map { _ in
+            let string = String((0..<Int(size.width)).map { _ in
+                Character(UnicodeScalar(UInt8(ascii: "!") + UInt8(generator.next() % 90)))
+            })
+            return screenCharArrayWithDefaultStyle(string, eol: EOL_HARD)
+        }
+    }()
+
+    private func makeGrid() -> VT100Grid {
+        return VT100Grid(size: Self.size, delegate: nil)!
+    }
+
+    private func append(_ line: ScreenCharArray, to grid: VT100Grid, lineBuffer: LineBuffer?) {
+        grid.appendChars(atCursor: line.line,
+                         length: line.length,
+                         scrollingInto: lineBuffer,
+                         unlimitedScrollback: false,
+                         useScrollbackWithRegion: false,
+                         wraparound: false,
+                         ansi: false,
+                         insert: false,
+                         externalAttributeIndex: nil,
+                         rtlFound: false,
+                         dwcFree: true)
+    }
+
+    private func sync(_ grid: VT100Grid, to copy: VT100Grid) {
+        copy.copyDirty(from: grid, didScroll: grid.haveScrolled)
+        grid.markAllCharsDirty(false, updateTimestamps: false)
+        grid.haveScrolled = false
+    }
+
+    func testRepaintInPlace() {
+        let grid = makeGrid()
+        let copy = makeGrid()
+        measure {
+            for frame in 0..<Self.frames {
+                for y in 0..<Self.size.height {
+                    grid.cursor = VT100GridCoord(x: 0, y: y)
+                    append(Self.lines[(frame + Int(y)) % Self.lines.count], to: grid, lineBuffer: nil)
+                }
+                sync(grid, to: copy)
+            }
+        }
+        XCTAssertEqual(copy.allLinesAsStrings, grid.allLinesAsStrings)
+    }
+
+    func testScrollWholeScreen() {
+        let grid = makeGrid()
+        let copy = makeGrid()
+        let lineBuffer = LineBuffer()
+        lineBuffer.setMaxLines(1000)
+        measure {
+            for frame in 0..<Self.frames {
+                for i in 0..<Self.size.height {
+                    grid.cursor = VT100GridCoord(x: 0, y: Self.size.height - 1)
+                    append(Self.lines[(frame + Int(i)) % Self.lines.count], to: grid, lineBuffer: lineBuffer)
+                    grid.scrollUp(into: lineBuffer,
+                                  unlimitedScrollback: false,
+                                  useScrollbackWithRegion: false,
+                                  softBreak: false,
+                                  sentToLineBuffer: nil)
+                }
+                sync(grid, to: copy)
+            }
+        }
+        XCTAssertEqual(copy.allLinesAsStrings, grid.allLinesAsStrings)
+    }
+
+    // One frame of a program that changes every line (at 120 Hz the whole frame has about 8 ms),
+    // measuring only the sync that publishes it.
+    func testSyncCostPerFrameWithEveryLineChanged() {
+        let grid = makeGrid()
+        let copy = makeGrid()
+        var frame = 0
+        measureMetrics([.wallClockTime], automaticallyStartMeasuring: false) {
+            for y in 0..<Self.size.height {
+                grid.cursor = VT100GridCoord(x: 0, y: y)
+                append(Self.lines[(frame + Int(y)) % Self.lines.count], to: grid, lineBuffer: nil)
+            }
+            frame += 1
+            startMeasuring()
+            sync(grid, to: copy)
+            stopMeasuring()
+        }
+        XCTAssertEqual(copy.allLinesAsStrings, grid.allLinesAsStrings)
+    }
+
+    func testScrollRegionAboveStatusLine() {
+        let grid = makeGrid()
+        let copy = makeGrid()
+        grid.scrollRegionRows = VT100GridRange(location: 0, length: Self.size.height - 1)
+        measure {
+            for frame in 0..<Self.frames {
+                for i in 0..<Self.size.height - 1 {
+                    grid.cursor = VT100GridCoord(x: 0, y: Self.size.height - 2)
+                    append(Self.lines[(frame + Int(i)) % Self.lines.count], to: grid, lineBuffer: nil)
+                    grid.scrollUp(into: nil,
+                                  unlimitedScrollback: false,
+                                  useScrollbackWithRegion: false,
+                                  softBreak: false,
+                                  sentToLineBuffer: nil)
+                }
+                grid.cursor = VT100GridCoord(x: 0, y: Self.size.height - 1)
+                append(Self.lines[frame % Self.lines.count], to: grid, lineBuffer: nil)
+                sync(grid, to: copy)
+            }
+        }
+        XCTAssertEqual(copy.allLinesAsStrings, grid.allLinesAsStrings)
+    }
+}
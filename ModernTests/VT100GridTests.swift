@@ -293,6 +293,93 @@ class VT100GridTests: XCTestCase {
         XCTAssertEqual(grid.cursorY, 3)
     }
 
+    func testScrollWholeScreenUpByLinesMatchesRepeatedScrolls() {
+        let width: Int32 = 4
+        let initialLines = [
+            "abcd",
+            "efgh\n",
+            "ijkl\n",
+            "mnop"
+        ]
+        let bulkGrid = VT100Grid(size: VT100GridSize(width: width, height: 4), delegate: nil)!
+        let repeatedGrid = VT100Grid(size: VT100GridSize(width: width, height: 4), delegate: nil)!
+        append(strings: initialLines, toGrid: bulkGrid, lineBuffer: LineBuffer(blockSize: 1000))
+        append(strings: initialLines, toGrid: repeatedGrid, lineBuffer: LineBuffer(blockSize: 1000))
+
+        let bulkBuffer = LineBuffer(blockSize: 1000)
+        let repeatedBuffer = LineBuffer(blockSize: 1000)
+        bulkGrid.scrollWholeScreenUp(byLines: 3, into: bulkBuffer, unlimitedScrollback: true)
+        for _ in 0..<3 {
+            repeatedGrid.scrollWholeScreenUp(into: repeatedBuffer, unlimitedScrollback: true)
+        }
+
+        XCTAssertEqual(bulkGrid.allLinesAsStrings, ["mnop\n", "\n", "\n", "\n"])
+        XCTAssertEqual(bulkGrid.allLinesAsStrings, repeatedGrid.allLinesAsStrings)
+        XCTAssertEqual(bulkBuffer.allWrappedLinesAsStrings(width: width),
+                       repeatedBuffer.allWrappedLinesAsStrings(width: width))
+        XCTAssertEqual(bulkGrid.dirtyIndexes.intersection(IndexSet(1..<4)), IndexSet(1..<4))
+    }
+
+    func testCopyDirtyFromScrolledGridCopiesEveryLine() {
+        let width: Int32 = 4
+        let source = VT100Grid(size: VT100GridSize(width: width, height: 4), delegate: nil)!
+        append(strings: ["abcd\n", "efgh\n", "ijkl\n", "mnop"], toGrid: source, lineBuffer: LineBuffer(blockSize: 1000))
+        let destination = source.copy() as! VT100Grid
+        source.markAllCharsDirty(false, updateTimestamps: false)
+        destination.markAllCharsDirty(false, updateTimestamps: false)
+
+        source.scrollWholeScreenUp(byLines: 2, into: nil, unlimitedScrollback: false)
+        source.markAllCharsDirty(false, updateTimestamps: false)
+        source.set(line: 2, to: "qrst")
+        destination.set(line: 0, to: "uvwx")
+        destination.markAllCharsDirty(false, updateTimestamps: false)
+        destination.markCharDirty(true, at: VT100GridCoord(x: 0, y: 3), updateTimestamp: false)
+
+        destination.copyDirty(from: source, didScroll: true)
+        XCTAssertEqual(destination.allLinesAsStrings, source.allLinesAsStrings)
+        XCTAssertEqual(destination.dirtyIndexes, IndexSet([2, 3]))
+    }
+
+    func testCopiesAreUnaffectedByLaterChanges() {
+        let grid = VT100Grid(size: VT100GridSize(width: 4, height: 40), delegate: nil)!
+        grid.set(line: 0, to: "abcd")
+        grid.set(line: 39, to: "efgh")
+        let snapshot = grid.copy() as! VT100Grid
+        let synced = VT100Grid(size: grid.size, delegate: nil)!
+        synced.copyDirty(from: grid, didScroll: false)
+
+        grid.set(line: 0, to: "ijkl")
+        grid.scrollWholeScreenUp(into: nil, unlimitedScrollback: false)
+
+        XCTAssertEqual(snapshot.lineAsString(0), "abcd\n")
+        XCTAssertEqual(snapshot.lineAsString(39), "efgh\n")
+        XCTAssertEqual(synced.lineAsString(0), "abcd\n")
+        XCTAssertEqual(synced.lineAsString(39), "efgh\n")
+        XCTAssertEqual(grid.lineAsString(38), "efgh\n")
+        XCTAssertEqual(grid.lineAsString(39), "\n")
+
+        snapshot.set(line: 1, to: "mnop")
+        XCTAssertEqual(synced.lineAsString(1), "\n")
+    }
+
+    // The source and destination lines are in the same chunk, which is shared with a copy, so the
+    // first write to it must unshare it before the source is read.
+    func testScrollRectInGridSharedWithCopy() {
+        let grid = VT100Grid(size: VT100GridSize(width: 4, height: 4), delegate: nil)!
+        append(strings: ["abcd\n", "efgh\n", "ijkl\n", "mnop"],
+               toGrid: grid,
+               lineBuffer: LineBuffer(blockSize: 1000))
+        var copy: VT100Grid? = grid.copy() as? VT100Grid
+        let before = copy!.allLinesAsStrings
+
+        grid.scroll(VT100GridRect(x: 1, y: 1, width: 2, height: 2), downBy: 1, softBreak: false, fill: .zero)
+
+        XCTAssertEqual(grid.allLinesAsStrings, ["abcd\n", "e\0\0h\n", "ifgl\n", "mnop\n"])
+        XCTAssertEqual(copy!.allLinesAsStrings, before)
+        copy = nil
+        XCTAssertEqual(grid.allLinesAsStrings, ["abcd\n", "e\0\0h\n", "ifgl\n", "mnop\n"])
+    }
+
     func testWholeScreenScrollRespectsSoftEOLs() {
         let width: Int32 = 4
         let height: Int32 = 4
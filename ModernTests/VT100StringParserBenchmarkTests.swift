@@ -0,0 +1,218 @@
+//
+//  VT100StringParserBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Measures ParseString in isolation from the rest of the pipeline (no VT100Parser, token
+// executor, or screen) so changes to the string decoders can be evaluated on their own.
+final class VT100StringParserBenchmarkTests: XCTestCase {
+    private struct Stats {
+        var tokens = 0
+        var bytes = 0
+        var crlfs = 0
+    }
+
+    // Produces output like tests/spam.cc as it arrives from the tty (i.e., with \n converted to
+    // \r\n). When `cm` is set, lines are longer and a third of the characters are fullwidth
+    // forms encoded as three bytes of UTF-8, which is what spam.cc does.
+    static func spamBytes(lines: Int, cm: Bool) -> [UInt8] {
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        var result = [UInt8]()
+        result.reserveCapacity(lines * (cm ? 15000 : 5000))
+        for _ in 0..<lines {
+            var length = Int(generator.next() % 9999)
+            if cm {
+                length *= 3
+            }
+            var j = 0
+            while j < length && j < 9999 {
+                if cm && j + 6 < length && generator.next() % 3 == 0 {
+                    result.append(contentsOf: [0xef, 0xbc, 0xa0 + UInt8(generator.next() % 26)])
+                    j += 3
+                } else {
+                    result.append(UInt8(ascii: "A") + UInt8(generator.next() % 60))
+                    j += 1
+                }
+            }
+            result.append(contentsOf: [13, 10])
+        }
+        return result
+    }
+
+    // Loads a file from the tests directory as it would arrive from the tty: newlines become CRLF
+    // and other control characters, which ParseString never sees, become spaces.
+    static func corpusBytes(_ name: String) throws -> [UInt8] {
+        let url = URL(fileURLWithPath: #filePath)
+            .deletingLastPathComponent()
+            .deletingLastPathComponent()
+            .appendingPathComponent("tests")
+            .appendingPathComponent(name)
+        guard let data = try? Data(contentsOf: url) else {
+            throw XCTSkip("Missing corpus file \(url.path)")
+        }
+        var result = [UInt8]()
+        result.reserveCapacity(data.count + data.count / 40)
+        for byte in data {
+            switch byte {
+            case 10:
+                result.append(contentsOf: [13, 10])
+            case 0..<32:
+                result.append(32)
+            default:
+                result.append(byte)
+            }
+        }
+        return result
+    }
+
+    private func parse(_ bytes: [UInt8],
+                       tokenHandler: ((VT100Token, UnsafePointer<UInt8>, Int) -> ())? = nil) -> Stats {
+        var stats = Stats()
+        var stream = VT100ByteStream()
+        VT100ByteStreamInit(&stream)
+        defer {
+            VT100ByteStreamFree(&stream)
+        }
+        bytes.withUnsafeBufferPointer { buffer in
+            VT100ByteStreamAppend(&stream, buffer.baseAddress, Int32(buffer.count))
+        }
+        while VT100ByteStreamGetRemainingSize(&stream) > 0 {
+            autoreleasepool {
+                var cursor = VT100ByteStreamCursor()
+                VT100ByteStreamCursorInit(&cursor, &stream)
+                var consumer = VT100ByteStreamConsumer()
+                VT100ByteStreamConsumerInit(&consumer, cursor)
+                let token = VT100Token()
+                ParseString(&consumer, token, String.Encoding.utf8.rawValue)
+                let consumed = max(1, Int(VT100ByteStreamConsumerGetConsumed(&consumer)))
+                if token.type == VT100_MIXED_ASCII_CR_LF {
+                    stats.crlfs += Int(token.crlfs.pointee.count) / 2
+                }
+                tokenHandler?(token, VT100ByteStreamCursorGetPointer(&cursor), consumed)
+                stats.tokens += 1
+                stats.bytes += consumed
+                VT100ByteStreamConsume(&stream, Int32(consumed))
+            }
+        }
+        return stats
+    }
+
+    // Reassembles the text from the tokens. Non-ASCII tokens must produce their strings without
+    // help from the raw bytes.
+    private func decodedText(_ bytes: [UInt8]) -> String {
+        var result = ""
+        _ = parse(bytes) { token, pointer, length in
+            if token.type == VT100_STRING {
+                result += token.string
+            } else {
+                result += String(decoding: UnsafeBufferPointer(start: pointer, count: length),
+                                 as: UTF8.self)
+            }
+        }
+        return result
+    }
+
+    func testMixedASCIIFindsEveryCRLF() {
+        let bytes = Self.spamBytes(lines: 200, cm: false)
+        let stats = parse(bytes)
+        XCTAssertEqual(stats.bytes, bytes.count)
+        XCTAssertEqual(stats.crlfs, 200)
+    }
+
+    func testMixedASCIIStopsAtControlCharacter() {
+        var bytes = Array("0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ".utf8)
+        bytes.insert(27, at: 50)
+        var stream = VT100ByteStream()
+        VT100ByteStreamInit(&stream)
+        defer {
+            VT100ByteStreamFree(&stream)
+        }
+        bytes.withUnsafeBufferPointer { buffer in
+            VT100ByteStreamAppend(&stream, buffer.baseAddress, Int32(buffer.count))
+        }
+        var cursor = VT100ByteStreamCursor()
+        VT100ByteStreamCursorInit(&cursor, &stream)
+        var consumer = VT100ByteStreamConsumer()
+        VT100ByteStreamConsumerInit(&consumer, cursor)
+        let token = VT100Token()
+        ParseString(&consumer, token, String.Encoding.utf8.rawValue)
+        XCTAssertEqual(token.type, VT100_ASCIISTRING)
+        XCTAssertEqual(VT100ByteStreamConsumerGetConsumed(&consumer), 50)
+    }
+
+    func testParseStringSpamPerformance() {
+        let bytes = Self.spamBytes(lines: 20000, cm: false)
+        measure {
+            _ = parse(bytes)
+        }
+    }
+
+    func testUTF8DecodesCorpora() throws {
+        for name in ["UTF-8-demo.txt", "chinese.txt"] {
+            let bytes = try Self.corpusBytes(name)
+            XCTAssertEqual(decodedText(bytes), String(decoding: bytes, as: UTF8.self), name)
+        }
+        let spam = Self.spamBytes(lines: 50, cm: true)
+        XCTAssertEqual(decodedText(spam), String(decoding: spam, as: UTF8.self))
+    }
+
+    func testUTF8DecodesAstralPlaneAsSurrogatePair() {
+        let bytes = Array("😀é中".utf8)
+        XCTAssertEqual(decodedText(bytes), "😀é中")
+    }
+
+    func testUTF8InvalidSequenceBecomesReplacementCharacter() {
+        let bytes: [UInt8] = [0xe4, 0xb8, 0xad, 0xc0, 0xaf, 0xe4, 0xb8, 0xad]
+        var strings = [String]()
+        _ = parse(bytes) { token, _, _ in
+            strings.append(token.string)
+        }
+        XCTAssertEqual(strings, ["中", "\u{FFFD}", "\u{FFFD}", "中"])
+    }
+
+    func testParseUTF8DemoPerformance() throws {
+        let bytes = try Self.corpusBytes("UTF-8-demo.txt")
+        let corpus = Array(repeating: bytes, count: 50).flatMap { $0 }
+        measure {
+            _ = parse(corpus)
+        }
+    }
+
+    func testParseChinesePerformance() throws {
+        let bytes = try Self.corpusBytes("chinese.txt")
+        let corpus = Array(repeating: bytes, count: 50).flatMap { $0 }
+        measure {
+            _ = parse(corpus)
+        }
+    }
+
+    func testParseStringSpamCMPerformance() {
+        let bytes = Self.spamBytes(lines: 5000, cm: true)
+        measure {
+            _ = parse(bytes)
+        }
+    }
+}
+
+// A deterministic generator so benchmark runs are comparable.
+struct BenchmarkRandomNumberGenerator: RandomNumberGenerator {
+    private var state: UInt64
+
+    init(seed: UInt64) {
+        state = seed
+    }
+
+    // splitmix64
+    mutating func next() -> UInt64 {
+        state &+= 0x9e3779b97f4a7c15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xbf58476d1ce4e5b9
+        z = (z ^ (z >> 27)) &* 0x94d049bb133111eb
+        return z ^ (z >> 31)
+    }
+}
@@ -0,0 +1,116 @@
+//
+//  iTermAPINotificationCoalescerTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class iTermAPINotificationCoalescerTests: XCTestCase {
+    private struct Delivery: Equatable {
+        var object: String
+        var connection: String
+        var coalescedCount: Int
+    }
+
+    private var deliveries = [Delivery]()
+    private var coalescer: iTermAPINotificationCoalescer!
+
+    override func setUp() {
+        super.setUp()
+        deliveries = []
+        coalescer = iTermAPINotificationCoalescer { [unowned self] object, connectionKey, count in
+            self.deliveries.append(Delivery(object: object as! String,
+                                            connection: connectionKey as! String,
+                                            coalescedCount: count))
+        }
+    }
+
+    private func post(_ object: String, key: String?, category: String = "screen", connection: String = "c1") {
+        coalescer.post(object, category: category, coalescingKey: key, connectionKey: connection)
+    }
+
+    private func waitForDeliveries(_ count: Int, timeout: TimeInterval = 5) {
+        let deadline = Date(timeIntervalSinceNow: timeout)
+        while deliveries.count < count && Date() < deadline {
+            RunLoop.current.run(until: Date(timeIntervalSinceNow: 0.01))
+        }
+    }
+
+    func testWithoutLimitEverythingIsDeliveredImmediately() {
+        post("a", key: "s1")
+        post("b", key: "s1")
+        XCTAssertEqual(deliveries.map(\.object), ["a", "b"])
+        XCTAssertEqual(deliveries.map(\.coalescedCount), [0, 0])
+    }
+
+    func testOnlyLatestIsDeliveredAfterWindow() {
+        coalescer.setMinimumInterval(0.2, forCategory: "screen", connectionKey: "c1")
+        post("a", key: "s1")
+        post("b", key: "s1")
+        post("c", key: "s1")
+        post("d", key: "s1")
+        XCTAssertEqual(deliveries, [Delivery(object: "a", connection: "c1", coalescedCount: 0)])
+
+        waitForDeliveries(2)
+        XCTAssertEqual(deliveries.last, Delivery(object: "d", connection: "c1", coalescedCount: 2))
+    }
+
+    func testIdleEntriesAreForgotten() {
+        coalescer.setMinimumInterval(0.05, forCategory: "screen", connectionKey: "c1")
+        for i in 0..<100 {
+            post("a", key: "s\(i)")
+        }
+        post("b", key: "s0")
+        XCTAssertEqual(coalescer.testOnlyNumberOfEntries(forConnectionKey: "c1"), 100)
+
+        waitForDeliveries(101)
+        let deadline = Date(timeIntervalSinceNow: 5)
+        while coalescer.testOnlyNumberOfEntries(forConnectionKey: "c1") > 0 && Date() < deadline {
+            RunLoop.current.run(until: Date(timeIntervalSinceNow: 0.01))
+        }
+        XCTAssertEqual(coalescer.testOnlyNumberOfEntries(forConnectionKey: "c1"), 0)
+        XCTAssertEqual(deliveries.last?.object, "b")
+
+        // A forgotten key is delivered immediately.
+        post("c", key: "s0")
+        XCTAssertEqual(deliveries.last?.object, "c")
+    }
+
+    func testKeysCategoriesAndConnectionsAreIndependent() {
+        coalescer.setMinimumInterval(10, forCategory: "screen", connectionKey: "c1")
+        post("a", key: "s1")
+        post("b", key: "s2")
+        post("c", key: "s1", connection: "c2")
+        post("d", key: "s1", category: "layout")
+        post("e", key: nil)
+        post("f", key: nil)
+        XCTAssertEqual(deliveries.map(\.object), ["a", "b", "c", "d", "e", "f"])
+    }
+
+    func testRemovingLimitFlushesPendingObjects() {
+        coalescer.setMinimumInterval(10, forCategory: "screen", connectionKey: "c1")
+        post("a", key: "s1")
+        post("b", key: "s1")
+        post("c", key: "s1")
+        XCTAssertEqual(deliveries.map(\.object), ["a"])
+
+        coalescer.setMinimumInterval(0, forCategory: "screen", connectionKey: "c1")
+        XCTAssertEqual(deliveries.last, Delivery(object: "c", connection: "c1", coalescedCount: 1))
+        post("d", key: "s1")
+        XCTAssertEqual(deliveries.map(\.object), ["a", "c", "d"])
+    }
+
+    func testRemovingConnectionDropsPendingObjects() {
+        coalescer.setMinimumInterval(0.05, forCategory: "screen", connectionKey: "c1")
+        post("a", key: "s1")
+        post("b", key: "s1")
+        coalescer.removeConnectionKey("c1")
+        XCTAssertEqual(coalescer.minimumInterval(forCategory: "screen", connectionKey: "c1"), 0)
+
+        RunLoop.current.run(until: Date(timeIntervalSinceNow: 0.2))
+        XCTAssertEqual(deliveries.map(\.object), ["a"])
+    }
+}
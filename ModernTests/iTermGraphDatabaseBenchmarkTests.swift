@@ -0,0 +1,127 @@
+//
+//  iTermGraphDatabaseBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// A synthetic arrangement shaped like restorable state for 40 windows with 4 tabs of 10 sessions
+// each: about five thousand nodes. Between saves one session changes, which is the common case for
+// the periodic save.
+final class iTermGraphDatabaseBenchmarkTests: iTermGraphDatabaseTestCase {
+    private static let windows = 40
+    private static let tabsPerWindow = 4
+    private static let sessionsPerTab = 10
+    private static let sessions = windows * tabsPerWindow * sessionsPerTab
+
+    private var generations = [Int](repeating: 1, count: sessions)
+
+    private func identifiers(_ prefix: String, count: Int) -> [String] {
+        return (0..<count).map { "\(prefix)-\($0)" }
+    }
+
+    private func sessionDictionary(_ index: Int) -> [String: Any] {
+        let generation = generations[index]
+        return ["guid": "session-\(index)",
+                "name": "Session \(index) (\(generation))",
+                "columns": 80,
+                "rows": 24,
+                "working directory": "/Users/example/src/project-\(index % 17)",
+                "profile": ["Guid": "profile-\(index % 5)", "Name": "Default"],
+                "cursor": ["x": generation % 80, "y": index % 24]]
+    }
+
+    private func variables(_ index: Int) -> [String: Any] {
+        return ["user.generation": generations[index], "user.tag": "tag-\(index % 11)"]
+    }
+
+    private func encodeArrangement(_ encoder: iTermGraphEncoder) {
+        encoder.encodeArray(withKey: "windows",
+                            generation: iTermGenerationAlwaysEncode,
+                            identifiers: identifiers("window", count: Self.windows),
+                            options: []) { _, window, windowEncoder, _ in
+            windowEncoder.encodeArray(withKey: "tabs",
+                                      generation: iTermGenerationAlwaysEncode,
+                                      identifiers: self.identifiers("tab", count: Self.tabsPerWindow),
+                                      options: []) { _, tab, tabEncoder, _ in
+                tabEncoder.encodeArray(withKey: "sessions",
+                                       generation: iTermGenerationAlwaysEncode,
+                                       identifiers: self.identifiers("session", count: Self.sessionsPerTab),
+                                       options: []) { _, session, sessionEncoder, _ in
+                    let index = (window * Self.tabsPerWindow + tab) * Self.sessionsPerTab + session
+                    return sessionEncoder.encodeChild(withKey: "session",
+                                                      identifier: "",
+                                                      generation: self.generations[index]) { encoder in
+                        let adapter = iTermGraphEncoderAdapter(graphEncoder: encoder)
+                        adapter.merge(self.sessionDictionary(index))
+                        return adapter.encodeDictionary(withKey: "variables",
+                                                        generation: self.generations[index]) { variables in
+                            variables.merge(self.variables(index))
+                            return true
+                        }
+                    }
+                }
+                return true
+            }
+            return true
+        }
+    }
+
+    private func save(_ db: iTermGraphDatabase) {
+        save(db) { encoder in
+            self.encodeArrangement(encoder)
+        }
+    }
+
+    func testInitialSave() {
+        var inserts = 0
+        var i = 0
+        measure {
+            let db = openDatabase("state-\(i).sqlite")
+            i += 1
+            save(db)
+            inserts = db.lastSaveStatistics.inserts
+        }
+        XCTAssertGreaterThan(inserts, 5000)
+    }
+
+    func testDeltaEncodeWithOneSessionChanged() {
+        let db = openDatabase()
+        save(db)
+        let previousRevision = db.record
+        var i = 0
+        measure {
+            generations[i % Self.sessions] += 1
+            i += 1
+            let encoder = iTermGraphDeltaEncoder(previousRevision: previousRevision)
+            encodeArrangement(encoder)
+            var count = 0
+            _ = encoder.enumerateRecords { _, _, _, _, _ in
+                count += 1
+            }
+            XCTAssertGreaterThan(count, 5000)
+        }
+    }
+
+    func testSaveWithOneSessionChanged() {
+        let db = openDatabase()
+        save(db)
+        var i = 0
+        measure {
+            for _ in 0..<10 {
+                generations[i % Self.sessions] += 1
+                i += 1
+                save(db)
+            }
+        }
+        let statistics = db.lastSaveStatistics
+        XCTAssertEqual(statistics.inserts, 0)
+        XCTAssertEqual(statistics.deletes, 0)
+        // The session and its variables.
+        XCTAssertEqual(statistics.updates, 2)
+        XCTAssertGreaterThan(statistics.unchanged, 0)
+    }
+}
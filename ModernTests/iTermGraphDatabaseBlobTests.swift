@@ -0,0 +1,116 @@
+//
+//  iTermGraphDatabaseBlobTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class iTermGraphDatabaseBlobTests: iTermGraphDatabaseTestCase {
+    private static let width = Int32(80)
+
+    // Small blocks so a few hundred lines make many sealed blocks and one tail.
+    private func makeLineBuffer(lines: Int) -> LineBuffer {
+        let lineBuffer = LineBuffer(blockSize: 256)
+        append(lines: 0..<lines, to: lineBuffer)
+        return lineBuffer
+    }
+
+    private func append(lines: Range<Int>, to lineBuffer: LineBuffer) {
+        for i in lines {
+            lineBuffer.append(screenCharArrayWithDefaultStyle("Line number \(i)", eol: EOL_HARD),
+                              width: Self.width)
+        }
+    }
+
+    private func save(_ lineBuffer: LineBuffer, to db: iTermGraphDatabase) {
+        save(db) { encoder in
+            lineBuffer.encode(iTermGraphEncoderAdapter(graphEncoder: encoder), maxLines: 100_000)
+        }
+    }
+
+    private func count(_ sql: String, in db: iTermGraphDatabase) -> Int64 {
+        let rs = try! db.db.executeQuery(sql, withNonOptionalArguments: [])
+        XCTAssertTrue(rs.next())
+        defer { rs.close() }
+        return rs.longLongInt(forColumn: "n")
+    }
+
+    private func blobKeys(in db: iTermGraphDatabase) -> Set<String> {
+        let rs = try! db.db.executeQuery("select key from Blob", withNonOptionalArguments: [])
+        defer { rs.close() }
+        var result = Set<String>()
+        while rs.next() {
+            result.insert(rs.string(forColumn: "key")!)
+        }
+        return result
+    }
+
+    private func numberOfBlocks(_ lineBuffer: LineBuffer) -> Int {
+        let encoder = iTermMutableDictionaryEncoderAdapter.encoder()
+        lineBuffer.encode(encoder, maxLines: 100_000)
+        return (encoder.mutableDictionary["Blocks"] as! [Any]).count
+    }
+
+    private func lines(_ lineBuffer: LineBuffer) -> [ScreenCharArray] {
+        return (0..<lineBuffer.numLines(withWidth: Self.width)).map {
+            lineBuffer.wrappedLine(at: $0, width: Self.width)
+        }
+    }
+
+    func testSealedBlocksAreStoredOnceAndTailIsInline() {
+        let lineBuffer = makeLineBuffer(lines: 300)
+        let db = openDatabase()
+        save(lineBuffer, to: db)
+
+        let sealed = numberOfBlocks(lineBuffer) - 1
+        XCTAssertGreaterThan(sealed, 1)
+        XCTAssertEqual(count("select count(*) as n from Blob", in: db), Int64(sealed))
+        let keys = blobKeys(in: db)
+
+        // Appending changes only the tail (and may seal it), so every existing blob is kept as is.
+        append(lines: 300..<320, to: lineBuffer)
+        save(lineBuffer, to: db)
+        let keysAfter = blobKeys(in: db)
+        XCTAssertTrue(keys.isSubset(of: keysAfter))
+        XCTAssertEqual(keysAfter.count, numberOfBlocks(lineBuffer) - 1)
+    }
+
+    func testDroppedBlocksAreDeleted() {
+        let lineBuffer = makeLineBuffer(lines: 300)
+        let db = openDatabase()
+        save(lineBuffer, to: db)
+
+        lineBuffer.setMaxLines(20)
+        lineBuffer.dropExcessLines(withWidth: Self.width)
+        save(lineBuffer, to: db)
+        XCTAssertEqual(count("select count(*) as n from Blob", in: db),
+                       Int64(numberOfBlocks(lineBuffer) - 1))
+    }
+
+    func testRestoreLoadsBlobsOnDemand() {
+        let lineBuffer = makeLineBuffer(lines: 300)
+        save(lineBuffer, to: openDatabase())
+
+        let record = openDatabase().record
+        let dictionary = record.propertyListValue as! [AnyHashable: Any]
+        let restored = LineBuffer(dictionary: dictionary, maintainBidiInfo: false)!
+        XCTAssertEqual(lines(restored), lines(lineBuffer))
+    }
+
+    // A record whose blob is gone can't be decoded, so the line buffer falls back to being empty
+    // instead of restoring only the blocks that happened to be inline.
+    func testMissingBlobFailsRestore() {
+        let lineBuffer = makeLineBuffer(lines: 300)
+        let db = openDatabase()
+        save(lineBuffer, to: db)
+        try! db.db.executeUpdate("delete from Blob", withNonOptionalArguments: [])
+
+        let record = openDatabase().record
+        let dictionary = record.propertyListValue as! [AnyHashable: Any]
+        let restored = LineBuffer(dictionary: dictionary, maintainBidiInfo: false)!
+        XCTAssertEqual(restored.numLines(withWidth: Self.width), 0)
+    }
+}
@@ -0,0 +1,40 @@
+//
+//  iTermGraphDatabaseSaveTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Pins down when a save rewrites a record whose only change is the type of a value.
+final class iTermGraphDatabaseSaveTests: iTermGraphDatabaseTestCase {
+    private func save(_ value: Any, generation: Int, to db: iTermGraphDatabase) {
+        save(db) { encoder in
+            _ = encoder.encodeChild(withKey: "child", identifier: "", generation: generation) { encoder in
+                iTermGraphEncoderAdapter(graphEncoder: encoder).merge(["value": value])
+                return true
+            }
+        }
+    }
+
+    // A record whose generation changed is compared byte for byte, so 1 becoming true is written.
+    func testTypeChangeIsWrittenWhenGenerationChanges() {
+        let db = openDatabase()
+        save(1, generation: 1, to: db)
+        save(true, generation: 2, to: db)
+        XCTAssertEqual(db.lastSaveStatistics.updates, 1)
+    }
+
+    // A record that is always encoded is compared with isEqual:, which treats 1 and true as equal.
+    func testTypeChangeIsNotWrittenForAlwaysEncodedRecord() {
+        let db = openDatabase()
+        save(1, generation: iTermGenerationAlwaysEncode, to: db)
+        save(true, generation: iTermGenerationAlwaysEncode, to: db)
+        XCTAssertEqual(db.lastSaveStatistics.updates, 0)
+
+        save(2, generation: iTermGenerationAlwaysEncode, to: db)
+        XCTAssertEqual(db.lastSaveStatistics.updates, 1)
+    }
+}
@@ -0,0 +1,40 @@
+//
+//  iTermGraphDatabaseTestCase.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Base class for tests of iTermGraphDatabase. Each test gets a fresh directory for its databases.
+class iTermGraphDatabaseTestCase: XCTestCase {
+    private(set) var directory: URL!
+
+    override func setUp() {
+        super.setUp()
+        directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try! FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+    }
+
+    override func tearDown() {
+        try? FileManager.default.removeItem(at: directory)
+        super.tearDown()
+    }
+
+    // Opens (creating it if needed) the database with this name and waits for it to load.
+    func openDatabase(_ name: String = "state.sqlite") -> iTermGraphDatabase {
+        let sqlite = iTermSqliteDatabaseImpl(url: directory.appendingPathComponent(name),
+                                             lockName: nil)
+        let db = iTermGraphDatabase(database: sqlite)
+        let ready = expectation(description: "loaded")
+        db.whenReady { ready.fulfill() }
+        wait(for: [ready], timeout: 10)
+        return db
+    }
+
+    func save(_ db: iTermGraphDatabase, block: (iTermGraphEncoder) -> Void) {
+        XCTAssertTrue(db.updateSynchronously(true, block: block, completion: nil))
+    }
+}
@@ -0,0 +1,38 @@
+//
+//  iTermScreenUpdateSubscriptionTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class iTermScreenUpdateSubscriptionTests: XCTestCase {
+    private let size = VT100GridSizeMake(80, 25)
+
+    func testFirstDeltaIsFullRefresh() {
+        let subscription = iTermScreenUpdateSubscription(includeStyles: false)
+        XCTAssertEqual(subscription.sequenceNumber, 0)
+        XCTAssertTrue(subscription.beginDelta(size: size, firstLineNumber: 100))
+        XCTAssertEqual(subscription.sequenceNumber, 1)
+        XCTAssertFalse(subscription.beginDelta(size: size, firstLineNumber: 100))
+        XCTAssertEqual(subscription.sequenceNumber, 2)
+    }
+
+    func testScrollingDoesNotNeedFullRefresh() {
+        let subscription = iTermScreenUpdateSubscription(includeStyles: false)
+        _ = subscription.beginDelta(size: size, firstLineNumber: 100)
+        XCTAssertFalse(subscription.beginDelta(size: size, firstLineNumber: 103))
+    }
+
+    func testChangesDeltasCantDescribeNeedFullRefresh() {
+        let subscription = iTermScreenUpdateSubscription(includeStyles: false)
+        _ = subscription.beginDelta(size: size, firstLineNumber: 100)
+        XCTAssertTrue(subscription.beginDelta(size: size, firstLineNumber: 0))
+        XCTAssertTrue(subscription.beginDelta(size: VT100GridSizeMake(100, 25), firstLineNumber: 0))
+        subscription.setNeedsFullRefresh()
+        XCTAssertTrue(subscription.beginDelta(size: VT100GridSizeMake(100, 25), firstLineNumber: 0))
+        XCTAssertEqual(subscription.sequenceNumber, 4)
+    }
+}
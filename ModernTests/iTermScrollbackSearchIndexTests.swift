@@ -0,0 +1,125 @@
+//
+//  iTermScrollbackSearchIndexTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class iTermScrollbackSearchIndexTests: XCTestCase {
+    private func signature(_ strings: [String]) -> iTermTrigramSignature {
+        let signature = iTermTrigramSignature()
+        for string in strings {
+            let sca = screenCharArrayWithDefaultStyle(string, eol: EOL_HARD)
+            signature.addCells(sca.line, length: sca.length)
+        }
+        return signature
+    }
+
+    private func mayMatch(_ query: String,
+                          mode: iTermFindMode,
+                          _ strings: [String]) -> Bool {
+        guard let query = iTermTrigramQuery(string: query, options: [], mode: mode) else {
+            XCTFail("Expected a query")
+            return true
+        }
+        return query.mayMatch(signature(strings))
+    }
+
+    func testLiteralQueries() {
+        let text = ["hello world", "another line"]
+        XCTAssertTrue(mayMatch("world", mode: .caseSensitiveSubstring, text))
+        XCTAssertTrue(mayMatch("LINE", mode: .caseInsensitiveSubstring, text))
+        XCTAssertFalse(mayMatch("xyz", mode: .smartCaseSensitivity, text))
+
+        // Trigrams don't span lines.
+        XCTAssertFalse(mayMatch("worldano", mode: .caseSensitiveSubstring, text))
+
+        // Too short to have a trigram.
+        XCTAssertNil(iTermTrigramQuery(string: "ab", options: [], mode: .caseSensitiveSubstring))
+    }
+
+    func testNonASCIITextIsNotSkippedWrongly() {
+        // Case-insensitive search ignores diacritics, so any block with non-ASCII text may match.
+        XCTAssertTrue(mayMatch("cafe", mode: .smartCaseSensitivity, ["Café au lait"]))
+        XCTAssertTrue(mayMatch("xyz", mode: .caseInsensitiveSubstring, ["Café au lait"]))
+
+        // Case-sensitive search can still skip it.
+        XCTAssertTrue(mayMatch("Caf", mode: .caseSensitiveSubstring, ["Café au lait"]))
+        XCTAssertFalse(mayMatch("xyz", mode: .caseSensitiveSubstring, ["Café au lait"]))
+    }
+
+    func testRegexRequiredLiterals() {
+        let text = ["the color is red"]
+        XCTAssertTrue(mayMatch("colou?r", mode: .caseSensitiveRegex, text))
+        XCTAssertFalse(mayMatch("colour+", mode: .caseSensitiveRegex, text))
+        XCTAssertTrue(mayMatch("c.lor is", mode: .caseInsensitiveRegex, text))
+        XCTAssertFalse(mayMatch("[[:alpha:]]xyz", mode: .caseSensitiveRegex, text))
+        XCTAssertTrue(mayMatch("is\\s+red", mode: .caseSensitiveRegex, text))
+        XCTAssertTrue(mayMatch("is r{1,2}ed", mode: .caseSensitiveRegex, text))
+
+        // Escapes with arguments aren't literals.
+        XCTAssertTrue(mayMatch("\\x74he color", mode: .caseSensitiveRegex, text))
+        XCTAssertTrue(mayMatch("\\p{L}he color", mode: .caseSensitiveRegex, text))
+
+        // Nothing is required when there's alternation or a group.
+        XCTAssertNil(iTermTrigramQuery(string: "xyz|red", options: [], mode: .caseSensitiveRegex))
+        XCTAssertNil(iTermTrigramQuery(string: "(xyz)?", options: [], mode: .caseSensitiveRegex))
+        XCTAssertNil(iTermTrigramQuery(string: "(?i)xyz", options: [], mode: .caseSensitiveRegex))
+    }
+
+    private func makeBuffer(indexed: Bool) -> LineBuffer {
+        let buffer = LineBuffer(blockSize: 140)
+        buffer.indexesForSearch = indexed
+        for i in 0..<64 {
+            let text = i == 40 ? "Line \(i) has the needle in it" : "Line \(i) is ordinary output text"
+            buffer.append(screenCharArrayWithDefaultStyle(text, eol: EOL_HARD), width: 80)
+        }
+        return buffer
+    }
+
+    private func search(_ buffer: LineBuffer, for query: String, mode: iTermFindMode) -> [Int32] {
+        let context = FindContext()
+        buffer.prepareToSearch(for: query,
+                               startingAt: buffer.firstPosition(),
+                               options: [.multipleResults],
+                               mode: mode,
+                               with: context)
+        var positions = [Int32]()
+        while context.status != .NotFound {
+            buffer.findSubstring(context, stopAt: buffer.lastPosition())
+            positions += (context.results ?? NSMutableArray()).map { ($0 as! ResultRange).position }
+            context.results?.removeAllObjects()
+        }
+        return positions
+    }
+
+    func testIndexedSearchFindsTheSameResults() {
+        let plain = makeBuffer(indexed: false)
+        let indexed = makeBuffer(indexed: true)
+        for (query, mode) in [("needle", iTermFindMode.smartCaseSensitivity),
+                              ("ordinary", .caseSensitiveSubstring),
+                              ("Line 4", .caseSensitiveSubstring),
+                              ("ne+dle", .caseInsensitiveRegex),
+                              ("absent", .smartCaseSensitivity)] {
+            XCTAssertEqual(search(indexed, for: query, mode: mode),
+                           search(plain, for: query, mode: mode),
+                           query)
+        }
+        XCTAssertEqual(search(indexed, for: "needle", mode: .smartCaseSensitivity).count, 1)
+    }
+
+    func testCopiesShareTheIndex() {
+        let buffer = makeBuffer(indexed: true)
+        let copy = buffer.copy() as! LineBuffer
+        for i in 0..<32 {
+            buffer.append(screenCharArrayWithDefaultStyle("More output \(i) with a second needle", eol: EOL_HARD),
+                          width: 80)
+        }
+        copy.forceMerge(from: buffer)
+        XCTAssertEqual(search(copy, for: "needle", mode: .smartCaseSensitivity),
+                       search(buffer, for: "needle", mode: .smartCaseSensitivity))
+    }
+}
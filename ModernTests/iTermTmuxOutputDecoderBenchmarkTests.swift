@@ -0,0 +1,185 @@
+//
+//  iTermTmuxOutputDecoderBenchmarkTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+// Replays a control-mode transcript shaped like one recorded while two panes spew a colored build
+// log: mostly %output lines, some %extended-output lines (pause mode), and the odd command response.
+// Each line goes through the path TmuxGateway takes for pane output: parse the header, then decode
+// the payload.
+final class iTermTmuxOutputDecoderBenchmarkTests: XCTestCase {
+    private static let transcriptLines: [Data] = {
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        let words = ["CompileC", "build/Release/iTerm2.build", "sources/VT100Grid.m", "warning:",
+                     "unused", "variable", "'x'", "[-Wunused-variable]", "Ld", "/usr/bin/clang",
+                     "-fobjc-arc", "→", "✓", "C:\\path\\to\\file", "100%"]
+        var lines = [Data]()
+        for i in 0..<20_000 {
+            if i % 500 == 0 {
+                lines.append(Data("%begin 1700000000 \(i) 1".utf8))
+                lines.append(Data("0: zsh* (1 panes) [300x100]".utf8))
+                lines.append(Data("%end 1700000000 \(i) 1".utf8))
+            }
+            var output = Data()
+            if generator.next() % 4 == 0 {
+                output.append(contentsOf: "\u{1b}[1;3\(generator.next() % 8)m".utf8)
+            }
+            for _ in 0..<(4 + Int(generator.next() % 20)) {
+                output.append(contentsOf: words[Int(generator.next() % UInt64(words.count))].utf8)
+                output.append(generator.next() % 10 == 0 ? UInt8(ascii: "\t") : UInt8(ascii: " "))
+            }
+            output.append(contentsOf: "\u{1b}[0m\r\n".utf8)
+            let header = i % 3 == 0 ? "%extended-output %2 \(generator.next() % 5000) : " : "%output %1 "
+            lines.append(Data(header.utf8) + escaped(output))
+        }
+        return lines
+    }()
+
+    // How tmux escapes pane output.
+    private static func escaped(_ data: Data) -> Data {
+        var result = Data()
+        for byte in data {
+            if byte < UInt8(ascii: " ") || byte == UInt8(ascii: "\\") {
+                result.append(contentsOf: String(format: "\\%03o", byte).utf8)
+            } else {
+                result.append(byte)
+            }
+        }
+        return result
+    }
+
+    // The decoder TmuxGateway used before: one append per byte of a null-terminated copy.
+    private static func referenceDecode(_ payload: Data) -> Data {
+        let bytes = [UInt8](payload) + [0]
+        let data = NSMutableData()
+        var i = 0
+        while bytes[i] != 0 {
+            var c = bytes[i]
+            if c < UInt8(ascii: " ") {
+                i += 1
+                continue
+            }
+            if c == UInt8(ascii: "\\") {
+                c = 0
+                for _ in 0..<3 {
+                    i += 1
+                    if bytes[i] == UInt8(ascii: "\r") {
+                        continue
+                    }
+                    if bytes[i] < UInt8(ascii: "0") || bytes[i] > UInt8(ascii: "7") {
+                        c = UInt8(ascii: "?")
+                        i -= 1
+                        break
+                    }
+                    c = c &* 8 &+ (bytes[i] - UInt8(ascii: "0"))
+                }
+            }
+            data.append(&c, length: 1)
+            i += 1
+        }
+        return data as Data
+    }
+
+    private func replay(_ decode: (UnsafePointer<UInt8>, Int) -> Data) -> Int {
+        var total = 0
+        for line in Self.transcriptLines {
+            line.withUnsafeBytes { buffer in
+                let bytes = buffer.bindMemory(to: UInt8.self).baseAddress!
+                let extended = line.starts(with: "%extended-output ".utf8)
+                guard extended || line.starts(with: "%output ".utf8) else {
+                    return
+                }
+                var parsed = iTermTmuxOutputLine()
+                XCTAssertTrue(iTermTmuxParseOutputLine(bytes, buffer.count, extended, &parsed))
+                total += decode(bytes + parsed.payload.location, parsed.payload.length).count
+            }
+        }
+        return total
+    }
+
+    func testDecoderMatchesReference() {
+        var payloads = Self.transcriptLines.compactMap { line -> Data? in
+            let extended = line.starts(with: "%extended-output ".utf8)
+            guard extended || line.starts(with: "%output ".utf8) else {
+                return nil
+            }
+            return line.withUnsafeBytes { buffer in
+                var parsed = iTermTmuxOutputLine()
+                XCTAssertTrue(iTermTmuxParseOutputLine(buffer.bindMemory(to: UInt8.self).baseAddress!,
+                                                       buffer.count,
+                                                       extended,
+                                                       &parsed))
+                return Data(buffer[parsed.payload.location..<NSMaxRange(parsed.payload)])
+            }
+        }
+        // Malformed escapes, stray \r's, a NUL, and an escape cut off by the end of the line.
+        payloads += ["a\\01x", "\\\r101", "\r\nb\\9", "c\u{0}d", "e\\7", "\\"].map { Data($0.utf8) }
+        for payload in payloads {
+            let expected = Self.referenceDecode(payload)
+            let actual = payload.withUnsafeBytes { buffer in
+                iTermTmuxDecodedOutput(buffer.bindMemory(to: UInt8.self).baseAddress!, buffer.count)
+            }
+            XCTAssertEqual(actual, expected)
+        }
+    }
+
+    func testParseOutputLines() {
+        func parse(_ string: String, extended: Bool) -> iTermTmuxOutputLine? {
+            let data = Data(string.utf8)
+            return data.withUnsafeBytes { buffer in
+                var line = iTermTmuxOutputLine()
+                let ok = iTermTmuxParseOutputLine(buffer.bindMemory(to: UInt8.self).baseAddress!,
+                                                  buffer.count,
+                                                  extended,
+                                                  &line)
+                return ok ? line : nil
+            }
+        }
+        let output = parse("%output %12 hello", extended: false)
+        XCTAssertEqual(output?.windowPane, 12)
+        XCTAssertEqual(output?.payload, NSRange(location: 12, length: 5))
+
+        let extended = parse("%extended-output %3 1500 future args : hi", extended: true)
+        XCTAssertEqual(extended?.windowPane, 3)
+        XCTAssertEqual(extended?.latency, 1500)
+        XCTAssertEqual(extended?.payload, NSRange(location: 39, length: 2))
+
+        XCTAssertNil(parse("%output 12 hello", extended: false))
+        XCTAssertNil(parse("%output %12", extended: false))
+        XCTAssertNil(parse("%output %x hello", extended: false))
+        XCTAssertNil(parse("%extended-output %3 1500 hi", extended: true))
+
+        // Numbers that don't fit are malformed.
+        XCTAssertNil(parse("%output %2147483648 hello", extended: false))
+        XCTAssertEqual(parse("%extended-output %1 9223372036854775807 : hi", extended: true)?.latency,
+                       Int64.max)
+        XCTAssertNil(parse("%extended-output %1 9223372036854775808 : hi", extended: true))
+        XCTAssertNil(parse("%extended-output %1 9223372036854775809 : hi", extended: true))
+    }
+
+    func testReplayTranscript() {
+        var total = 0
+        measure {
+            total = replay { bytes, length in
+                iTermTmuxDecodedOutput(bytes, length)
+            }
+        }
+        XCTAssertGreaterThan(total, 0)
+    }
+
+    // For comparison with testReplayTranscript.
+    func testReplayTranscriptWithReferenceDecoder() {
+        var total = 0
+        measure {
+            total = replay { bytes, length in
+                Self.referenceDecode(Data(bytes: bytes, count: length))
+            }
+        }
+        XCTAssertGreaterThan(total, 0)
+    }
+}
@@ -0,0 +1,64 @@
+//
+//  iTermTriggerPrefilterTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class iTermTriggerPrefilterTests: XCTestCase {
+    private func candidates(_ patterns: [String], _ string: String) -> [Int] {
+        let prefilter = iTermTriggerPrefilter(patterns: patterns)
+        return Array(prefilter.indexesOfPatternsThatMayMatch(string))
+    }
+
+    func testRequiredLiterals() {
+        XCTAssertEqual(iTermRegexLiterals.requiredLiterals(inPattern: "error: (\\d+)"), ["error: "])
+        XCTAssertEqual(iTermRegexLiterals.requiredLiterals(inPattern: "^\\$ "), ["$ "])
+        XCTAssertEqual(iTermRegexLiterals.requiredLiterals(inPattern: "colou?r"), ["colo", "r"])
+        XCTAssertEqual(iTermRegexLiterals.requiredLiterals(inPattern: "warn(ing)?"), ["warn"])
+        XCTAssertEqual(iTermRegexLiterals.requiredLiterals(inPattern: "(?i)fatal"), [])
+        XCTAssertEqual(iTermRegexLiterals.requiredLiterals(inPattern: "fatal|panic"), [])
+    }
+
+    func testOnlyTriggersWithTheirLiteralAreCandidates() {
+        let patterns = ["error: (\\d+)", "^\\$ ", "warn(ing)?", "(?i)fatal"]
+        XCTAssertEqual(candidates(patterns, "build error: 3"), [0, 3])
+        XCTAssertEqual(candidates(patterns, "a warning"), [2, 3])
+        XCTAssertEqual(candidates(patterns, "$ ls"), [1, 3])
+        XCTAssertEqual(candidates(patterns, ""), [3])
+    }
+
+    func testOverlappingLiterals() {
+        // Finding "bcd" means following a failure link out of the path for "abce".
+        XCTAssertEqual(candidates(["abce", "bcd", "c"], "xabcdx"), [1, 2])
+        XCTAssertEqual(candidates(["abcd", "bc"], "abcd"), [0, 1])
+    }
+
+    func testNonASCIIEndsAMatch() {
+        XCTAssertEqual(candidates(["abc"], "ab\u{e9}c"), [])
+        XCTAssertEqual(candidates(["abc"], "\u{e9}abc\u{e9}"), [0])
+    }
+
+    func testNeverRulesOutAMatchingRegex() {
+        let patterns = ["^error(\\d+): (.*)$", "\\[warn\\] (\\w+)", "code (\\d+)", "x{2,3}yz",
+                        "a\\.b", "[abc]def", "(foo)?bar"]
+        let regexes = patterns.map { try! NSRegularExpression(pattern: $0) }
+        let prefilter = iTermTriggerPrefilter(patterns: patterns)
+        var generator = BenchmarkRandomNumberGenerator(seed: 1)
+        let alphabet = Array("abcdefrxyz.[]: 0123456789errorwarncode")
+        for _ in 0..<2000 {
+            let string = String((0..<Int(generator.next() % 40)).map { _ in
+                alphabet[Int(generator.next() % UInt64(alphabet.count))]
+            })
+            let candidates = prefilter.indexesOfPatternsThatMayMatch(string)
+            for (i, regex) in regexes.enumerated() {
+                if regex.firstMatch(in: string, range: NSRange(location: 0, length: string.utf16.count)) != nil {
+                    XCTAssertTrue(candidates.contains(i), "\(patterns[i]) matches \(string)")
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+//
+//  iTermTriggerWorkerTests.swift
+//  ModernTests
+//
+//  Created by agent on 10/16/26.
+//
+
+import XCTest
+@testable import iTerm2SharedARC
+
+final class iTermTriggerWorkerTests: XCTestCase {
+    private func trigger(_ regex: String, partial: Bool = false) -> Trigger {
+        return Trigger(fromUntrustedDict: [kTriggerActionKey: "BellTrigger",
+                                           kTriggerRegexKey: regex,
+                                           kTriggerPartialLineKey: partial])!
+    }
+
+    func testResultsAreDeliveredInOrder() {
+        let triggers = [trigger("error (\\d+)"), trigger("warning")]
+        let worker = iTermTriggerWorker(capacity: 2)
+        let lock = NSLock()
+        var delivered = [Int]()
+        var matchCounts = [[Int]]()
+        let done = expectation(description: "all lines matched")
+        let count = 100
+        for i in 0..<count {
+            let line = iTermStringLine(string: i % 2 == 0 ? "error \(i) error \(i + 1)" : "no match \(i)")
+            worker.add(line, triggers: triggers, prefilter: nil, partialLine: false) { results in
+                lock.lock()
+                delivered.append(i)
+                matchCounts.append(results.map { ($0 as? iTermTriggerMatchResult)?.count ?? -1 })
+                let finished = delivered.count == count
+                lock.unlock()
+                if finished {
+                    done.fulfill()
+                }
+            }
+        }
+        wait(for: [done], timeout: 10)
+        XCTAssertEqual(delivered, Array(0..<count))
+        XCTAssertEqual(matchCounts[0], [2, 0])
+        XCTAssertEqual(matchCounts[1], [0, 0])
+        XCTAssertEqual(worker.pendingCount, 0)
+    }
+
+    func testAddingNeverBlocks() {
+        let triggers = [trigger("error")]
+        let worker = iTermTriggerWorker(capacity: 1)
+        // Hold up the worker in the first completion until every line has been added.
+        let added = DispatchSemaphore(value: 0)
+        let done = expectation(description: "all lines matched")
+        done.expectedFulfillmentCount = 10
+        for i in 0..<10 {
+            worker.add(iTermStringLine(string: "error"), triggers: triggers, prefilter: nil, partialLine: false) { _ in
+                if i == 0 {
+                    added.wait()
+                }
+                done.fulfill()
+            }
+        }
+        XCTAssertGreaterThan(worker.pendingCount, worker.capacity)
+        added.signal()
+        wait(for: [done], timeout: 10)
+        XCTAssertEqual(worker.pendingCount, 0)
+    }
+
+    func testSkippedTriggersGetNull() {
+        let disabled = trigger("error")
+        disabled.disabled = true
+        let triggers = [trigger("error"), trigger("warning"), disabled, trigger("err", partial: true)]
+        let prefilter = iTermTriggerPrefilter(patterns: triggers.map { $0.regex })
+        let worker = iTermTriggerWorker(capacity: 4)
+        let done = expectation(description: "matched")
+        var kinds = [String]()
+        worker.add(iTermStringLine(string: "an error"), triggers: triggers, prefilter: prefilter, partialLine: true) { results in
+            kinds = results.map { $0 is NSNull ? "skipped" : "matched" }
+            done.fulfill()
+        }
+        wait(for: [done], timeout: 10)
+        // Only the last trigger runs on partial lines; the second is ruled out by the prefilter.
+        XCTAssertEqual(kinds, ["skipped", "skipped", "skipped", "matched"])
+    }
+}
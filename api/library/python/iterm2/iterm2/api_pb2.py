@@ -15,7 +15,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\tapi.proto\x12\x06iterm2\"\xd9\x10\n\x17\x43lientOriginatedMessage\x12\n\n\x02id\x18\x01 \x01(\x03\x12\x36\n\x12get_buffer_request\x18\x64 \x01(\x0b\x32\x18.iterm2.GetBufferRequestH\x00\x12\x36\n\x12get_prompt_request\x18\x65 \x01(\x0b\x32\x18.iterm2.GetPromptRequestH\x00\x12\x39\n\x13transaction_request\x18\x66 \x01(\x0b\x32\x1a.iterm2.TransactionRequestH\x00\x12;\n\x14notification_request\x18g \x01(\x0b\x32\x1b.iterm2.NotificationRequestH\x00\x12<\n\x15register_tool_request\x18h \x01(\x0b\x32\x1b.iterm2.RegisterToolRequestH\x00\x12I\n\x1cset_profile_property_request\x18i \x01(\x0b\x32!.iterm2.SetProfilePropertyRequestH\x00\x12<\n\x15list_sessions_request\x18j \x01(\x0b\x32\x1b.iterm2.ListSessionsRequestH\x00\x12\x34\n\x11send_text_request\x18k \x01(\x0b\x32\x17.iterm2.SendTextRequestH\x00\x12\x36\n\x12\x63reate_tab_request\x18l \x01(\x0b\x32\x18.iterm2.CreateTabRequestH\x00\x12\x36\n\x12split_pane_request\x18m \x01(\x0b\x32\x18.iterm2.SplitPaneRequestH\x00\x12I\n\x1cget_profile_property_request\x18n \x01(\x0b\x32!.iterm2.GetProfilePropertyRequestH\x00\x12:\n\x14set_property_request\x18o \x01(\x0b\x32\x1a.iterm2.SetPropertyRequestH\x00\x12:\n\x14get_property_request\x18p \x01(\x0b\x32\x1a.iterm2.GetPropertyRequestH\x00\x12/\n\x0einject_request\x18q \x01(\x0b\x32\x15.iterm2.InjectRequestH\x00\x12\x33\n\x10\x61\x63tivate_request\x18r \x01(\x0b\x32\x17.iterm2.ActivateRequestH\x00\x12\x33\n\x10variable_request\x18s \x01(\x0b\x32\x17.iterm2.VariableRequestH\x00\x12\x44\n\x19saved_arrangement_request\x18t \x01(\x0b\x32\x1f.iterm2.SavedArrangementRequestH\x00\x12-\n\rfocus_request\x18u \x01(\x0b\x32\x14.iterm2.FocusRequestH\x00\x12<\n\x15list_profiles_request\x18v \x01(\x0b\x32\x1b.iterm2.ListProfilesRequestH\x00\x12X\n$server_originated_rpc_result_request\x18w \x01(\x0b\x32(.iterm2.ServerOriginatedRPCResultRequestH\x00\x12@\n\x17restart_session_request\x18x \x01(\x0b\x32\x1d.iterm2.RestartSessionRequestH\x00\x12\x34\n\x11menu_item_request\x18y \x01(\x0b\x32\x17.iterm2.MenuItemRequestH\x00\x12=\n\x16set_tab_layout_request\x18z \x01(\x0b\x32\x1b.iterm2.SetTabLayoutRequestH\x00\x12K\n\x1dget_broadcast_domains_request\x18{ \x01(\x0b\x32\".iterm2.GetBroadcastDomainsRequestH\x00\x12+\n\x0ctmux_request\x18| \x01(\x0b\x32\x13.iterm2.TmuxRequestH\x00\x12:\n\x14reorder_tabs_request\x18} \x01(\x0b\x32\x1a.iterm2.ReorderTabsRequestH\x00\x12\x39\n\x13preferences_request\x18~ \x01(\x0b\x32\x1a.iterm2.PreferencesRequestH\x00\x12:\n\x14\x63olor_preset_request\x18\x7f \x01(\x0b\x32\x1a.iterm2.ColorPresetRequestH\x00\x12\x36\n\x11selection_request\x18\x80\x01 \x01(\x0b\x32\x18.iterm2.SelectionRequestH\x00\x12J\n\x1cstatus_bar_component_request\x18\x81\x01 \x01(\x0b\x32!.iterm2.StatusBarComponentRequestH\x00\x12L\n\x1dset_broadcast_domains_request\x18\x82\x01 \x01(\x0b\x32\".iterm2.SetBroadcastDomainsRequestH\x00\x12.\n\rclose_request\x18\x83\x01 \x01(\x0b\x32\x14.iterm2.CloseRequestH\x00\x12\x41\n\x17invoke_function_request\x18\x84\x01 \x01(\x0b\x32\x1d.iterm2.InvokeFunctionRequestH\x00\x12;\n\x14list_prompts_request\x18\x85\x01 \x01(\x0b\x32\x1a.iterm2.ListPromptsRequestH\x00\x42\x0c\n\nsubmessage\"\xdd\x11\n\x17ServerOriginatedMessage\x12\n\n\x02id\x18\x01 \x01(\x03\x12\x0f\n\x05\x65rror\x18\x02 \x01(\tH\x00\x12\x38\n\x13get_buffer_response\x18\x64 \x01(\x0b\x32\x19.iterm2.GetBufferResponseH\x00\x12\x38\n\x13get_prompt_response\x18\x65 \x01(\x0b\x32\x19.iterm2.GetPromptResponseH\x00\x12;\n\x14transaction_response\x18\x66 \x01(\x0b\x32\x1b.iterm2.TransactionResponseH\x00\x12=\n\x15notification_response\x18g \x01(\x0b\x32\x1c.iterm2.NotificationResponseH\x00\x12>\n\x16register_tool_response\x18h \x01(\x0b\x32\x1c.iterm2.RegisterToolResponseH\x00\x12K\n\x1dset_profile_property_response\x18i \x01(\x0b\x32\".iterm2.SetProfilePropertyResponseH\x00\x12>\n\x16list_sessions_response\x18j \x01(\x0b\x32\x1c.iterm2.ListSessionsResponseH\x00\x12\x36\n\x12send_text_response\x18k \x01(\x0b\x32\x18.iterm2.SendTextResponseH\x00\x12\x38\n\x13\x63reate_tab_response\x18l \x01(\x0b\x32\x19.iterm2.CreateTabResponseH\x00\x12\x38\n\x13split_pane_response\x18m \x01(\x0b\x32\x19.iterm2.SplitPaneResponseH\x00\x12K\n\x1dget_profile_property_response\x18n \x01(\x0b\x32\".iterm2.GetProfilePropertyResponseH\x00\x12<\n\x15set_property_response\x18o \x01(\x0b\x32\x1b.iterm2.SetPropertyResponseH\x00\x12<\n\x15get_property_response\x18p \x01(\x0b\x32\x1b.iterm2.GetPropertyResponseH\x00\x12\x31\n\x0finject_response\x18q \x01(\x0b\x32\x16.iterm2.InjectResponseH\x00\x12\x35\n\x11\x61\x63tivate_response\x18r \x01(\x0b\x32\x18.iterm2.ActivateResponseH\x00\x12\x35\n\x11variable_response\x18s \x01(\x0b\x32\x18.iterm2.VariableResponseH\x00\x12\x46\n\x1asaved_arrangement_response\x18t \x01(\x0b\x32 .iterm2.SavedArrangementResponseH\x00\x12/\n\x0e\x66ocus_response\x18u \x01(\x0b\x32\x15.iterm2.FocusResponseH\x00\x12>\n\x16list_profiles_response\x18v \x01(\x0b\x32\x1c.iterm2.ListProfilesResponseH\x00\x12Z\n%server_originated_rpc_result_response\x18w \x01(\x0b\x32).iterm2.ServerOriginatedRPCResultResponseH\x00\x12\x42\n\x18restart_session_response\x18x \x01(\x0b\x32\x1e.iterm2.RestartSessionResponseH\x00\x12\x36\n\x12menu_item_response\x18y \x01(\x0b\x32\x18.iterm2.MenuItemResponseH\x00\x12?\n\x17set_tab_layout_response\x18z \x01(\x0b\x32\x1c.iterm2.SetTabLayoutResponseH\x00\x12M\n\x1eget_broadcast_domains_response\x18{ \x01(\x0b\x32#.iterm2.GetBroadcastDomainsResponseH\x00\x12-\n\rtmux_response\x18| \x01(\x0b\x32\x14.iterm2.TmuxResponseH\x00\x12<\n\x15reorder_tabs_response\x18} \x01(\x0b\x32\x1b.iterm2.ReorderTabsResponseH\x00\x12;\n\x14preferences_response\x18~ \x01(\x0b\x32\x1b.iterm2.PreferencesResponseH\x00\x12<\n\x15\x63olor_preset_response\x18\x7f \x01(\x0b\x32\x1b.iterm2.ColorPresetResponseH\x00\x12\x38\n\x12selection_response\x18\x80\x01 \x01(\x0b\x32\x19.iterm2.SelectionResponseH\x00\x12L\n\x1dstatus_bar_component_response\x18\x81\x01 \x01(\x0b\x32\".iterm2.StatusBarComponentResponseH\x00\x12N\n\x1eset_broadcast_domains_response\x18\x82\x01 \x01(\x0b\x32#.iterm2.SetBroadcastDomainsResponseH\x00\x12\x30\n\x0e\x63lose_response\x18\x83\x01 \x01(\x0b\x32\x15.iterm2.CloseResponseH\x00\x12\x43\n\x18invoke_function_response\x18\x84\x01 \x01(\x0b\x32\x1e.iterm2.InvokeFunctionResponseH\x00\x12=\n\x15list_prompts_response\x18\x85\x01 \x01(\x0b\x32\x1b.iterm2.ListPromptsResponseH\x00\x12-\n\x0cnotification\x18\xe8\x07 \x01(\x0b\x32\x14.iterm2.NotificationH\x00\x42\x0c\n\nsubmessage\"\xcf\x03\n\x15InvokeFunctionRequest\x12\x30\n\x03tab\x18\x01 \x01(\x0b\x32!.iterm2.InvokeFunctionRequest.TabH\x00\x12\x38\n\x07session\x18\x02 \x01(\x0b\x32%.iterm2.InvokeFunctionRequest.SessionH\x00\x12\x36\n\x06window\x18\x03 \x01(\x0b\x32$.iterm2.InvokeFunctionRequest.WindowH\x00\x12\x30\n\x03\x61pp\x18\x04 \x01(\x0b\x32!.iterm2.InvokeFunctionRequest.AppH\x00\x12\x36\n\x06method\x18\x07 \x01(\x0b\x32$.iterm2.InvokeFunctionRequest.MethodH\x00\x12\x12\n\ninvocation\x18\x05 \x01(\t\x12\x13\n\x07timeout\x18\x06 \x01(\x01:\x02-1\x1a\x15\n\x03Tab\x12\x0e\n\x06tab_id\x18\x01 \x01(\t\x1a\x1d\n\x07Session\x12\x12\n\nsession_id\x18\x01 \x01(\t\x1a\x1b\n\x06Window\x12\x11\n\twindow_id\x18\x01 \x01(\t\x1a\x05\n\x03\x41pp\x1a\x1a\n\x06Method\x12\x10\n\x08receiver\x18\x01 \x01(\tB\t\n\x07\x63ontext\"\xd9\x02\n\x16InvokeFunctionResponse\x12\x35\n\x05\x65rror\x18\x01 \x01(\x0b\x32$.iterm2.InvokeFunctionResponse.ErrorH\x00\x12\x39\n\x07success\x18\x02 \x01(\x0b\x32&.iterm2.InvokeFunctionResponse.SuccessH\x00\x1aT\n\x05\x45rror\x12\x35\n\x06status\x18\x01 \x01(\x0e\x32%.iterm2.InvokeFunctionResponse.Status\x12\x14\n\x0c\x65rror_reason\x18\x02 \x01(\t\x1a\x1e\n\x07Success\x12\x13\n\x0bjson_result\x18\x01 \x01(\t\"H\n\x06Status\x12\x0b\n\x07TIMEOUT\x10\x01\x12\n\n\x06\x46\x41ILED\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\x12\x0e\n\nINVALID_ID\x10\x04\x42\r\n\x0b\x64isposition\"\xad\x02\n\x0c\x43loseRequest\x12.\n\x04tabs\x18\x01 \x01(\x0b\x32\x1e.iterm2.CloseRequest.CloseTabsH\x00\x12\x36\n\x08sessions\x18\x02 \x01(\x0b\x32\".iterm2.CloseRequest.CloseSessionsH\x00\x12\x34\n\x07windows\x18\x03 \x01(\x0b\x32!.iterm2.CloseRequest.CloseWindowsH\x00\x12\r\n\x05\x66orce\x18\x04 \x01(\x08\x1a\x1c\n\tCloseTabs\x12\x0f\n\x07tab_ids\x18\x01 \x03(\t\x1a$\n\rCloseSessions\x12\x13\n\x0bsession_ids\x18\x01 \x03(\t\x1a\"\n\x0c\x43loseWindows\x12\x12\n\nwindow_ids\x18\x01 \x03(\tB\x08\n\x06target\"s\n\rCloseResponse\x12.\n\x08statuses\x18\x01 \x03(\x0e\x32\x1c.iterm2.CloseResponse.Status\"2\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\r\n\tNOT_FOUND\x10\x01\x12\x11\n\rUSER_DECLINED\x10\x02\"P\n\x1aSetBroadcastDomainsRequest\x12\x32\n\x11\x62roadcast_domains\x18\x01 \x03(\x0b\x32\x17.iterm2.BroadcastDomain\"\xc7\x01\n\x1bSetBroadcastDomainsResponse\x12:\n\x06status\x18\x01 \x01(\x0e\x32*.iterm2.SetBroadcastDomainsResponse.Status\"l\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\"\n\x1e\x42ROADCAST_DOMAINS_NOT_DISJOINT\x10\x02\x12\x1f\n\x1bSESSIONS_NOT_IN_SAME_WINDOW\x10\x03\"\xce\x01\n\x19StatusBarComponentRequest\x12\x45\n\x0copen_popover\x18\x01 \x01(\x0b\x32-.iterm2.StatusBarComponentRequest.OpenPopoverH\x00\x12\x12\n\nidentifier\x18\x02 \x01(\t\x1aK\n\x0bOpenPopover\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12\x0c\n\x04html\x18\x02 \x01(\t\x12\x1a\n\x04size\x18\x03 \x01(\x0b\x32\x0c.iterm2.SizeB\t\n\x07request\"\xaf\x01\n\x1aStatusBarComponentResponse\x12\x39\n\x06status\x18\x01 \x01(\x0e\x32).iterm2.StatusBarComponentResponse.Status\"V\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x16\n\x12INVALID_IDENTIFIER\x10\x03\"]\n\x12WindowedCoordRange\x12\'\n\x0b\x63oord_range\x18\x01 \x01(\x0b\x32\x12.iterm2.CoordRange\x12\x1e\n\x07\x63olumns\x18\x02 \x01(\x0b\x32\r.iterm2.Range\"\x8a\x01\n\x0cSubSelection\x12\x38\n\x14windowed_coord_range\x18\x01 \x01(\x0b\x32\x1a.iterm2.WindowedCoordRange\x12-\n\x0eselection_mode\x18\x02 \x01(\x0e\x32\x15.iterm2.SelectionMode\x12\x11\n\tconnected\x18\x03 \x01(\x08\"9\n\tSelection\x12,\n\x0esub_selections\x18\x01 \x03(\x0b\x32\x14.iterm2.SubSelection\"\xb7\x02\n\x10SelectionRequest\x12M\n\x15get_selection_request\x18\x01 \x01(\x0b\x32,.iterm2.SelectionRequest.GetSelectionRequestH\x00\x12M\n\x15set_selection_request\x18\x02 \x01(\x0b\x32,.iterm2.SelectionRequest.SetSelectionRequestH\x00\x1a)\n\x13GetSelectionRequest\x12\x12\n\nsession_id\x18\x01 \x01(\t\x1aO\n\x13SetSelectionRequest\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12$\n\tselection\x18\x02 \x01(\x0b\x32\x11.iterm2.SelectionB\t\n\x07request\"\x9c\x03\n\x11SelectionResponse\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.SelectionResponse.Status\x12P\n\x16get_selection_response\x18\x02 \x01(\x0b\x32..iterm2.SelectionResponse.GetSelectionResponseH\x00\x12P\n\x16set_selection_response\x18\x03 \x01(\x0b\x32..iterm2.SelectionResponse.SetSelectionResponseH\x00\x1a<\n\x14GetSelectionResponse\x12$\n\tselection\x18\x02 \x01(\x0b\x32\x11.iterm2.Selection\x1a\x16\n\x14SetSelectionResponse\"O\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x13\n\x0fINVALID_SESSION\x10\x01\x12\x11\n\rINVALID_RANGE\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\x42\n\n\x08response\"\xc5\x01\n\x12\x43olorPresetRequest\x12>\n\x0clist_presets\x18\x01 \x01(\x0b\x32&.iterm2.ColorPresetRequest.ListPresetsH\x00\x12:\n\nget_preset\x18\x02 \x01(\x0b\x32$.iterm2.ColorPresetRequest.GetPresetH\x00\x1a\r\n\x0bListPresets\x1a\x19\n\tGetPreset\x12\x0c\n\x04name\x18\x01 \x01(\tB\t\n\x07request\"\xf4\x03\n\x13\x43olorPresetResponse\x12?\n\x0clist_presets\x18\x01 \x01(\x0b\x32\'.iterm2.ColorPresetResponse.ListPresetsH\x00\x12;\n\nget_preset\x18\x02 \x01(\x0b\x32%.iterm2.ColorPresetResponse.GetPresetH\x00\x12\x32\n\x06status\x18\x03 \x01(\x0e\x32\".iterm2.ColorPresetResponse.Status\x1a\x1b\n\x0bListPresets\x12\x0c\n\x04name\x18\x01 \x03(\t\x1a\xc2\x01\n\tGetPreset\x12J\n\x0e\x63olor_settings\x18\x01 \x03(\x0b\x32\x32.iterm2.ColorPresetResponse.GetPreset.ColorSetting\x1ai\n\x0c\x43olorSetting\x12\x0b\n\x03red\x18\x01 \x01(\x02\x12\r\n\x05green\x18\x02 \x01(\x02\x12\x0c\n\x04\x62lue\x18\x03 \x01(\x02\x12\r\n\x05\x61lpha\x18\x04 \x01(\x02\x12\x13\n\x0b\x63olor_space\x18\x05 \x01(\t\x12\x0b\n\x03key\x18\x06 \x01(\t\"=\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x14\n\x10PRESET_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x42\n\n\x08response\"\xcb\x04\n\x12PreferencesRequest\x12\x34\n\x08requests\x18\x01 \x03(\x0b\x32\".iterm2.PreferencesRequest.Request\x1a\xfe\x03\n\x07Request\x12R\n\x16set_preference_request\x18\x01 \x01(\x0b\x32\x30.iterm2.PreferencesRequest.Request.SetPreferenceH\x00\x12R\n\x16get_preference_request\x18\x02 \x01(\x0b\x32\x30.iterm2.PreferencesRequest.Request.GetPreferenceH\x00\x12[\n\x1bset_default_profile_request\x18\x03 \x01(\x0b\x32\x34.iterm2.PreferencesRequest.Request.SetDefaultProfileH\x00\x12[\n\x1bget_default_profile_request\x18\x04 \x01(\x0b\x32\x34.iterm2.PreferencesRequest.Request.GetDefaultProfileH\x00\x1a\x30\n\rSetPreference\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\t\x1a\x1c\n\rGetPreference\x12\x0b\n\x03key\x18\x01 \x01(\t\x1a!\n\x11SetDefaultProfile\x12\x0c\n\x04guid\x18\x01 \x01(\t\x1a\x13\n\x11GetDefaultProfileB\t\n\x07request\"\xbf\x07\n\x13PreferencesResponse\x12\x33\n\x07results\x18\x01 \x03(\x0b\x32\".iterm2.PreferencesResponse.Result\x1a\xf2\x06\n\x06Result\x12U\n\x14unrecognized_request\x18\x01 \x01(\x0b\x32\x35.iterm2.PreferencesResponse.Result.UnrecognizedResultH\x00\x12W\n\x15set_preference_result\x18\x02 \x01(\x0b\x32\x36.iterm2.PreferencesResponse.Result.SetPreferenceResultH\x00\x12W\n\x15get_preference_result\x18\x03 \x01(\x0b\x32\x36.iterm2.PreferencesResponse.Result.GetPreferenceResultH\x00\x12`\n\x1aset_default_profile_result\x18\x04 \x01(\x0b\x32:.iterm2.PreferencesResponse.Result.SetDefaultProfileResultH\x00\x12`\n\x1aget_default_profile_result\x18\x05 \x01(\x0b\x32:.iterm2.PreferencesResponse.Result.GetDefaultProfileResultH\x00\x1a\x97\x01\n\x13SetPreferenceResult\x12M\n\x06status\x18\x01 \x01(\x0e\x32=.iterm2.PreferencesResponse.Result.SetPreferenceResult.Status\"1\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x0c\n\x08\x42\x41\x44_JSON\x10\x01\x12\x11\n\rINVALID_VALUE\x10\x02\x1a)\n\x13GetPreferenceResult\x12\x12\n\njson_value\x18\x01 \x01(\t\x1a\x8c\x01\n\x17SetDefaultProfileResult\x12Q\n\x06status\x18\x01 \x01(\x0e\x32\x41.iterm2.PreferencesResponse.Result.SetDefaultProfileResult.Status\"\x1e\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x0c\n\x08\x42\x41\x44_GUID\x10\x01\x1a\x14\n\x12UnrecognizedResult\x1a\'\n\x17GetDefaultProfileResult\x12\x0c\n\x04guid\x18\x01 \x01(\tB\x08\n\x06result\"\x82\x01\n\x12ReorderTabsRequest\x12:\n\x0b\x61ssignments\x18\x03 \x03(\x0b\x32%.iterm2.ReorderTabsRequest.Assignment\x1a\x30\n\nAssignment\x12\x11\n\twindow_id\x18\x01 \x01(\t\x12\x0f\n\x07tab_ids\x18\x02 \x03(\t\"\x9e\x01\n\x13ReorderTabsResponse\x12\x32\n\x06status\x18\x04 \x01(\x0e\x32\".iterm2.ReorderTabsResponse.Status\"S\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x16\n\x12INVALID_ASSIGNMENT\x10\x01\x12\x15\n\x11INVALID_WINDOW_ID\x10\x02\x12\x12\n\x0eINVALID_TAB_ID\x10\x03\"\xe3\x03\n\x0bTmuxRequest\x12?\n\x10list_connections\x18\x01 \x01(\x0b\x32#.iterm2.TmuxRequest.ListConnectionsH\x00\x12\x37\n\x0csend_command\x18\x02 \x01(\x0b\x32\x1f.iterm2.TmuxRequest.SendCommandH\x00\x12\x42\n\x12set_window_visible\x18\x03 \x01(\x0b\x32$.iterm2.TmuxRequest.SetWindowVisibleH\x00\x12\x39\n\rcreate_window\x18\x04 \x01(\x0b\x32 .iterm2.TmuxRequest.CreateWindowH\x00\x1a\x11\n\x0fListConnections\x1a\x35\n\x0bSendCommand\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x0f\n\x07\x63ommand\x18\x02 \x01(\t\x1aM\n\x10SetWindowVisible\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x0f\n\x07visible\x18\x03 \x01(\x08\x1a\x37\n\x0c\x43reateWindow\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x10\n\x08\x61\x66\x66inity\x18\x02 \x01(\tB\t\n\x07payload\"\x89\x05\n\x0cTmuxResponse\x12@\n\x10list_connections\x18\x01 \x01(\x0b\x32$.iterm2.TmuxResponse.ListConnectionsH\x00\x12\x38\n\x0csend_command\x18\x02 \x01(\x0b\x32 .iterm2.TmuxResponse.SendCommandH\x00\x12\x43\n\x12set_window_visible\x18\x03 \x01(\x0b\x32%.iterm2.TmuxResponse.SetWindowVisibleH\x00\x12:\n\rcreate_window\x18\x05 \x01(\x0b\x32!.iterm2.TmuxResponse.CreateWindowH\x00\x12+\n\x06status\x18\x04 \x01(\x0e\x32\x1b.iterm2.TmuxResponse.Status\x1a\x97\x01\n\x0fListConnections\x12\x44\n\x0b\x63onnections\x18\x01 \x03(\x0b\x32/.iterm2.TmuxResponse.ListConnections.Connection\x1a>\n\nConnection\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x19\n\x11owning_session_id\x18\x02 \x01(\t\x1a\x1d\n\x0bSendCommand\x12\x0e\n\x06output\x18\x01 \x01(\t\x1a\x12\n\x10SetWindowVisible\x1a\x1e\n\x0c\x43reateWindow\x12\x0e\n\x06tab_id\x18\x01 \x01(\t\"W\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x13\n\x0fINVALID_REQUEST\x10\x01\x12\x19\n\x15INVALID_CONNECTION_ID\x10\x02\x12\x15\n\x11INVALID_WINDOW_ID\x10\x03\x42\t\n\x07payload\"\x1c\n\x1aGetBroadcastDomainsRequest\"&\n\x0f\x42roadcastDomain\x12\x13\n\x0bsession_ids\x18\x01 \x03(\t\"Q\n\x1bGetBroadcastDomainsResponse\x12\x32\n\x11\x62roadcast_domains\x18\x01 \x03(\x0b\x32\x17.iterm2.BroadcastDomain\"J\n\x13SetTabLayoutRequest\x12#\n\x04root\x18\x01 \x01(\x0b\x32\x15.iterm2.SplitTreeNode\x12\x0e\n\x06tab_id\x18\x02 \x01(\t\"\x8f\x01\n\x14SetTabLayoutResponse\x12\x33\n\x06status\x18\x01 \x01(\x0e\x32#.iterm2.SetTabLayoutResponse.Status\"B\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x0e\n\nBAD_TAB_ID\x10\x01\x12\x0e\n\nWRONG_TREE\x10\x02\x12\x10\n\x0cINVALID_SIZE\x10\x03\"9\n\x0fMenuItemRequest\x12\x12\n\nidentifier\x18\x01 \x01(\t\x12\x12\n\nquery_only\x18\x02 \x01(\x08\"\x99\x01\n\x10MenuItemResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.MenuItemResponse.Status\x12\x0f\n\x07\x63hecked\x18\x02 \x01(\x08\x12\x0f\n\x07\x65nabled\x18\x03 \x01(\x08\"2\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x12\n\x0e\x42\x41\x44_IDENTIFIER\x10\x01\x12\x0c\n\x08\x44ISABLED\x10\x02\"C\n\x15RestartSessionRequest\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12\x16\n\x0eonly_if_exited\x18\x02 \x01(\x08\"\x95\x01\n\x16RestartSessionResponse\x12\x35\n\x06status\x18\x01 \x01(\x0e\x32%.iterm2.RestartSessionResponse.Status\"D\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x1b\n\x17SESSION_NOT_RESTARTABLE\x10\x02\"p\n ServerOriginatedRPCResultRequest\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12\x18\n\x0ejson_exception\x18\x02 \x01(\tH\x00\x12\x14\n\njson_value\x18\x03 \x01(\tH\x00\x42\x08\n\x06result\"#\n!ServerOriginatedRPCResultResponse\"8\n\x13ListProfilesRequest\x12\x12\n\nproperties\x18\x01 \x03(\t\x12\r\n\x05guids\x18\x02 \x03(\t\"\x86\x01\n\x14ListProfilesResponse\x12\x36\n\x08profiles\x18\x01 \x03(\x0b\x32$.iterm2.ListProfilesResponse.Profile\x1a\x36\n\x07Profile\x12+\n\nproperties\x18\x01 \x03(\x0b\x32\x17.iterm2.ProfileProperty\"\x0e\n\x0c\x46ocusRequest\"H\n\rFocusResponse\x12\x37\n\rnotifications\x18\x01 \x03(\x0b\x32 .iterm2.FocusChangedNotification\"\x9d\x01\n\x17SavedArrangementRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x36\n\x06\x61\x63tion\x18\x02 \x01(\x0e\x32&.iterm2.SavedArrangementRequest.Action\x12\x11\n\twindow_id\x18\x03 \x01(\t\")\n\x06\x41\x63tion\x12\x0b\n\x07RESTORE\x10\x00\x12\x08\n\x04SAVE\x10\x01\x12\x08\n\x04LIST\x10\x02\"\xbc\x01\n\x18SavedArrangementResponse\x12\x37\n\x06status\x18\x01 \x01(\x0e\x32\'.iterm2.SavedArrangementResponse.Status\x12\r\n\x05names\x18\x02 \x03(\t\"X\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x19\n\x15\x41RRANGEMENT_NOT_FOUND\x10\x01\x12\x14\n\x10WINDOW_NOT_FOUND\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\"\xc1\x01\n\x0fVariableRequest\x12\x14\n\nsession_id\x18\x01 \x01(\tH\x00\x12\x10\n\x06tab_id\x18\x04 \x01(\tH\x00\x12\r\n\x03\x61pp\x18\x05 \x01(\x08H\x00\x12\x13\n\twindow_id\x18\x06 \x01(\tH\x00\x12(\n\x03set\x18\x02 \x03(\x0b\x32\x1b.iterm2.VariableRequest.Set\x12\x0b\n\x03get\x18\x03 \x03(\t\x1a\"\n\x03Set\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\tB\x07\n\x05scope\"\xe5\x01\n\x10VariableResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.VariableResponse.Status\x12\x0e\n\x06values\x18\x02 \x03(\t\"\x8f\x01\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x10\n\x0cINVALID_NAME\x10\x02\x12\x11\n\rMISSING_SCOPE\x10\x03\x12\x11\n\rTAB_NOT_FOUND\x10\x04\x12\x18\n\x14MULTI_GET_DISALLOWED\x10\x05\x12\x14\n\x10WINDOW_NOT_FOUND\x10\x06\"\x96\x02\n\x0f\x41\x63tivateRequest\x12\x13\n\twindow_id\x18\x01 \x01(\tH\x00\x12\x10\n\x06tab_id\x18\x02 \x01(\tH\x00\x12\x14\n\nsession_id\x18\x03 \x01(\tH\x00\x12\x1a\n\x12order_window_front\x18\x04 \x01(\x08\x12\x12\n\nselect_tab\x18\x05 \x01(\x08\x12\x16\n\x0eselect_session\x18\x06 \x01(\x08\x12\x31\n\x0c\x61\x63tivate_app\x18\x07 \x01(\x0b\x32\x1b.iterm2.ActivateRequest.App\x1a=\n\x03\x41pp\x12\x19\n\x11raise_all_windows\x18\x01 \x01(\x08\x12\x1b\n\x13ignoring_other_apps\x18\x02 \x01(\x08\x42\x0c\n\nidentifier\"}\n\x10\x41\x63tivateResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.ActivateResponse.Status\"8\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x12\n\x0e\x42\x41\x44_IDENTIFIER\x10\x01\x12\x12\n\x0eINVALID_OPTION\x10\x02\"1\n\rInjectRequest\x12\x12\n\nsession_id\x18\x01 \x03(\t\x12\x0c\n\x04\x64\x61ta\x18\x02 \x01(\x0c\"h\n\x0eInjectResponse\x12-\n\x06status\x18\x01 \x03(\x0e\x32\x1d.iterm2.InjectResponse.Status\"\'\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\"[\n\x12GetPropertyRequest\x12\x13\n\twindow_id\x18\x01 \x01(\tH\x00\x12\x14\n\nsession_id\x18\x03 \x01(\tH\x00\x12\x0c\n\x04name\x18\x02 \x01(\tB\x0c\n\nidentifier\"\x9a\x01\n\x13GetPropertyResponse\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.GetPropertyResponse.Status\x12\x12\n\njson_value\x18\x02 \x01(\t\";\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11UNRECOGNIZED_NAME\x10\x01\x12\x12\n\x0eINVALID_TARGET\x10\x02\"o\n\x12SetPropertyRequest\x12\x13\n\twindow_id\x18\x01 \x01(\tH\x00\x12\x14\n\nsession_id\x18\x05 \x01(\tH\x00\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x12\n\njson_value\x18\x04 \x01(\tB\x0c\n\nidentifier\"\xc3\x01\n\x13SetPropertyResponse\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.SetPropertyResponse.Status\"x\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11UNRECOGNIZED_NAME\x10\x01\x12\x11\n\rINVALID_VALUE\x10\x02\x12\x12\n\x0eINVALID_TARGET\x10\x03\x12\x0c\n\x08\x44\x45\x46\x45RRED\x10\x04\x12\x0e\n\nIMPOSSIBLE\x10\x05\x12\n\n\x06\x46\x41ILED\x10\x06\"\xd8\x01\n\x13RegisterToolRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\nidentifier\x18\x02 \x01(\t\x12+\n\x1creveal_if_already_registered\x18\x05 \x01(\x08:\x05\x66\x61lse\x12\x46\n\ttool_type\x18\x03 \x01(\x0e\x32$.iterm2.RegisterToolRequest.ToolType:\rWEB_VIEW_TOOL\x12\x0b\n\x03URL\x18\x04 \x01(\t\"\x1d\n\x08ToolType\x12\x11\n\rWEB_VIEW_TOOL\x10\x01\"\xdf\x0c\n\x16RPCRegistrationRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x46\n\targuments\x18\x02 \x03(\x0b\x32\x33.iterm2.RPCRegistrationRequest.RPCArgumentSignature\x12<\n\x08\x64\x65\x66\x61ults\x18\x04 \x03(\x0b\x32*.iterm2.RPCRegistrationRequest.RPCArgument\x12\x0f\n\x07timeout\x18\x03 \x01(\x02\x12:\n\x04role\x18\x05 \x01(\x0e\x32#.iterm2.RPCRegistrationRequest.Role:\x07GENERIC\x12Y\n\x18session_title_attributes\x18\x07 \x01(\x0b\x32\x35.iterm2.RPCRegistrationRequest.SessionTitleAttributesH\x00\x12\x66\n\x1fstatus_bar_component_attributes\x18\x08 \x01(\x0b\x32;.iterm2.RPCRegistrationRequest.StatusBarComponentAttributesH\x00\x12W\n\x17\x63ontext_menu_attributes\x18\t \x01(\x0b\x32\x34.iterm2.RPCRegistrationRequest.ContextMenuAttributesH\x00\x12\x18\n\x0c\x64isplay_name\x18\x06 \x01(\tB\x02\x18\x01\x1a$\n\x14RPCArgumentSignature\x12\x0c\n\x04name\x18\x01 \x01(\t\x1a)\n\x0bRPCArgument\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x1aI\n\x16SessionTitleAttributes\x12\x14\n\x0c\x64isplay_name\x18\x01 \x01(\t\x12\x19\n\x11unique_identifier\x18\x06 \x01(\t\x1a\xd9\x05\n\x1cStatusBarComponentAttributes\x12\x19\n\x11short_description\x18\x01 \x01(\t\x12\x1c\n\x14\x64\x65tailed_description\x18\x02 \x01(\t\x12O\n\x05knobs\x18\x03 \x03(\x0b\x32@.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Knob\x12\x10\n\x08\x65xemplar\x18\x04 \x01(\t\x12\x16\n\x0eupdate_cadence\x18\x05 \x01(\x02\x12\x19\n\x11unique_identifier\x18\x06 \x01(\t\x12O\n\x05icons\x18\x07 \x03(\x0b\x32@.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Icon\x12^\n\x06\x66ormat\x18\x08 \x01(\x0e\x32\x42.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Format:\nPLAIN_TEXT\x1a\xef\x01\n\x04Knob\x12\x0c\n\x04name\x18\x01 \x01(\t\x12S\n\x04type\x18\x02 \x01(\x0e\x32\x45.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Knob.Type\x12\x13\n\x0bplaceholder\x18\x03 \x01(\t\x12\x1a\n\x12json_default_value\x18\x04 \x01(\t\x12\x0b\n\x03key\x18\x05 \x01(\t\"F\n\x04Type\x12\x0c\n\x08\x43heckbox\x10\x01\x12\n\n\x06String\x10\x02\x12\x19\n\x15PositiveFloatingPoint\x10\x03\x12\t\n\x05\x43olor\x10\x04\x1a#\n\x04Icon\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x0c\x12\r\n\x05scale\x18\x02 \x01(\x02\"\"\n\x06\x46ormat\x12\x0e\n\nPLAIN_TEXT\x10\x00\x12\x08\n\x04HTML\x10\x01\x1aH\n\x15\x43ontextMenuAttributes\x12\x14\n\x0c\x64isplay_name\x18\x01 \x01(\t\x12\x19\n\x11unique_identifier\x18\x02 \x01(\t\"R\n\x04Role\x12\x0b\n\x07GENERIC\x10\x01\x12\x11\n\rSESSION_TITLE\x10\x02\x12\x18\n\x14STATUS_BAR_COMPONENT\x10\x03\x12\x10\n\x0c\x43ONTEXT_MENU\x10\x04\x42\x18\n\x16RoleSpecificAttributes\"\x8b\x01\n\x14RegisterToolResponse\x12\x33\n\x06status\x18\x01 \x01(\x0e\x32#.iterm2.RegisterToolResponse.Status\">\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11REQUEST_MALFORMED\x10\x01\x12\x15\n\x11PERMISSION_DENIED\x10\x02\"\xbe\x01\n\x10KeystrokePattern\x12-\n\x12required_modifiers\x18\x01 \x03(\x0e\x32\x11.iterm2.Modifiers\x12.\n\x13\x66orbidden_modifiers\x18\x02 \x03(\x0e\x32\x11.iterm2.Modifiers\x12\x10\n\x08keycodes\x18\x03 \x03(\x05\x12\x12\n\ncharacters\x18\x04 \x03(\t\x12%\n\x1d\x63haracters_ignoring_modifiers\x18\x05 \x03(\t\"e\n\x17KeystrokeMonitorRequest\x12\x38\n\x12patterns_to_ignore\x18\x01 \x03(\x0b\x32\x18.iterm2.KeystrokePatternB\x02\x18\x01\x12\x10\n\x08\x61\x64vanced\x18\x02 \x01(\x08\"N\n\x16KeystrokeFilterRequest\x12\x34\n\x12patterns_to_ignore\x18\x01 \x03(\x0b\x32\x18.iterm2.KeystrokePattern\"`\n\x16VariableMonitorRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12$\n\x05scope\x18\x02 \x01(\x0e\x32\x15.iterm2.VariableScope\x12\x12\n\nidentifier\x18\x03 \x01(\t\"$\n\x14ProfileChangeRequest\x12\x0c\n\x04guid\x18\x01 \x01(\t\"@\n\x14PromptMonitorRequest\x12(\n\x05modes\x18\x01 \x03(\x0e\x32\x19.iterm2.PromptMonitorMode\"\x8d\x04\n\x13NotificationRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x11\n\tsubscribe\x18\x02 \x01(\x08\x12\x33\n\x11notification_type\x18\x03 \x01(\x0e\x32\x18.iterm2.NotificationType\x12\x42\n\x18rpc_registration_request\x18\x04 \x01(\x0b\x32\x1e.iterm2.RPCRegistrationRequestH\x00\x12\x44\n\x19keystroke_monitor_request\x18\x05 \x01(\x0b\x32\x1f.iterm2.KeystrokeMonitorRequestH\x00\x12\x42\n\x18variable_monitor_request\x18\x06 \x01(\x0b\x32\x1e.iterm2.VariableMonitorRequestH\x00\x12>\n\x16profile_change_request\x18\x07 \x01(\x0b\x32\x1c.iterm2.ProfileChangeRequestH\x00\x12\x42\n\x18keystroke_filter_request\x18\x08 \x01(\x0b\x32\x1e.iterm2.KeystrokeFilterRequestH\x00\x12>\n\x16prompt_monitor_request\x18\t \x01(\x0b\x32\x1c.iterm2.PromptMonitorRequestH\x00\x42\x0b\n\targuments\"\xf5\x01\n\x14NotificationResponse\x12\x33\n\x06status\x18\x01 \x01(\x0e\x32#.iterm2.NotificationResponse.Status\"\xa7\x01\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x12\n\x0eNOT_SUBSCRIBED\x10\x03\x12\x16\n\x12\x41LREADY_SUBSCRIBED\x10\x04\x12#\n\x1f\x44UPLICATE_SERVER_ORIGINATED_RPC\x10\x05\x12\x16\n\x12INVALID_IDENTIFIER\x10\x06\"\xca\x07\n\x0cNotification\x12=\n\x16keystroke_notification\x18\x01 \x01(\x0b\x32\x1d.iterm2.KeystrokeNotification\x12\x44\n\x1ascreen_update_notification\x18\x02 \x01(\x0b\x32 .iterm2.ScreenUpdateNotification\x12\x37\n\x13prompt_notification\x18\x03 \x01(\x0b\x32\x1a.iterm2.PromptNotification\x12L\n\x1clocation_change_notification\x18\x04 \x01(\x0b\x32\".iterm2.LocationChangeNotificationB\x02\x18\x01\x12U\n#custom_escape_sequence_notification\x18\x05 \x01(\x0b\x32(.iterm2.CustomEscapeSequenceNotification\x12@\n\x18new_session_notification\x18\x06 \x01(\x0b\x32\x1e.iterm2.NewSessionNotification\x12L\n\x1eterminate_session_notification\x18\x07 \x01(\x0b\x32$.iterm2.TerminateSessionNotification\x12\x46\n\x1blayout_changed_notification\x18\x08 \x01(\x0b\x32!.iterm2.LayoutChangedNotification\x12\x44\n\x1a\x66ocus_changed_notification\x18\t \x01(\x0b\x32 .iterm2.FocusChangedNotification\x12S\n\"server_originated_rpc_notification\x18\n \x01(\x0b\x32\'.iterm2.ServerOriginatedRPCNotification\x12N\n\x19\x62roadcast_domains_changed\x18\x0b \x01(\x0b\x32+.iterm2.BroadcastDomainsChangedNotification\x12J\n\x1dvariable_changed_notification\x18\x0c \x01(\x0b\x32#.iterm2.VariableChangedNotification\x12H\n\x1cprofile_changed_notification\x18\r \x01(\x0b\x32\".iterm2.ProfileChangedNotification\"*\n\x1aProfileChangedNotification\x12\x0c\n\x04guid\x18\x01 \x01(\t\"}\n\x1bVariableChangedNotification\x12$\n\x05scope\x18\x01 \x01(\x0e\x32\x15.iterm2.VariableScope\x12\x12\n\nidentifier\x18\x02 \x01(\t\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x16\n\x0ejson_new_value\x18\x04 \x01(\t\"Y\n#BroadcastDomainsChangedNotification\x12\x32\n\x11\x62roadcast_domains\x18\x01 \x03(\x0b\x32\x17.iterm2.BroadcastDomain\"\x90\x01\n\x13ServerOriginatedRPC\x12\x0c\n\x04name\x18\x02 \x01(\t\x12:\n\targuments\x18\x03 \x03(\x0b\x32\'.iterm2.ServerOriginatedRPC.RPCArgument\x1a/\n\x0bRPCArgument\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\t\"_\n\x1fServerOriginatedRPCNotification\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12(\n\x03rpc\x18\x02 \x01(\x0b\x32\x1b.iterm2.ServerOriginatedRPC\"\x85\x02\n\x15KeystrokeNotification\x12\x12\n\ncharacters\x18\x01 \x01(\t\x12#\n\x1b\x63haractersIgnoringModifiers\x18\x02 \x01(\t\x12$\n\tmodifiers\x18\x03 \x03(\x0e\x32\x11.iterm2.Modifiers\x12\x0f\n\x07keyCode\x18\x04 \x01(\x05\x12\x0f\n\x07session\x18\x05 \x01(\t\x12\x34\n\x06\x61\x63tion\x18\x06 \x01(\x0e\x32$.iterm2.KeystrokeNotification.Action\"5\n\x06\x41\x63tion\x12\x0c\n\x08KEY_DOWN\x10\x00\x12\n\n\x06KEY_UP\x10\x01\x12\x11\n\rFLAGS_CHANGED\x10\x02\"+\n\x18ScreenUpdateNotification\x12\x0f\n\x07session\x18\x01 \x01(\t\"Z\n\x18PromptNotificationPrompt\x12\x13\n\x0bplaceholder\x18\x01 \x01(\t\x12)\n\x06prompt\x18\x02 \x01(\x0b\x32\x19.iterm2.GetPromptResponse\"1\n\x1ePromptNotificationCommandStart\x12\x0f\n\x07\x63ommand\x18\x01 \x01(\t\".\n\x1cPromptNotificationCommandEnd\x12\x0e\n\x06status\x18\x01 \x01(\x05\"\xfa\x01\n\x12PromptNotification\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x32\n\x06prompt\x18\x02 \x01(\x0b\x32 .iterm2.PromptNotificationPromptH\x00\x12?\n\rcommand_start\x18\x03 \x01(\x0b\x32&.iterm2.PromptNotificationCommandStartH\x00\x12;\n\x0b\x63ommand_end\x18\x04 \x01(\x0b\x32$.iterm2.PromptNotificationCommandEndH\x00\x12\x18\n\x10unique_prompt_id\x18\x05 \x01(\tB\x07\n\x05\x65vent\"f\n\x1aLocationChangeNotification\x12\x11\n\thost_name\x18\x01 \x01(\t\x12\x11\n\tuser_name\x18\x02 \x01(\t\x12\x11\n\tdirectory\x18\x03 \x01(\t\x12\x0f\n\x07session\x18\x04 \x01(\t\"]\n CustomEscapeSequenceNotification\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x17\n\x0fsender_identity\x18\x02 \x01(\t\x12\x0f\n\x07payload\x18\x03 \x01(\t\",\n\x16NewSessionNotification\x12\x12\n\nsession_id\x18\x01 \x01(\t\"\x84\x03\n\x18\x46ocusChangedNotification\x12\x1c\n\x12\x61pplication_active\x18\x01 \x01(\x08H\x00\x12\x39\n\x06window\x18\x02 \x01(\x0b\x32\'.iterm2.FocusChangedNotification.WindowH\x00\x12\x16\n\x0cselected_tab\x18\x03 \x01(\tH\x00\x12\x11\n\x07session\x18\x04 \x01(\tH\x00\x1a\xda\x01\n\x06Window\x12K\n\rwindow_status\x18\x01 \x01(\x0e\x32\x34.iterm2.FocusChangedNotification.Window.WindowStatus\x12\x11\n\twindow_id\x18\x02 \x01(\t\"p\n\x0cWindowStatus\x12\x1e\n\x1aTERMINAL_WINDOW_BECAME_KEY\x10\x00\x12\x1e\n\x1aTERMINAL_WINDOW_IS_CURRENT\x10\x01\x12 \n\x1cTERMINAL_WINDOW_RESIGNED_KEY\x10\x02\x42\x07\n\x05\x65vent\"2\n\x1cTerminateSessionNotification\x12\x12\n\nsession_id\x18\x01 \x01(\t\"Y\n\x19LayoutChangedNotification\x12<\n\x16list_sessions_response\x18\x01 \x01(\x0b\x32\x1c.iterm2.ListSessionsResponse\"b\n\x10GetBufferRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12%\n\nline_range\x18\x02 \x01(\x0b\x32\x11.iterm2.LineRange\x12\x16\n\x0einclude_styles\x18\x03 \x01(\x08\"\xe8\x02\n\x11GetBufferResponse\x12\x34\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.GetBufferResponse.Status:\x02OK\x12 \n\x05range\x18\x02 \x01(\x0b\x32\r.iterm2.RangeB\x02\x18\x01\x12&\n\x08\x63ontents\x18\x03 \x03(\x0b\x32\x14.iterm2.LineContents\x12\x1d\n\x06\x63ursor\x18\x04 \x01(\x0b\x32\r.iterm2.Coord\x12\"\n\x16num_lines_above_screen\x18\x05 \x01(\x03\x42\x02\x18\x01\x12\x38\n\x14windowed_coord_range\x18\x06 \x01(\x0b\x32\x1a.iterm2.WindowedCoordRange\"V\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x16\n\x12INVALID_LINE_RANGE\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\"=\n\x10GetPromptRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x18\n\x10unique_prompt_id\x18\x02 \x01(\t\"\xe3\x03\n\x11GetPromptResponse\x12\x34\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.GetPromptResponse.Status:\x02OK\x12(\n\x0cprompt_range\x18\x02 \x01(\x0b\x32\x12.iterm2.CoordRange\x12)\n\rcommand_range\x18\x03 \x01(\x0b\x32\x12.iterm2.CoordRange\x12(\n\x0coutput_range\x18\x04 \x01(\x0b\x32\x12.iterm2.CoordRange\x12\x19\n\x11working_directory\x18\x05 \x01(\t\x12\x0f\n\x07\x63ommand\x18\x06 \x01(\t\x12\x35\n\x0cprompt_state\x18\x07 \x01(\x0e\x32\x1f.iterm2.GetPromptResponse.State\x12\x13\n\x0b\x65xit_status\x18\t \x01(\r\x12\x18\n\x10unique_prompt_id\x18\n \x01(\t\"V\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x16\n\x12PROMPT_UNAVAILABLE\x10\x03\"/\n\x05State\x12\x0b\n\x07\x45\x44ITING\x10\x00\x12\x0b\n\x07RUNNING\x10\x01\x12\x0c\n\x08\x46INISHED\x10\x02\"V\n\x12ListPromptsRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x17\n\x0f\x66irst_unique_id\x18\x02 \x01(\t\x12\x16\n\x0elast_unique_id\x18\x03 \x01(\t\"\x90\x01\n\x13ListPromptsResponse\x12\x36\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.ListPromptsResponse.Status:\x02OK\x12\x18\n\x10unique_prompt_id\x18\x02 \x03(\t\"\'\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\":\n\x19GetProfilePropertyRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x0c\n\x04keys\x18\x02 \x03(\t\"2\n\x0fProfileProperty\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\t\"\xd3\x01\n\x1aGetProfilePropertyResponse\x12=\n\x06status\x18\x01 \x01(\x0e\x32).iterm2.GetProfilePropertyResponse.Status:\x02OK\x12+\n\nproperties\x18\x03 \x03(\x0b\x32\x17.iterm2.ProfileProperty\"I\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\t\n\x05\x45RROR\x10\x03\"\xa7\x02\n\x19SetProfilePropertyRequest\x12\x11\n\x07session\x18\x01 \x01(\tH\x00\x12?\n\tguid_list\x18\x02 \x01(\x0b\x32*.iterm2.SetProfilePropertyRequest.GuidListH\x00\x12\x0b\n\x03key\x18\x03 \x01(\t\x12\x12\n\njson_value\x18\x04 \x01(\t\x12\x41\n\x0b\x61ssignments\x18\x05 \x03(\x0b\x32,.iterm2.SetProfilePropertyRequest.Assignment\x1a\x19\n\x08GuidList\x12\r\n\x05guids\x18\x01 \x03(\t\x1a-\n\nAssignment\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\tB\x08\n\x06target\"\xa9\x01\n\x1aSetProfilePropertyResponse\x12=\n\x06status\x18\x01 \x01(\x0e\x32).iterm2.SetProfilePropertyResponse.Status:\x02OK\"L\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x0c\n\x08\x42\x41\x44_GUID\x10\x03\"#\n\x12TransactionRequest\x12\r\n\x05\x62\x65gin\x18\x01 \x01(\x08\"\x8f\x01\n\x13TransactionResponse\x12\x36\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.TransactionResponse.Status:\x02OK\"@\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x12\n\x0eNO_TRANSACTION\x10\x01\x12\x1a\n\x16\x41LREADY_IN_TRANSACTION\x10\x02\"{\n\tLineRange\x12\x1c\n\x14screen_contents_only\x18\x01 \x01(\x08\x12\x16\n\x0etrailing_lines\x18\x02 \x01(\x05\x12\x38\n\x14windowed_coord_range\x18\x03 \x01(\x0b\x32\x1a.iterm2.WindowedCoordRange\")\n\x05Range\x12\x10\n\x08location\x18\x01 \x01(\x03\x12\x0e\n\x06length\x18\x02 \x01(\x03\"F\n\nCoordRange\x12\x1c\n\x05start\x18\x01 \x01(\x0b\x32\r.iterm2.Coord\x12\x1a\n\x03\x65nd\x18\x02 \x01(\x0b\x32\r.iterm2.Coord\"\x1d\n\x05\x43oord\x12\t\n\x01x\x18\x01 \x01(\x05\x12\t\n\x01y\x18\x02 \x01(\x03\"4\n\x08RGBColor\x12\x0b\n\x03red\x18\x01 \x01(\r\x12\r\n\x05green\x18\x02 \x01(\r\x12\x0c\n\x04\x62lue\x18\x03 \x01(\r\"&\n\x03URL\x12\x0b\n\x03url\x18\x01 \x01(\t\x12\x12\n\nidentifier\x18\x02 \x01(\t\"\xe1\x04\n\tCellStyle\x12\x14\n\nfgStandard\x18\x01 \x01(\rH\x00\x12-\n\x0b\x66gAlternate\x18\x02 \x01(\x0e\x32\x16.iterm2.AlternateColorH\x00\x12!\n\x05\x66gRgb\x18\x03 \x01(\x0b\x32\x10.iterm2.RGBColorH\x00\x12\x1f\n\x15\x66gAlternatePlacementX\x18\x04 \x01(\rH\x00\x12\x14\n\nbgStandard\x18\x05 \x01(\rH\x01\x12-\n\x0b\x62gAlternate\x18\x06 \x01(\x0e\x32\x16.iterm2.AlternateColorH\x01\x12!\n\x05\x62gRgb\x18\x07 \x01(\x0b\x32\x10.iterm2.RGBColorH\x01\x12\x1f\n\x15\x62gAlternatePlacementY\x18\x08 \x01(\rH\x01\x12\x0c\n\x04\x62old\x18\t \x01(\x08\x12\r\n\x05\x66\x61int\x18\n \x01(\x08\x12\x0e\n\x06italic\x18\x0b \x01(\x08\x12\r\n\x05\x62link\x18\x0c \x01(\x08\x12\x11\n\tunderline\x18\r \x01(\x08\x12\x15\n\rstrikethrough\x18\x0e \x01(\x08\x12\x11\n\tinvisible\x18\x0f \x01(\x08\x12\x0f\n\x07inverse\x18\x10 \x01(\x08\x12\x0f\n\x07guarded\x18\x11 \x01(\x08\x12+\n\x05image\x18\x12 \x01(\x0e\x32\x1c.iterm2.ImagePlaceholderType\x12(\n\x0eunderlineColor\x18\x13 \x01(\x0b\x32\x10.iterm2.RGBColor\x12\x0f\n\x07\x62lockID\x18\x14 \x01(\t\x12\x18\n\x03url\x18\x15 \x01(\x0b\x32\x0b.iterm2.URL\x12\x0f\n\x07repeats\x18\x16 \x01(\rB\t\n\x07\x66gColorB\t\n\x07\x62gColor\"\x8d\x02\n\x0cLineContents\x12\x0c\n\x04text\x18\x01 \x01(\t\x12\x37\n\x14\x63ode_points_per_cell\x18\x02 \x03(\x0b\x32\x19.iterm2.CodePointsPerCell\x12N\n\x0c\x63ontinuation\x18\x03 \x01(\x0e\x32!.iterm2.LineContents.Continuation:\x15\x43ONTINUATION_HARD_EOL\x12 \n\x05style\x18\x04 \x03(\x0b\x32\x11.iterm2.CellStyle\"D\n\x0c\x43ontinuation\x12\x19\n\x15\x43ONTINUATION_HARD_EOL\x10\x01\x12\x19\n\x15\x43ONTINUATION_SOFT_EOL\x10\x02\"@\n\x11\x43odePointsPerCell\x12\x1a\n\x0fnum_code_points\x18\x01 \x01(\x05:\x01\x31\x12\x0f\n\x07repeats\x18\x02 \x01(\x05\"\x15\n\x13ListSessionsRequest\"L\n\x0fSendTextRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x0c\n\x04text\x18\x02 \x01(\t\x12\x1a\n\x12suppress_broadcast\x18\x03 \x01(\x08\"l\n\x10SendTextResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.SendTextResponse.Status\"\'\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\"%\n\x04Size\x12\r\n\x05width\x18\x01 \x01(\x05\x12\x0e\n\x06height\x18\x02 \x01(\x05\"\x1d\n\x05Point\x12\t\n\x01x\x18\x01 \x01(\x05\x12\t\n\x01y\x18\x02 \x01(\x05\"B\n\x05\x46rame\x12\x1d\n\x06origin\x18\x01 \x01(\x0b\x32\r.iterm2.Point\x12\x1a\n\x04size\x18\x02 \x01(\x0b\x32\x0c.iterm2.Size\"y\n\x0eSessionSummary\x12\x19\n\x11unique_identifier\x18\x01 \x01(\t\x12\x1c\n\x05\x66rame\x18\x02 \x01(\x0b\x32\r.iterm2.Frame\x12\x1f\n\tgrid_size\x18\x03 \x01(\x0b\x32\x0c.iterm2.Size\x12\r\n\x05title\x18\x04 \x01(\t\"\xc1\x01\n\rSplitTreeNode\x12\x10\n\x08vertical\x18\x01 \x01(\x08\x12\x32\n\x05links\x18\x02 \x03(\x0b\x32#.iterm2.SplitTreeNode.SplitTreeLink\x1aj\n\rSplitTreeLink\x12)\n\x07session\x18\x01 \x01(\x0b\x32\x16.iterm2.SessionSummaryH\x00\x12%\n\x04node\x18\x02 \x01(\x0b\x32\x15.iterm2.SplitTreeNodeH\x00\x42\x07\n\x05\x63hild\"\x9d\x03\n\x14ListSessionsResponse\x12\x34\n\x07windows\x18\x01 \x03(\x0b\x32#.iterm2.ListSessionsResponse.Window\x12/\n\x0f\x62uried_sessions\x18\x02 \x03(\x0b\x32\x16.iterm2.SessionSummary\x1ay\n\x06Window\x12.\n\x04tabs\x18\x01 \x03(\x0b\x32 .iterm2.ListSessionsResponse.Tab\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x1c\n\x05\x66rame\x18\x03 \x01(\x0b\x32\r.iterm2.Frame\x12\x0e\n\x06number\x18\x04 \x01(\x05\x1a\xa2\x01\n\x03Tab\x12#\n\x04root\x18\x03 \x01(\x0b\x32\x15.iterm2.SplitTreeNode\x12\x0e\n\x06tab_id\x18\x02 \x01(\t\x12\x16\n\x0etmux_window_id\x18\x04 \x01(\t\x12\x1a\n\x12tmux_connection_id\x18\x05 \x01(\t\x12\x32\n\x12minimized_sessions\x18\x06 \x03(\x0b\x32\x16.iterm2.SessionSummary\"\x9f\x01\n\x10\x43reateTabRequest\x12\x14\n\x0cprofile_name\x18\x01 \x01(\t\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x11\n\ttab_index\x18\x03 \x01(\r\x12\x13\n\x07\x63ommand\x18\x04 \x01(\tB\x02\x18\x01\x12:\n\x19\x63ustom_profile_properties\x18\x05 \x03(\x0b\x32\x17.iterm2.ProfileProperty\"\xf0\x01\n\x11\x43reateTabResponse\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.CreateTabResponse.Status\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x0e\n\x06tab_id\x18\x03 \x01(\x05\x12\x12\n\nsession_id\x18\x04 \x01(\t\"r\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x18\n\x14INVALID_PROFILE_NAME\x10\x01\x12\x15\n\x11INVALID_WINDOW_ID\x10\x02\x12\x15\n\x11INVALID_TAB_INDEX\x10\x03\x12\x18\n\x14MISSING_SUBSTITUTION\x10\x04\"\xfe\x01\n\x10SplitPaneRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12@\n\x0fsplit_direction\x18\x02 \x01(\x0e\x32\'.iterm2.SplitPaneRequest.SplitDirection\x12\x15\n\x06\x62\x65\x66ore\x18\x03 \x01(\x08:\x05\x66\x61lse\x12\x14\n\x0cprofile_name\x18\x04 \x01(\t\x12:\n\x19\x63ustom_profile_properties\x18\x05 \x03(\x0b\x32\x17.iterm2.ProfileProperty\".\n\x0eSplitDirection\x12\x0c\n\x08VERTICAL\x10\x00\x12\x0e\n\nHORIZONTAL\x10\x01\"\xd5\x01\n\x11SplitPaneResponse\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.SplitPaneResponse.Status\x12\x12\n\nsession_id\x18\x02 \x03(\t\"z\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x18\n\x14INVALID_PROFILE_NAME\x10\x02\x12\x10\n\x0c\x43\x41NNOT_SPLIT\x10\x03\x12%\n!MALFORMED_CUSTOM_PROFILE_PROPERTY\x10\x04*V\n\rSelectionMode\x12\r\n\tCHARACTER\x10\x00\x12\x08\n\x04WORD\x10\x01\x12\x08\n\x04LINE\x10\x02\x12\t\n\x05SMART\x10\x03\x12\x07\n\x03\x42OX\x10\x04\x12\x0e\n\nWHOLE_LINE\x10\x05*\xb4\x03\n\x10NotificationType\x12\x17\n\x13NOTIFY_ON_KEYSTROKE\x10\x01\x12\x1b\n\x17NOTIFY_ON_SCREEN_UPDATE\x10\x02\x12\x14\n\x10NOTIFY_ON_PROMPT\x10\x03\x12!\n\x19NOTIFY_ON_LOCATION_CHANGE\x10\x04\x1a\x02\x08\x01\x12$\n NOTIFY_ON_CUSTOM_ESCAPE_SEQUENCE\x10\x05\x12\x1d\n\x19NOTIFY_ON_VARIABLE_CHANGE\x10\x0c\x12\x14\n\x10KEYSTROKE_FILTER\x10\x0e\x12\x19\n\x15NOTIFY_ON_NEW_SESSION\x10\x06\x12\x1f\n\x1bNOTIFY_ON_TERMINATE_SESSION\x10\x07\x12\x1b\n\x17NOTIFY_ON_LAYOUT_CHANGE\x10\x08\x12\x1a\n\x16NOTIFY_ON_FOCUS_CHANGE\x10\t\x12#\n\x1fNOTIFY_ON_SERVER_ORIGINATED_RPC\x10\n\x12\x1e\n\x1aNOTIFY_ON_BROADCAST_CHANGE\x10\x0b\x12\x1c\n\x18NOTIFY_ON_PROFILE_CHANGE\x10\r*V\n\tModifiers\x12\x0b\n\x07\x43ONTROL\x10\x01\x12\n\n\x06OPTION\x10\x02\x12\x0b\n\x07\x43OMMAND\x10\x03\x12\t\n\x05SHIFT\x10\x04\x12\x0c\n\x08\x46UNCTION\x10\x05\x12\n\n\x06NUMPAD\x10\x06*:\n\rVariableScope\x12\x0b\n\x07SESSION\x10\x01\x12\x07\n\x03TAB\x10\x02\x12\n\n\x06WINDOW\x10\x03\x12\x07\n\x03\x41PP\x10\x04*C\n\x11PromptMonitorMode\x12\n\n\x06PROMPT\x10\x01\x12\x11\n\rCOMMAND_START\x10\x02\x12\x0f\n\x0b\x43OMMAND_END\x10\x03*G\n\x0e\x41lternateColor\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\x14\n\x10REVERSED_DEFAULT\x10\x03\x12\x12\n\x0eSYSTEM_MESSAGE\x10\x04*7\n\x14ImagePlaceholderType\x12\x08\n\x04NONE\x10\x00\x12\n\n\x06ITERM2\x10\x01\x12\t\n\x05KITTY\x10\x02\x42\x06\xa2\x02\x03ITM')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\tapi.proto\x12\x06iterm2\"\xa0\x11\n\x17\x43lientOriginatedMessage\x12\n\n\x02id\x18\x01 \x01(\x03\x12\x36\n\x12get_buffer_request\x18\x64 \x01(\x0b\x32\x18.iterm2.GetBufferRequestH\x00\x12\x36\n\x12get_prompt_request\x18\x65 \x01(\x0b\x32\x18.iterm2.GetPromptRequestH\x00\x12\x39\n\x13transaction_request\x18\x66 \x01(\x0b\x32\x1a.iterm2.TransactionRequestH\x00\x12;\n\x14notification_request\x18g \x01(\x0b\x32\x1b.iterm2.NotificationRequestH\x00\x12<\n\x15register_tool_request\x18h \x01(\x0b\x32\x1b.iterm2.RegisterToolRequestH\x00\x12I\n\x1cset_profile_property_request\x18i \x01(\x0b\x32!.iterm2.SetProfilePropertyRequestH\x00\x12<\n\x15list_sessions_request\x18j \x01(\x0b\x32\x1b.iterm2.ListSessionsRequestH\x00\x12\x34\n\x11send_text_request\x18k \x01(\x0b\x32\x17.iterm2.SendTextRequestH\x00\x12\x36\n\x12\x63reate_tab_request\x18l \x01(\x0b\x32\x18.iterm2.CreateTabRequestH\x00\x12\x36\n\x12split_pane_request\x18m \x01(\x0b\x32\x18.iterm2.SplitPaneRequestH\x00\x12I\n\x1cget_profile_property_request\x18n \x01(\x0b\x32!.iterm2.GetProfilePropertyRequestH\x00\x12:\n\x14set_property_request\x18o \x01(\x0b\x32\x1a.iterm2.SetPropertyRequestH\x00\x12:\n\x14get_property_request\x18p \x01(\x0b\x32\x1a.iterm2.GetPropertyRequestH\x00\x12/\n\x0einject_request\x18q \x01(\x0b\x32\x15.iterm2.InjectRequestH\x00\x12\x33\n\x10\x61\x63tivate_request\x18r \x01(\x0b\x32\x17.iterm2.ActivateRequestH\x00\x12\x33\n\x10variable_request\x18s \x01(\x0b\x32\x17.iterm2.VariableRequestH\x00\x12\x44\n\x19saved_arrangement_request\x18t \x01(\x0b\x32\x1f.iterm2.SavedArrangementRequestH\x00\x12-\n\rfocus_request\x18u \x01(\x0b\x32\x14.iterm2.FocusRequestH\x00\x12<\n\x15list_profiles_request\x18v \x01(\x0b\x32\x1b.iterm2.ListProfilesRequestH\x00\x12X\n$server_originated_rpc_result_request\x18w \x01(\x0b\x32(.iterm2.ServerOriginatedRPCResultRequestH\x00\x12@\n\x17restart_session_request\x18x \x01(\x0b\x32\x1d.iterm2.RestartSessionRequestH\x00\x12\x34\n\x11menu_item_request\x18y \x01(\x0b\x32\x17.iterm2.MenuItemRequestH\x00\x12=\n\x16set_tab_layout_request\x18z \x01(\x0b\x32\x1b.iterm2.SetTabLayoutRequestH\x00\x12K\n\x1dget_broadcast_domains_request\x18{ \x01(\x0b\x32\".iterm2.GetBroadcastDomainsRequestH\x00\x12+\n\x0ctmux_request\x18| \x01(\x0b\x32\x13.iterm2.TmuxRequestH\x00\x12:\n\x14reorder_tabs_request\x18} \x01(\x0b\x32\x1a.iterm2.ReorderTabsRequestH\x00\x12\x39\n\x13preferences_request\x18~ \x01(\x0b\x32\x1a.iterm2.PreferencesRequestH\x00\x12:\n\x14\x63olor_preset_request\x18\x7f \x01(\x0b\x32\x1a.iterm2.ColorPresetRequestH\x00\x12\x36\n\x11selection_request\x18\x80\x01 \x01(\x0b\x32\x18.iterm2.SelectionRequestH\x00\x12J\n\x1cstatus_bar_component_request\x18\x81\x01 \x01(\x0b\x32!.iterm2.StatusBarComponentRequestH\x00\x12L\n\x1dset_broadcast_domains_request\x18\x82\x01 \x01(\x0b\x32\".iterm2.SetBroadcastDomainsRequestH\x00\x12.\n\rclose_request\x18\x83\x01 \x01(\x0b\x32\x14.iterm2.CloseRequestH\x00\x12\x41\n\x17invoke_function_request\x18\x84\x01 \x01(\x0b\x32\x1d.iterm2.InvokeFunctionRequestH\x00\x12;\n\x14list_prompts_request\x18\x85\x01 \x01(\x0b\x32\x1a.iterm2.ListPromptsRequestH\x00\x12\x45\n\x19\x65xport_scrollback_request\x18\x86\x01 \x01(\x0b\x32\x1f.iterm2.ExportScrollbackRequestH\x00\x42\x0c\n\nsubmessage\"\xa6\x12\n\x17ServerOriginatedMessage\x12\n\n\x02id\x18\x01 \x01(\x03\x12\x0f\n\x05\x65rror\x18\x02 \x01(\tH\x00\x12\x38\n\x13get_buffer_response\x18\x64 \x01(\x0b\x32\x19.iterm2.GetBufferResponseH\x00\x12\x38\n\x13get_prompt_response\x18\x65 \x01(\x0b\x32\x19.iterm2.GetPromptResponseH\x00\x12;\n\x14transaction_response\x18\x66 \x01(\x0b\x32\x1b.iterm2.TransactionResponseH\x00\x12=\n\x15notification_response\x18g \x01(\x0b\x32\x1c.iterm2.NotificationResponseH\x00\x12>\n\x16register_tool_response\x18h \x01(\x0b\x32\x1c.iterm2.RegisterToolResponseH\x00\x12K\n\x1dset_profile_property_response\x18i \x01(\x0b\x32\".iterm2.SetProfilePropertyResponseH\x00\x12>\n\x16list_sessions_response\x18j \x01(\x0b\x32\x1c.iterm2.ListSessionsResponseH\x00\x12\x36\n\x12send_text_response\x18k \x01(\x0b\x32\x18.iterm2.SendTextResponseH\x00\x12\x38\n\x13\x63reate_tab_response\x18l \x01(\x0b\x32\x19.iterm2.CreateTabResponseH\x00\x12\x38\n\x13split_pane_response\x18m \x01(\x0b\x32\x19.iterm2.SplitPaneResponseH\x00\x12K\n\x1dget_profile_property_response\x18n \x01(\x0b\x32\".iterm2.GetProfilePropertyResponseH\x00\x12<\n\x15set_property_response\x18o \x01(\x0b\x32\x1b.iterm2.SetPropertyResponseH\x00\x12<\n\x15get_property_response\x18p \x01(\x0b\x32\x1b.iterm2.GetPropertyResponseH\x00\x12\x31\n\x0finject_response\x18q \x01(\x0b\x32\x16.iterm2.InjectResponseH\x00\x12\x35\n\x11\x61\x63tivate_response\x18r \x01(\x0b\x32\x18.iterm2.ActivateResponseH\x00\x12\x35\n\x11variable_response\x18s \x01(\x0b\x32\x18.iterm2.VariableResponseH\x00\x12\x46\n\x1asaved_arrangement_response\x18t \x01(\x0b\x32 .iterm2.SavedArrangementResponseH\x00\x12/\n\x0e\x66ocus_response\x18u \x01(\x0b\x32\x15.iterm2.FocusResponseH\x00\x12>\n\x16list_profiles_response\x18v \x01(\x0b\x32\x1c.iterm2.ListProfilesResponseH\x00\x12Z\n%server_originated_rpc_result_response\x18w \x01(\x0b\x32).iterm2.ServerOriginatedRPCResultResponseH\x00\x12\x42\n\x18restart_session_response\x18x \x01(\x0b\x32\x1e.iterm2.RestartSessionResponseH\x00\x12\x36\n\x12menu_item_response\x18y \x01(\x0b\x32\x18.iterm2.MenuItemResponseH\x00\x12?\n\x17set_tab_layout_response\x18z \x01(\x0b\x32\x1c.iterm2.SetTabLayoutResponseH\x00\x12M\n\x1eget_broadcast_domains_response\x18{ \x01(\x0b\x32#.iterm2.GetBroadcastDomainsResponseH\x00\x12-\n\rtmux_response\x18| \x01(\x0b\x32\x14.iterm2.TmuxResponseH\x00\x12<\n\x15reorder_tabs_response\x18} \x01(\x0b\x32\x1b.iterm2.ReorderTabsResponseH\x00\x12;\n\x14preferences_response\x18~ \x01(\x0b\x32\x1b.iterm2.PreferencesResponseH\x00\x12<\n\x15\x63olor_preset_response\x18\x7f \x01(\x0b\x32\x1b.iterm2.ColorPresetResponseH\x00\x12\x38\n\x12selection_response\x18\x80\x01 \x01(\x0b\x32\x19.iterm2.SelectionResponseH\x00\x12L\n\x1dstatus_bar_component_response\x18\x81\x01 \x01(\x0b\x32\".iterm2.StatusBarComponentResponseH\x00\x12N\n\x1eset_broadcast_domains_response\x18\x82\x01 \x01(\x0b\x32#.iterm2.SetBroadcastDomainsResponseH\x00\x12\x30\n\x0e\x63lose_response\x18\x83\x01 \x01(\x0b\x32\x15.iterm2.CloseResponseH\x00\x12\x43\n\x18invoke_function_response\x18\x84\x01 \x01(\x0b\x32\x1e.iterm2.InvokeFunctionResponseH\x00\x12=\n\x15list_prompts_response\x18\x85\x01 \x01(\x0b\x32\x1b.iterm2.ListPromptsResponseH\x00\x12G\n\x1a\x65xport_scrollback_response\x18\x86\x01 \x01(\x0b\x32 .iterm2.ExportScrollbackResponseH\x00\x12-\n\x0cnotification\x18\xe8\x07 \x01(\x0b\x32\x14.iterm2.NotificationH\x00\x42\x0c\n\nsubmessage\"\xcf\x03\n\x15InvokeFunctionRequest\x12\x30\n\x03tab\x18\x01 \x01(\x0b\x32!.iterm2.InvokeFunctionRequest.TabH\x00\x12\x38\n\x07session\x18\x02 \x01(\x0b\x32%.iterm2.InvokeFunctionRequest.SessionH\x00\x12\x36\n\x06window\x18\x03 \x01(\x0b\x32$.iterm2.InvokeFunctionRequest.WindowH\x00\x12\x30\n\x03\x61pp\x18\x04 \x01(\x0b\x32!.iterm2.InvokeFunctionRequest.AppH\x00\x12\x36\n\x06method\x18\x07 \x01(\x0b\x32$.iterm2.InvokeFunctionRequest.MethodH\x00\x12\x12\n\ninvocation\x18\x05 \x01(\t\x12\x13\n\x07timeout\x18\x06 \x01(\x01:\x02-1\x1a\x15\n\x03Tab\x12\x0e\n\x06tab_id\x18\x01 \x01(\t\x1a\x1d\n\x07Session\x12\x12\n\nsession_id\x18\x01 \x01(\t\x1a\x1b\n\x06Window\x12\x11\n\twindow_id\x18\x01 \x01(\t\x1a\x05\n\x03\x41pp\x1a\x1a\n\x06Method\x12\x10\n\x08receiver\x18\x01 \x01(\tB\t\n\x07\x63ontext\"\xd9\x02\n\x16InvokeFunctionResponse\x12\x35\n\x05\x65rror\x18\x01 \x01(\x0b\x32$.iterm2.InvokeFunctionResponse.ErrorH\x00\x12\x39\n\x07success\x18\x02 \x01(\x0b\x32&.iterm2.InvokeFunctionResponse.SuccessH\x00\x1aT\n\x05\x45rror\x12\x35\n\x06status\x18\x01 \x01(\x0e\x32%.iterm2.InvokeFunctionResponse.Status\x12\x14\n\x0c\x65rror_reason\x18\x02 \x01(\t\x1a\x1e\n\x07Success\x12\x13\n\x0bjson_result\x18\x01 \x01(\t\"H\n\x06Status\x12\x0b\n\x07TIMEOUT\x10\x01\x12\n\n\x06\x46\x41ILED\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\x12\x0e\n\nINVALID_ID\x10\x04\x42\r\n\x0b\x64isposition\"\xad\x02\n\x0c\x43loseRequest\x12.\n\x04tabs\x18\x01 \x01(\x0b\x32\x1e.iterm2.CloseRequest.CloseTabsH\x00\x12\x36\n\x08sessions\x18\x02 \x01(\x0b\x32\".iterm2.CloseRequest.CloseSessionsH\x00\x12\x34\n\x07windows\x18\x03 \x01(\x0b\x32!.iterm2.CloseRequest.CloseWindowsH\x00\x12\r\n\x05\x66orce\x18\x04 \x01(\x08\x1a\x1c\n\tCloseTabs\x12\x0f\n\x07tab_ids\x18\x01 \x03(\t\x1a$\n\rCloseSessions\x12\x13\n\x0bsession_ids\x18\x01 \x03(\t\x1a\"\n\x0c\x43loseWindows\x12\x12\n\nwindow_ids\x18\x01 \x03(\tB\x08\n\x06target\"s\n\rCloseResponse\x12.\n\x08statuses\x18\x01 \x03(\x0e\x32\x1c.iterm2.CloseResponse.Status\"2\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\r\n\tNOT_FOUND\x10\x01\x12\x11\n\rUSER_DECLINED\x10\x02\"P\n\x1aSetBroadcastDomainsRequest\x12\x32\n\x11\x62roadcast_domains\x18\x01 \x03(\x0b\x32\x17.iterm2.BroadcastDomain\"\xc7\x01\n\x1bSetBroadcastDomainsResponse\x12:\n\x06status\x18\x01 \x01(\x0e\x32*.iterm2.SetBroadcastDomainsResponse.Status\"l\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\"\n\x1e\x42ROADCAST_DOMAINS_NOT_DISJOINT\x10\x02\x12\x1f\n\x1bSESSIONS_NOT_IN_SAME_WINDOW\x10\x03\"\xce\x01\n\x19StatusBarComponentRequest\x12\x45\n\x0copen_popover\x18\x01 \x01(\x0b\x32-.iterm2.StatusBarComponentRequest.OpenPopoverH\x00\x12\x12\n\nidentifier\x18\x02 \x01(\t\x1aK\n\x0bOpenPopover\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12\x0c\n\x04html\x18\x02 \x01(\t\x12\x1a\n\x04size\x18\x03 \x01(\x0b\x32\x0c.iterm2.SizeB\t\n\x07request\"\xaf\x01\n\x1aStatusBarComponentResponse\x12\x39\n\x06status\x18\x01 \x01(\x0e\x32).iterm2.StatusBarComponentResponse.Status\"V\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x16\n\x12INVALID_IDENTIFIER\x10\x03\"]\n\x12WindowedCoordRange\x12\'\n\x0b\x63oord_range\x18\x01 \x01(\x0b\x32\x12.iterm2.CoordRange\x12\x1e\n\x07\x63olumns\x18\x02 \x01(\x0b\x32\r.iterm2.Range\"\x8a\x01\n\x0cSubSelection\x12\x38\n\x14windowed_coord_range\x18\x01 \x01(\x0b\x32\x1a.iterm2.WindowedCoordRange\x12-\n\x0eselection_mode\x18\x02 \x01(\x0e\x32\x15.iterm2.SelectionMode\x12\x11\n\tconnected\x18\x03 \x01(\x08\"9\n\tSelection\x12,\n\x0esub_selections\x18\x01 \x03(\x0b\x32\x14.iterm2.SubSelection\"\xb7\x02\n\x10SelectionRequest\x12M\n\x15get_selection_request\x18\x01 \x01(\x0b\x32,.iterm2.SelectionRequest.GetSelectionRequestH\x00\x12M\n\x15set_selection_request\x18\x02 \x01(\x0b\x32,.iterm2.SelectionRequest.SetSelectionRequestH\x00\x1a)\n\x13GetSelectionRequest\x12\x12\n\nsession_id\x18\x01 \x01(\t\x1aO\n\x13SetSelectionRequest\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12$\n\tselection\x18\x02 \x01(\x0b\x32\x11.iterm2.SelectionB\t\n\x07request\"\x9c\x03\n\x11SelectionResponse\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.SelectionResponse.Status\x12P\n\x16get_selection_response\x18\x02 \x01(\x0b\x32..iterm2.SelectionResponse.GetSelectionResponseH\x00\x12P\n\x16set_selection_response\x18\x03 \x01(\x0b\x32..iterm2.SelectionResponse.SetSelectionResponseH\x00\x1a<\n\x14GetSelectionResponse\x12$\n\tselection\x18\x02 \x01(\x0b\x32\x11.iterm2.Selection\x1a\x16\n\x14SetSelectionResponse\"O\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x13\n\x0fINVALID_SESSION\x10\x01\x12\x11\n\rINVALID_RANGE\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\x42\n\n\x08response\"\xc5\x01\n\x12\x43olorPresetRequest\x12>\n\x0clist_presets\x18\x01 \x01(\x0b\x32&.iterm2.ColorPresetRequest.ListPresetsH\x00\x12:\n\nget_preset\x18\x02 \x01(\x0b\x32$.iterm2.ColorPresetRequest.GetPresetH\x00\x1a\r\n\x0bListPresets\x1a\x19\n\tGetPreset\x12\x0c\n\x04name\x18\x01 \x01(\tB\t\n\x07request\"\xf4\x03\n\x13\x43olorPresetResponse\x12?\n\x0clist_presets\x18\x01 \x01(\x0b\x32\'.iterm2.ColorPresetResponse.ListPresetsH\x00\x12;\n\nget_preset\x18\x02 \x01(\x0b\x32%.iterm2.ColorPresetResponse.GetPresetH\x00\x12\x32\n\x06status\x18\x03 \x01(\x0e\x32\".iterm2.ColorPresetResponse.Status\x1a\x1b\n\x0bListPresets\x12\x0c\n\x04name\x18\x01 \x03(\t\x1a\xc2\x01\n\tGetPreset\x12J\n\x0e\x63olor_settings\x18\x01 \x03(\x0b\x32\x32.iterm2.ColorPresetResponse.GetPreset.ColorSetting\x1ai\n\x0c\x43olorSetting\x12\x0b\n\x03red\x18\x01 \x01(\x02\x12\r\n\x05green\x18\x02 \x01(\x02\x12\x0c\n\x04\x62lue\x18\x03 \x01(\x02\x12\r\n\x05\x61lpha\x18\x04 \x01(\x02\x12\x13\n\x0b\x63olor_space\x18\x05 \x01(\t\x12\x0b\n\x03key\x18\x06 \x01(\t\"=\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x14\n\x10PRESET_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x42\n\n\x08response\"\xcb\x04\n\x12PreferencesRequest\x12\x34\n\x08requests\x18\x01 \x03(\x0b\x32\".iterm2.PreferencesRequest.Request\x1a\xfe\x03\n\x07Request\x12R\n\x16set_preference_request\x18\x01 \x01(\x0b\x32\x30.iterm2.PreferencesRequest.Request.SetPreferenceH\x00\x12R\n\x16get_preference_request\x18\x02 \x01(\x0b\x32\x30.iterm2.PreferencesRequest.Request.GetPreferenceH\x00\x12[\n\x1bset_default_profile_request\x18\x03 \x01(\x0b\x32\x34.iterm2.PreferencesRequest.Request.SetDefaultProfileH\x00\x12[\n\x1bget_default_profile_request\x18\x04 \x01(\x0b\x32\x34.iterm2.PreferencesRequest.Request.GetDefaultProfileH\x00\x1a\x30\n\rSetPreference\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\t\x1a\x1c\n\rGetPreference\x12\x0b\n\x03key\x18\x01 \x01(\t\x1a!\n\x11SetDefaultProfile\x12\x0c\n\x04guid\x18\x01 \x01(\t\x1a\x13\n\x11GetDefaultProfileB\t\n\x07request\"\xbf\x07\n\x13PreferencesResponse\x12\x33\n\x07results\x18\x01 \x03(\x0b\x32\".iterm2.PreferencesResponse.Result\x1a\xf2\x06\n\x06Result\x12U\n\x14unrecognized_request\x18\x01 \x01(\x0b\x32\x35.iterm2.PreferencesResponse.Result.UnrecognizedResultH\x00\x12W\n\x15set_preference_result\x18\x02 \x01(\x0b\x32\x36.iterm2.PreferencesResponse.Result.SetPreferenceResultH\x00\x12W\n\x15get_preference_result\x18\x03 \x01(\x0b\x32\x36.iterm2.PreferencesResponse.Result.GetPreferenceResultH\x00\x12`\n\x1aset_default_profile_result\x18\x04 \x01(\x0b\x32:.iterm2.PreferencesResponse.Result.SetDefaultProfileResultH\x00\x12`\n\x1aget_default_profile_result\x18\x05 \x01(\x0b\x32:.iterm2.PreferencesResponse.Result.GetDefaultProfileResultH\x00\x1a\x97\x01\n\x13SetPreferenceResult\x12M\n\x06status\x18\x01 \x01(\x0e\x32=.iterm2.PreferencesResponse.Result.SetPreferenceResult.Status\"1\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x0c\n\x08\x42\x41\x44_JSON\x10\x01\x12\x11\n\rINVALID_VALUE\x10\x02\x1a)\n\x13GetPreferenceResult\x12\x12\n\njson_value\x18\x01 \x01(\t\x1a\x8c\x01\n\x17SetDefaultProfileResult\x12Q\n\x06status\x18\x01 \x01(\x0e\x32\x41.iterm2.PreferencesResponse.Result.SetDefaultProfileResult.Status\"\x1e\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x0c\n\x08\x42\x41\x44_GUID\x10\x01\x1a\x14\n\x12UnrecognizedResult\x1a\'\n\x17GetDefaultProfileResult\x12\x0c\n\x04guid\x18\x01 \x01(\tB\x08\n\x06result\"\x82\x01\n\x12ReorderTabsRequest\x12:\n\x0b\x61ssignments\x18\x03 \x03(\x0b\x32%.iterm2.ReorderTabsRequest.Assignment\x1a\x30\n\nAssignment\x12\x11\n\twindow_id\x18\x01 \x01(\t\x12\x0f\n\x07tab_ids\x18\x02 \x03(\t\"\x9e\x01\n\x13ReorderTabsResponse\x12\x32\n\x06status\x18\x04 \x01(\x0e\x32\".iterm2.ReorderTabsResponse.Status\"S\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x16\n\x12INVALID_ASSIGNMENT\x10\x01\x12\x15\n\x11INVALID_WINDOW_ID\x10\x02\x12\x12\n\x0eINVALID_TAB_ID\x10\x03\"\xe3\x03\n\x0bTmuxRequest\x12?\n\x10list_connections\x18\x01 \x01(\x0b\x32#.iterm2.TmuxRequest.ListConnectionsH\x00\x12\x37\n\x0csend_command\x18\x02 \x01(\x0b\x32\x1f.iterm2.TmuxRequest.SendCommandH\x00\x12\x42\n\x12set_window_visible\x18\x03 \x01(\x0b\x32$.iterm2.TmuxRequest.SetWindowVisibleH\x00\x12\x39\n\rcreate_window\x18\x04 \x01(\x0b\x32 .iterm2.TmuxRequest.CreateWindowH\x00\x1a\x11\n\x0fListConnections\x1a\x35\n\x0bSendCommand\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x0f\n\x07\x63ommand\x18\x02 \x01(\t\x1aM\n\x10SetWindowVisible\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x0f\n\x07visible\x18\x03 \x01(\x08\x1a\x37\n\x0c\x43reateWindow\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x10\n\x08\x61\x66\x66inity\x18\x02 \x01(\tB\t\n\x07payload\"\x89\x05\n\x0cTmuxResponse\x12@\n\x10list_connections\x18\x01 \x01(\x0b\x32$.iterm2.TmuxResponse.ListConnectionsH\x00\x12\x38\n\x0csend_command\x18\x02 \x01(\x0b\x32 .iterm2.TmuxResponse.SendCommandH\x00\x12\x43\n\x12set_window_visible\x18\x03 \x01(\x0b\x32%.iterm2.TmuxResponse.SetWindowVisibleH\x00\x12:\n\rcreate_window\x18\x05 \x01(\x0b\x32!.iterm2.TmuxResponse.CreateWindowH\x00\x12+\n\x06status\x18\x04 \x01(\x0e\x32\x1b.iterm2.TmuxResponse.Status\x1a\x97\x01\n\x0fListConnections\x12\x44\n\x0b\x63onnections\x18\x01 \x03(\x0b\x32/.iterm2.TmuxResponse.ListConnections.Connection\x1a>\n\nConnection\x12\x15\n\rconnection_id\x18\x01 \x01(\t\x12\x19\n\x11owning_session_id\x18\x02 \x01(\t\x1a\x1d\n\x0bSendCommand\x12\x0e\n\x06output\x18\x01 \x01(\t\x1a\x12\n\x10SetWindowVisible\x1a\x1e\n\x0c\x43reateWindow\x12\x0e\n\x06tab_id\x18\x01 \x01(\t\"W\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x13\n\x0fINVALID_REQUEST\x10\x01\x12\x19\n\x15INVALID_CONNECTION_ID\x10\x02\x12\x15\n\x11INVALID_WINDOW_ID\x10\x03\x42\t\n\x07payload\"\x1c\n\x1aGetBroadcastDomainsRequest\"&\n\x0f\x42roadcastDomain\x12\x13\n\x0bsession_ids\x18\x01 \x03(\t\"Q\n\x1bGetBroadcastDomainsResponse\x12\x32\n\x11\x62roadcast_domains\x18\x01 \x03(\x0b\x32\x17.iterm2.BroadcastDomain\"J\n\x13SetTabLayoutRequest\x12#\n\x04root\x18\x01 \x01(\x0b\x32\x15.iterm2.SplitTreeNode\x12\x0e\n\x06tab_id\x18\x02 \x01(\t\"\x8f\x01\n\x14SetTabLayoutResponse\x12\x33\n\x06status\x18\x01 \x01(\x0e\x32#.iterm2.SetTabLayoutResponse.Status\"B\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x0e\n\nBAD_TAB_ID\x10\x01\x12\x0e\n\nWRONG_TREE\x10\x02\x12\x10\n\x0cINVALID_SIZE\x10\x03\"9\n\x0fMenuItemRequest\x12\x12\n\nidentifier\x18\x01 \x01(\t\x12\x12\n\nquery_only\x18\x02 \x01(\x08\"\x99\x01\n\x10MenuItemResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.MenuItemResponse.Status\x12\x0f\n\x07\x63hecked\x18\x02 \x01(\x08\x12\x0f\n\x07\x65nabled\x18\x03 \x01(\x08\"2\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x12\n\x0e\x42\x41\x44_IDENTIFIER\x10\x01\x12\x0c\n\x08\x44ISABLED\x10\x02\"C\n\x15RestartSessionRequest\x12\x12\n\nsession_id\x18\x01 \x01(\t\x12\x16\n\x0eonly_if_exited\x18\x02 \x01(\x08\"\x95\x01\n\x16RestartSessionResponse\x12\x35\n\x06status\x18\x01 \x01(\x0e\x32%.iterm2.RestartSessionResponse.Status\"D\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x1b\n\x17SESSION_NOT_RESTARTABLE\x10\x02\"p\n ServerOriginatedRPCResultRequest\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12\x18\n\x0ejson_exception\x18\x02 \x01(\tH\x00\x12\x14\n\njson_value\x18\x03 \x01(\tH\x00\x42\x08\n\x06result\"#\n!ServerOriginatedRPCResultResponse\"8\n\x13ListProfilesRequest\x12\x12\n\nproperties\x18\x01 \x03(\t\x12\r\n\x05guids\x18\x02 \x03(\t\"\x86\x01\n\x14ListProfilesResponse\x12\x36\n\x08profiles\x18\x01 \x03(\x0b\x32$.iterm2.ListProfilesResponse.Profile\x1a\x36\n\x07Profile\x12+\n\nproperties\x18\x01 \x03(\x0b\x32\x17.iterm2.ProfileProperty\"\x0e\n\x0c\x46ocusRequest\"H\n\rFocusResponse\x12\x37\n\rnotifications\x18\x01 \x03(\x0b\x32 .iterm2.FocusChangedNotification\"\x9d\x01\n\x17SavedArrangementRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x36\n\x06\x61\x63tion\x18\x02 \x01(\x0e\x32&.iterm2.SavedArrangementRequest.Action\x12\x11\n\twindow_id\x18\x03 \x01(\t\")\n\x06\x41\x63tion\x12\x0b\n\x07RESTORE\x10\x00\x12\x08\n\x04SAVE\x10\x01\x12\x08\n\x04LIST\x10\x02\"\xbc\x01\n\x18SavedArrangementResponse\x12\x37\n\x06status\x18\x01 \x01(\x0e\x32\'.iterm2.SavedArrangementResponse.Status\x12\r\n\x05names\x18\x02 \x03(\t\"X\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x19\n\x15\x41RRANGEMENT_NOT_FOUND\x10\x01\x12\x14\n\x10WINDOW_NOT_FOUND\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\"\xc1\x01\n\x0fVariableRequest\x12\x14\n\nsession_id\x18\x01 \x01(\tH\x00\x12\x10\n\x06tab_id\x18\x04 \x01(\tH\x00\x12\r\n\x03\x61pp\x18\x05 \x01(\x08H\x00\x12\x13\n\twindow_id\x18\x06 \x01(\tH\x00\x12(\n\x03set\x18\x02 \x03(\x0b\x32\x1b.iterm2.VariableRequest.Set\x12\x0b\n\x03get\x18\x03 \x03(\t\x1a\"\n\x03Set\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\tB\x07\n\x05scope\"\xe5\x01\n\x10VariableResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.VariableResponse.Status\x12\x0e\n\x06values\x18\x02 \x03(\t\"\x8f\x01\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x10\n\x0cINVALID_NAME\x10\x02\x12\x11\n\rMISSING_SCOPE\x10\x03\x12\x11\n\rTAB_NOT_FOUND\x10\x04\x12\x18\n\x14MULTI_GET_DISALLOWED\x10\x05\x12\x14\n\x10WINDOW_NOT_FOUND\x10\x06\"\x96\x02\n\x0f\x41\x63tivateRequest\x12\x13\n\twindow_id\x18\x01 \x01(\tH\x00\x12\x10\n\x06tab_id\x18\x02 \x01(\tH\x00\x12\x14\n\nsession_id\x18\x03 \x01(\tH\x00\x12\x1a\n\x12order_window_front\x18\x04 \x01(\x08\x12\x12\n\nselect_tab\x18\x05 \x01(\x08\x12\x16\n\x0eselect_session\x18\x06 \x01(\x08\x12\x31\n\x0c\x61\x63tivate_app\x18\x07 \x01(\x0b\x32\x1b.iterm2.ActivateRequest.App\x1a=\n\x03\x41pp\x12\x19\n\x11raise_all_windows\x18\x01 \x01(\x08\x12\x1b\n\x13ignoring_other_apps\x18\x02 \x01(\x08\x42\x0c\n\nidentifier\"}\n\x10\x41\x63tivateResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.ActivateResponse.Status\"8\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x12\n\x0e\x42\x41\x44_IDENTIFIER\x10\x01\x12\x12\n\x0eINVALID_OPTION\x10\x02\"1\n\rInjectRequest\x12\x12\n\nsession_id\x18\x01 \x03(\t\x12\x0c\n\x04\x64\x61ta\x18\x02 \x01(\x0c\"h\n\x0eInjectResponse\x12-\n\x06status\x18\x01 \x03(\x0e\x32\x1d.iterm2.InjectResponse.Status\"\'\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\"[\n\x12GetPropertyRequest\x12\x13\n\twindow_id\x18\x01 \x01(\tH\x00\x12\x14\n\nsession_id\x18\x03 \x01(\tH\x00\x12\x0c\n\x04name\x18\x02 \x01(\tB\x0c\n\nidentifier\"\x9a\x01\n\x13GetPropertyResponse\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.GetPropertyResponse.Status\x12\x12\n\njson_value\x18\x02 \x01(\t\";\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11UNRECOGNIZED_NAME\x10\x01\x12\x12\n\x0eINVALID_TARGET\x10\x02\"o\n\x12SetPropertyRequest\x12\x13\n\twindow_id\x18\x01 \x01(\tH\x00\x12\x14\n\nsession_id\x18\x05 \x01(\tH\x00\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x12\n\njson_value\x18\x04 \x01(\tB\x0c\n\nidentifier\"\xc3\x01\n\x13SetPropertyResponse\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.SetPropertyResponse.Status\"x\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11UNRECOGNIZED_NAME\x10\x01\x12\x11\n\rINVALID_VALUE\x10\x02\x12\x12\n\x0eINVALID_TARGET\x10\x03\x12\x0c\n\x08\x44\x45\x46\x45RRED\x10\x04\x12\x0e\n\nIMPOSSIBLE\x10\x05\x12\n\n\x06\x46\x41ILED\x10\x06\"\xd8\x01\n\x13RegisterToolRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\nidentifier\x18\x02 \x01(\t\x12+\n\x1creveal_if_already_registered\x18\x05 \x01(\x08:\x05\x66\x61lse\x12\x46\n\ttool_type\x18\x03 \x01(\x0e\x32$.iterm2.RegisterToolRequest.ToolType:\rWEB_VIEW_TOOL\x12\x0b\n\x03URL\x18\x04 \x01(\t\"\x1d\n\x08ToolType\x12\x11\n\rWEB_VIEW_TOOL\x10\x01\"\xdf\x0c\n\x16RPCRegistrationRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x46\n\targuments\x18\x02 \x03(\x0b\x32\x33.iterm2.RPCRegistrationRequest.RPCArgumentSignature\x12<\n\x08\x64\x65\x66\x61ults\x18\x04 \x03(\x0b\x32*.iterm2.RPCRegistrationRequest.RPCArgument\x12\x0f\n\x07timeout\x18\x03 \x01(\x02\x12:\n\x04role\x18\x05 \x01(\x0e\x32#.iterm2.RPCRegistrationRequest.Role:\x07GENERIC\x12Y\n\x18session_title_attributes\x18\x07 \x01(\x0b\x32\x35.iterm2.RPCRegistrationRequest.SessionTitleAttributesH\x00\x12\x66\n\x1fstatus_bar_component_attributes\x18\x08 \x01(\x0b\x32;.iterm2.RPCRegistrationRequest.StatusBarComponentAttributesH\x00\x12W\n\x17\x63ontext_menu_attributes\x18\t \x01(\x0b\x32\x34.iterm2.RPCRegistrationRequest.ContextMenuAttributesH\x00\x12\x18\n\x0c\x64isplay_name\x18\x06 \x01(\tB\x02\x18\x01\x1a$\n\x14RPCArgumentSignature\x12\x0c\n\x04name\x18\x01 \x01(\t\x1a)\n\x0bRPCArgument\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x1aI\n\x16SessionTitleAttributes\x12\x14\n\x0c\x64isplay_name\x18\x01 \x01(\t\x12\x19\n\x11unique_identifier\x18\x06 \x01(\t\x1a\xd9\x05\n\x1cStatusBarComponentAttributes\x12\x19\n\x11short_description\x18\x01 \x01(\t\x12\x1c\n\x14\x64\x65tailed_description\x18\x02 \x01(\t\x12O\n\x05knobs\x18\x03 \x03(\x0b\x32@.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Knob\x12\x10\n\x08\x65xemplar\x18\x04 \x01(\t\x12\x16\n\x0eupdate_cadence\x18\x05 \x01(\x02\x12\x19\n\x11unique_identifier\x18\x06 \x01(\t\x12O\n\x05icons\x18\x07 \x03(\x0b\x32@.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Icon\x12^\n\x06\x66ormat\x18\x08 \x01(\x0e\x32\x42.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Format:\nPLAIN_TEXT\x1a\xef\x01\n\x04Knob\x12\x0c\n\x04name\x18\x01 \x01(\t\x12S\n\x04type\x18\x02 \x01(\x0e\x32\x45.iterm2.RPCRegistrationRequest.StatusBarComponentAttributes.Knob.Type\x12\x13\n\x0bplaceholder\x18\x03 \x01(\t\x12\x1a\n\x12json_default_value\x18\x04 \x01(\t\x12\x0b\n\x03key\x18\x05 \x01(\t\"F\n\x04Type\x12\x0c\n\x08\x43heckbox\x10\x01\x12\n\n\x06String\x10\x02\x12\x19\n\x15PositiveFloatingPoint\x10\x03\x12\t\n\x05\x43olor\x10\x04\x1a#\n\x04Icon\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x0c\x12\r\n\x05scale\x18\x02 \x01(\x02\"\"\n\x06\x46ormat\x12\x0e\n\nPLAIN_TEXT\x10\x00\x12\x08\n\x04HTML\x10\x01\x1aH\n\x15\x43ontextMenuAttributes\x12\x14\n\x0c\x64isplay_name\x18\x01 \x01(\t\x12\x19\n\x11unique_identifier\x18\x02 \x01(\t\"R\n\x04Role\x12\x0b\n\x07GENERIC\x10\x01\x12\x11\n\rSESSION_TITLE\x10\x02\x12\x18\n\x14STATUS_BAR_COMPONENT\x10\x03\x12\x10\n\x0c\x43ONTEXT_MENU\x10\x04\x42\x18\n\x16RoleSpecificAttributes\"\x8b\x01\n\x14RegisterToolResponse\x12\x33\n\x06status\x18\x01 \x01(\x0e\x32#.iterm2.RegisterToolResponse.Status\">\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11REQUEST_MALFORMED\x10\x01\x12\x15\n\x11PERMISSION_DENIED\x10\x02\"\xbe\x01\n\x10KeystrokePattern\x12-\n\x12required_modifiers\x18\x01 \x03(\x0e\x32\x11.iterm2.Modifiers\x12.\n\x13\x66orbidden_modifiers\x18\x02 \x03(\x0e\x32\x11.iterm2.Modifiers\x12\x10\n\x08keycodes\x18\x03 \x03(\x05\x12\x12\n\ncharacters\x18\x04 \x03(\t\x12%\n\x1d\x63haracters_ignoring_modifiers\x18\x05 \x03(\t\"e\n\x17KeystrokeMonitorRequest\x12\x38\n\x12patterns_to_ignore\x18\x01 \x03(\x0b\x32\x18.iterm2.KeystrokePatternB\x02\x18\x01\x12\x10\n\x08\x61\x64vanced\x18\x02 \x01(\x08\"N\n\x16KeystrokeFilterRequest\x12\x34\n\x12patterns_to_ignore\x18\x01 \x03(\x0b\x32\x18.iterm2.KeystrokePattern\"`\n\x16VariableMonitorRequest\x12\x0c\n\x04name\x18\x01 \x01(\t\x12$\n\x05scope\x18\x02 \x01(\x0e\x32\x15.iterm2.VariableScope\x12\x12\n\nidentifier\x18\x03 \x01(\t\"$\n\x14ProfileChangeRequest\x12\x0c\n\x04guid\x18\x01 \x01(\t\"@\n\x14PromptMonitorRequest\x12(\n\x05modes\x18\x01 \x03(\x0e\x32\x19.iterm2.PromptMonitorMode\"T\n\x1aScreenUpdateMonitorRequest\x12\x0e\n\x06\x64\x65ltas\x18\x01 \x01(\x08\x12\x16\n\x0einclude_styles\x18\x02 \x01(\x08\x12\x0e\n\x06resync\x18\x03 \x01(\x08\"\x8a\x05\n\x13NotificationRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x11\n\tsubscribe\x18\x02 \x01(\x08\x12\x33\n\x11notification_type\x18\x03 \x01(\x0e\x32\x18.iterm2.NotificationType\x12\x42\n\x18rpc_registration_request\x18\x04 \x01(\x0b\x32\x1e.iterm2.RPCRegistrationRequestH\x00\x12\x44\n\x19keystroke_monitor_request\x18\x05 \x01(\x0b\x32\x1f.iterm2.KeystrokeMonitorRequestH\x00\x12\x42\n\x18variable_monitor_request\x18\x06 \x01(\x0b\x32\x1e.iterm2.VariableMonitorRequestH\x00\x12>\n\x16profile_change_request\x18\x07 \x01(\x0b\x32\x1c.iterm2.ProfileChangeRequestH\x00\x12\x42\n\x18keystroke_filter_request\x18\x08 \x01(\x0b\x32\x1e.iterm2.KeystrokeFilterRequestH\x00\x12>\n\x16prompt_monitor_request\x18\t \x01(\x0b\x32\x1c.iterm2.PromptMonitorRequestH\x00\x12K\n\x1dscreen_update_monitor_request\x18\n \x01(\x0b\x32\".iterm2.ScreenUpdateMonitorRequestH\x00\x12\x1c\n\x14\x63oalescing_window_ms\x18\x0b \x01(\r\x12\x10\n\x08max_rate\x18\x0c \x01(\x01\x42\x0b\n\targuments\"\xf5\x01\n\x14NotificationResponse\x12\x33\n\x06status\x18\x01 \x01(\x0e\x32#.iterm2.NotificationResponse.Status\"\xa7\x01\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x12\n\x0eNOT_SUBSCRIBED\x10\x03\x12\x16\n\x12\x41LREADY_SUBSCRIBED\x10\x04\x12#\n\x1f\x44UPLICATE_SERVER_ORIGINATED_RPC\x10\x05\x12\x16\n\x12INVALID_IDENTIFIER\x10\x06\"\xe3\x07\n\x0cNotification\x12=\n\x16keystroke_notification\x18\x01 \x01(\x0b\x32\x1d.iterm2.KeystrokeNotification\x12\x44\n\x1ascreen_update_notification\x18\x02 \x01(\x0b\x32 .iterm2.ScreenUpdateNotification\x12\x37\n\x13prompt_notification\x18\x03 \x01(\x0b\x32\x1a.iterm2.PromptNotification\x12L\n\x1clocation_change_notification\x18\x04 \x01(\x0b\x32\".iterm2.LocationChangeNotificationB\x02\x18\x01\x12U\n#custom_escape_sequence_notification\x18\x05 \x01(\x0b\x32(.iterm2.CustomEscapeSequenceNotification\x12@\n\x18new_session_notification\x18\x06 \x01(\x0b\x32\x1e.iterm2.NewSessionNotification\x12L\n\x1eterminate_session_notification\x18\x07 \x01(\x0b\x32$.iterm2.TerminateSessionNotification\x12\x46\n\x1blayout_changed_notification\x18\x08 \x01(\x0b\x32!.iterm2.LayoutChangedNotification\x12\x44\n\x1a\x66ocus_changed_notification\x18\t \x01(\x0b\x32 .iterm2.FocusChangedNotification\x12S\n\"server_originated_rpc_notification\x18\n \x01(\x0b\x32\'.iterm2.ServerOriginatedRPCNotification\x12N\n\x19\x62roadcast_domains_changed\x18\x0b \x01(\x0b\x32+.iterm2.BroadcastDomainsChangedNotification\x12J\n\x1dvariable_changed_notification\x18\x0c \x01(\x0b\x32#.iterm2.VariableChangedNotification\x12H\n\x1cprofile_changed_notification\x18\r \x01(\x0b\x32\".iterm2.ProfileChangedNotification\x12\x17\n\x0f\x63oalesced_count\x18\x0e \x01(\r\"*\n\x1aProfileChangedNotification\x12\x0c\n\x04guid\x18\x01 \x01(\t\"}\n\x1bVariableChangedNotification\x12$\n\x05scope\x18\x01 \x01(\x0e\x32\x15.iterm2.VariableScope\x12\x12\n\nidentifier\x18\x02 \x01(\t\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x16\n\x0ejson_new_value\x18\x04 \x01(\t\"Y\n#BroadcastDomainsChangedNotification\x12\x32\n\x11\x62roadcast_domains\x18\x01 \x03(\x0b\x32\x17.iterm2.BroadcastDomain\"\x90\x01\n\x13ServerOriginatedRPC\x12\x0c\n\x04name\x18\x02 \x01(\t\x12:\n\targuments\x18\x03 \x03(\x0b\x32\'.iterm2.ServerOriginatedRPC.RPCArgument\x1a/\n\x0bRPCArgument\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\t\"_\n\x1fServerOriginatedRPCNotification\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12(\n\x03rpc\x18\x02 \x01(\x0b\x32\x1b.iterm2.ServerOriginatedRPC\"\x85\x02\n\x15KeystrokeNotification\x12\x12\n\ncharacters\x18\x01 \x01(\t\x12#\n\x1b\x63haractersIgnoringModifiers\x18\x02 \x01(\t\x12$\n\tmodifiers\x18\x03 \x03(\x0e\x32\x11.iterm2.Modifiers\x12\x0f\n\x07keyCode\x18\x04 \x01(\x05\x12\x0f\n\x07session\x18\x05 \x01(\t\x12\x34\n\x06\x61\x63tion\x18\x06 \x01(\x0e\x32$.iterm2.KeystrokeNotification.Action\"5\n\x06\x41\x63tion\x12\x0c\n\x08KEY_DOWN\x10\x00\x12\n\n\x06KEY_UP\x10\x01\x12\x11\n\rFLAGS_CHANGED\x10\x02\"U\n\x18ScreenUpdateNotification\x12\x0f\n\x07session\x18\x01 \x01(\t\x12(\n\x05\x64\x65lta\x18\x02 \x01(\x0b\x32\x19.iterm2.ScreenUpdateDelta\"\xc0\x01\n\x11ScreenUpdateDelta\x12\x17\n\x0fsequence_number\x18\x01 \x01(\x03\x12\x14\n\x0c\x66ull_refresh\x18\x02 \x01(\x08\x12\x1a\n\x04size\x18\x03 \x01(\x0b\x32\x0c.iterm2.Size\x12\x19\n\x11\x66irst_line_number\x18\x04 \x01(\x03\x12&\n\x05lines\x18\x05 \x03(\x0b\x32\x17.iterm2.ScreenLineDelta\x12\x1d\n\x06\x63ursor\x18\x06 \x01(\x0b\x32\r.iterm2.Coord\"_\n\x0fScreenLineDelta\x12\t\n\x01y\x18\x01 \x01(\x05\x12\t\n\x01x\x18\x02 \x01(\x05\x12\x0e\n\x06length\x18\x03 \x01(\x05\x12&\n\x08\x63ontents\x18\x04 \x01(\x0b\x32\x14.iterm2.LineContents\"Z\n\x18PromptNotificationPrompt\x12\x13\n\x0bplaceholder\x18\x01 \x01(\t\x12)\n\x06prompt\x18\x02 \x01(\x0b\x32\x19.iterm2.GetPromptResponse\"1\n\x1ePromptNotificationCommandStart\x12\x0f\n\x07\x63ommand\x18\x01 \x01(\t\".\n\x1cPromptNotificationCommandEnd\x12\x0e\n\x06status\x18\x01 \x01(\x05\"\xfa\x01\n\x12PromptNotification\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x32\n\x06prompt\x18\x02 \x01(\x0b\x32 .iterm2.PromptNotificationPromptH\x00\x12?\n\rcommand_start\x18\x03 \x01(\x0b\x32&.iterm2.PromptNotificationCommandStartH\x00\x12;\n\x0b\x63ommand_end\x18\x04 \x01(\x0b\x32$.iterm2.PromptNotificationCommandEndH\x00\x12\x18\n\x10unique_prompt_id\x18\x05 \x01(\tB\x07\n\x05\x65vent\"f\n\x1aLocationChangeNotification\x12\x11\n\thost_name\x18\x01 \x01(\t\x12\x11\n\tuser_name\x18\x02 \x01(\t\x12\x11\n\tdirectory\x18\x03 \x01(\t\x12\x0f\n\x07session\x18\x04 \x01(\t\"]\n CustomEscapeSequenceNotification\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x17\n\x0fsender_identity\x18\x02 \x01(\t\x12\x0f\n\x07payload\x18\x03 \x01(\t\",\n\x16NewSessionNotification\x12\x12\n\nsession_id\x18\x01 \x01(\t\"\x84\x03\n\x18\x46ocusChangedNotification\x12\x1c\n\x12\x61pplication_active\x18\x01 \x01(\x08H\x00\x12\x39\n\x06window\x18\x02 \x01(\x0b\x32\'.iterm2.FocusChangedNotification.WindowH\x00\x12\x16\n\x0cselected_tab\x18\x03 \x01(\tH\x00\x12\x11\n\x07session\x18\x04 \x01(\tH\x00\x1a\xda\x01\n\x06Window\x12K\n\rwindow_status\x18\x01 \x01(\x0e\x32\x34.iterm2.FocusChangedNotification.Window.WindowStatus\x12\x11\n\twindow_id\x18\x02 \x01(\t\"p\n\x0cWindowStatus\x12\x1e\n\x1aTERMINAL_WINDOW_BECAME_KEY\x10\x00\x12\x1e\n\x1aTERMINAL_WINDOW_IS_CURRENT\x10\x01\x12 \n\x1cTERMINAL_WINDOW_RESIGNED_KEY\x10\x02\x42\x07\n\x05\x65vent\"2\n\x1cTerminateSessionNotification\x12\x12\n\nsession_id\x18\x01 \x01(\t\"Y\n\x19LayoutChangedNotification\x12<\n\x16list_sessions_response\x18\x01 \x01(\x0b\x32\x1c.iterm2.ListSessionsResponse\"b\n\x10GetBufferRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12%\n\nline_range\x18\x02 \x01(\x0b\x32\x11.iterm2.LineRange\x12\x16\n\x0einclude_styles\x18\x03 \x01(\x08\"\xe8\x02\n\x11GetBufferResponse\x12\x34\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.GetBufferResponse.Status:\x02OK\x12 \n\x05range\x18\x02 \x01(\x0b\x32\r.iterm2.RangeB\x02\x18\x01\x12&\n\x08\x63ontents\x18\x03 \x03(\x0b\x32\x14.iterm2.LineContents\x12\x1d\n\x06\x63ursor\x18\x04 \x01(\x0b\x32\r.iterm2.Coord\x12\"\n\x16num_lines_above_screen\x18\x05 \x01(\x03\x42\x02\x18\x01\x12\x38\n\x14windowed_coord_range\x18\x06 \x01(\x0b\x32\x1a.iterm2.WindowedCoordRange\"V\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x16\n\x12INVALID_LINE_RANGE\x10\x02\x12\x15\n\x11REQUEST_MALFORMED\x10\x03\"=\n\x10GetPromptRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x18\n\x10unique_prompt_id\x18\x02 \x01(\t\"\xe3\x03\n\x11GetPromptResponse\x12\x34\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.GetPromptResponse.Status:\x02OK\x12(\n\x0cprompt_range\x18\x02 \x01(\x0b\x32\x12.iterm2.CoordRange\x12)\n\rcommand_range\x18\x03 \x01(\x0b\x32\x12.iterm2.CoordRange\x12(\n\x0coutput_range\x18\x04 \x01(\x0b\x32\x12.iterm2.CoordRange\x12\x19\n\x11working_directory\x18\x05 \x01(\t\x12\x0f\n\x07\x63ommand\x18\x06 \x01(\t\x12\x35\n\x0cprompt_state\x18\x07 \x01(\x0e\x32\x1f.iterm2.GetPromptResponse.State\x12\x13\n\x0b\x65xit_status\x18\t \x01(\r\x12\x18\n\x10unique_prompt_id\x18\n \x01(\t\"V\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x16\n\x12PROMPT_UNAVAILABLE\x10\x03\"/\n\x05State\x12\x0b\n\x07\x45\x44ITING\x10\x00\x12\x0b\n\x07RUNNING\x10\x01\x12\x0c\n\x08\x46INISHED\x10\x02\"V\n\x12ListPromptsRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x17\n\x0f\x66irst_unique_id\x18\x02 \x01(\t\x12\x16\n\x0elast_unique_id\x18\x03 \x01(\t\"\x90\x01\n\x13ListPromptsResponse\x12\x36\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.ListPromptsResponse.Status:\x02OK\x12\x18\n\x10unique_prompt_id\x18\x02 \x03(\t\"\'\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\"\x8a\x01\n\x17\x45xportScrollbackRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12,\n\x08position\x18\x02 \x01(\x0b\x32\x1a.iterm2.ScrollbackPosition\x12\x18\n\tmax_cells\x18\x03 \x01(\x05:\x05\x36\x35\x35\x33\x36\x12\x16\n\x0einclude_styles\x18\x04 \x01(\x08\"A\n\x12ScrollbackPosition\x12\x19\n\x11\x61\x62solute_position\x18\x01 \x01(\x03\x12\x10\n\x08y_offset\x18\x02 \x01(\x05\"\xe7\x03\n\x18\x45xportScrollbackResponse\x12;\n\x06status\x18\x01 \x01(\x0e\x32\'.iterm2.ExportScrollbackResponse.Status:\x02OK\x12,\n\x08position\x18\x02 \x01(\x0b\x32\x1a.iterm2.ScrollbackPosition\x12\x31\n\rnext_position\x18\x03 \x01(\x0b\x32\x1a.iterm2.ScrollbackPosition\x12\x0e\n\x06\x61t_end\x18\x04 \x01(\x08\x12\x16\n\x0e\x63ontinues_line\x18\x05 \x01(\x08\x12\x0c\n\x04text\x18\x06 \x01(\t\x12\x18\n\x0cline_lengths\x18\x07 \x03(\x05\x42\x02\x10\x01\x12\x37\n\x14\x63ode_points_per_cell\x18\x08 \x03(\x0b\x32\x19.iterm2.CodePointsPerCell\x12&\n\x0bstyle_table\x18\t \x03(\x0b\x32\x11.iterm2.CellStyle\x12\x1d\n\x11style_run_lengths\x18\n \x03(\x05\x42\x02\x10\x01\x12\x1d\n\x11style_run_indexes\x18\x0b \x03(\x05\x42\x02\x10\x01\">\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\":\n\x19GetProfilePropertyRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x0c\n\x04keys\x18\x02 \x03(\t\"2\n\x0fProfileProperty\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\t\"\xd3\x01\n\x1aGetProfilePropertyResponse\x12=\n\x06status\x18\x01 \x01(\x0e\x32).iterm2.GetProfilePropertyResponse.Status:\x02OK\x12+\n\nproperties\x18\x03 \x03(\x0b\x32\x17.iterm2.ProfileProperty\"I\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\t\n\x05\x45RROR\x10\x03\"\xa7\x02\n\x19SetProfilePropertyRequest\x12\x11\n\x07session\x18\x01 \x01(\tH\x00\x12?\n\tguid_list\x18\x02 \x01(\x0b\x32*.iterm2.SetProfilePropertyRequest.GuidListH\x00\x12\x0b\n\x03key\x18\x03 \x01(\t\x12\x12\n\njson_value\x18\x04 \x01(\t\x12\x41\n\x0b\x61ssignments\x18\x05 \x03(\x0b\x32,.iterm2.SetProfilePropertyRequest.Assignment\x1a\x19\n\x08GuidList\x12\r\n\x05guids\x18\x01 \x03(\t\x1a-\n\nAssignment\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\x12\n\njson_value\x18\x02 \x01(\tB\x08\n\x06target\"\xa9\x01\n\x1aSetProfilePropertyResponse\x12=\n\x06status\x18\x01 \x01(\x0e\x32).iterm2.SetProfilePropertyResponse.Status:\x02OK\"L\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x15\n\x11REQUEST_MALFORMED\x10\x02\x12\x0c\n\x08\x42\x41\x44_GUID\x10\x03\"#\n\x12TransactionRequest\x12\r\n\x05\x62\x65gin\x18\x01 \x01(\x08\"\x8f\x01\n\x13TransactionResponse\x12\x36\n\x06status\x18\x01 \x01(\x0e\x32\".iterm2.TransactionResponse.Status:\x02OK\"@\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x12\n\x0eNO_TRANSACTION\x10\x01\x12\x1a\n\x16\x41LREADY_IN_TRANSACTION\x10\x02\"{\n\tLineRange\x12\x1c\n\x14screen_contents_only\x18\x01 \x01(\x08\x12\x16\n\x0etrailing_lines\x18\x02 \x01(\x05\x12\x38\n\x14windowed_coord_range\x18\x03 \x01(\x0b\x32\x1a.iterm2.WindowedCoordRange\")\n\x05Range\x12\x10\n\x08location\x18\x01 \x01(\x03\x12\x0e\n\x06length\x18\x02 \x01(\x03\"F\n\nCoordRange\x12\x1c\n\x05start\x18\x01 \x01(\x0b\x32\r.iterm2.Coord\x12\x1a\n\x03\x65nd\x18\x02 \x01(\x0b\x32\r.iterm2.Coord\"\x1d\n\x05\x43oord\x12\t\n\x01x\x18\x01 \x01(\x05\x12\t\n\x01y\x18\x02 \x01(\x03\"4\n\x08RGBColor\x12\x0b\n\x03red\x18\x01 \x01(\r\x12\r\n\x05green\x18\x02 \x01(\r\x12\x0c\n\x04\x62lue\x18\x03 \x01(\r\"&\n\x03URL\x12\x0b\n\x03url\x18\x01 \x01(\t\x12\x12\n\nidentifier\x18\x02 \x01(\t\"\xe1\x04\n\tCellStyle\x12\x14\n\nfgStandard\x18\x01 \x01(\rH\x00\x12-\n\x0b\x66gAlternate\x18\x02 \x01(\x0e\x32\x16.iterm2.AlternateColorH\x00\x12!\n\x05\x66gRgb\x18\x03 \x01(\x0b\x32\x10.iterm2.RGBColorH\x00\x12\x1f\n\x15\x66gAlternatePlacementX\x18\x04 \x01(\rH\x00\x12\x14\n\nbgStandard\x18\x05 \x01(\rH\x01\x12-\n\x0b\x62gAlternate\x18\x06 \x01(\x0e\x32\x16.iterm2.AlternateColorH\x01\x12!\n\x05\x62gRgb\x18\x07 \x01(\x0b\x32\x10.iterm2.RGBColorH\x01\x12\x1f\n\x15\x62gAlternatePlacementY\x18\x08 \x01(\rH\x01\x12\x0c\n\x04\x62old\x18\t \x01(\x08\x12\r\n\x05\x66\x61int\x18\n \x01(\x08\x12\x0e\n\x06italic\x18\x0b \x01(\x08\x12\r\n\x05\x62link\x18\x0c \x01(\x08\x12\x11\n\tunderline\x18\r \x01(\x08\x12\x15\n\rstrikethrough\x18\x0e \x01(\x08\x12\x11\n\tinvisible\x18\x0f \x01(\x08\x12\x0f\n\x07inverse\x18\x10 \x01(\x08\x12\x0f\n\x07guarded\x18\x11 \x01(\x08\x12+\n\x05image\x18\x12 \x01(\x0e\x32\x1c.iterm2.ImagePlaceholderType\x12(\n\x0eunderlineColor\x18\x13 \x01(\x0b\x32\x10.iterm2.RGBColor\x12\x0f\n\x07\x62lockID\x18\x14 \x01(\t\x12\x18\n\x03url\x18\x15 \x01(\x0b\x32\x0b.iterm2.URL\x12\x0f\n\x07repeats\x18\x16 \x01(\rB\t\n\x07\x66gColorB\t\n\x07\x62gColor\"\x8d\x02\n\x0cLineContents\x12\x0c\n\x04text\x18\x01 \x01(\t\x12\x37\n\x14\x63ode_points_per_cell\x18\x02 \x03(\x0b\x32\x19.iterm2.CodePointsPerCell\x12N\n\x0c\x63ontinuation\x18\x03 \x01(\x0e\x32!.iterm2.LineContents.Continuation:\x15\x43ONTINUATION_HARD_EOL\x12 \n\x05style\x18\x04 \x03(\x0b\x32\x11.iterm2.CellStyle\"D\n\x0c\x43ontinuation\x12\x19\n\x15\x43ONTINUATION_HARD_EOL\x10\x01\x12\x19\n\x15\x43ONTINUATION_SOFT_EOL\x10\x02\"@\n\x11\x43odePointsPerCell\x12\x1a\n\x0fnum_code_points\x18\x01 \x01(\x05:\x01\x31\x12\x0f\n\x07repeats\x18\x02 \x01(\x05\"\x15\n\x13ListSessionsRequest\"L\n\x0fSendTextRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12\x0c\n\x04text\x18\x02 \x01(\t\x12\x1a\n\x12suppress_broadcast\x18\x03 \x01(\x08\"l\n\x10SendTextResponse\x12/\n\x06status\x18\x01 \x01(\x0e\x32\x1f.iterm2.SendTextResponse.Status\"\'\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\"%\n\x04Size\x12\r\n\x05width\x18\x01 \x01(\x05\x12\x0e\n\x06height\x18\x02 \x01(\x05\"\x1d\n\x05Point\x12\t\n\x01x\x18\x01 \x01(\x05\x12\t\n\x01y\x18\x02 \x01(\x05\"B\n\x05\x46rame\x12\x1d\n\x06origin\x18\x01 \x01(\x0b\x32\r.iterm2.Point\x12\x1a\n\x04size\x18\x02 \x01(\x0b\x32\x0c.iterm2.Size\"y\n\x0eSessionSummary\x12\x19\n\x11unique_identifier\x18\x01 \x01(\t\x12\x1c\n\x05\x66rame\x18\x02 \x01(\x0b\x32\r.iterm2.Frame\x12\x1f\n\tgrid_size\x18\x03 \x01(\x0b\x32\x0c.iterm2.Size\x12\r\n\x05title\x18\x04 \x01(\t\"\xc1\x01\n\rSplitTreeNode\x12\x10\n\x08vertical\x18\x01 \x01(\x08\x12\x32\n\x05links\x18\x02 \x03(\x0b\x32#.iterm2.SplitTreeNode.SplitTreeLink\x1aj\n\rSplitTreeLink\x12)\n\x07session\x18\x01 \x01(\x0b\x32\x16.iterm2.SessionSummaryH\x00\x12%\n\x04node\x18\x02 \x01(\x0b\x32\x15.iterm2.SplitTreeNodeH\x00\x42\x07\n\x05\x63hild\"\x9d\x03\n\x14ListSessionsResponse\x12\x34\n\x07windows\x18\x01 \x03(\x0b\x32#.iterm2.ListSessionsResponse.Window\x12/\n\x0f\x62uried_sessions\x18\x02 \x03(\x0b\x32\x16.iterm2.SessionSummary\x1ay\n\x06Window\x12.\n\x04tabs\x18\x01 \x03(\x0b\x32 .iterm2.ListSessionsResponse.Tab\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x1c\n\x05\x66rame\x18\x03 \x01(\x0b\x32\r.iterm2.Frame\x12\x0e\n\x06number\x18\x04 \x01(\x05\x1a\xa2\x01\n\x03Tab\x12#\n\x04root\x18\x03 \x01(\x0b\x32\x15.iterm2.SplitTreeNode\x12\x0e\n\x06tab_id\x18\x02 \x01(\t\x12\x16\n\x0etmux_window_id\x18\x04 \x01(\t\x12\x1a\n\x12tmux_connection_id\x18\x05 \x01(\t\x12\x32\n\x12minimized_sessions\x18\x06 \x03(\x0b\x32\x16.iterm2.SessionSummary\"\x9f\x01\n\x10\x43reateTabRequest\x12\x14\n\x0cprofile_name\x18\x01 \x01(\t\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x11\n\ttab_index\x18\x03 \x01(\r\x12\x13\n\x07\x63ommand\x18\x04 \x01(\tB\x02\x18\x01\x12:\n\x19\x63ustom_profile_properties\x18\x05 \x03(\x0b\x32\x17.iterm2.ProfileProperty\"\xf0\x01\n\x11\x43reateTabResponse\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.CreateTabResponse.Status\x12\x11\n\twindow_id\x18\x02 \x01(\t\x12\x0e\n\x06tab_id\x18\x03 \x01(\x05\x12\x12\n\nsession_id\x18\x04 \x01(\t\"r\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x18\n\x14INVALID_PROFILE_NAME\x10\x01\x12\x15\n\x11INVALID_WINDOW_ID\x10\x02\x12\x15\n\x11INVALID_TAB_INDEX\x10\x03\x12\x18\n\x14MISSING_SUBSTITUTION\x10\x04\"\xfe\x01\n\x10SplitPaneRequest\x12\x0f\n\x07session\x18\x01 \x01(\t\x12@\n\x0fsplit_direction\x18\x02 \x01(\x0e\x32\'.iterm2.SplitPaneRequest.SplitDirection\x12\x15\n\x06\x62\x65\x66ore\x18\x03 \x01(\x08:\x05\x66\x61lse\x12\x14\n\x0cprofile_name\x18\x04 \x01(\t\x12:\n\x19\x63ustom_profile_properties\x18\x05 \x03(\x0b\x32\x17.iterm2.ProfileProperty\".\n\x0eSplitDirection\x12\x0c\n\x08VERTICAL\x10\x00\x12\x0e\n\nHORIZONTAL\x10\x01\"\xd5\x01\n\x11SplitPaneResponse\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .iterm2.SplitPaneResponse.Status\x12\x12\n\nsession_id\x18\x02 \x03(\t\"z\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x15\n\x11SESSION_NOT_FOUND\x10\x01\x12\x18\n\x14INVALID_PROFILE_NAME\x10\x02\x12\x10\n\x0c\x43\x41NNOT_SPLIT\x10\x03\x12%\n!MALFORMED_CUSTOM_PROFILE_PROPERTY\x10\x04*V\n\rSelectionMode\x12\r\n\tCHARACTER\x10\x00\x12\x08\n\x04WORD\x10\x01\x12\x08\n\x04LINE\x10\x02\x12\t\n\x05SMART\x10\x03\x12\x07\n\x03\x42OX\x10\x04\x12\x0e\n\nWHOLE_LINE\x10\x05*\xb4\x03\n\x10NotificationType\x12\x17\n\x13NOTIFY_ON_KEYSTROKE\x10\x01\x12\x1b\n\x17NOTIFY_ON_SCREEN_UPDATE\x10\x02\x12\x14\n\x10NOTIFY_ON_PROMPT\x10\x03\x12!\n\x19NOTIFY_ON_LOCATION_CHANGE\x10\x04\x1a\x02\x08\x01\x12$\n NOTIFY_ON_CUSTOM_ESCAPE_SEQUENCE\x10\x05\x12\x1d\n\x19NOTIFY_ON_VARIABLE_CHANGE\x10\x0c\x12\x14\n\x10KEYSTROKE_FILTER\x10\x0e\x12\x19\n\x15NOTIFY_ON_NEW_SESSION\x10\x06\x12\x1f\n\x1bNOTIFY_ON_TERMINATE_SESSION\x10\x07\x12\x1b\n\x17NOTIFY_ON_LAYOUT_CHANGE\x10\x08\x12\x1a\n\x16NOTIFY_ON_FOCUS_CHANGE\x10\t\x12#\n\x1fNOTIFY_ON_SERVER_ORIGINATED_RPC\x10\n\x12\x1e\n\x1aNOTIFY_ON_BROADCAST_CHANGE\x10\x0b\x12\x1c\n\x18NOTIFY_ON_PROFILE_CHANGE\x10\r*V\n\tModifiers\x12\x0b\n\x07\x43ONTROL\x10\x01\x12\n\n\x06OPTION\x10\x02\x12\x0b\n\x07\x43OMMAND\x10\x03\x12\t\n\x05SHIFT\x10\x04\x12\x0c\n\x08\x46UNCTION\x10\x05\x12\n\n\x06NUMPAD\x10\x06*:\n\rVariableScope\x12\x0b\n\x07SESSION\x10\x01\x12\x07\n\x03TAB\x10\x02\x12\n\n\x06WINDOW\x10\x03\x12\x07\n\x03\x41PP\x10\x04*C\n\x11PromptMonitorMode\x12\n\n\x06PROMPT\x10\x01\x12\x11\n\rCOMMAND_START\x10\x02\x12\x0f\n\x0b\x43OMMAND_END\x10\x03*G\n\x0e\x41lternateColor\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\x14\n\x10REVERSED_DEFAULT\x10\x03\x12\x12\n\x0eSYSTEM_MESSAGE\x10\x04*7\n\x14ImagePlaceholderType\x12\x08\n\x04NONE\x10\x00\x12\n\n\x06ITERM2\x10\x01\x12\t\n\x05KITTY\x10\x02\x42\x06\xa2\x02\x03ITM')
 
 _SELECTIONMODE = DESCRIPTOR.enum_types_by_name['SelectionMode']
 SelectionMode = enum_type_wrapper.EnumTypeWrapper(_SELECTIONMODE)
@@ -182,6 +182,7 @@ _KEYSTROKEFILTERREQUEST = DESCRIPTOR.message_types_by_name['KeystrokeFilterReque
 _VARIABLEMONITORREQUEST = DESCRIPTOR.message_types_by_name['VariableMonitorRequest']
 _PROFILECHANGEREQUEST = DESCRIPTOR.message_types_by_name['ProfileChangeRequest']
 _PROMPTMONITORREQUEST = DESCRIPTOR.message_types_by_name['PromptMonitorRequest']
+_SCREENUPDATEMONITORREQUEST = DESCRIPTOR.message_types_by_name['ScreenUpdateMonitorRequest']
 _NOTIFICATIONREQUEST = DESCRIPTOR.message_types_by_name['NotificationRequest']
 _NOTIFICATIONRESPONSE = DESCRIPTOR.message_types_by_name['NotificationResponse']
 _NOTIFICATION = DESCRIPTOR.message_types_by_name['Notification']
@@ -193,6 +194,8 @@ _SERVERORIGINATEDRPC_RPCARGUMENT = _SERVERORIGINATEDRPC.nested_types_by_name['RP
 _SERVERORIGINATEDRPCNOTIFICATION = DESCRIPTOR.message_types_by_name['ServerOriginatedRPCNotification']
 _KEYSTROKENOTIFICATION = DESCRIPTOR.message_types_by_name['KeystrokeNotification']
 _SCREENUPDATENOTIFICATION = DESCRIPTOR.message_types_by_name['ScreenUpdateNotification']
+_SCREENUPDATEDELTA = DESCRIPTOR.message_types_by_name['ScreenUpdateDelta']
+_SCREENLINEDELTA = DESCRIPTOR.message_types_by_name['ScreenLineDelta']
 _PROMPTNOTIFICATIONPROMPT = DESCRIPTOR.message_types_by_name['PromptNotificationPrompt']
 _PROMPTNOTIFICATIONCOMMANDSTART = DESCRIPTOR.message_types_by_name['PromptNotificationCommandStart']
 _PROMPTNOTIFICATIONCOMMANDEND = DESCRIPTOR.message_types_by_name['PromptNotificationCommandEnd']
@@ -210,6 +213,9 @@ _GETPROMPTREQUEST = DESCRIPTOR.message_types_by_name['GetPromptRequest']
 _GETPROMPTRESPONSE = DESCRIPTOR.message_types_by_name['GetPromptResponse']
 _LISTPROMPTSREQUEST = DESCRIPTOR.message_types_by_name['ListPromptsRequest']
 _LISTPROMPTSRESPONSE = DESCRIPTOR.message_types_by_name['ListPromptsResponse']
+_EXPORTSCROLLBACKREQUEST = DESCRIPTOR.message_types_by_name['ExportScrollbackRequest']
+_SCROLLBACKPOSITION = DESCRIPTOR.message_types_by_name['ScrollbackPosition']
+_EXPORTSCROLLBACKRESPONSE = DESCRIPTOR.message_types_by_name['ExportScrollbackResponse']
 _GETPROFILEPROPERTYREQUEST = DESCRIPTOR.message_types_by_name['GetProfilePropertyRequest']
 _PROFILEPROPERTY = DESCRIPTOR.message_types_by_name['ProfileProperty']
 _GETPROFILEPROPERTYRESPONSE = DESCRIPTOR.message_types_by_name['GetProfilePropertyResponse']
@@ -276,6 +282,7 @@ _GETBUFFERRESPONSE_STATUS = _GETBUFFERRESPONSE.enum_types_by_name['Status']
 _GETPROMPTRESPONSE_STATUS = _GETPROMPTRESPONSE.enum_types_by_name['Status']
 _GETPROMPTRESPONSE_STATE = _GETPROMPTRESPONSE.enum_types_by_name['State']
 _LISTPROMPTSRESPONSE_STATUS = _LISTPROMPTSRESPONSE.enum_types_by_name['Status']
+_EXPORTSCROLLBACKRESPONSE_STATUS = _EXPORTSCROLLBACKRESPONSE.enum_types_by_name['Status']
 _GETPROFILEPROPERTYRESPONSE_STATUS = _GETPROFILEPROPERTYRESPONSE.enum_types_by_name['Status']
 _SETPROFILEPROPERTYRESPONSE_STATUS = _SETPROFILEPROPERTYRESPONSE.enum_types_by_name['Status']
 _TRANSACTIONRESPONSE_STATUS = _TRANSACTIONRESPONSE.enum_types_by_name['Status']
@@ -1105,6 +1112,13 @@ PromptMonitorRequest = _reflection.GeneratedProtocolMessageType('PromptMonitorRe
   })
 _sym_db.RegisterMessage(PromptMonitorRequest)
 
+ScreenUpdateMonitorRequest = _reflection.GeneratedProtocolMessageType('ScreenUpdateMonitorRequest', (_message.Message,), {
+  'DESCRIPTOR' : _SCREENUPDATEMONITORREQUEST,
+  '__module__' : 'api_pb2'
+  # @@protoc_insertion_point(class_scope:iterm2.ScreenUpdateMonitorRequest)
+  })
+_sym_db.RegisterMessage(ScreenUpdateMonitorRequest)
+
 NotificationRequest = _reflection.GeneratedProtocolMessageType('NotificationRequest', (_message.Message,), {
   'DESCRIPTOR' : _NOTIFICATIONREQUEST,
   '__module__' : 'api_pb2'
@@ -1183,6 +1197,20 @@ ScreenUpdateNotification = _reflection.GeneratedProtocolMessageType('ScreenUpdat
   })
 _sym_db.RegisterMessage(ScreenUpdateNotification)
 
+ScreenUpdateDelta = _reflection.GeneratedProtocolMessageType('ScreenUpdateDelta', (_message.Message,), {
+  'DESCRIPTOR' : _SCREENUPDATEDELTA,
+  '__module__' : 'api_pb2'
+  # @@protoc_insertion_point(class_scope:iterm2.ScreenUpdateDelta)
+  })
+_sym_db.RegisterMessage(ScreenUpdateDelta)
+
+ScreenLineDelta = _reflection.GeneratedProtocolMessageType('ScreenLineDelta', (_message.Message,), {
+  'DESCRIPTOR' : _SCREENLINEDELTA,
+  '__module__' : 'api_pb2'
+  # @@protoc_insertion_point(class_scope:iterm2.ScreenLineDelta)
+  })
+_sym_db.RegisterMessage(ScreenLineDelta)
+
 PromptNotificationPrompt = _reflection.GeneratedProtocolMessageType('PromptNotificationPrompt', (_message.Message,), {
   'DESCRIPTOR' : _PROMPTNOTIFICATIONPROMPT,
   '__module__' : 'api_pb2'
@@ -1303,6 +1331,27 @@ ListPromptsResponse = _reflection.GeneratedProtocolMessageType('ListPromptsRespo
   })
 _sym_db.RegisterMessage(ListPromptsResponse)
 
+ExportScrollbackRequest = _reflection.GeneratedProtocolMessageType('ExportScrollbackRequest', (_message.Message,), {
+  'DESCRIPTOR' : _EXPORTSCROLLBACKREQUEST,
+  '__module__' : 'api_pb2'
+  # @@protoc_insertion_point(class_scope:iterm2.ExportScrollbackRequest)
+  })
+_sym_db.RegisterMessage(ExportScrollbackRequest)
+
+ScrollbackPosition = _reflection.GeneratedProtocolMessageType('ScrollbackPosition', (_message.Message,), {
+  'DESCRIPTOR' : _SCROLLBACKPOSITION,
+  '__module__' : 'api_pb2'
+  # @@protoc_insertion_point(class_scope:iterm2.ScrollbackPosition)
+  })
+_sym_db.RegisterMessage(ScrollbackPosition)
+
+ExportScrollbackResponse = _reflection.GeneratedProtocolMessageType('ExportScrollbackResponse', (_message.Message,), {
+  'DESCRIPTOR' : _EXPORTSCROLLBACKRESPONSE,
+  '__module__' : 'api_pb2'
+  # @@protoc_insertion_point(class_scope:iterm2.ExportScrollbackResponse)
+  })
+_sym_db.RegisterMessage(ExportScrollbackResponse)
+
 GetProfilePropertyRequest = _reflection.GeneratedProtocolMessageType('GetProfilePropertyRequest', (_message.Message,), {
   'DESCRIPTOR' : _GETPROFILEPROPERTYREQUEST,
   '__module__' : 'api_pb2'
@@ -1562,444 +1611,464 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _GETBUFFERRESPONSE.fields_by_name['range']._serialized_options = b'\030\001'
   _GETBUFFERRESPONSE.fields_by_name['num_lines_above_screen']._options = None
   _GETBUFFERRESPONSE.fields_by_name['num_lines_above_screen']._serialized_options = b'\030\001'
+  _EXPORTSCROLLBACKRESPONSE.fields_by_name['line_lengths']._options = None
+  _EXPORTSCROLLBACKRESPONSE.fields_by_name['line_lengths']._serialized_options = b'\020\001'
+  _EXPORTSCROLLBACKRESPONSE.fields_by_name['style_run_lengths']._options = None
+  _EXPORTSCROLLBACKRESPONSE.fields_by_name['style_run_lengths']._serialized_options = b'\020\001'
+  _EXPORTSCROLLBACKRESPONSE.fields_by_name['style_run_indexes']._options = None
+  _EXPORTSCROLLBACKRESPONSE.fields_by_name['style_run_indexes']._serialized_options = b'\020\001'
   _CREATETABREQUEST.fields_by_name['command']._options = None
   _CREATETABREQUEST.fields_by_name['command']._serialized_options = b'\030\001'
-  _SELECTIONMODE._serialized_start=26065
-  _SELECTIONMODE._serialized_end=26151
-  _NOTIFICATIONTYPE._serialized_start=26154
-  _NOTIFICATIONTYPE._serialized_end=26590
-  _MODIFIERS._serialized_start=26592
-  _MODIFIERS._serialized_end=26678
-  _VARIABLESCOPE._serialized_start=26680
-  _VARIABLESCOPE._serialized_end=26738
-  _PROMPTMONITORMODE._serialized_start=26740
-  _PROMPTMONITORMODE._serialized_end=26807
-  _ALTERNATECOLOR._serialized_start=26809
-  _ALTERNATECOLOR._serialized_end=26880
-  _IMAGEPLACEHOLDERTYPE._serialized_start=26882
-  _IMAGEPLACEHOLDERTYPE._serialized_end=26937
+  _SELECTIONMODE._serialized_start=27477
+  _SELECTIONMODE._serialized_end=27563
+  _NOTIFICATIONTYPE._serialized_start=27566
+  _NOTIFICATIONTYPE._serialized_end=28002
+  _MODIFIERS._serialized_start=28004
+  _MODIFIERS._serialized_end=28090
+  _VARIABLESCOPE._serialized_start=28092
+  _VARIABLESCOPE._serialized_end=28150
+  _PROMPTMONITORMODE._serialized_start=28152
+  _PROMPTMONITORMODE._serialized_end=28219
+  _ALTERNATECOLOR._serialized_start=28221
+  _ALTERNATECOLOR._serialized_end=28292
+  _IMAGEPLACEHOLDERTYPE._serialized_start=28294
+  _IMAGEPLACEHOLDERTYPE._serialized_end=28349
   _CLIENTORIGINATEDMESSAGE._serialized_start=22
-  _CLIENTORIGINATEDMESSAGE._serialized_end=2159
-  _SERVERORIGINATEDMESSAGE._serialized_start=2162
-  _SERVERORIGINATEDMESSAGE._serialized_end=4431
-  _INVOKEFUNCTIONREQUEST._serialized_start=4434
-  _INVOKEFUNCTIONREQUEST._serialized_end=4897
-  _INVOKEFUNCTIONREQUEST_TAB._serialized_start=4770
-  _INVOKEFUNCTIONREQUEST_TAB._serialized_end=4791
-  _INVOKEFUNCTIONREQUEST_SESSION._serialized_start=4793
-  _INVOKEFUNCTIONREQUEST_SESSION._serialized_end=4822
-  _INVOKEFUNCTIONREQUEST_WINDOW._serialized_start=4824
-  _INVOKEFUNCTIONREQUEST_WINDOW._serialized_end=4851
-  _INVOKEFUNCTIONREQUEST_APP._serialized_start=4853
-  _INVOKEFUNCTIONREQUEST_APP._serialized_end=4858
-  _INVOKEFUNCTIONREQUEST_METHOD._serialized_start=4860
-  _INVOKEFUNCTIONREQUEST_METHOD._serialized_end=4886
-  _INVOKEFUNCTIONRESPONSE._serialized_start=4900
-  _INVOKEFUNCTIONRESPONSE._serialized_end=5245
-  _INVOKEFUNCTIONRESPONSE_ERROR._serialized_start=5040
-  _INVOKEFUNCTIONRESPONSE_ERROR._serialized_end=5124
-  _INVOKEFUNCTIONRESPONSE_SUCCESS._serialized_start=5126
-  _INVOKEFUNCTIONRESPONSE_SUCCESS._serialized_end=5156
-  _INVOKEFUNCTIONRESPONSE_STATUS._serialized_start=5158
-  _INVOKEFUNCTIONRESPONSE_STATUS._serialized_end=5230
-  _CLOSEREQUEST._serialized_start=5248
-  _CLOSEREQUEST._serialized_end=5549
-  _CLOSEREQUEST_CLOSETABS._serialized_start=5437
-  _CLOSEREQUEST_CLOSETABS._serialized_end=5465
-  _CLOSEREQUEST_CLOSESESSIONS._serialized_start=5467
-  _CLOSEREQUEST_CLOSESESSIONS._serialized_end=5503
-  _CLOSEREQUEST_CLOSEWINDOWS._serialized_start=5505
-  _CLOSEREQUEST_CLOSEWINDOWS._serialized_end=5539
-  _CLOSERESPONSE._serialized_start=5551
-  _CLOSERESPONSE._serialized_end=5666
-  _CLOSERESPONSE_STATUS._serialized_start=5616
-  _CLOSERESPONSE_STATUS._serialized_end=5666
-  _SETBROADCASTDOMAINSREQUEST._serialized_start=5668
-  _SETBROADCASTDOMAINSREQUEST._serialized_end=5748
-  _SETBROADCASTDOMAINSRESPONSE._serialized_start=5751
-  _SETBROADCASTDOMAINSRESPONSE._serialized_end=5950
-  _SETBROADCASTDOMAINSRESPONSE_STATUS._serialized_start=5842
-  _SETBROADCASTDOMAINSRESPONSE_STATUS._serialized_end=5950
-  _STATUSBARCOMPONENTREQUEST._serialized_start=5953
-  _STATUSBARCOMPONENTREQUEST._serialized_end=6159
-  _STATUSBARCOMPONENTREQUEST_OPENPOPOVER._serialized_start=6073
-  _STATUSBARCOMPONENTREQUEST_OPENPOPOVER._serialized_end=6148
-  _STATUSBARCOMPONENTRESPONSE._serialized_start=6162
-  _STATUSBARCOMPONENTRESPONSE._serialized_end=6337
-  _STATUSBARCOMPONENTRESPONSE_STATUS._serialized_start=6251
-  _STATUSBARCOMPONENTRESPONSE_STATUS._serialized_end=6337
-  _WINDOWEDCOORDRANGE._serialized_start=6339
-  _WINDOWEDCOORDRANGE._serialized_end=6432
-  _SUBSELECTION._serialized_start=6435
-  _SUBSELECTION._serialized_end=6573
-  _SELECTION._serialized_start=6575
-  _SELECTION._serialized_end=6632
-  _SELECTIONREQUEST._serialized_start=6635
-  _SELECTIONREQUEST._serialized_end=6946
-  _SELECTIONREQUEST_GETSELECTIONREQUEST._serialized_start=6813
-  _SELECTIONREQUEST_GETSELECTIONREQUEST._serialized_end=6854
-  _SELECTIONREQUEST_SETSELECTIONREQUEST._serialized_start=6856
-  _SELECTIONREQUEST_SETSELECTIONREQUEST._serialized_end=6935
-  _SELECTIONRESPONSE._serialized_start=6949
-  _SELECTIONRESPONSE._serialized_end=7361
-  _SELECTIONRESPONSE_GETSELECTIONRESPONSE._serialized_start=7184
-  _SELECTIONRESPONSE_GETSELECTIONRESPONSE._serialized_end=7244
-  _SELECTIONRESPONSE_SETSELECTIONRESPONSE._serialized_start=7246
-  _SELECTIONRESPONSE_SETSELECTIONRESPONSE._serialized_end=7268
-  _SELECTIONRESPONSE_STATUS._serialized_start=7270
-  _SELECTIONRESPONSE_STATUS._serialized_end=7349
-  _COLORPRESETREQUEST._serialized_start=7364
-  _COLORPRESETREQUEST._serialized_end=7561
-  _COLORPRESETREQUEST_LISTPRESETS._serialized_start=7510
-  _COLORPRESETREQUEST_LISTPRESETS._serialized_end=7523
-  _COLORPRESETREQUEST_GETPRESET._serialized_start=7525
-  _COLORPRESETREQUEST_GETPRESET._serialized_end=7550
-  _COLORPRESETRESPONSE._serialized_start=7564
-  _COLORPRESETRESPONSE._serialized_end=8064
-  _COLORPRESETRESPONSE_LISTPRESETS._serialized_start=7765
-  _COLORPRESETRESPONSE_LISTPRESETS._serialized_end=7792
-  _COLORPRESETRESPONSE_GETPRESET._serialized_start=7795
-  _COLORPRESETRESPONSE_GETPRESET._serialized_end=7989
-  _COLORPRESETRESPONSE_GETPRESET_COLORSETTING._serialized_start=7884
-  _COLORPRESETRESPONSE_GETPRESET_COLORSETTING._serialized_end=7989
-  _COLORPRESETRESPONSE_STATUS._serialized_start=7991
-  _COLORPRESETRESPONSE_STATUS._serialized_end=8052
-  _PREFERENCESREQUEST._serialized_start=8067
-  _PREFERENCESREQUEST._serialized_end=8654
-  _PREFERENCESREQUEST_REQUEST._serialized_start=8144
-  _PREFERENCESREQUEST_REQUEST._serialized_end=8654
-  _PREFERENCESREQUEST_REQUEST_SETPREFERENCE._serialized_start=8509
-  _PREFERENCESREQUEST_REQUEST_SETPREFERENCE._serialized_end=8557
-  _PREFERENCESREQUEST_REQUEST_GETPREFERENCE._serialized_start=8559
-  _PREFERENCESREQUEST_REQUEST_GETPREFERENCE._serialized_end=8587
-  _PREFERENCESREQUEST_REQUEST_SETDEFAULTPROFILE._serialized_start=8589
-  _PREFERENCESREQUEST_REQUEST_SETDEFAULTPROFILE._serialized_end=8622
-  _PREFERENCESREQUEST_REQUEST_GETDEFAULTPROFILE._serialized_start=8624
-  _PREFERENCESREQUEST_REQUEST_GETDEFAULTPROFILE._serialized_end=8643
-  _PREFERENCESRESPONSE._serialized_start=8657
-  _PREFERENCESRESPONSE._serialized_end=9616
-  _PREFERENCESRESPONSE_RESULT._serialized_start=8734
-  _PREFERENCESRESPONSE_RESULT._serialized_end=9616
-  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT._serialized_start=9206
-  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT._serialized_end=9357
-  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT_STATUS._serialized_start=9308
-  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT_STATUS._serialized_end=9357
-  _PREFERENCESRESPONSE_RESULT_GETPREFERENCERESULT._serialized_start=9359
-  _PREFERENCESRESPONSE_RESULT_GETPREFERENCERESULT._serialized_end=9400
-  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT._serialized_start=9403
-  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT._serialized_end=9543
-  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT_STATUS._serialized_start=9513
-  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT_STATUS._serialized_end=9543
-  _PREFERENCESRESPONSE_RESULT_UNRECOGNIZEDRESULT._serialized_start=9545
-  _PREFERENCESRESPONSE_RESULT_UNRECOGNIZEDRESULT._serialized_end=9565
-  _PREFERENCESRESPONSE_RESULT_GETDEFAULTPROFILERESULT._serialized_start=9567
-  _PREFERENCESRESPONSE_RESULT_GETDEFAULTPROFILERESULT._serialized_end=9606
-  _REORDERTABSREQUEST._serialized_start=9619
-  _REORDERTABSREQUEST._serialized_end=9749
-  _REORDERTABSREQUEST_ASSIGNMENT._serialized_start=9701
-  _REORDERTABSREQUEST_ASSIGNMENT._serialized_end=9749
-  _REORDERTABSRESPONSE._serialized_start=9752
-  _REORDERTABSRESPONSE._serialized_end=9910
-  _REORDERTABSRESPONSE_STATUS._serialized_start=9827
-  _REORDERTABSRESPONSE_STATUS._serialized_end=9910
-  _TMUXREQUEST._serialized_start=9913
-  _TMUXREQUEST._serialized_end=10396
-  _TMUXREQUEST_LISTCONNECTIONS._serialized_start=10177
-  _TMUXREQUEST_LISTCONNECTIONS._serialized_end=10194
-  _TMUXREQUEST_SENDCOMMAND._serialized_start=10196
-  _TMUXREQUEST_SENDCOMMAND._serialized_end=10249
-  _TMUXREQUEST_SETWINDOWVISIBLE._serialized_start=10251
-  _TMUXREQUEST_SETWINDOWVISIBLE._serialized_end=10328
-  _TMUXREQUEST_CREATEWINDOW._serialized_start=10330
-  _TMUXREQUEST_CREATEWINDOW._serialized_end=10385
-  _TMUXRESPONSE._serialized_start=10399
-  _TMUXRESPONSE._serialized_end=11048
-  _TMUXRESPONSE_LISTCONNECTIONS._serialized_start=10714
-  _TMUXRESPONSE_LISTCONNECTIONS._serialized_end=10865
-  _TMUXRESPONSE_LISTCONNECTIONS_CONNECTION._serialized_start=10803
-  _TMUXRESPONSE_LISTCONNECTIONS_CONNECTION._serialized_end=10865
-  _TMUXRESPONSE_SENDCOMMAND._serialized_start=10867
-  _TMUXRESPONSE_SENDCOMMAND._serialized_end=10896
-  _TMUXRESPONSE_SETWINDOWVISIBLE._serialized_start=10251
-  _TMUXRESPONSE_SETWINDOWVISIBLE._serialized_end=10269
-  _TMUXRESPONSE_CREATEWINDOW._serialized_start=10918
-  _TMUXRESPONSE_CREATEWINDOW._serialized_end=10948
-  _TMUXRESPONSE_STATUS._serialized_start=10950
-  _TMUXRESPONSE_STATUS._serialized_end=11037
-  _GETBROADCASTDOMAINSREQUEST._serialized_start=11050
-  _GETBROADCASTDOMAINSREQUEST._serialized_end=11078
-  _BROADCASTDOMAIN._serialized_start=11080
-  _BROADCASTDOMAIN._serialized_end=11118
-  _GETBROADCASTDOMAINSRESPONSE._serialized_start=11120
-  _GETBROADCASTDOMAINSRESPONSE._serialized_end=11201
-  _SETTABLAYOUTREQUEST._serialized_start=11203
-  _SETTABLAYOUTREQUEST._serialized_end=11277
-  _SETTABLAYOUTRESPONSE._serialized_start=11280
-  _SETTABLAYOUTRESPONSE._serialized_end=11423
-  _SETTABLAYOUTRESPONSE_STATUS._serialized_start=11357
-  _SETTABLAYOUTRESPONSE_STATUS._serialized_end=11423
-  _MENUITEMREQUEST._serialized_start=11425
-  _MENUITEMREQUEST._serialized_end=11482
-  _MENUITEMRESPONSE._serialized_start=11485
-  _MENUITEMRESPONSE._serialized_end=11638
-  _MENUITEMRESPONSE_STATUS._serialized_start=11588
-  _MENUITEMRESPONSE_STATUS._serialized_end=11638
-  _RESTARTSESSIONREQUEST._serialized_start=11640
-  _RESTARTSESSIONREQUEST._serialized_end=11707
-  _RESTARTSESSIONRESPONSE._serialized_start=11710
-  _RESTARTSESSIONRESPONSE._serialized_end=11859
-  _RESTARTSESSIONRESPONSE_STATUS._serialized_start=11791
-  _RESTARTSESSIONRESPONSE_STATUS._serialized_end=11859
-  _SERVERORIGINATEDRPCRESULTREQUEST._serialized_start=11861
-  _SERVERORIGINATEDRPCRESULTREQUEST._serialized_end=11973
-  _SERVERORIGINATEDRPCRESULTRESPONSE._serialized_start=11975
-  _SERVERORIGINATEDRPCRESULTRESPONSE._serialized_end=12010
-  _LISTPROFILESREQUEST._serialized_start=12012
-  _LISTPROFILESREQUEST._serialized_end=12068
-  _LISTPROFILESRESPONSE._serialized_start=12071
-  _LISTPROFILESRESPONSE._serialized_end=12205
-  _LISTPROFILESRESPONSE_PROFILE._serialized_start=12151
-  _LISTPROFILESRESPONSE_PROFILE._serialized_end=12205
-  _FOCUSREQUEST._serialized_start=12207
-  _FOCUSREQUEST._serialized_end=12221
-  _FOCUSRESPONSE._serialized_start=12223
-  _FOCUSRESPONSE._serialized_end=12295
-  _SAVEDARRANGEMENTREQUEST._serialized_start=12298
-  _SAVEDARRANGEMENTREQUEST._serialized_end=12455
-  _SAVEDARRANGEMENTREQUEST_ACTION._serialized_start=12414
-  _SAVEDARRANGEMENTREQUEST_ACTION._serialized_end=12455
-  _SAVEDARRANGEMENTRESPONSE._serialized_start=12458
-  _SAVEDARRANGEMENTRESPONSE._serialized_end=12646
-  _SAVEDARRANGEMENTRESPONSE_STATUS._serialized_start=12558
-  _SAVEDARRANGEMENTRESPONSE_STATUS._serialized_end=12646
-  _VARIABLEREQUEST._serialized_start=12649
-  _VARIABLEREQUEST._serialized_end=12842
-  _VARIABLEREQUEST_SET._serialized_start=12799
-  _VARIABLEREQUEST_SET._serialized_end=12833
-  _VARIABLERESPONSE._serialized_start=12845
-  _VARIABLERESPONSE._serialized_end=13074
-  _VARIABLERESPONSE_STATUS._serialized_start=12931
-  _VARIABLERESPONSE_STATUS._serialized_end=13074
-  _ACTIVATEREQUEST._serialized_start=13077
-  _ACTIVATEREQUEST._serialized_end=13355
-  _ACTIVATEREQUEST_APP._serialized_start=13280
-  _ACTIVATEREQUEST_APP._serialized_end=13341
-  _ACTIVATERESPONSE._serialized_start=13357
-  _ACTIVATERESPONSE._serialized_end=13482
-  _ACTIVATERESPONSE_STATUS._serialized_start=13426
-  _ACTIVATERESPONSE_STATUS._serialized_end=13482
-  _INJECTREQUEST._serialized_start=13484
-  _INJECTREQUEST._serialized_end=13533
-  _INJECTRESPONSE._serialized_start=13535
-  _INJECTRESPONSE._serialized_end=13639
-  _INJECTRESPONSE_STATUS._serialized_start=5842
-  _INJECTRESPONSE_STATUS._serialized_end=5881
-  _GETPROPERTYREQUEST._serialized_start=13641
-  _GETPROPERTYREQUEST._serialized_end=13732
-  _GETPROPERTYRESPONSE._serialized_start=13735
-  _GETPROPERTYRESPONSE._serialized_end=13889
-  _GETPROPERTYRESPONSE_STATUS._serialized_start=13830
-  _GETPROPERTYRESPONSE_STATUS._serialized_end=13889
-  _SETPROPERTYREQUEST._serialized_start=13891
-  _SETPROPERTYREQUEST._serialized_end=14002
-  _SETPROPERTYRESPONSE._serialized_start=14005
-  _SETPROPERTYRESPONSE._serialized_end=14200
-  _SETPROPERTYRESPONSE_STATUS._serialized_start=14080
-  _SETPROPERTYRESPONSE_STATUS._serialized_end=14200
-  _REGISTERTOOLREQUEST._serialized_start=14203
-  _REGISTERTOOLREQUEST._serialized_end=14419
-  _REGISTERTOOLREQUEST_TOOLTYPE._serialized_start=14390
-  _REGISTERTOOLREQUEST_TOOLTYPE._serialized_end=14419
-  _RPCREGISTRATIONREQUEST._serialized_start=14422
-  _RPCREGISTRATIONREQUEST._serialized_end=16053
-  _RPCREGISTRATIONREQUEST_RPCARGUMENTSIGNATURE._serialized_start=14983
-  _RPCREGISTRATIONREQUEST_RPCARGUMENTSIGNATURE._serialized_end=15019
-  _RPCREGISTRATIONREQUEST_RPCARGUMENT._serialized_start=15021
-  _RPCREGISTRATIONREQUEST_RPCARGUMENT._serialized_end=15062
-  _RPCREGISTRATIONREQUEST_SESSIONTITLEATTRIBUTES._serialized_start=15064
-  _RPCREGISTRATIONREQUEST_SESSIONTITLEATTRIBUTES._serialized_end=15137
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES._serialized_start=15140
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES._serialized_end=15869
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB._serialized_start=15557
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB._serialized_end=15796
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB_TYPE._serialized_start=15726
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB_TYPE._serialized_end=15796
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_ICON._serialized_start=15798
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_ICON._serialized_end=15833
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_FORMAT._serialized_start=15835
-  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_FORMAT._serialized_end=15869
-  _RPCREGISTRATIONREQUEST_CONTEXTMENUATTRIBUTES._serialized_start=15871
-  _RPCREGISTRATIONREQUEST_CONTEXTMENUATTRIBUTES._serialized_end=15943
-  _RPCREGISTRATIONREQUEST_ROLE._serialized_start=15945
-  _RPCREGISTRATIONREQUEST_ROLE._serialized_end=16027
-  _REGISTERTOOLRESPONSE._serialized_start=16056
-  _REGISTERTOOLRESPONSE._serialized_end=16195
-  _REGISTERTOOLRESPONSE_STATUS._serialized_start=16133
-  _REGISTERTOOLRESPONSE_STATUS._serialized_end=16195
-  _KEYSTROKEPATTERN._serialized_start=16198
-  _KEYSTROKEPATTERN._serialized_end=16388
-  _KEYSTROKEMONITORREQUEST._serialized_start=16390
-  _KEYSTROKEMONITORREQUEST._serialized_end=16491
-  _KEYSTROKEFILTERREQUEST._serialized_start=16493
-  _KEYSTROKEFILTERREQUEST._serialized_end=16571
-  _VARIABLEMONITORREQUEST._serialized_start=16573
-  _VARIABLEMONITORREQUEST._serialized_end=16669
-  _PROFILECHANGEREQUEST._serialized_start=16671
-  _PROFILECHANGEREQUEST._serialized_end=16707
-  _PROMPTMONITORREQUEST._serialized_start=16709
-  _PROMPTMONITORREQUEST._serialized_end=16773
-  _NOTIFICATIONREQUEST._serialized_start=16776
-  _NOTIFICATIONREQUEST._serialized_end=17301
-  _NOTIFICATIONRESPONSE._serialized_start=17304
-  _NOTIFICATIONRESPONSE._serialized_end=17549
-  _NOTIFICATIONRESPONSE_STATUS._serialized_start=17382
-  _NOTIFICATIONRESPONSE_STATUS._serialized_end=17549
-  _NOTIFICATION._serialized_start=17552
-  _NOTIFICATION._serialized_end=18522
-  _PROFILECHANGEDNOTIFICATION._serialized_start=18524
-  _PROFILECHANGEDNOTIFICATION._serialized_end=18566
-  _VARIABLECHANGEDNOTIFICATION._serialized_start=18568
-  _VARIABLECHANGEDNOTIFICATION._serialized_end=18693
-  _BROADCASTDOMAINSCHANGEDNOTIFICATION._serialized_start=18695
-  _BROADCASTDOMAINSCHANGEDNOTIFICATION._serialized_end=18784
-  _SERVERORIGINATEDRPC._serialized_start=18787
-  _SERVERORIGINATEDRPC._serialized_end=18931
-  _SERVERORIGINATEDRPC_RPCARGUMENT._serialized_start=18884
-  _SERVERORIGINATEDRPC_RPCARGUMENT._serialized_end=18931
-  _SERVERORIGINATEDRPCNOTIFICATION._serialized_start=18933
-  _SERVERORIGINATEDRPCNOTIFICATION._serialized_end=19028
-  _KEYSTROKENOTIFICATION._serialized_start=19031
-  _KEYSTROKENOTIFICATION._serialized_end=19292
-  _KEYSTROKENOTIFICATION_ACTION._serialized_start=19239
-  _KEYSTROKENOTIFICATION_ACTION._serialized_end=19292
-  _SCREENUPDATENOTIFICATION._serialized_start=19294
-  _SCREENUPDATENOTIFICATION._serialized_end=19337
-  _PROMPTNOTIFICATIONPROMPT._serialized_start=19339
-  _PROMPTNOTIFICATIONPROMPT._serialized_end=19429
-  _PROMPTNOTIFICATIONCOMMANDSTART._serialized_start=19431
-  _PROMPTNOTIFICATIONCOMMANDSTART._serialized_end=19480
-  _PROMPTNOTIFICATIONCOMMANDEND._serialized_start=19482
-  _PROMPTNOTIFICATIONCOMMANDEND._serialized_end=19528
-  _PROMPTNOTIFICATION._serialized_start=19531
-  _PROMPTNOTIFICATION._serialized_end=19781
-  _LOCATIONCHANGENOTIFICATION._serialized_start=19783
-  _LOCATIONCHANGENOTIFICATION._serialized_end=19885
-  _CUSTOMESCAPESEQUENCENOTIFICATION._serialized_start=19887
-  _CUSTOMESCAPESEQUENCENOTIFICATION._serialized_end=19980
-  _NEWSESSIONNOTIFICATION._serialized_start=19982
-  _NEWSESSIONNOTIFICATION._serialized_end=20026
-  _FOCUSCHANGEDNOTIFICATION._serialized_start=20029
-  _FOCUSCHANGEDNOTIFICATION._serialized_end=20417
-  _FOCUSCHANGEDNOTIFICATION_WINDOW._serialized_start=20190
-  _FOCUSCHANGEDNOTIFICATION_WINDOW._serialized_end=20408
-  _FOCUSCHANGEDNOTIFICATION_WINDOW_WINDOWSTATUS._serialized_start=20296
-  _FOCUSCHANGEDNOTIFICATION_WINDOW_WINDOWSTATUS._serialized_end=20408
-  _TERMINATESESSIONNOTIFICATION._serialized_start=20419
-  _TERMINATESESSIONNOTIFICATION._serialized_end=20469
-  _LAYOUTCHANGEDNOTIFICATION._serialized_start=20471
-  _LAYOUTCHANGEDNOTIFICATION._serialized_end=20560
-  _GETBUFFERREQUEST._serialized_start=20562
-  _GETBUFFERREQUEST._serialized_end=20660
-  _GETBUFFERRESPONSE._serialized_start=20663
-  _GETBUFFERRESPONSE._serialized_end=21023
-  _GETBUFFERRESPONSE_STATUS._serialized_start=20937
-  _GETBUFFERRESPONSE_STATUS._serialized_end=21023
-  _GETPROMPTREQUEST._serialized_start=21025
-  _GETPROMPTREQUEST._serialized_end=21086
-  _GETPROMPTRESPONSE._serialized_start=21089
-  _GETPROMPTRESPONSE._serialized_end=21572
-  _GETPROMPTRESPONSE_STATUS._serialized_start=21437
-  _GETPROMPTRESPONSE_STATUS._serialized_end=21523
-  _GETPROMPTRESPONSE_STATE._serialized_start=21525
-  _GETPROMPTRESPONSE_STATE._serialized_end=21572
-  _LISTPROMPTSREQUEST._serialized_start=21574
-  _LISTPROMPTSREQUEST._serialized_end=21660
-  _LISTPROMPTSRESPONSE._serialized_start=21663
-  _LISTPROMPTSRESPONSE._serialized_end=21807
-  _LISTPROMPTSRESPONSE_STATUS._serialized_start=5842
-  _LISTPROMPTSRESPONSE_STATUS._serialized_end=5881
-  _GETPROFILEPROPERTYREQUEST._serialized_start=21809
-  _GETPROFILEPROPERTYREQUEST._serialized_end=21867
-  _PROFILEPROPERTY._serialized_start=21869
-  _PROFILEPROPERTY._serialized_end=21919
-  _GETPROFILEPROPERTYRESPONSE._serialized_start=21922
-  _GETPROFILEPROPERTYRESPONSE._serialized_end=22133
-  _GETPROFILEPROPERTYRESPONSE_STATUS._serialized_start=22060
-  _GETPROFILEPROPERTYRESPONSE_STATUS._serialized_end=22133
-  _SETPROFILEPROPERTYREQUEST._serialized_start=22136
-  _SETPROFILEPROPERTYREQUEST._serialized_end=22431
-  _SETPROFILEPROPERTYREQUEST_GUIDLIST._serialized_start=22349
-  _SETPROFILEPROPERTYREQUEST_GUIDLIST._serialized_end=22374
-  _SETPROFILEPROPERTYREQUEST_ASSIGNMENT._serialized_start=22376
-  _SETPROFILEPROPERTYREQUEST_ASSIGNMENT._serialized_end=22421
-  _SETPROFILEPROPERTYRESPONSE._serialized_start=22434
-  _SETPROFILEPROPERTYRESPONSE._serialized_end=22603
-  _SETPROFILEPROPERTYRESPONSE_STATUS._serialized_start=22527
-  _SETPROFILEPROPERTYRESPONSE_STATUS._serialized_end=22603
-  _TRANSACTIONREQUEST._serialized_start=22605
-  _TRANSACTIONREQUEST._serialized_end=22640
-  _TRANSACTIONRESPONSE._serialized_start=22643
-  _TRANSACTIONRESPONSE._serialized_end=22786
-  _TRANSACTIONRESPONSE_STATUS._serialized_start=22722
-  _TRANSACTIONRESPONSE_STATUS._serialized_end=22786
-  _LINERANGE._serialized_start=22788
-  _LINERANGE._serialized_end=22911
-  _RANGE._serialized_start=22913
-  _RANGE._serialized_end=22954
-  _COORDRANGE._serialized_start=22956
-  _COORDRANGE._serialized_end=23026
-  _COORD._serialized_start=23028
-  _COORD._serialized_end=23057
-  _RGBCOLOR._serialized_start=23059
-  _RGBCOLOR._serialized_end=23111
-  _URL._serialized_start=23113
-  _URL._serialized_end=23151
-  _CELLSTYLE._serialized_start=23154
-  _CELLSTYLE._serialized_end=23763
-  _LINECONTENTS._serialized_start=23766
-  _LINECONTENTS._serialized_end=24035
-  _LINECONTENTS_CONTINUATION._serialized_start=23967
-  _LINECONTENTS_CONTINUATION._serialized_end=24035
-  _CODEPOINTSPERCELL._serialized_start=24037
-  _CODEPOINTSPERCELL._serialized_end=24101
-  _LISTSESSIONSREQUEST._serialized_start=24103
-  _LISTSESSIONSREQUEST._serialized_end=24124
-  _SENDTEXTREQUEST._serialized_start=24126
-  _SENDTEXTREQUEST._serialized_end=24202
-  _SENDTEXTRESPONSE._serialized_start=24204
-  _SENDTEXTRESPONSE._serialized_end=24312
-  _SENDTEXTRESPONSE_STATUS._serialized_start=5842
-  _SENDTEXTRESPONSE_STATUS._serialized_end=5881
-  _SIZE._serialized_start=24314
-  _SIZE._serialized_end=24351
-  _POINT._serialized_start=24353
-  _POINT._serialized_end=24382
-  _FRAME._serialized_start=24384
-  _FRAME._serialized_end=24450
-  _SESSIONSUMMARY._serialized_start=24452
-  _SESSIONSUMMARY._serialized_end=24573
-  _SPLITTREENODE._serialized_start=24576
-  _SPLITTREENODE._serialized_end=24769
-  _SPLITTREENODE_SPLITTREELINK._serialized_start=24663
-  _SPLITTREENODE_SPLITTREELINK._serialized_end=24769
-  _LISTSESSIONSRESPONSE._serialized_start=24772
-  _LISTSESSIONSRESPONSE._serialized_end=25185
-  _LISTSESSIONSRESPONSE_WINDOW._serialized_start=24899
-  _LISTSESSIONSRESPONSE_WINDOW._serialized_end=25020
-  _LISTSESSIONSRESPONSE_TAB._serialized_start=25023
-  _LISTSESSIONSRESPONSE_TAB._serialized_end=25185
-  _CREATETABREQUEST._serialized_start=25188
-  _CREATETABREQUEST._serialized_end=25347
-  _CREATETABRESPONSE._serialized_start=25350
-  _CREATETABRESPONSE._serialized_end=25590
-  _CREATETABRESPONSE_STATUS._serialized_start=25476
-  _CREATETABRESPONSE_STATUS._serialized_end=25590
-  _SPLITPANEREQUEST._serialized_start=25593
-  _SPLITPANEREQUEST._serialized_end=25847
-  _SPLITPANEREQUEST_SPLITDIRECTION._serialized_start=25801
-  _SPLITPANEREQUEST_SPLITDIRECTION._serialized_end=25847
-  _SPLITPANERESPONSE._serialized_start=25850
-  _SPLITPANERESPONSE._serialized_end=26063
-  _SPLITPANERESPONSE_STATUS._serialized_start=25941
-  _SPLITPANERESPONSE_STATUS._serialized_end=26063
+  _CLIENTORIGINATEDMESSAGE._serialized_end=2230
+  _SERVERORIGINATEDMESSAGE._serialized_start=2233
+  _SERVERORIGINATEDMESSAGE._serialized_end=4575
+  _INVOKEFUNCTIONREQUEST._serialized_start=4578
+  _INVOKEFUNCTIONREQUEST._serialized_end=5041
+  _INVOKEFUNCTIONREQUEST_TAB._serialized_start=4914
+  _INVOKEFUNCTIONREQUEST_TAB._serialized_end=4935
+  _INVOKEFUNCTIONREQUEST_SESSION._serialized_start=4937
+  _INVOKEFUNCTIONREQUEST_SESSION._serialized_end=4966
+  _INVOKEFUNCTIONREQUEST_WINDOW._serialized_start=4968
+  _INVOKEFUNCTIONREQUEST_WINDOW._serialized_end=4995
+  _INVOKEFUNCTIONREQUEST_APP._serialized_start=4997
+  _INVOKEFUNCTIONREQUEST_APP._serialized_end=5002
+  _INVOKEFUNCTIONREQUEST_METHOD._serialized_start=5004
+  _INVOKEFUNCTIONREQUEST_METHOD._serialized_end=5030
+  _INVOKEFUNCTIONRESPONSE._serialized_start=5044
+  _INVOKEFUNCTIONRESPONSE._serialized_end=5389
+  _INVOKEFUNCTIONRESPONSE_ERROR._serialized_start=5184
+  _INVOKEFUNCTIONRESPONSE_ERROR._serialized_end=5268
+  _INVOKEFUNCTIONRESPONSE_SUCCESS._serialized_start=5270
+  _INVOKEFUNCTIONRESPONSE_SUCCESS._serialized_end=5300
+  _INVOKEFUNCTIONRESPONSE_STATUS._serialized_start=5302
+  _INVOKEFUNCTIONRESPONSE_STATUS._serialized_end=5374
+  _CLOSEREQUEST._serialized_start=5392
+  _CLOSEREQUEST._serialized_end=5693
+  _CLOSEREQUEST_CLOSETABS._serialized_start=5581
+  _CLOSEREQUEST_CLOSETABS._serialized_end=5609
+  _CLOSEREQUEST_CLOSESESSIONS._serialized_start=5611
+  _CLOSEREQUEST_CLOSESESSIONS._serialized_end=5647
+  _CLOSEREQUEST_CLOSEWINDOWS._serialized_start=5649
+  _CLOSEREQUEST_CLOSEWINDOWS._serialized_end=5683
+  _CLOSERESPONSE._serialized_start=5695
+  _CLOSERESPONSE._serialized_end=5810
+  _CLOSERESPONSE_STATUS._serialized_start=5760
+  _CLOSERESPONSE_STATUS._serialized_end=5810
+  _SETBROADCASTDOMAINSREQUEST._serialized_start=5812
+  _SETBROADCASTDOMAINSREQUEST._serialized_end=5892
+  _SETBROADCASTDOMAINSRESPONSE._serialized_start=5895
+  _SETBROADCASTDOMAINSRESPONSE._serialized_end=6094
+  _SETBROADCASTDOMAINSRESPONSE_STATUS._serialized_start=5986
+  _SETBROADCASTDOMAINSRESPONSE_STATUS._serialized_end=6094
+  _STATUSBARCOMPONENTREQUEST._serialized_start=6097
+  _STATUSBARCOMPONENTREQUEST._serialized_end=6303
+  _STATUSBARCOMPONENTREQUEST_OPENPOPOVER._serialized_start=6217
+  _STATUSBARCOMPONENTREQUEST_OPENPOPOVER._serialized_end=6292
+  _STATUSBARCOMPONENTRESPONSE._serialized_start=6306
+  _STATUSBARCOMPONENTRESPONSE._serialized_end=6481
+  _STATUSBARCOMPONENTRESPONSE_STATUS._serialized_start=6395
+  _STATUSBARCOMPONENTRESPONSE_STATUS._serialized_end=6481
+  _WINDOWEDCOORDRANGE._serialized_start=6483
+  _WINDOWEDCOORDRANGE._serialized_end=6576
+  _SUBSELECTION._serialized_start=6579
+  _SUBSELECTION._serialized_end=6717
+  _SELECTION._serialized_start=6719
+  _SELECTION._serialized_end=6776
+  _SELECTIONREQUEST._serialized_start=6779
+  _SELECTIONREQUEST._serialized_end=7090
+  _SELECTIONREQUEST_GETSELECTIONREQUEST._serialized_start=6957
+  _SELECTIONREQUEST_GETSELECTIONREQUEST._serialized_end=6998
+  _SELECTIONREQUEST_SETSELECTIONREQUEST._serialized_start=7000
+  _SELECTIONREQUEST_SETSELECTIONREQUEST._serialized_end=7079
+  _SELECTIONRESPONSE._serialized_start=7093
+  _SELECTIONRESPONSE._serialized_end=7505
+  _SELECTIONRESPONSE_GETSELECTIONRESPONSE._serialized_start=7328
+  _SELECTIONRESPONSE_GETSELECTIONRESPONSE._serialized_end=7388
+  _SELECTIONRESPONSE_SETSELECTIONRESPONSE._serialized_start=7390
+  _SELECTIONRESPONSE_SETSELECTIONRESPONSE._serialized_end=7412
+  _SELECTIONRESPONSE_STATUS._serialized_start=7414
+  _SELECTIONRESPONSE_STATUS._serialized_end=7493
+  _COLORPRESETREQUEST._serialized_start=7508
+  _COLORPRESETREQUEST._serialized_end=7705
+  _COLORPRESETREQUEST_LISTPRESETS._serialized_start=7654
+  _COLORPRESETREQUEST_LISTPRESETS._serialized_end=7667
+  _COLORPRESETREQUEST_GETPRESET._serialized_start=7669
+  _COLORPRESETREQUEST_GETPRESET._serialized_end=7694
+  _COLORPRESETRESPONSE._serialized_start=7708
+  _COLORPRESETRESPONSE._serialized_end=8208
+  _COLORPRESETRESPONSE_LISTPRESETS._serialized_start=7909
+  _COLORPRESETRESPONSE_LISTPRESETS._serialized_end=7936
+  _COLORPRESETRESPONSE_GETPRESET._serialized_start=7939
+  _COLORPRESETRESPONSE_GETPRESET._serialized_end=8133
+  _COLORPRESETRESPONSE_GETPRESET_COLORSETTING._serialized_start=8028
+  _COLORPRESETRESPONSE_GETPRESET_COLORSETTING._serialized_end=8133
+  _COLORPRESETRESPONSE_STATUS._serialized_start=8135
+  _COLORPRESETRESPONSE_STATUS._serialized_end=8196
+  _PREFERENCESREQUEST._serialized_start=8211
+  _PREFERENCESREQUEST._serialized_end=8798
+  _PREFERENCESREQUEST_REQUEST._serialized_start=8288
+  _PREFERENCESREQUEST_REQUEST._serialized_end=8798
+  _PREFERENCESREQUEST_REQUEST_SETPREFERENCE._serialized_start=8653
+  _PREFERENCESREQUEST_REQUEST_SETPREFERENCE._serialized_end=8701
+  _PREFERENCESREQUEST_REQUEST_GETPREFERENCE._serialized_start=8703
+  _PREFERENCESREQUEST_REQUEST_GETPREFERENCE._serialized_end=8731
+  _PREFERENCESREQUEST_REQUEST_SETDEFAULTPROFILE._serialized_start=8733
+  _PREFERENCESREQUEST_REQUEST_SETDEFAULTPROFILE._serialized_end=8766
+  _PREFERENCESREQUEST_REQUEST_GETDEFAULTPROFILE._serialized_start=8768
+  _PREFERENCESREQUEST_REQUEST_GETDEFAULTPROFILE._serialized_end=8787
+  _PREFERENCESRESPONSE._serialized_start=8801
+  _PREFERENCESRESPONSE._serialized_end=9760
+  _PREFERENCESRESPONSE_RESULT._serialized_start=8878
+  _PREFERENCESRESPONSE_RESULT._serialized_end=9760
+  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT._serialized_start=9350
+  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT._serialized_end=9501
+  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT_STATUS._serialized_start=9452
+  _PREFERENCESRESPONSE_RESULT_SETPREFERENCERESULT_STATUS._serialized_end=9501
+  _PREFERENCESRESPONSE_RESULT_GETPREFERENCERESULT._serialized_start=9503
+  _PREFERENCESRESPONSE_RESULT_GETPREFERENCERESULT._serialized_end=9544
+  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT._serialized_start=9547
+  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT._serialized_end=9687
+  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT_STATUS._serialized_start=9657
+  _PREFERENCESRESPONSE_RESULT_SETDEFAULTPROFILERESULT_STATUS._serialized_end=9687
+  _PREFERENCESRESPONSE_RESULT_UNRECOGNIZEDRESULT._serialized_start=9689
+  _PREFERENCESRESPONSE_RESULT_UNRECOGNIZEDRESULT._serialized_end=9709
+  _PREFERENCESRESPONSE_RESULT_GETDEFAULTPROFILERESULT._serialized_start=9711
+  _PREFERENCESRESPONSE_RESULT_GETDEFAULTPROFILERESULT._serialized_end=9750
+  _REORDERTABSREQUEST._serialized_start=9763
+  _REORDERTABSREQUEST._serialized_end=9893
+  _REORDERTABSREQUEST_ASSIGNMENT._serialized_start=9845
+  _REORDERTABSREQUEST_ASSIGNMENT._serialized_end=9893
+  _REORDERTABSRESPONSE._serialized_start=9896
+  _REORDERTABSRESPONSE._serialized_end=10054
+  _REORDERTABSRESPONSE_STATUS._serialized_start=9971
+  _REORDERTABSRESPONSE_STATUS._serialized_end=10054
+  _TMUXREQUEST._serialized_start=10057
+  _TMUXREQUEST._serialized_end=10540
+  _TMUXREQUEST_LISTCONNECTIONS._serialized_start=10321
+  _TMUXREQUEST_LISTCONNECTIONS._serialized_end=10338
+  _TMUXREQUEST_SENDCOMMAND._serialized_start=10340
+  _TMUXREQUEST_SENDCOMMAND._serialized_end=10393
+  _TMUXREQUEST_SETWINDOWVISIBLE._serialized_start=10395
+  _TMUXREQUEST_SETWINDOWVISIBLE._serialized_end=10472
+  _TMUXREQUEST_CREATEWINDOW._serialized_start=10474
+  _TMUXREQUEST_CREATEWINDOW._serialized_end=10529
+  _TMUXRESPONSE._serialized_start=10543
+  _TMUXRESPONSE._serialized_end=11192
+  _TMUXRESPONSE_LISTCONNECTIONS._serialized_start=10858
+  _TMUXRESPONSE_LISTCONNECTIONS._serialized_end=11009
+  _TMUXRESPONSE_LISTCONNECTIONS_CONNECTION._serialized_start=10947
+  _TMUXRESPONSE_LISTCONNECTIONS_CONNECTION._serialized_end=11009
+  _TMUXRESPONSE_SENDCOMMAND._serialized_start=11011
+  _TMUXRESPONSE_SENDCOMMAND._serialized_end=11040
+  _TMUXRESPONSE_SETWINDOWVISIBLE._serialized_start=10395
+  _TMUXRESPONSE_SETWINDOWVISIBLE._serialized_end=10413
+  _TMUXRESPONSE_CREATEWINDOW._serialized_start=11062
+  _TMUXRESPONSE_CREATEWINDOW._serialized_end=11092
+  _TMUXRESPONSE_STATUS._serialized_start=11094
+  _TMUXRESPONSE_STATUS._serialized_end=11181
+  _GETBROADCASTDOMAINSREQUEST._serialized_start=11194
+  _GETBROADCASTDOMAINSREQUEST._serialized_end=11222
+  _BROADCASTDOMAIN._serialized_start=11224
+  _BROADCASTDOMAIN._serialized_end=11262
+  _GETBROADCASTDOMAINSRESPONSE._serialized_start=11264
+  _GETBROADCASTDOMAINSRESPONSE._serialized_end=11345
+  _SETTABLAYOUTREQUEST._serialized_start=11347
+  _SETTABLAYOUTREQUEST._serialized_end=11421
+  _SETTABLAYOUTRESPONSE._serialized_start=11424
+  _SETTABLAYOUTRESPONSE._serialized_end=11567
+  _SETTABLAYOUTRESPONSE_STATUS._serialized_start=11501
+  _SETTABLAYOUTRESPONSE_STATUS._serialized_end=11567
+  _MENUITEMREQUEST._serialized_start=11569
+  _MENUITEMREQUEST._serialized_end=11626
+  _MENUITEMRESPONSE._serialized_start=11629
+  _MENUITEMRESPONSE._serialized_end=11782
+  _MENUITEMRESPONSE_STATUS._serialized_start=11732
+  _MENUITEMRESPONSE_STATUS._serialized_end=11782
+  _RESTARTSESSIONREQUEST._serialized_start=11784
+  _RESTARTSESSIONREQUEST._serialized_end=11851
+  _RESTARTSESSIONRESPONSE._serialized_start=11854
+  _RESTARTSESSIONRESPONSE._serialized_end=12003
+  _RESTARTSESSIONRESPONSE_STATUS._serialized_start=11935
+  _RESTARTSESSIONRESPONSE_STATUS._serialized_end=12003
+  _SERVERORIGINATEDRPCRESULTREQUEST._serialized_start=12005
+  _SERVERORIGINATEDRPCRESULTREQUEST._serialized_end=12117
+  _SERVERORIGINATEDRPCRESULTRESPONSE._serialized_start=12119
+  _SERVERORIGINATEDRPCRESULTRESPONSE._serialized_end=12154
+  _LISTPROFILESREQUEST._serialized_start=12156
+  _LISTPROFILESREQUEST._serialized_end=12212
+  _LISTPROFILESRESPONSE._serialized_start=12215
+  _LISTPROFILESRESPONSE._serialized_end=12349
+  _LISTPROFILESRESPONSE_PROFILE._serialized_start=12295
+  _LISTPROFILESRESPONSE_PROFILE._serialized_end=12349
+  _FOCUSREQUEST._serialized_start=12351
+  _FOCUSREQUEST._serialized_end=12365
+  _FOCUSRESPONSE._serialized_start=12367
+  _FOCUSRESPONSE._serialized_end=12439
+  _SAVEDARRANGEMENTREQUEST._serialized_start=12442
+  _SAVEDARRANGEMENTREQUEST._serialized_end=12599
+  _SAVEDARRANGEMENTREQUEST_ACTION._serialized_start=12558
+  _SAVEDARRANGEMENTREQUEST_ACTION._serialized_end=12599
+  _SAVEDARRANGEMENTRESPONSE._serialized_start=12602
+  _SAVEDARRANGEMENTRESPONSE._serialized_end=12790
+  _SAVEDARRANGEMENTRESPONSE_STATUS._serialized_start=12702
+  _SAVEDARRANGEMENTRESPONSE_STATUS._serialized_end=12790
+  _VARIABLEREQUEST._serialized_start=12793
+  _VARIABLEREQUEST._serialized_end=12986
+  _VARIABLEREQUEST_SET._serialized_start=12943
+  _VARIABLEREQUEST_SET._serialized_end=12977
+  _VARIABLERESPONSE._serialized_start=12989
+  _VARIABLERESPONSE._serialized_end=13218
+  _VARIABLERESPONSE_STATUS._serialized_start=13075
+  _VARIABLERESPONSE_STATUS._serialized_end=13218
+  _ACTIVATEREQUEST._serialized_start=13221
+  _ACTIVATEREQUEST._serialized_end=13499
+  _ACTIVATEREQUEST_APP._serialized_start=13424
+  _ACTIVATEREQUEST_APP._serialized_end=13485
+  _ACTIVATERESPONSE._serialized_start=13501
+  _ACTIVATERESPONSE._serialized_end=13626
+  _ACTIVATERESPONSE_STATUS._serialized_start=13570
+  _ACTIVATERESPONSE_STATUS._serialized_end=13626
+  _INJECTREQUEST._serialized_start=13628
+  _INJECTREQUEST._serialized_end=13677
+  _INJECTRESPONSE._serialized_start=13679
+  _INJECTRESPONSE._serialized_end=13783
+  _INJECTRESPONSE_STATUS._serialized_start=5986
+  _INJECTRESPONSE_STATUS._serialized_end=6025
+  _GETPROPERTYREQUEST._serialized_start=13785
+  _GETPROPERTYREQUEST._serialized_end=13876
+  _GETPROPERTYRESPONSE._serialized_start=13879
+  _GETPROPERTYRESPONSE._serialized_end=14033
+  _GETPROPERTYRESPONSE_STATUS._serialized_start=13974
+  _GETPROPERTYRESPONSE_STATUS._serialized_end=14033
+  _SETPROPERTYREQUEST._serialized_start=14035
+  _SETPROPERTYREQUEST._serialized_end=14146
+  _SETPROPERTYRESPONSE._serialized_start=14149
+  _SETPROPERTYRESPONSE._serialized_end=14344
+  _SETPROPERTYRESPONSE_STATUS._serialized_start=14224
+  _SETPROPERTYRESPONSE_STATUS._serialized_end=14344
+  _REGISTERTOOLREQUEST._serialized_start=14347
+  _REGISTERTOOLREQUEST._serialized_end=14563
+  _REGISTERTOOLREQUEST_TOOLTYPE._serialized_start=14534
+  _REGISTERTOOLREQUEST_TOOLTYPE._serialized_end=14563
+  _RPCREGISTRATIONREQUEST._serialized_start=14566
+  _RPCREGISTRATIONREQUEST._serialized_end=16197
+  _RPCREGISTRATIONREQUEST_RPCARGUMENTSIGNATURE._serialized_start=15127
+  _RPCREGISTRATIONREQUEST_RPCARGUMENTSIGNATURE._serialized_end=15163
+  _RPCREGISTRATIONREQUEST_RPCARGUMENT._serialized_start=15165
+  _RPCREGISTRATIONREQUEST_RPCARGUMENT._serialized_end=15206
+  _RPCREGISTRATIONREQUEST_SESSIONTITLEATTRIBUTES._serialized_start=15208
+  _RPCREGISTRATIONREQUEST_SESSIONTITLEATTRIBUTES._serialized_end=15281
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES._serialized_start=15284
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES._serialized_end=16013
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB._serialized_start=15701
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB._serialized_end=15940
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB_TYPE._serialized_start=15870
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_KNOB_TYPE._serialized_end=15940
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_ICON._serialized_start=15942
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_ICON._serialized_end=15977
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_FORMAT._serialized_start=15979
+  _RPCREGISTRATIONREQUEST_STATUSBARCOMPONENTATTRIBUTES_FORMAT._serialized_end=16013
+  _RPCREGISTRATIONREQUEST_CONTEXTMENUATTRIBUTES._serialized_start=16015
+  _RPCREGISTRATIONREQUEST_CONTEXTMENUATTRIBUTES._serialized_end=16087
+  _RPCREGISTRATIONREQUEST_ROLE._serialized_start=16089
+  _RPCREGISTRATIONREQUEST_ROLE._serialized_end=16171
+  _REGISTERTOOLRESPONSE._serialized_start=16200
+  _REGISTERTOOLRESPONSE._serialized_end=16339
+  _REGISTERTOOLRESPONSE_STATUS._serialized_start=16277
+  _REGISTERTOOLRESPONSE_STATUS._serialized_end=16339
+  _KEYSTROKEPATTERN._serialized_start=16342
+  _KEYSTROKEPATTERN._serialized_end=16532
+  _KEYSTROKEMONITORREQUEST._serialized_start=16534
+  _KEYSTROKEMONITORREQUEST._serialized_end=16635
+  _KEYSTROKEFILTERREQUEST._serialized_start=16637
+  _KEYSTROKEFILTERREQUEST._serialized_end=16715
+  _VARIABLEMONITORREQUEST._serialized_start=16717
+  _VARIABLEMONITORREQUEST._serialized_end=16813
+  _PROFILECHANGEREQUEST._serialized_start=16815
+  _PROFILECHANGEREQUEST._serialized_end=16851
+  _PROMPTMONITORREQUEST._serialized_start=16853
+  _PROMPTMONITORREQUEST._serialized_end=16917
+  _SCREENUPDATEMONITORREQUEST._serialized_start=16919
+  _SCREENUPDATEMONITORREQUEST._serialized_end=17003
+  _NOTIFICATIONREQUEST._serialized_start=17006
+  _NOTIFICATIONREQUEST._serialized_end=17656
+  _NOTIFICATIONRESPONSE._serialized_start=17659
+  _NOTIFICATIONRESPONSE._serialized_end=17904
+  _NOTIFICATIONRESPONSE_STATUS._serialized_start=17737
+  _NOTIFICATIONRESPONSE_STATUS._serialized_end=17904
+  _NOTIFICATION._serialized_start=17907
+  _NOTIFICATION._serialized_end=18902
+  _PROFILECHANGEDNOTIFICATION._serialized_start=18904
+  _PROFILECHANGEDNOTIFICATION._serialized_end=18946
+  _VARIABLECHANGEDNOTIFICATION._serialized_start=18948
+  _VARIABLECHANGEDNOTIFICATION._serialized_end=19073
+  _BROADCASTDOMAINSCHANGEDNOTIFICATION._serialized_start=19075
+  _BROADCASTDOMAINSCHANGEDNOTIFICATION._serialized_end=19164
+  _SERVERORIGINATEDRPC._serialized_start=19167
+  _SERVERORIGINATEDRPC._serialized_end=19311
+  _SERVERORIGINATEDRPC_RPCARGUMENT._serialized_start=19264
+  _SERVERORIGINATEDRPC_RPCARGUMENT._serialized_end=19311
+  _SERVERORIGINATEDRPCNOTIFICATION._serialized_start=19313
+  _SERVERORIGINATEDRPCNOTIFICATION._serialized_end=19408
+  _KEYSTROKENOTIFICATION._serialized_start=19411
+  _KEYSTROKENOTIFICATION._serialized_end=19672
+  _KEYSTROKENOTIFICATION_ACTION._serialized_start=19619
+  _KEYSTROKENOTIFICATION_ACTION._serialized_end=19672
+  _SCREENUPDATENOTIFICATION._serialized_start=19674
+  _SCREENUPDATENOTIFICATION._serialized_end=19759
+  _SCREENUPDATEDELTA._serialized_start=19762
+  _SCREENUPDATEDELTA._serialized_end=19954
+  _SCREENLINEDELTA._serialized_start=19956
+  _SCREENLINEDELTA._serialized_end=20051
+  _PROMPTNOTIFICATIONPROMPT._serialized_start=20053
+  _PROMPTNOTIFICATIONPROMPT._serialized_end=20143
+  _PROMPTNOTIFICATIONCOMMANDSTART._serialized_start=20145
+  _PROMPTNOTIFICATIONCOMMANDSTART._serialized_end=20194
+  _PROMPTNOTIFICATIONCOMMANDEND._serialized_start=20196
+  _PROMPTNOTIFICATIONCOMMANDEND._serialized_end=20242
+  _PROMPTNOTIFICATION._serialized_start=20245
+  _PROMPTNOTIFICATION._serialized_end=20495
+  _LOCATIONCHANGENOTIFICATION._serialized_start=20497
+  _LOCATIONCHANGENOTIFICATION._serialized_end=20599
+  _CUSTOMESCAPESEQUENCENOTIFICATION._serialized_start=20601
+  _CUSTOMESCAPESEQUENCENOTIFICATION._serialized_end=20694
+  _NEWSESSIONNOTIFICATION._serialized_start=20696
+  _NEWSESSIONNOTIFICATION._serialized_end=20740
+  _FOCUSCHANGEDNOTIFICATION._serialized_start=20743
+  _FOCUSCHANGEDNOTIFICATION._serialized_end=21131
+  _FOCUSCHANGEDNOTIFICATION_WINDOW._serialized_start=20904
+  _FOCUSCHANGEDNOTIFICATION_WINDOW._serialized_end=21122
+  _FOCUSCHANGEDNOTIFICATION_WINDOW_WINDOWSTATUS._serialized_start=21010
+  _FOCUSCHANGEDNOTIFICATION_WINDOW_WINDOWSTATUS._serialized_end=21122
+  _TERMINATESESSIONNOTIFICATION._serialized_start=21133
+  _TERMINATESESSIONNOTIFICATION._serialized_end=21183
+  _LAYOUTCHANGEDNOTIFICATION._serialized_start=21185
+  _LAYOUTCHANGEDNOTIFICATION._serialized_end=21274
+  _GETBUFFERREQUEST._serialized_start=21276
+  _GETBUFFERREQUEST._serialized_end=21374
+  _GETBUFFERRESPONSE._serialized_start=21377
+  _GETBUFFERRESPONSE._serialized_end=21737
+  _GETBUFFERRESPONSE_STATUS._serialized_start=21651
+  _GETBUFFERRESPONSE_STATUS._serialized_end=21737
+  _GETPROMPTREQUEST._serialized_start=21739
+  _GETPROMPTREQUEST._serialized_end=21800
+  _GETPROMPTRESPONSE._serialized_start=21803
+  _GETPROMPTRESPONSE._serialized_end=22286
+  _GETPROMPTRESPONSE_STATUS._serialized_start=22151
+  _GETPROMPTRESPONSE_STATUS._serialized_end=22237
+  _GETPROMPTRESPONSE_STATE._serialized_start=22239
+  _GETPROMPTRESPONSE_STATE._serialized_end=22286
+  _LISTPROMPTSREQUEST._serialized_start=22288
+  _LISTPROMPTSREQUEST._serialized_end=22374
+  _LISTPROMPTSRESPONSE._serialized_start=22377
+  _LISTPROMPTSRESPONSE._serialized_end=22521
+  _LISTPROMPTSRESPONSE_STATUS._serialized_start=5986
+  _LISTPROMPTSRESPONSE_STATUS._serialized_end=6025
+  _EXPORTSCROLLBACKREQUEST._serialized_start=22524
+  _EXPORTSCROLLBACKREQUEST._serialized_end=22662
+  _SCROLLBACKPOSITION._serialized_start=22664
+  _SCROLLBACKPOSITION._serialized_end=22729
+  _EXPORTSCROLLBACKRESPONSE._serialized_start=22732
+  _EXPORTSCROLLBACKRESPONSE._serialized_end=23219
+  _EXPORTSCROLLBACKRESPONSE_STATUS._serialized_start=6395
+  _EXPORTSCROLLBACKRESPONSE_STATUS._serialized_end=6457
+  _GETPROFILEPROPERTYREQUEST._serialized_start=23221
+  _GETPROFILEPROPERTYREQUEST._serialized_end=23279
+  _PROFILEPROPERTY._serialized_start=23281
+  _PROFILEPROPERTY._serialized_end=23331
+  _GETPROFILEPROPERTYRESPONSE._serialized_start=23334
+  _GETPROFILEPROPERTYRESPONSE._serialized_end=23545
+  _GETPROFILEPROPERTYRESPONSE_STATUS._serialized_start=23472
+  _GETPROFILEPROPERTYRESPONSE_STATUS._serialized_end=23545
+  _SETPROFILEPROPERTYREQUEST._serialized_start=23548
+  _SETPROFILEPROPERTYREQUEST._serialized_end=23843
+  _SETPROFILEPROPERTYREQUEST_GUIDLIST._serialized_start=23761
+  _SETPROFILEPROPERTYREQUEST_GUIDLIST._serialized_end=23786
+  _SETPROFILEPROPERTYREQUEST_ASSIGNMENT._serialized_start=23788
+  _SETPROFILEPROPERTYREQUEST_ASSIGNMENT._serialized_end=23833
+  _SETPROFILEPROPERTYRESPONSE._serialized_start=23846
+  _SETPROFILEPROPERTYRESPONSE._serialized_end=24015
+  _SETPROFILEPROPERTYRESPONSE_STATUS._serialized_start=23939
+  _SETPROFILEPROPERTYRESPONSE_STATUS._serialized_end=24015
+  _TRANSACTIONREQUEST._serialized_start=24017
+  _TRANSACTIONREQUEST._serialized_end=24052
+  _TRANSACTIONRESPONSE._serialized_start=24055
+  _TRANSACTIONRESPONSE._serialized_end=24198
+  _TRANSACTIONRESPONSE_STATUS._serialized_start=24134
+  _TRANSACTIONRESPONSE_STATUS._serialized_end=24198
+  _LINERANGE._serialized_start=24200
+  _LINERANGE._serialized_end=24323
+  _RANGE._serialized_start=24325
+  _RANGE._serialized_end=24366
+  _COORDRANGE._serialized_start=24368
+  _COORDRANGE._serialized_end=24438
+  _COORD._serialized_start=24440
+  _COORD._serialized_end=24469
+  _RGBCOLOR._serialized_start=24471
+  _RGBCOLOR._serialized_end=24523
+  _URL._serialized_start=24525
+  _URL._serialized_end=24563
+  _CELLSTYLE._serialized_start=24566
+  _CELLSTYLE._serialized_end=25175
+  _LINECONTENTS._serialized_start=25178
+  _LINECONTENTS._serialized_end=25447
+  _LINECONTENTS_CONTINUATION._serialized_start=25379
+  _LINECONTENTS_CONTINUATION._serialized_end=25447
+  _CODEPOINTSPERCELL._serialized_start=25449
+  _CODEPOINTSPERCELL._serialized_end=25513
+  _LISTSESSIONSREQUEST._serialized_start=25515
+  _LISTSESSIONSREQUEST._serialized_end=25536
+  _SENDTEXTREQUEST._serialized_start=25538
+  _SENDTEXTREQUEST._serialized_end=25614
+  _SENDTEXTRESPONSE._serialized_start=25616
+  _SENDTEXTRESPONSE._serialized_end=25724
+  _SENDTEXTRESPONSE_STATUS._serialized_start=5986
+  _SENDTEXTRESPONSE_STATUS._serialized_end=6025
+  _SIZE._serialized_start=25726
+  _SIZE._serialized_end=25763
+  _POINT._serialized_start=25765
+  _POINT._serialized_end=25794
+  _FRAME._serialized_start=25796
+  _FRAME._serialized_end=25862
+  _SESSIONSUMMARY._serialized_start=25864
+  _SESSIONSUMMARY._serialized_end=25985
+  _SPLITTREENODE._serialized_start=25988
+  _SPLITTREENODE._serialized_end=26181
+  _SPLITTREENODE_SPLITTREELINK._serialized_start=26075
+  _SPLITTREENODE_SPLITTREELINK._serialized_end=26181
+  _LISTSESSIONSRESPONSE._serialized_start=26184
+  _LISTSESSIONSRESPONSE._serialized_end=26597
+  _LISTSESSIONSRESPONSE_WINDOW._serialized_start=26311
+  _LISTSESSIONSRESPONSE_WINDOW._serialized_end=26432
+  _LISTSESSIONSRESPONSE_TAB._serialized_start=26435
+  _LISTSESSIONSRESPONSE_TAB._serialized_end=26597
+  _CREATETABREQUEST._serialized_start=26600
+  _CREATETABREQUEST._serialized_end=26759
+  _CREATETABRESPONSE._serialized_start=26762
+  _CREATETABRESPONSE._serialized_end=27002
+  _CREATETABRESPONSE_STATUS._serialized_start=26888
+  _CREATETABRESPONSE_STATUS._serialized_end=27002
+  _SPLITPANEREQUEST._serialized_start=27005
+  _SPLITPANEREQUEST._serialized_end=27259
+  _SPLITPANEREQUEST_SPLITDIRECTION._serialized_start=27213
+  _SPLITPANEREQUEST_SPLITDIRECTION._serialized_end=27259
+  _SPLITPANERESPONSE._serialized_start=27262
+  _SPLITPANERESPONSE._serialized_end=27475
+  _SPLITPANERESPONSE_STATUS._serialized_start=27353
+  _SPLITPANERESPONSE_STATUS._serialized_end=27475
 # @@protoc_insertion_point(module_scope)
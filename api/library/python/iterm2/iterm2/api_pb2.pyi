@@ -169,6 +169,7 @@ class ClientOriginatedMessage(google.protobuf.message.Message):
     CLOSE_REQUEST_FIELD_NUMBER: builtins.int
     INVOKE_FUNCTION_REQUEST_FIELD_NUMBER: builtins.int
     LIST_PROMPTS_REQUEST_FIELD_NUMBER: builtins.int
+    EXPORT_SCROLLBACK_REQUEST_FIELD_NUMBER: builtins.int
     id: builtins.int = ...
 
     @property
@@ -273,6 +274,9 @@ class ClientOriginatedMessage(google.protobuf.message.Message):
     @property
     def list_prompts_request(self) -> global___ListPromptsRequest: ...
 
+    @property
+    def export_scrollback_request(self) -> global___ExportScrollbackRequest: ...
+
     def __init__(self,
         *,
         id : typing.Optional[builtins.int] = ...,
@@ -310,10 +314,11 @@ class ClientOriginatedMessage(google.protobuf.message.Message):
         close_request : typing.Optional[global___CloseRequest] = ...,
         invoke_function_request : typing.Optional[global___InvokeFunctionRequest] = ...,
         list_prompts_request : typing.Optional[global___ListPromptsRequest] = ...,
+        export_scrollback_request : typing.Optional[global___ExportScrollbackRequest] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal[u"activate_request",b"activate_request",u"close_request",b"close_request",u"color_preset_request",b"color_preset_request",u"create_tab_request",b"create_tab_request",u"focus_request",b"focus_request",u"get_broadcast_domains_request",b"get_broadcast_domains_request",u"get_buffer_request",b"get_buffer_request",u"get_profile_property_request",b"get_profile_property_request",u"get_prompt_request",b"get_prompt_request",u"get_property_request",b"get_property_request",u"id",b"id",u"inject_request",b"inject_request",u"invoke_function_request",b"invoke_function_request",u"list_profiles_request",b"list_profiles_request",u"list_prompts_request",b"list_prompts_request",u"list_sessions_request",b"list_sessions_request",u"menu_item_request",b"menu_item_request",u"notification_request",b"notification_request",u"preferences_request",b"preferences_request",u"register_tool_request",b"register_tool_request",u"reorder_tabs_request",b"reorder_tabs_request",u"restart_session_request",b"restart_session_request",u"saved_arrangement_request",b"saved_arrangement_request",u"selection_request",b"selection_request",u"send_text_request",b"send_text_request",u"server_originated_rpc_result_request",b"server_originated_rpc_result_request",u"set_broadcast_domains_request",b"set_broadcast_domains_request",u"set_profile_property_request",b"set_profile_property_request",u"set_property_request",b"set_property_request",u"set_tab_layout_request",b"set_tab_layout_request",u"split_pane_request",b"split_pane_request",u"status_bar_component_request",b"status_bar_component_request",u"submessage",b"submessage",u"tmux_request",b"tmux_request",u"transaction_request",b"transaction_request",u"variable_request",b"variable_request"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal[u"activate_request",b"activate_request",u"close_request",b"close_request",u"color_preset_request",b"color_preset_request",u"create_tab_request",b"create_tab_request",u"focus_request",b"focus_request",u"get_broadcast_domains_request",b"get_broadcast_domains_request",u"get_buffer_request",b"get_buffer_request",u"get_profile_property_request",b"get_profile_property_request",u"get_prompt_request",b"get_prompt_request",u"get_property_request",b"get_property_request",u"id",b"id",u"inject_request",b"inject_request",u"invoke_function_request",b"invoke_function_request",u"list_profiles_request",b"list_profiles_request",u"list_prompts_request",b"list_prompts_request",u"list_sessions_request",b"list_sessions_request",u"menu_item_request",b"menu_item_request",u"notification_request",b"notification_request",u"preferences_request",b"preferences_request",u"register_tool_request",b"register_tool_request",u"reorder_tabs_request",b"reorder_tabs_request",u"restart_session_request",b"restart_session_request",u"saved_arrangement_request",b"saved_arrangement_request",u"selection_request",b"selection_request",u"send_text_request",b"send_text_request",u"server_originated_rpc_result_request",b"server_originated_rpc_result_request",u"set_broadcast_domains_request",b"set_broadcast_domains_request",u"set_profile_property_request",b"set_profile_property_request",u"set_property_request",b"set_property_request",u"set_tab_layout_request",b"set_tab_layout_request",u"split_pane_request",b"split_pane_request",u"status_bar_component_request",b"status_bar_component_request",u"submessage",b"submessage",u"tmux_request",b"tmux_request",u"transaction_request",b"transaction_request",u"variable_request",b"variable_request"]) -> None: ...
-    def WhichOneof(self, oneof_group: typing_extensions.Literal[u"submessage",b"submessage"]) -> typing_extensions.Literal["get_buffer_request","get_prompt_request","transaction_request","notification_request","register_tool_request","set_profile_property_request","list_sessions_request","send_text_request","create_tab_request","split_pane_request","get_profile_property_request","set_property_request","get_property_request","inject_request","activate_request","variable_request","saved_arrangement_request","focus_request","list_profiles_request","server_originated_rpc_result_request","restart_session_request","menu_item_request","set_tab_layout_request","get_broadcast_domains_request","tmux_request","reorder_tabs_request","preferences_request","color_preset_request","selection_request","status_bar_component_request","set_broadcast_domains_request","close_request","invoke_function_request","list_prompts_request"]: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"activate_request",b"activate_request",u"close_request",b"close_request",u"color_preset_request",b"color_preset_request",u"create_tab_request",b"create_tab_request",u"export_scrollback_request",b"export_scrollback_request",u"focus_request",b"focus_request",u"get_broadcast_domains_request",b"get_broadcast_domains_request",u"get_buffer_request",b"get_buffer_request",u"get_profile_property_request",b"get_profile_property_request",u"get_prompt_request",b"get_prompt_request",u"get_property_request",b"get_property_request",u"id",b"id",u"inject_request",b"inject_request",u"invoke_function_request",b"invoke_function_request",u"list_profiles_request",b"list_profiles_request",u"list_prompts_request",b"list_prompts_request",u"list_sessions_request",b"list_sessions_request",u"menu_item_request",b"menu_item_request",u"notification_request",b"notification_request",u"preferences_request",b"preferences_request",u"register_tool_request",b"register_tool_request",u"reorder_tabs_request",b"reorder_tabs_request",u"restart_session_request",b"restart_session_request",u"saved_arrangement_request",b"saved_arrangement_request",u"selection_request",b"selection_request",u"send_text_request",b"send_text_request",u"server_originated_rpc_result_request",b"server_originated_rpc_result_request",u"set_broadcast_domains_request",b"set_broadcast_domains_request",u"set_profile_property_request",b"set_profile_property_request",u"set_property_request",b"set_property_request",u"set_tab_layout_request",b"set_tab_layout_request",u"split_pane_request",b"split_pane_request",u"status_bar_component_request",b"status_bar_component_request",u"submessage",b"submessage",u"tmux_request",b"tmux_request",u"transaction_request",b"transaction_request",u"variable_request",b"variable_request"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"activate_request",b"activate_request",u"close_request",b"close_request",u"color_preset_request",b"color_preset_request",u"create_tab_request",b"create_tab_request",u"export_scrollback_request",b"export_scrollback_request",u"focus_request",b"focus_request",u"get_broadcast_domains_request",b"get_broadcast_domains_request",u"get_buffer_request",b"get_buffer_request",u"get_profile_property_request",b"get_profile_property_request",u"get_prompt_request",b"get_prompt_request",u"get_property_request",b"get_property_request",u"id",b"id",u"inject_request",b"inject_request",u"invoke_function_request",b"invoke_function_request",u"list_profiles_request",b"list_profiles_request",u"list_prompts_request",b"list_prompts_request",u"list_sessions_request",b"list_sessions_request",u"menu_item_request",b"menu_item_request",u"notification_request",b"notification_request",u"preferences_request",b"preferences_request",u"register_tool_request",b"register_tool_request",u"reorder_tabs_request",b"reorder_tabs_request",u"restart_session_request",b"restart_session_request",u"saved_arrangement_request",b"saved_arrangement_request",u"selection_request",b"selection_request",u"send_text_request",b"send_text_request",u"server_originated_rpc_result_request",b"server_originated_rpc_result_request",u"set_broadcast_domains_request",b"set_broadcast_domains_request",u"set_profile_property_request",b"set_profile_property_request",u"set_property_request",b"set_property_request",u"set_tab_layout_request",b"set_tab_layout_request",u"split_pane_request",b"split_pane_request",u"status_bar_component_request",b"status_bar_component_request",u"submessage",b"submessage",u"tmux_request",b"tmux_request",u"transaction_request",b"transaction_request",u"variable_request",b"variable_request"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal[u"submessage",b"submessage"]) -> typing_extensions.Literal["get_buffer_request","get_prompt_request","transaction_request","notification_request","register_tool_request","set_profile_property_request","list_sessions_request","send_text_request","create_tab_request","split_pane_request","get_profile_property_request","set_property_request","get_property_request","inject_request","activate_request","variable_request","saved_arrangement_request","focus_request","list_profiles_request","server_originated_rpc_result_request","restart_session_request","menu_item_request","set_tab_layout_request","get_broadcast_domains_request","tmux_request","reorder_tabs_request","preferences_request","color_preset_request","selection_request","status_bar_component_request","set_broadcast_domains_request","close_request","invoke_function_request","list_prompts_request","export_scrollback_request"]: ...
 global___ClientOriginatedMessage = ClientOriginatedMessage
 
 class ServerOriginatedMessage(google.protobuf.message.Message):
@@ -354,6 +359,7 @@ class ServerOriginatedMessage(google.protobuf.message.Message):
     CLOSE_RESPONSE_FIELD_NUMBER: builtins.int
     INVOKE_FUNCTION_RESPONSE_FIELD_NUMBER: builtins.int
     LIST_PROMPTS_RESPONSE_FIELD_NUMBER: builtins.int
+    EXPORT_SCROLLBACK_RESPONSE_FIELD_NUMBER: builtins.int
     NOTIFICATION_FIELD_NUMBER: builtins.int
     id: builtins.int = ...
     error: typing.Text = ...
@@ -460,6 +466,9 @@ class ServerOriginatedMessage(google.protobuf.message.Message):
     @property
     def list_prompts_response(self) -> global___ListPromptsResponse: ...
 
+    @property
+    def export_scrollback_response(self) -> global___ExportScrollbackResponse: ...
+
     @property
     def notification(self) -> global___Notification: ...
 
@@ -501,11 +510,12 @@ class ServerOriginatedMessage(google.protobuf.message.Message):
         close_response : typing.Optional[global___CloseResponse] = ...,
         invoke_function_response : typing.Optional[global___InvokeFunctionResponse] = ...,
         list_prompts_response : typing.Optional[global___ListPromptsResponse] = ...,
+        export_scrollback_response : typing.Optional[global___ExportScrollbackResponse] = ...,
         notification : typing.Optional[global___Notification] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal[u"activate_response",b"activate_response",u"close_response",b"close_response",u"color_preset_response",b"color_preset_response",u"create_tab_response",b"create_tab_response",u"error",b"error",u"focus_response",b"focus_response",u"get_broadcast_domains_response",b"get_broadcast_domains_response",u"get_buffer_response",b"get_buffer_response",u"get_profile_property_response",b"get_profile_property_response",u"get_prompt_response",b"get_prompt_response",u"get_property_response",b"get_property_response",u"id",b"id",u"inject_response",b"inject_response",u"invoke_function_response",b"invoke_function_response",u"list_profiles_response",b"list_profiles_response",u"list_prompts_response",b"list_prompts_response",u"list_sessions_response",b"list_sessions_response",u"menu_item_response",b"menu_item_response",u"notification",b"notification",u"notification_response",b"notification_response",u"preferences_response",b"preferences_response",u"register_tool_response",b"register_tool_response",u"reorder_tabs_response",b"reorder_tabs_response",u"restart_session_response",b"restart_session_response",u"saved_arrangement_response",b"saved_arrangement_response",u"selection_response",b"selection_response",u"send_text_response",b"send_text_response",u"server_originated_rpc_result_response",b"server_originated_rpc_result_response",u"set_broadcast_domains_response",b"set_broadcast_domains_response",u"set_profile_property_response",b"set_profile_property_response",u"set_property_response",b"set_property_response",u"set_tab_layout_response",b"set_tab_layout_response",u"split_pane_response",b"split_pane_response",u"status_bar_component_response",b"status_bar_component_response",u"submessage",b"submessage",u"tmux_response",b"tmux_response",u"transaction_response",b"transaction_response",u"variable_response",b"variable_response"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal[u"activate_response",b"activate_response",u"close_response",b"close_response",u"color_preset_response",b"color_preset_response",u"create_tab_response",b"create_tab_response",u"error",b"error",u"focus_response",b"focus_response",u"get_broadcast_domains_response",b"get_broadcast_domains_response",u"get_buffer_response",b"get_buffer_response",u"get_profile_property_response",b"get_profile_property_response",u"get_prompt_response",b"get_prompt_response",u"get_property_response",b"get_property_response",u"id",b"id",u"inject_response",b"inject_response",u"invoke_function_response",b"invoke_function_response",u"list_profiles_response",b"list_profiles_response",u"list_prompts_response",b"list_prompts_response",u"list_sessions_response",b"list_sessions_response",u"menu_item_response",b"menu_item_response",u"notification",b"notification",u"notification_response",b"notification_response",u"preferences_response",b"preferences_response",u"register_tool_response",b"register_tool_response",u"reorder_tabs_response",b"reorder_tabs_response",u"restart_session_response",b"restart_session_response",u"saved_arrangement_response",b"saved_arrangement_response",u"selection_response",b"selection_response",u"send_text_response",b"send_text_response",u"server_originated_rpc_result_response",b"server_originated_rpc_result_response",u"set_broadcast_domains_response",b"set_broadcast_domains_response",u"set_profile_property_response",b"set_profile_property_response",u"set_property_response",b"set_property_response",u"set_tab_layout_response",b"set_tab_layout_response",u"split_pane_response",b"split_pane_response",u"status_bar_component_response",b"status_bar_component_response",u"submessage",b"submessage",u"tmux_response",b"tmux_response",u"transaction_response",b"transaction_response",u"variable_response",b"variable_response"]) -> None: ...
-    def WhichOneof(self, oneof_group: typing_extensions.Literal[u"submessage",b"submessage"]) -> typing_extensions.Literal["error","get_buffer_response","get_prompt_response","transaction_response","notification_response","register_tool_response","set_profile_property_response","list_sessions_response","send_text_response","create_tab_response","split_pane_response","get_profile_property_response","set_property_response","get_property_response","inject_response","activate_response","variable_response","saved_arrangement_response","focus_response","list_profiles_response","server_originated_rpc_result_response","restart_session_response","menu_item_response","set_tab_layout_response","get_broadcast_domains_response","tmux_response","reorder_tabs_response","preferences_response","color_preset_response","selection_response","status_bar_component_response","set_broadcast_domains_response","close_response","invoke_function_response","list_prompts_response","notification"]: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"activate_response",b"activate_response",u"close_response",b"close_response",u"color_preset_response",b"color_preset_response",u"create_tab_response",b"create_tab_response",u"error",b"error",u"export_scrollback_response",b"export_scrollback_response",u"focus_response",b"focus_response",u"get_broadcast_domains_response",b"get_broadcast_domains_response",u"get_buffer_response",b"get_buffer_response",u"get_profile_property_response",b"get_profile_property_response",u"get_prompt_response",b"get_prompt_response",u"get_property_response",b"get_property_response",u"id",b"id",u"inject_response",b"inject_response",u"invoke_function_response",b"invoke_function_response",u"list_profiles_response",b"list_profiles_response",u"list_prompts_response",b"list_prompts_response",u"list_sessions_response",b"list_sessions_response",u"menu_item_response",b"menu_item_response",u"notification",b"notification",u"notification_response",b"notification_response",u"preferences_response",b"preferences_response",u"register_tool_response",b"register_tool_response",u"reorder_tabs_response",b"reorder_tabs_response",u"restart_session_response",b"restart_session_response",u"saved_arrangement_response",b"saved_arrangement_response",u"selection_response",b"selection_response",u"send_text_response",b"send_text_response",u"server_originated_rpc_result_response",b"server_originated_rpc_result_response",u"set_broadcast_domains_response",b"set_broadcast_domains_response",u"set_profile_property_response",b"set_profile_property_response",u"set_property_response",b"set_property_response",u"set_tab_layout_response",b"set_tab_layout_response",u"split_pane_response",b"split_pane_response",u"status_bar_component_response",b"status_bar_component_response",u"submessage",b"submessage",u"tmux_response",b"tmux_response",u"transaction_response",b"transaction_response",u"variable_response",b"variable_response"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"activate_response",b"activate_response",u"close_response",b"close_response",u"color_preset_response",b"color_preset_response",u"create_tab_response",b"create_tab_response",u"error",b"error",u"export_scrollback_response",b"export_scrollback_response",u"focus_response",b"focus_response",u"get_broadcast_domains_response",b"get_broadcast_domains_response",u"get_buffer_response",b"get_buffer_response",u"get_profile_property_response",b"get_profile_property_response",u"get_prompt_response",b"get_prompt_response",u"get_property_response",b"get_property_response",u"id",b"id",u"inject_response",b"inject_response",u"invoke_function_response",b"invoke_function_response",u"list_profiles_response",b"list_profiles_response",u"list_prompts_response",b"list_prompts_response",u"list_sessions_response",b"list_sessions_response",u"menu_item_response",b"menu_item_response",u"notification",b"notification",u"notification_response",b"notification_response",u"preferences_response",b"preferences_response",u"register_tool_response",b"register_tool_response",u"reorder_tabs_response",b"reorder_tabs_response",u"restart_session_response",b"restart_session_response",u"saved_arrangement_response",b"saved_arrangement_response",u"selection_response",b"selection_response",u"send_text_response",b"send_text_response",u"server_originated_rpc_result_response",b"server_originated_rpc_result_response",u"set_broadcast_domains_response",b"set_broadcast_domains_response",u"set_profile_property_response",b"set_profile_property_response",u"set_property_response",b"set_property_response",u"set_tab_layout_response",b"set_tab_layout_response",u"split_pane_response",b"split_pane_response",u"status_bar_component_response",b"status_bar_component_response",u"submessage",b"submessage",u"tmux_response",b"tmux_response",u"transaction_response",b"transaction_response",u"variable_response",b"variable_response"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal[u"submessage",b"submessage"]) -> typing_extensions.Literal["error","get_buffer_response","get_prompt_response","transaction_response","notification_response","register_tool_response","set_profile_property_response","list_sessions_response","send_text_response","create_tab_response","split_pane_response","get_profile_property_response","set_property_response","get_property_response","inject_response","activate_response","variable_response","saved_arrangement_response","focus_response","list_profiles_response","server_originated_rpc_result_response","restart_session_response","menu_item_response","set_tab_layout_response","get_broadcast_domains_response","tmux_response","reorder_tabs_response","preferences_response","color_preset_response","selection_response","status_bar_component_response","set_broadcast_domains_response","close_response","invoke_function_response","list_prompts_response","export_scrollback_response","notification"]: ...
 global___ServerOriginatedMessage = ServerOriginatedMessage
 
 class InvokeFunctionRequest(google.protobuf.message.Message):
@@ -2576,6 +2586,25 @@ class PromptMonitorRequest(google.protobuf.message.Message):
     def ClearField(self, field_name: typing_extensions.Literal[u"modes",b"modes"]) -> None: ...
 global___PromptMonitorRequest = PromptMonitorRequest
 
+class ScreenUpdateMonitorRequest(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
+    DELTAS_FIELD_NUMBER: builtins.int
+    INCLUDE_STYLES_FIELD_NUMBER: builtins.int
+    RESYNC_FIELD_NUMBER: builtins.int
+    deltas: builtins.bool = ...
+    include_styles: builtins.bool = ...
+    resync: builtins.bool = ...
+
+    def __init__(self,
+        *,
+        deltas : typing.Optional[builtins.bool] = ...,
+        include_styles : typing.Optional[builtins.bool] = ...,
+        resync : typing.Optional[builtins.bool] = ...,
+        ) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"deltas",b"deltas",u"include_styles",b"include_styles",u"resync",b"resync"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"deltas",b"deltas",u"include_styles",b"include_styles",u"resync",b"resync"]) -> None: ...
+global___ScreenUpdateMonitorRequest = ScreenUpdateMonitorRequest
+
 class NotificationRequest(google.protobuf.message.Message):
     DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
     SESSION_FIELD_NUMBER: builtins.int
@@ -2587,9 +2616,14 @@ class NotificationRequest(google.protobuf.message.Message):
     PROFILE_CHANGE_REQUEST_FIELD_NUMBER: builtins.int
     KEYSTROKE_FILTER_REQUEST_FIELD_NUMBER: builtins.int
     PROMPT_MONITOR_REQUEST_FIELD_NUMBER: builtins.int
+    SCREEN_UPDATE_MONITOR_REQUEST_FIELD_NUMBER: builtins.int
+    COALESCING_WINDOW_MS_FIELD_NUMBER: builtins.int
+    MAX_RATE_FIELD_NUMBER: builtins.int
     session: typing.Text = ...
     subscribe: builtins.bool = ...
     notification_type: global___NotificationType.V = ...
+    coalescing_window_ms: builtins.int = ...
+    max_rate: builtins.float = ...
 
     @property
     def rpc_registration_request(self) -> global___RPCRegistrationRequest: ...
@@ -2609,6 +2643,9 @@ class NotificationRequest(google.protobuf.message.Message):
     @property
     def prompt_monitor_request(self) -> global___PromptMonitorRequest: ...
 
+    @property
+    def screen_update_monitor_request(self) -> global___ScreenUpdateMonitorRequest: ...
+
     def __init__(self,
         *,
         session : typing.Optional[typing.Text] = ...,
@@ -2620,10 +2657,13 @@ class NotificationRequest(google.protobuf.message.Message):
         profile_change_request : typing.Optional[global___ProfileChangeRequest] = ...,
         keystroke_filter_request : typing.Optional[global___KeystrokeFilterRequest] = ...,
         prompt_monitor_request : typing.Optional[global___PromptMonitorRequest] = ...,
+        screen_update_monitor_request : typing.Optional[global___ScreenUpdateMonitorRequest] = ...,
+        coalescing_window_ms : typing.Optional[builtins.int] = ...,
+        max_rate : typing.Optional[builtins.float] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal[u"arguments",b"arguments",u"keystroke_filter_request",b"keystroke_filter_request",u"keystroke_monitor_request",b"keystroke_monitor_request",u"notification_type",b"notification_type",u"profile_change_request",b"profile_change_request",u"prompt_monitor_request",b"prompt_monitor_request",u"rpc_registration_request",b"rpc_registration_request",u"session",b"session",u"subscribe",b"subscribe",u"variable_monitor_request",b"variable_monitor_request"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal[u"arguments",b"arguments",u"keystroke_filter_request",b"keystroke_filter_request",u"keystroke_monitor_request",b"keystroke_monitor_request",u"notification_type",b"notification_type",u"profile_change_request",b"profile_change_request",u"prompt_monitor_request",b"prompt_monitor_request",u"rpc_registration_request",b"rpc_registration_request",u"session",b"session",u"subscribe",b"subscribe",u"variable_monitor_request",b"variable_monitor_request"]) -> None: ...
-    def WhichOneof(self, oneof_group: typing_extensions.Literal[u"arguments",b"arguments"]) -> typing_extensions.Literal["rpc_registration_request","keystroke_monitor_request","variable_monitor_request","profile_change_request","keystroke_filter_request","prompt_monitor_request"]: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"arguments",b"arguments",u"coalescing_window_ms",b"coalescing_window_ms",u"keystroke_filter_request",b"keystroke_filter_request",u"keystroke_monitor_request",b"keystroke_monitor_request",u"max_rate",b"max_rate",u"notification_type",b"notification_type",u"profile_change_request",b"profile_change_request",u"prompt_monitor_request",b"prompt_monitor_request",u"rpc_registration_request",b"rpc_registration_request",u"screen_update_monitor_request",b"screen_update_monitor_request",u"session",b"session",u"subscribe",b"subscribe",u"variable_monitor_request",b"variable_monitor_request"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"arguments",b"arguments",u"coalescing_window_ms",b"coalescing_window_ms",u"keystroke_filter_request",b"keystroke_filter_request",u"keystroke_monitor_request",b"keystroke_monitor_request",u"max_rate",b"max_rate",u"notification_type",b"notification_type",u"profile_change_request",b"profile_change_request",u"prompt_monitor_request",b"prompt_monitor_request",u"rpc_registration_request",b"rpc_registration_request",u"screen_update_monitor_request",b"screen_update_monitor_request",u"session",b"session",u"subscribe",b"subscribe",u"variable_monitor_request",b"variable_monitor_request"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal[u"arguments",b"arguments"]) -> typing_extensions.Literal["rpc_registration_request","keystroke_monitor_request","variable_monitor_request","profile_change_request","keystroke_filter_request","prompt_monitor_request","screen_update_monitor_request"]: ...
 global___NotificationRequest = NotificationRequest
 
 class NotificationResponse(google.protobuf.message.Message):
@@ -2673,6 +2713,8 @@ class Notification(google.protobuf.message.Message):
     BROADCAST_DOMAINS_CHANGED_FIELD_NUMBER: builtins.int
     VARIABLE_CHANGED_NOTIFICATION_FIELD_NUMBER: builtins.int
     PROFILE_CHANGED_NOTIFICATION_FIELD_NUMBER: builtins.int
+    COALESCED_COUNT_FIELD_NUMBER: builtins.int
+    coalesced_count: builtins.int = ...
 
     @property
     def keystroke_notification(self) -> global___KeystrokeNotification: ...
@@ -2728,9 +2770,10 @@ class Notification(google.protobuf.message.Message):
         broadcast_domains_changed : typing.Optional[global___BroadcastDomainsChangedNotification] = ...,
         variable_changed_notification : typing.Optional[global___VariableChangedNotification] = ...,
         profile_changed_notification : typing.Optional[global___ProfileChangedNotification] = ...,
+        coalesced_count : typing.Optional[builtins.int] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal[u"broadcast_domains_changed",b"broadcast_domains_changed",u"custom_escape_sequence_notification",b"custom_escape_sequence_notification",u"focus_changed_notification",b"focus_changed_notification",u"keystroke_notification",b"keystroke_notification",u"layout_changed_notification",b"layout_changed_notification",u"location_change_notification",b"location_change_notification",u"new_session_notification",b"new_session_notification",u"profile_changed_notification",b"profile_changed_notification",u"prompt_notification",b"prompt_notification",u"screen_update_notification",b"screen_update_notification",u"server_originated_rpc_notification",b"server_originated_rpc_notification",u"terminate_session_notification",b"terminate_session_notification",u"variable_changed_notification",b"variable_changed_notification"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal[u"broadcast_domains_changed",b"broadcast_domains_changed",u"custom_escape_sequence_notification",b"custom_escape_sequence_notification",u"focus_changed_notification",b"focus_changed_notification",u"keystroke_notification",b"keystroke_notification",u"layout_changed_notification",b"layout_changed_notification",u"location_change_notification",b"location_change_notification",u"new_session_notification",b"new_session_notification",u"profile_changed_notification",b"profile_changed_notification",u"prompt_notification",b"prompt_notification",u"screen_update_notification",b"screen_update_notification",u"server_originated_rpc_notification",b"server_originated_rpc_notification",u"terminate_session_notification",b"terminate_session_notification",u"variable_changed_notification",b"variable_changed_notification"]) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"broadcast_domains_changed",b"broadcast_domains_changed",u"coalesced_count",b"coalesced_count",u"custom_escape_sequence_notification",b"custom_escape_sequence_notification",u"focus_changed_notification",b"focus_changed_notification",u"keystroke_notification",b"keystroke_notification",u"layout_changed_notification",b"layout_changed_notification",u"location_change_notification",b"location_change_notification",u"new_session_notification",b"new_session_notification",u"profile_changed_notification",b"profile_changed_notification",u"prompt_notification",b"prompt_notification",u"screen_update_notification",b"screen_update_notification",u"server_originated_rpc_notification",b"server_originated_rpc_notification",u"terminate_session_notification",b"terminate_session_notification",u"variable_changed_notification",b"variable_changed_notification"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"broadcast_domains_changed",b"broadcast_domains_changed",u"coalesced_count",b"coalesced_count",u"custom_escape_sequence_notification",b"custom_escape_sequence_notification",u"focus_changed_notification",b"focus_changed_notification",u"keystroke_notification",b"keystroke_notification",u"layout_changed_notification",b"layout_changed_notification",u"location_change_notification",b"location_change_notification",u"new_session_notification",b"new_session_notification",u"profile_changed_notification",b"profile_changed_notification",u"prompt_notification",b"prompt_notification",u"screen_update_notification",b"screen_update_notification",u"server_originated_rpc_notification",b"server_originated_rpc_notification",u"terminate_session_notification",b"terminate_session_notification",u"variable_changed_notification",b"variable_changed_notification"]) -> None: ...
 global___Notification = Notification
 
 class ProfileChangedNotification(google.protobuf.message.Message):
@@ -2875,16 +2918,79 @@ global___KeystrokeNotification = KeystrokeNotification
 class ScreenUpdateNotification(google.protobuf.message.Message):
     DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
     SESSION_FIELD_NUMBER: builtins.int
+    DELTA_FIELD_NUMBER: builtins.int
     session: typing.Text = ...
 
+    @property
+    def delta(self) -> global___ScreenUpdateDelta: ...
+
     def __init__(self,
         *,
         session : typing.Optional[typing.Text] = ...,
+        delta : typing.Optional[global___ScreenUpdateDelta] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal[u"session",b"session"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal[u"session",b"session"]) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"delta",b"delta",u"session",b"session"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"delta",b"delta",u"session",b"session"]) -> None: ...
 global___ScreenUpdateNotification = ScreenUpdateNotification
 
+class ScreenUpdateDelta(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
+    SEQUENCE_NUMBER_FIELD_NUMBER: builtins.int
+    FULL_REFRESH_FIELD_NUMBER: builtins.int
+    SIZE_FIELD_NUMBER: builtins.int
+    FIRST_LINE_NUMBER_FIELD_NUMBER: builtins.int
+    LINES_FIELD_NUMBER: builtins.int
+    CURSOR_FIELD_NUMBER: builtins.int
+    sequence_number: builtins.int = ...
+    full_refresh: builtins.bool = ...
+    first_line_number: builtins.int = ...
+
+    @property
+    def size(self) -> global___Size: ...
+
+    @property
+    def lines(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___ScreenLineDelta]: ...
+
+    @property
+    def cursor(self) -> global___Coord: ...
+
+    def __init__(self,
+        *,
+        sequence_number : typing.Optional[builtins.int] = ...,
+        full_refresh : typing.Optional[builtins.bool] = ...,
+        size : typing.Optional[global___Size] = ...,
+        first_line_number : typing.Optional[builtins.int] = ...,
+        lines : typing.Optional[typing.Iterable[global___ScreenLineDelta]] = ...,
+        cursor : typing.Optional[global___Coord] = ...,
+        ) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"cursor",b"cursor",u"first_line_number",b"first_line_number",u"full_refresh",b"full_refresh",u"sequence_number",b"sequence_number",u"size",b"size"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"cursor",b"cursor",u"first_line_number",b"first_line_number",u"full_refresh",b"full_refresh",u"lines",b"lines",u"sequence_number",b"sequence_number",u"size",b"size"]) -> None: ...
+global___ScreenUpdateDelta = ScreenUpdateDelta
+
+class ScreenLineDelta(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
+    Y_FIELD_NUMBER: builtins.int
+    X_FIELD_NUMBER: builtins.int
+    LENGTH_FIELD_NUMBER: builtins.int
+    CONTENTS_FIELD_NUMBER: builtins.int
+    y: builtins.int = ...
+    x: builtins.int = ...
+    length: builtins.int = ...
+
+    @property
+    def contents(self) -> global___LineContents: ...
+
+    def __init__(self,
+        *,
+        y : typing.Optional[builtins.int] = ...,
+        x : typing.Optional[builtins.int] = ...,
+        length : typing.Optional[builtins.int] = ...,
+        contents : typing.Optional[global___LineContents] = ...,
+        ) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"contents",b"contents",u"length",b"length",u"x",b"x",u"y",b"y"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"contents",b"contents",u"length",b"length",u"x",b"x",u"y",b"y"]) -> None: ...
+global___ScreenLineDelta = ScreenLineDelta
+
 class PromptNotificationPrompt(google.protobuf.message.Message):
     DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
     PLACEHOLDER_FIELD_NUMBER: builtins.int
@@ -3291,6 +3397,111 @@ class ListPromptsResponse(google.protobuf.message.Message):
     def ClearField(self, field_name: typing_extensions.Literal[u"status",b"status",u"unique_prompt_id",b"unique_prompt_id"]) -> None: ...
 global___ListPromptsResponse = ListPromptsResponse
 
+class ExportScrollbackRequest(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
+    SESSION_FIELD_NUMBER: builtins.int
+    POSITION_FIELD_NUMBER: builtins.int
+    MAX_CELLS_FIELD_NUMBER: builtins.int
+    INCLUDE_STYLES_FIELD_NUMBER: builtins.int
+    session: typing.Text = ...
+    max_cells: builtins.int = ...
+    include_styles: builtins.bool = ...
+
+    @property
+    def position(self) -> global___ScrollbackPosition: ...
+
+    def __init__(self,
+        *,
+        session : typing.Optional[typing.Text] = ...,
+        position : typing.Optional[global___ScrollbackPosition] = ...,
+        max_cells : typing.Optional[builtins.int] = ...,
+        include_styles : typing.Optional[builtins.bool] = ...,
+        ) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"include_styles",b"include_styles",u"max_cells",b"max_cells",u"position",b"position",u"session",b"session"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"include_styles",b"include_styles",u"max_cells",b"max_cells",u"position",b"position",u"session",b"session"]) -> None: ...
+global___ExportScrollbackRequest = ExportScrollbackRequest
+
+
+class ScrollbackPosition(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
+    ABSOLUTE_POSITION_FIELD_NUMBER: builtins.int
+    Y_OFFSET_FIELD_NUMBER: builtins.int
+    absolute_position: builtins.int = ...
+    y_offset: builtins.int = ...
+
+    def __init__(self,
+        *,
+        absolute_position : typing.Optional[builtins.int] = ...,
+        y_offset : typing.Optional[builtins.int] = ...,
+        ) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"absolute_position",b"absolute_position",u"y_offset",b"y_offset"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"absolute_position",b"absolute_position",u"y_offset",b"y_offset"]) -> None: ...
+global___ScrollbackPosition = ScrollbackPosition
+
+
+class ExportScrollbackResponse(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
+    class _Status(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[Status.V], builtins.type):
+        DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor = ...
+        OK = ExportScrollbackResponse.Status.V(0)
+        SESSION_NOT_FOUND = ExportScrollbackResponse.Status.V(1)
+        REQUEST_MALFORMED = ExportScrollbackResponse.Status.V(2)
+    class Status(metaclass=_Status):
+        V = typing.NewType('V', builtins.int)
+    OK = ExportScrollbackResponse.Status.V(0)
+    SESSION_NOT_FOUND = ExportScrollbackResponse.Status.V(1)
+    REQUEST_MALFORMED = ExportScrollbackResponse.Status.V(2)
+
+    STATUS_FIELD_NUMBER: builtins.int
+    POSITION_FIELD_NUMBER: builtins.int
+    NEXT_POSITION_FIELD_NUMBER: builtins.int
+    AT_END_FIELD_NUMBER: builtins.int
+    CONTINUES_LINE_FIELD_NUMBER: builtins.int
+    TEXT_FIELD_NUMBER: builtins.int
+    LINE_LENGTHS_FIELD_NUMBER: builtins.int
+    CODE_POINTS_PER_CELL_FIELD_NUMBER: builtins.int
+    STYLE_TABLE_FIELD_NUMBER: builtins.int
+    STYLE_RUN_LENGTHS_FIELD_NUMBER: builtins.int
+    STYLE_RUN_INDEXES_FIELD_NUMBER: builtins.int
+    status: global___ExportScrollbackResponse.Status.V = ...
+    at_end: builtins.bool = ...
+    continues_line: builtins.bool = ...
+    text: typing.Text = ...
+    line_lengths: google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.int] = ...
+    style_run_lengths: google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.int] = ...
+    style_run_indexes: google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.int] = ...
+
+    @property
+    def position(self) -> global___ScrollbackPosition: ...
+
+    @property
+    def next_position(self) -> global___ScrollbackPosition: ...
+
+    @property
+    def code_points_per_cell(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___CodePointsPerCell]: ...
+
+    @property
+    def style_table(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___CellStyle]: ...
+
+    def __init__(self,
+        *,
+        status : typing.Optional[global___ExportScrollbackResponse.Status.V] = ...,
+        position : typing.Optional[global___ScrollbackPosition] = ...,
+        next_position : typing.Optional[global___ScrollbackPosition] = ...,
+        at_end : typing.Optional[builtins.bool] = ...,
+        continues_line : typing.Optional[builtins.bool] = ...,
+        text : typing.Optional[typing.Text] = ...,
+        line_lengths : typing.Optional[typing.Iterable[builtins.int]] = ...,
+        code_points_per_cell : typing.Optional[typing.Iterable[global___CodePointsPerCell]] = ...,
+        style_table : typing.Optional[typing.Iterable[global___CellStyle]] = ...,
+        style_run_lengths : typing.Optional[typing.Iterable[builtins.int]] = ...,
+        style_run_indexes : typing.Optional[typing.Iterable[builtins.int]] = ...,
+        ) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal[u"at_end",b"at_end",u"continues_line",b"continues_line",u"next_position",b"next_position",u"position",b"position",u"status",b"status",u"text",b"text"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal[u"at_end",b"at_end",u"code_points_per_cell",b"code_points_per_cell",u"continues_line",b"continues_line",u"line_lengths",b"line_lengths",u"next_position",b"next_position",u"position",b"position",u"status",b"status",u"style_run_indexes",b"style_run_indexes",u"style_run_lengths",b"style_run_lengths",u"style_table",b"style_table",u"text",b"text"]) -> None: ...
+global___ExportScrollbackResponse = ExportScrollbackResponse
+
+
 class GetProfilePropertyRequest(google.protobuf.message.Message):
     DESCRIPTOR: google.protobuf.descriptor.Descriptor = ...
     SESSION_FIELD_NUMBER: builtins.int
@@ -149,7 +149,8 @@ async def async_filter_keystrokes(
 
 
 async def async_subscribe_to_screen_update_notification(
-        connection, callback, session=None):
+        connection, callback, session=None, deltas=False,
+        include_styles=False, coalescing_window_ms=None, max_rate=None):
     """
     Registers a callback to be run when the screen contents change.
 
@@ -157,15 +158,58 @@ async def async_subscribe_to_screen_update_notification(
     :param callback: A coroutine taking two arguments: an :class:`Connection`
         and iterm2.api_pb2.ScreenUpdateNotification..
     :param session: The session to monitor, or None.
+    :param deltas: If True, each notification's `delta` describes the cells
+        that changed since the previous notification.
+    :param include_styles: If True, deltas include the style of each cell.
+    :param coalescing_window_ms: If set, notifications for a session come at
+        most once per this many milliseconds. Ignored with `deltas`.
+    :param max_rate: If set, the maximum number of notifications per second
+        for a session. Ignored with `deltas`.
 
     :returns: A token that can be passed to unsubscribe.
     """
+    sumr = None
+    if deltas:
+        sumr = iterm2.api_pb2.ScreenUpdateMonitorRequest()
+        sumr.deltas = True
+        sumr.include_styles = include_styles
     return await _async_subscribe(
         connection,
         True,
         iterm2.api_pb2.NOTIFY_ON_SCREEN_UPDATE,
         callback,
-        session=session)
+        session=session,
+        screen_update_monitor_request=sumr,
+        coalescing_window_ms=coalescing_window_ms,
+        max_rate=max_rate)
+
+
+async def async_request_screen_update_resync(connection, session):
+    """
+    Asks for the next screen update delta to be a full refresh.
+
+    Use this when a delta's `sequence_number` is not one more than that of
+    the previous delta, which means some updates were missed. The full refresh
+    is sent right away.
+
+    :param connection: A connected :class:`Connection`.
+    :param session: The ID of the session whose deltas are out of sync.
+        Resyncs are per-session even if you subscribed to all sessions.
+    """
+    sumr = iterm2.api_pb2.ScreenUpdateMonitorRequest()
+    sumr.deltas = True
+    sumr.resync = True
+    response = await iterm2.rpc.async_notification_request(
+        connection,
+        True,
+        iterm2.api_pb2.NOTIFY_ON_SCREEN_UPDATE,
+        session,
+        screen_update_monitor_request=sumr)
+    status = response.notification_response.status
+    # pylint: disable=no-member
+    if status != iterm2.api_pb2.NotificationResponse.Status.Value("OK"):
+        raise SubscriptionException(
+            iterm2.api_pb2.NotificationResponse.Status.Name(status))
 
 
 async def async_subscribe_to_prompt_notification(
@@ -384,7 +428,8 @@ async def async_subscribe_to_server_originated_rpc_notification(
 
 
 async def async_subscribe_to_variable_change_notification(
-        connection, callback, scope, name, identifier):
+        connection, callback, scope, name, identifier,
+        coalescing_window_ms=None, max_rate=None):
     """
     Registers a callback to be invoked when a variable changes.
 
@@ -396,6 +441,11 @@ async def async_subscribe_to_variable_change_notification(
     :param identifier: The identifier of the object (window, tab, or session)
         being monitored, or None for app. Sometimes this will be "all" or
         "active".
+    :param coalescing_window_ms: If set, changes to the variable are reported
+        at most once per this many milliseconds. Only the latest value is
+        reported.
+    :param max_rate: If set, the maximum number of changes reported per
+        second.
     """
     # pylint: disable=no-member
     request = iterm2.api_pb2.VariableMonitorRequest()
@@ -416,7 +466,9 @@ async def async_subscribe_to_variable_change_notification(
         callback,
         session=None,
         variable_monitor_request=request,
-        key=key)
+        key=key,
+        coalescing_window_ms=coalescing_window_ms,
+        max_rate=max_rate)
 
 
 async def async_subscribe_to_profile_change_notification(
@@ -466,7 +518,10 @@ async def _async_subscribe(
         key=None,
         profile_change_request=None,
         prompt_monitor_modes=None,
-        keystroke_filter_request=None):
+        keystroke_filter_request=None,
+        screen_update_monitor_request=None,
+        coalescing_window_ms=None,
+        max_rate=None):
     """Note: session argument is ignored for variable-change notifications."""
     _register_helper_if_needed()
     transformed_session = session if session is not None else "all"
@@ -494,7 +549,10 @@ async def _async_subscribe(
         variable_monitor_request,
         profile_change_request,
         prompt_monitor_modes,
-        keystroke_filter_request)
+        keystroke_filter_request,
+        screen_update_monitor_request,
+        coalescing_window_ms,
+        max_rate)
     status = response.notification_response.status
     # pylint: disable=no-member
     status_ok = (
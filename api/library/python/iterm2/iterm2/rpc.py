@@ -43,7 +43,10 @@ async def async_notification_request(
         variable_monitor_request=None,
         profile_change_request=None,
         prompt_monitor_modes=None,
-        keystroke_filter_request=None):
+        keystroke_filter_request=None,
+        screen_update_monitor_request=None,
+        coalescing_window_ms=None,
+        max_rate=None):
     """
     Requests a change to a notification subscription.
 
@@ -61,6 +64,12 @@ async def async_notification_request(
         profile change monitor) or None.
     prompt_monitor_modes: The prompt monitor modes (only for registering a
         prompt monitor) or None.
+    screen_update_monitor_request: The screen update monitor request (only
+        for registering a screen update monitor) or None.
+    coalescing_window_ms: Deliver at most one notification with the same key
+        per this many milliseconds, dropping all but the latest, or None.
+    max_rate: Maximum number of notifications per second with the same key,
+        or None.
 
     Returns: iterm2.api_pb2.ServerOriginatedMessage
     """
@@ -88,6 +97,14 @@ async def async_notification_request(
         for mode in prompt_monitor_modes:
             request.notification_request.prompt_monitor_request.modes.append(
                 mode)
+    if screen_update_monitor_request:
+        request.notification_request.screen_update_monitor_request.CopyFrom(
+            screen_update_monitor_request)
+    if coalescing_window_ms is not None:
+        request.notification_request.coalescing_window_ms = \
+            coalescing_window_ms
+    if max_rate is not None:
+        request.notification_request.max_rate = max_rate
     request.notification_request.subscribe = subscribe
     request.notification_request.notification_type = notification_type
     return await _async_call(connection, request)
@@ -270,6 +287,36 @@ async def async_list_prompts(
     return await _async_call(connection, request)
 
 
+async def async_export_scrollback(
+        connection, session, absolute_position=None, y_offset=None,
+        max_cells=None, include_styles=False):
+    """
+    Fetches a chunk of a session's scrollback history.
+
+    connection: A connected iterm2.Connection.
+    session: Session ID
+    absolute_position: Where to begin, taken from the next_position of the
+        previous response. None to begin at the oldest line.
+    y_offset: Accompanies absolute_position.
+    max_cells: Maximum number of cells to return, or None for the default.
+    include_styles: Whether to fill in the style table and style runs.
+
+    Returns: iterm2.api_pb2.ServerOriginatedMessage
+    """
+    request = _alloc_request()
+    request.export_scrollback_request.SetInParent()
+    request.export_scrollback_request.session = session
+    if absolute_position is not None:
+        request.export_scrollback_request.position.absolute_position = (
+            absolute_position)
+        if y_offset is not None:
+            request.export_scrollback_request.position.y_offset = y_offset
+    if max_cells is not None:
+        request.export_scrollback_request.max_cells = max_cells
+    request.export_scrollback_request.include_styles = include_styles
+    return await _async_call(connection, request)
+
+
 async def async_start_transaction(connection):
     """
     Begins a transaction, locking iTerm2 until the transaction ends. Be careful
@@ -2747,7 +2747,7 @@ static NSString *const kDiffScriptPath = @"/tmp/diffs";
     [self registerCall:_cmd];
 }
 
-- (void)textViewDidFindDirtyRects {
+- (void)textViewDidFindDirtyRects:(NSData *)dirtyRanges {
 }
 
 - (iTermBackgroundImageMode)backgroundImageMode {
@@ -472,6 +472,61 @@ class SearchEngineTests: XCTestCase {
         }
         expectEquals(expected, results)
     }
+
+    func testConcurrentSearchesOfManyScreens() {
+        let screens = (0..<8).map { _ in
+            let screen = Screen()
+            appendTestNumbers(screen: screen)
+            screen.searchEngine.searchesConcurrently = true
+            return screen
+        }
+        let request = SearchRequest(direction: .backwards,
+                                    regex: false,
+                                    query: "test",
+                                    caseSensitivity: .insensitive,
+                                    wantMultipleResults: true,
+                                    limitResultsToOnePerRawLine: false,
+                                    emptyQueryMatches: false,
+                                    spanLines: false,
+                                    cumulativeOverflow: 0,
+                                    initialStart: VT100GridAbsCoord(x: 5, y: 9))
+        // Start them all before consuming any so they run at the same time.
+        for screen in screens {
+            _ = screen.searchEngine.search(request: request,
+                                           snapshot: screen.snapshot(forcingPrimaryGrid: false))
+        }
+        let expected = Array(0...9).reversed().map { y in
+            SearchResult(fromX: 0, y: y, toX: 3, y: y)!
+        }
+        for screen in screens {
+            expectEquals(expected, consumeAll(screen.searchEngine))
+            XCTAssertGreaterThan(screen.searchEngine.bytesToSearch, 0)
+            XCTAssertGreaterThanOrEqual(screen.searchEngine.bytesSearched,
+                                        screen.searchEngine.bytesToSearch)
+        }
+    }
+
+    func testBytesToSearchCoversOnlyLineRange() {
+        let screen = Screen()
+        appendTestNumbers(screen: screen)
+        let request = SearchRequest(absLineRange: 3..<8,
+                                    direction: .backwards,
+                                    regex: false,
+                                    query: "test",
+                                    caseSensitivity: .insensitive,
+                                    wantMultipleResults: true,
+                                    limitResultsToOnePerRawLine: false,
+                                    emptyQueryMatches: false,
+                                    spanLines: false,
+                                    cumulativeOverflow: 0,
+                                    initialStart: VT100GridAbsCoord(x: 0, y: 9))
+        _ = performTestSearch(screen: screen, request: request)
+
+        // Half of the lines are in range.
+        XCTAssertGreaterThan(screen.searchEngine.bytesToSearch, 0)
+        XCTAssertLessThan(screen.searchEngine.bytesToSearch, screen.searchEngine.bytesInSnapshot)
+        XCTAssertEqual(screen.searchEngine.bytesSearched, screen.searchEngine.bytesToSearch)
+    }
 }
 
 // MARK: - Helpers
@@ -640,16 +695,19 @@ private func performTestSearch(screen: Screen,
     let snapshot = screen.snapshot(forcingPrimaryGrid: false)
     _ = screen.searchEngine.search(request: request,
                                    snapshot: snapshot)
+    return consumeAll(screen.searchEngine)
+}
 
+private func consumeAll(_ searchEngine: iTermSearchEngine) -> [SearchResult] {
     var results = [SearchResult]()
     var rangeSearched = VT100GridAbsCoordRange()
     var lineRange = NSRange()
     while true {
         var finished = ObjCBool(false)
-        if let partialResults = screen.searchEngine.consume(rangeSearched: &rangeSearched,
-                                                            lineRange: &lineRange,
-                                                            finished: &finished,
-                                                            block: true) {
+        if let partialResults = searchEngine.consume(rangeSearched: &rangeSearched,
+                                                     lineRange: &lineRange,
+                                                     finished: &finished,
+                                                     block: true) {
             results.append(contentsOf: partialResults)
         }
         if finished.boolValue {
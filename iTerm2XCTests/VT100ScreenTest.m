@@ -4708,9 +4708,8 @@ static NSString *VT100ScreenTestFindLines =
         [lineBuffer wrappedLineAtIndex:0 width:80 continuation:&cont];
         {
             LineBlock *block = [lineBuffer testOnlyBlockAtIndex:0];
-            LineBlockMetadata blockmeta = [block internalMetadataForLine:0];
-            NSLog(@"%p", blockmeta.double_width_characters);
-//            dwcCache = blockmeta.double_width_characters;
+            NSLog(@"%p", [block internalDoubleWidthCharacterCacheForLine:0]);
+//            dwcCache = [block internalDoubleWidthCharacterCacheForLine:0];
 //            XCTAssertTrue(dwcCache != nil);
         }
 
@@ -4719,8 +4718,7 @@ static NSString *VT100ScreenTestFindLines =
 
         {
             LineBlock *block = [lineBuffer testOnlyBlockAtIndex:0];
-            LineBlockMetadata blockmeta = [block internalMetadataForLine:0];
-            XCTAssertTrue(blockmeta.double_width_characters == nil);
+            XCTAssertTrue([block internalDoubleWidthCharacterCacheForLine:0] == nil);
         }
     }
 //    XCTAssertTrue(dwcCache == nil);
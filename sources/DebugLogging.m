@@ -13,6 +13,7 @@
 #import "NSData+iTerm.h"
 #import "NSFileManager+iTerm.h"
 #import "NSView+RecursiveDescription.h"
+#import "TaskNotifier.h"
 #import <Cocoa/Cocoa.h>
 
 #import <os/log.h>
@@ -46,7 +47,9 @@ static void AppendWindowDescription(NSWindow *window, NSMutableString *windows)
     if (term) {
         for (PTYSession *session in term.allSessions) {
             NSString *itd = [[session screen] intervalTreeDump];
-            [windows appendFormat:@"For %@:\n%@\n\n", session, itd];
+            [windows appendFormat:@"For %@:\n%@\nParser stream: %@\nScrollback: %@\n\n",
+             session, itd, [[session screen] parserStreamMemoryDescription],
+             [[session screen] scrollbackMemoryDescription]];
         }
     }
 }
@@ -99,6 +102,8 @@ NSString *iTermDebugLogHeaderString(void) {
                         @"Windows: %@\n"
                         @"Ordered windows: %@\n"
                         @"Pinned messages: %@\n"
+                        @"Parser pool: %@\n"
+                        @"Task notifier: %@\n"
                         @"------ END HEADER ------\n\n",
 
                         [[[NSBundle mainBundle] infoDictionary] objectForKey:@"CFBundleVersion"],
@@ -110,7 +115,9 @@ NSString *iTermDebugLogHeaderString(void) {
                         [[NSApplication sharedApplication] keyWindow],
                         windows,
                         [(iTermApplication *)NSApp orderedWindowsPlusAllHotkeyPanels],
-                        pinnedMessages];
+                        pinnedMessages,
+                        [[TaskNotifier sharedInstance] parserPoolDescription],
+                        [[TaskNotifier sharedInstance] fileDescriptorMonitorName]];
     return header;
 }
 
@@ -23,12 +23,11 @@
 }
 
 - (void)sanityCheckBidiDisplayInfoForRawLine:(int)i {
-    const LineBlockMetadata *metadata = [_metadataArray metadataAtIndex:i];
-    iTermBidiDisplayInfo *actual = metadata->bidi_display_info;
+    iTermBidiDisplayInfo *actual = [_metadataArray bidiDisplayInfoAtIndex:i];
     if (actual) {
         MutableScreenCharArray *msca = [[MutableScreenCharArray alloc] initWithLine:_characterBuffer.pointer + [self _lineRawOffset:i]
                                                                              length:[self _lineLength:i]
-                                                                       continuation:metadata->continuation];
+                                                                       continuation:[_metadataArray continuationAtIndex:i]];
         iTermBidiDisplayInfo *expected = [[iTermBidiDisplayInfo alloc] initUnpaddedWithScreenCharArray:msca];
         ITAssertWithMessage([actual isEqual:expected], @"actual=%@ expected=%@", actual, expected);
     }
@@ -41,18 +40,16 @@
 }
 
 - (MutableScreenCharArray *)mutableScreenCharArrayForRawLine:(int)i {
-    const LineBlockMetadata *md = [_metadataArray metadataAtIndex:i];
     return [[MutableScreenCharArray alloc] initWithLine:_characterBuffer.pointer + [self _lineRawOffset:i]
                                                  length:[self _lineLength:i]
-                                           continuation:md->continuation];
+                                           continuation:[_metadataArray continuationAtIndex:i]];
 }
 
 - (void)updateBidiInfoForRawLine:(int)i {
-    const LineBlockMetadata *md = [_metadataArray metadataAtIndex:i];
     iTermBidiDisplayInfo *bidiInfo = nil;
 
     MutableScreenCharArray *msca = nil;
-    if (md->lineMetadata.rtlFound) {
+    if ([_metadataArray rtlFoundAtIndex:i]) {
         msca = [self mutableScreenCharArrayForRawLine:i];
         bidiInfo = [[iTermBidiDisplayInfo alloc] initUnpaddedWithScreenCharArray:msca];
         if (bidiInfo) {
@@ -64,7 +61,7 @@
                 line[i].rtlStatus = RTLStatusLTR;
             }
         }
-    } else if (md->bidi_display_info == nil) {
+    } else if ([_metadataArray bidiDisplayInfoAtIndex:i] == nil) {
         // It's already nil so return to avoid making a CoW of _metadataArray for nothing.
         return;
     }
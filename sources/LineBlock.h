@@ -16,6 +16,8 @@
 #import "LineBlockMetadataArray.h"
 
 @class LineBlock;
+@class iTermScrollbackSpillFile;
+@class iTermTrigramSignature;
 
 extern dispatch_queue_t gDeallocQueue;
 
@@ -156,6 +158,27 @@ extern dispatch_queue_t gDeallocQueue;
 // Remove extra space from the end of the buffer. Future appends will fail.
 - (void)shrinkToFit;
 
+// Switches to a compact representation of the characters that is materialized the next time
+// they're needed. Call this on blocks that are no longer being appended to. Returns whether the
+// block is packed afterwards.
+- (BOOL)packCharacterBuffer;
+
+// Moves the characters to `file`. They're mapped back in the next time they're needed. Returns
+// whether the block is spilled afterwards.
+- (BOOL)spillCharacterBufferToFile:(iTermScrollbackSpillFile *)file;
+
+// Like -packCharacterBuffer but only succeeds if another copy of this block already packed or
+// spilled the buffer they share, so it's cheap enough for the main thread.
+- (BOOL)adoptCompactCharacterBuffer;
+
+// YES if packed or spilled.
+@property(nonatomic, readonly) BOOL characterBufferIsPacked;
+@property(nonatomic, readonly) BOOL characterBufferIsSpilled;
+@property(nonatomic, readonly) NSInteger characterBufferMemoryUsage;
+
+// +[iTermCharacterBuffer accessClock] as of the last time the characters were read.
+@property(nonatomic, readonly) int characterBufferLastAccess;
+
 // Return a raw line
 - (const screen_char_t *)rawLine:(int)linenum;
 - (ScreenCharArray *)screenCharArrayForRawLine:(int)linenum;
@@ -183,6 +206,9 @@ extern dispatch_queue_t gDeallocQueue;
 // Returns the total number of lines, including dropped lines.
 - (int)numEntries;
 
+// Adds the trigrams of each raw line to `signature`. See iTermScrollbackSearchIndex.
+- (void)addToTrigramSignature:(iTermTrigramSignature *)signature;
+
 // Searches for a substring, populating results with ResultRange objects.
 - (void)findSubstring:(NSString*)substring
               options:(FindOptions)options
@@ -266,7 +292,7 @@ void EnableDoubleWidthCharacterLineCache(void);
 - (ScreenCharArray *)lastRawLine;
 
 // For tests only
-- (LineBlockMutableMetadata)internalMetadataForLine:(int)line;
+- (iTermDoubleWidthCharacterCache *)internalDoubleWidthCharacterCacheForLine:(int)line;
 - (BOOL)hasOwner;
 - (void)dropMirroringProgenitor:(LineBlock *)other;
 - (BOOL)isSynchronizedWithProgenitor;
@@ -19,6 +19,7 @@ extern "C" {
 #import "iTermLegacyAtomicMutableArrayOfWeakObjects.h"
 #import "iTermMalloc.h"
 #import "iTermMetadata.h"
+#import "iTermScrollbackSearchIndex.h"
 #import "iTermWeakBox.h"
 #import "LineBlockMetadataArray.h"
 #import "LineBufferHelpers.h"
@@ -384,16 +385,16 @@ NS_INLINE void iTermLineBlockDidChange(__unsafe_unretained LineBlock *lineBlock,
 }
 
 - (void)sanityCheckmetadataCacheForRawLine:(int)i {
-    const LineBlockMetadata *metadata = [_metadataArray metadataAtIndex:i];
     [self sanityCheckBidiDisplayInfoForRawLine:i];
-    [metadata->doubleWidthCharacters sanityCheckWithCharacters:_characterBuffer.pointer + _startOffset + (i > 0 ? cumulative_line_lengths[i - 1] : 0)
-                                                        length:[self lengthOfRawLine:i]];
-    if (metadata->width_for_number_of_wrapped_lines > 0) {
+    [[_metadataArray doubleWidthCharacterCacheAtIndex:i] sanityCheckWithCharacters:_characterBuffer.pointer + _startOffset + (i > 0 ? cumulative_line_lengths[i - 1] : 0)
+                                                                            length:[self lengthOfRawLine:i]];
+    const LineBlockWrappedLineCount wrappedLineCount = [_metadataArray wrappedLineCountAtIndex:i];
+    if (wrappedLineCount.width > 0) {
         int actual = [self calculateNumberOfFullLinesWithOffset:[self _lineRawOffset:i]
                                                          length:[self lengthOfRawLine:i]
-                                                          width:metadata->width_for_number_of_wrapped_lines
+                                                          width:wrappedLineCount.width
                                                      mayHaveDWC:YES];
-        assert(actual == metadata->number_of_wrapped_lines);
+        assert(actual == wrappedLineCount.count);
     }
 }
 
@@ -592,8 +593,8 @@ NS_INLINE void iTermLineBlockDidChange(__unsafe_unretained LineBlock *lineBlock,
     }
     for (i = _firstEntry; i < cll_entries; ++i) {
         BOOL iscont = (i == cll_entries-1) && is_partial;
-        NSString *md = iTermMetadataShortDescription([_metadataArray metadataAtIndex:i]->lineMetadata,
-                                                     cumulative_line_lengths[i] - prev);
+        NSString *md = iTermImmutableMetadataShortDescription([_metadataArray immutableLineMetadataAtIndex:i],
+                                                              cumulative_line_lengths[i] - prev);
         NSString *message = [NSString stringWithFormat:@"Line %d, length %d, offset from raw=%d, abs pos=%lld, continued=%s %@: %@\n",
                              i,
                              cumulative_line_lengths[i] - prev,
@@ -611,15 +612,14 @@ NS_INLINE void iTermLineBlockDidChange(__unsafe_unretained LineBlock *lineBlock,
 - (NSString *)debugStringForRawLine:(int)i {
     const screen_char_t *line = [self rawLine:i + _firstEntry];
     const int length = [self lengthOfRawLine:i + _firstEntry];
-    const LineBlockMetadata *lbm = [_metadataArray metadataAtIndex:i + _firstEntry];
-    screen_char_t continuation = lbm->continuation;
+    screen_char_t continuation = [_metadataArray continuationAtIndex:i + _firstEntry];
     if (i + _firstEntry == cll_entries - 1 && is_partial && continuation.code == EOL_HARD) {
         continuation.code = EOL_SOFT;
     }
     ScreenCharArray *sca = [[ScreenCharArray alloc] initWithLine:line
                                                           length:length
-                                                        metadata:iTermMetadataMakeImmutable(lbm->lineMetadata)
-                                                    continuation:lbm->continuation];
+                                                        metadata:[_metadataArray immutableLineMetadataAtIndex:i + _firstEntry]
+                                                    continuation:[_metadataArray continuationAtIndex:i + _firstEntry]];
     return [sca stringValue];
 }
 
@@ -638,8 +638,8 @@ NS_INLINE void iTermLineBlockDidChange(__unsafe_unretained LineBlock *lineBlock,
     }
     for (i = _firstEntry; i < cll_entries; ++i) {
         BOOL iscont = (i == cll_entries-1) && is_partial;
-        NSString *md = iTermMetadataShortDescription([_metadataArray metadataAtIndex:i]->lineMetadata,
-                                                     cumulative_line_lengths[i] - prev);
+        NSString *md = iTermImmutableMetadataShortDescription([_metadataArray immutableLineMetadataAtIndex:i],
+                                                              cumulative_line_lengths[i] - prev);
         NSString *message = [NSString stringWithFormat:@"Line %d, length %d, offset from raw=%d, abs pos=%lld, continued=%s %@: %@\n",
                              i,
                              cumulative_line_lengths[i] - prev,
@@ -665,6 +665,14 @@ NS_INLINE int LineBlockNumberOfFullLinesFastPath(int length, int width) {
 - (int)numberOfFullLinesFromOffset:(int)offset
                             length:(int)length
                              width:(int)width {
+    return [self numberOfFullLinesFromOffset:offset length:length width:width characters:NULL];
+}
+
+// `characters`, if not NULL, holds the contents of _characterBuffer and is read instead of it.
+- (int)numberOfFullLinesFromOffset:(int)offset
+                            length:(int)length
+                             width:(int)width
+                        characters:(const screen_char_t *)characters {
     if (width <= 1 || !_mayHaveDoubleWidthCharacter) {
         return LineBlockNumberOfFullLinesFastPath(length, width);
     }
@@ -678,7 +686,8 @@ NS_INLINE int LineBlockNumberOfFullLinesFastPath(int length, int width) {
         result = [self calculateNumberOfFullLinesWithOffset:offset
                                                      length:length
                                                       width:width
-                                                 mayHaveDWC:_mayHaveDoubleWidthCharacter];
+                                                 mayHaveDWC:_mayHaveDoubleWidthCharacter
+                                                 characters:characters];
         it->second = result;
     } else {
         result = it->second;
@@ -712,11 +721,23 @@ static int iTermLineBlockNumberOfFullLinesImpl(const screen_char_t *buffer,
                                      length:(int)length
                                       width:(int)width
                                  mayHaveDWC:(BOOL)mayHaveDWC {
+    return [self calculateNumberOfFullLinesWithOffset:offset
+                                               length:length
+                                                width:width
+                                           mayHaveDWC:mayHaveDWC
+                                           characters:NULL];
+}
+
+- (int)calculateNumberOfFullLinesWithOffset:(int)offset
+                                     length:(int)length
+                                      width:(int)width
+                                 mayHaveDWC:(BOOL)mayHaveDWC
+                                 characters:(const screen_char_t *)characters {
     if (width <= 1 || !mayHaveDWC) {
         // Need to use max(0) because otherwise we get -1 for length=0 width=1.
         return LineBlockNumberOfFullLinesFastPath(length, width);
     }
-    return iTermLineBlockNumberOfFullLinesImpl(_characterBuffer.pointer + offset, length, width);
+    return iTermLineBlockNumberOfFullLinesImpl((characters ?: _characterBuffer.pointer) + offset, length, width);
 }
 
 - (NSInteger)sizeFromLine:(int)lineNum width:(int)width {
@@ -836,11 +857,10 @@ static int iTermLineBlockNumberOfFullLinesImpl(const screen_char_t *buffer,
             originalLength -= start;
         }
         cert.mutableCumulativeLineLengths[cll_entries - 1] += length;
-        const iTermMetadata *amendedMetadata = [_metadataArray appendToLastLine:&lineMetadata
-                                                                 originalLength:originalLength
-                                                               additionalLength:length
-                                                                   continuation:continuation];
-        didFindRTL = amendedMetadata->rtlFound;
+        didFindRTL = [_metadataArray appendToLastLine:&lineMetadata
+                                       originalLength:originalLength
+                                     additionalLength:length
+                                         continuation:continuation];
 #ifdef TEST_LINEBUFFER_SANITY
         [self checkAndResetCachedNumlines:@"appendLine partial case" width:width];
 #endif
@@ -872,15 +892,14 @@ static int iTermLineBlockNumberOfFullLinesImpl(const screen_char_t *buffer,
 }
 
 - (void)didFindRTLInLine:(int)line cert:(id<iTermLineBlockMutationCertificate>)cert {
-    const LineBlockMetadata *existing = [_metadataArray metadataAtIndex:line];
-    if (!existing->lineMetadata.rtlFound) {
+    if (![_metadataArray rtlFoundAtIndex:line]) {
         [_metadataArray setRTLFound:YES atIndex:line];
     }
 }
 
 // Only used by tests
-- (LineBlockMutableMetadata)internalMetadataForLine:(int)line {
-    return iTermLineBlockMetadataProvideGetMutable([_metadataArray metadataProviderAtIndex:line]);
+- (iTermDoubleWidthCharacterCache *)internalDoubleWidthCharacterCacheForLine:(int)line {
+    return [_metadataArray doubleWidthCharacterCacheAtIndex:line];
 }
 
 - (int)offsetOfStartOfLineIncludingOffset:(int)offset {
@@ -982,15 +1001,17 @@ static int iTermLineBlockNumberOfFullLinesImpl(const screen_char_t *buffer,
     return pos;
 }
 
-- (void)populateDoubleWidthCharacterCacheInMetadata:(LineBlockMutableMetadata)mutableMetadata
-                                     startingOffset:(int)startingOffset
-                                             length:(int)length
-                                              width:(int)width {
+- (iTermDoubleWidthCharacterCache *)populateDoubleWidthCharacterCacheForRawLine:(int)rawLine
+                                                                startingOffset:(int)startingOffset
+                                                                        length:(int)length
+                                                                         width:(int)width {
     assert(gEnableDoubleWidthCharacterLineCache);
-    mutableMetadata.metadata->doubleWidthCharacters =
+    iTermDoubleWidthCharacterCache *cache =
         [[iTermDoubleWidthCharacterCache alloc] initWithCharacters:_characterBuffer.pointer + _startOffset + startingOffset
                                                             length:length
                                                              width:width];
+    [_metadataArray setDoubleWidthCharacterCache:cache atIndex:rawLine];
+    return cache;
 }
 
 // startingOffset is relative to bufferStart.
@@ -999,19 +1020,20 @@ static int iTermLineBlockNumberOfFullLinesImpl(const screen_char_t *buffer,
                          wrappedLineNumber:(int)n  // lineNum
                               bufferLength:(int)length
                                      width:(int)width
-                                  metadata:(iTermLineBlockMetadataProvider)metadataProvider {
+                                   rawLine:(int)rawLine {
     assert(gEnableDoubleWidthCharacterLineCache);
     ITBetaAssert(n >= 0, @"Negative lines to offsetOfWrappedLineInBuffer");
-    const LineBlockMetadata *metadata = iTermLineBlockMetadataProviderGetImmutable(metadataProvider);
     if (_mayHaveDoubleWidthCharacter) {
-        if (![metadata->doubleWidthCharacters validForWidth:width length:length]) {
-            [self populateDoubleWidthCharacterCacheInMetadata:iTermLineBlockMetadataProvideGetMutable(metadataProvider)
-                                               startingOffset:startingOffset
-                                                       length:length
-                                                        width:width];
+        iTermDoubleWidthCharacterCache *doubleWidthCharacters = [_metadataArray doubleWidthCharacterCacheAtIndex:rawLine];
+        if (![doubleWidthCharacters validForWidth:width length:length]) {
+            doubleWidthCharacters = [self populateDoubleWidthCharacterCacheForRawLine:rawLine
+                                                                       startingOffset:startingOffset
+                                                                               length:length
+                                                                                width:width];
         }
         int lines = 0;
-        const int i = [metadata->doubleWidthCharacters offsetForWrappedLine:n totalLines:&lines];
+        const int i = [doubleWidthCharacters offsetForWrappedLine:n totalLines:&lines];
+        const LineBlockWrappedLineCount wrappedLineCount = [_metadataArray wrappedLineCountAtIndex:rawLine];
         ITAssertWithMessage(i <= length, @"[2] i=%@ exceeds length=%@, n=%@, width=%@, lines=%@, bufferStartOffset=%@, startingOffset=%@, metadata_.width_for_number_of_wrapped_lines=%@, metadata->number_of_wrapped_lines=%@, numberOfFullLinesCache=%@, indexSet=%@, debugInfo=%@ clls=%@",
                             @(i),
                             @(length),
@@ -1020,10 +1042,10 @@ static int iTermLineBlockNumberOfFullLinesImpl(const screen_char_t *buffer,
                             @(lines),
                             @(self.bufferStartOffset),
                             @(startingOffset),
-                            @(metadata ? metadata->width_for_number_of_wrapped_lines : 0xdeadbeef),
-                            @(metadata ? metadata->number_of_wrapped_lines : 0xdeadbeef),
+                            @(wrappedLineCount.width),
+                            @(wrappedLineCount.count),
                             [self dumpNumberOfFullLinesCache],
-                            metadata->doubleWidthCharacters.indexSet,
+                            doubleWidthCharacters.indexSet,
                             _debugInfo ? _debugInfo() : @"n/a",
                             [self dumpCumulativeLineLengths]);
         return i;
@@ -1127,7 +1149,7 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
                                        wrappedLineNumber:lineNum
                                             bufferLength:location.length
                                                    width:width
-                                                metadata:[_metadataArray metadataProviderAtIndex:location.index]];
+                                                 rawLine:location.index];
     }
     return OffsetOfWrappedLine(_characterBuffer.pointer + _startOffset + location.prev,
                                lineNum,
@@ -1197,20 +1219,18 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
         // line.
         *yOffsetPtr = location.numEmptyLines;
     }
-    const LineBlockMetadata *md = [_metadataArray metadataAtIndex:location.index];
     if (continuationPtr) {
-        *continuationPtr = md->continuation;
+        *continuationPtr = [_metadataArray continuationAtIndex:location.index];
         continuationPtr->code = *includesEndOfLine;
     }
     if (isStartOfWrappedLine) {
         *isStartOfWrappedLine = (offset == 0);
     }
     if (metadataPtr) {
-        iTermMetadataRetainAutorelease(md->lineMetadata);
-        *metadataPtr = iTermMetadataMakeImmutable(md->lineMetadata);
+        *metadataPtr = [_metadataArray immutableLineMetadataAtIndex:location.index];
     }
     if (bidiInfoPtr) {
-        *bidiInfoPtr = [self subBidiInfo:md->bidi_display_info
+        *bidiInfoPtr = [self subBidiInfo:[_metadataArray bidiDisplayInfoAtIndex:location.index]
                                    range:NSMakeRange(offset, width) width:width];
     }
     if (lineOffset) {
@@ -1260,18 +1280,15 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
         int spans;
         const BOOL useCache = gUseCachingNumberOfLines;
         if (useCache && _mayHaveDoubleWidthCharacter) {
-            iTermLineBlockMetadataProvider provider = [_metadataArray metadataProviderAtIndex:i];
-            const LineBlockMetadata *metadata = iTermLineBlockMetadataProviderGetImmutable(provider);
-            if (metadata->width_for_number_of_wrapped_lines == width &&
-                metadata->number_of_wrapped_lines > 0) {
-                spans = metadata->number_of_wrapped_lines;
+            const LineBlockWrappedLineCount cached = [_metadataArray wrappedLineCountAtIndex:i];
+            if (cached.width == width && cached.count > 0) {
+                spans = cached.count;
             } else {
                 spans = [self numberOfFullLinesFromOffset:self.bufferStartOffset + prev
                                                    length:length
                                                     width:width];
-                LineBlockMutableMetadata mutableMetadata = iTermLineBlockMetadataProvideGetMutable(provider);
-                mutableMetadata.metadata->number_of_wrapped_lines = spans;
-                mutableMetadata.metadata->width_for_number_of_wrapped_lines = width;
+                [_metadataArray setWrappedLineCount:(LineBlockWrappedLineCount){ .width = width, .count = spans }
+                                            atIndex:i];
              }
         } else {
             spans = [self numberOfFullLinesFromOffset:self.bufferStartOffset + prev
@@ -1393,11 +1410,9 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
     } else {
         continuation.code = EOL_HARD;
     }
-    const LineBlockMetadata *md = [_metadataArray metadataAtIndex:location.index];
-
     return [[ScreenCharArray alloc] initWithLine:buffer
                                           length:length
-                                        metadata:iTermMetadataMakeImmutable(md->lineMetadata)
+                                        metadata:[_metadataArray immutableLineMetadataAtIndex:location.index]
                                     continuation:continuation];
 }
 
@@ -1418,6 +1433,26 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
         return cached_numlines;
     }
 
+    __block int count = 0;
+    if (width > 1 && _mayHaveDoubleWidthCharacter && (_characterBuffer.isPacked || _characterBuffer.isSpilled)) {
+        // Every block is counted after a resize. Scan compacted scrollback without materializing
+        // it, or resizing would undo all the compaction.
+        [_characterBuffer readCharactersWithoutCaching:^(const screen_char_t *characters) {
+            count = [self countNumLinesWithWrapWidth:width characters:characters];
+        }];
+    } else {
+        count = [self countNumLinesWithWrapWidth:width characters:NULL];
+    }
+
+    // Save the result so it doesn't have to be recalculated until some relatively rare operation
+    // occurs that invalidates the cache.
+    cached_numlines_width = width;
+    cached_numlines = count;
+
+    return count;
+}
+
+- (int)countNumLinesWithWrapWidth:(int)width characters:(const screen_char_t *)characters {
     int count = 0;
     int prev = 0;
     int i;
@@ -1428,16 +1463,11 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
         int length = cll - prev;
         const int marginalLines = [self numberOfFullLinesFromOffset:self.bufferStartOffset + prev
                                                              length:length
-                                                              width:width] + 1;
+                                                              width:width
+                                                         characters:characters] + 1;
         count += marginalLines;
         prev = cll;
     }
-
-    // Save the result so it doesn't have to be recalculated until some relatively rare operation
-    // occurs that invalidates the cache.
-    cached_numlines_width = width;
-    cached_numlines = count;
-
     return count;
 }
 
@@ -1705,12 +1735,10 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
     if (cll_entries <= _firstEntry) {
         return nil;
     }
-    const LineBlockMetadata *md = [_metadataArray metadataAtIndex:cll_entries - 1];
-
     return [[ScreenCharArray alloc] initWithLine:[self rawLine:cll_entries - 1]
                                           length:[self lengthOfLastLine]
-                                        metadata:iTermMetadataMakeImmutable(md->lineMetadata)
-                                    continuation:md->continuation];
+                                        metadata:[_metadataArray immutableLineMetadataAtIndex:cll_entries - 1]
+                                    continuation:[_metadataArray continuationAtIndex:cll_entries - 1]];
 }
 
 - (int)lengthOfRawLine:(int)linenum {
@@ -1737,11 +1765,10 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
 }
 
 - (ScreenCharArray *)screenCharArrayForRawLine:(int)linenum {
-    const LineBlockMetadata *md = [_metadataArray metadataAtIndex:linenum];
     return [[ScreenCharArray alloc] initWithLine:[self rawLine:linenum]
                                           length:[self lengthOfRawLine:linenum]
-                                        metadata:iTermMetadataMakeImmutable(md->lineMetadata)
-                                    continuation:md->continuation];
+                                        metadata:[_metadataArray immutableLineMetadataAtIndex:linenum]
+                                    continuation:[_metadataArray continuationAtIndex:linenum]];
 }
 
 - (const screen_char_t*)rawLine:(int)linenum {
@@ -1810,6 +1837,66 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
     });
 }
 
+- (BOOL)packCharacterBuffer {
+    if (_characterBuffer.isPacked) {
+        return YES;
+    }
+    iTermCharacterBuffer *packed = [_characterBuffer existingCompactCopyPreservingLength:self.rawSpaceUsed];
+    if (!packed) {
+        packed = [_characterBuffer packedCopyPreservingLength:self.rawSpaceUsed];
+    }
+    return [self setCompactCharacterBuffer:packed];
+}
+
+- (BOOL)spillCharacterBufferToFile:(iTermScrollbackSpillFile *)file {
+    if (_characterBuffer.isSpilled) {
+        return YES;
+    }
+    iTermCharacterBuffer *spilled = [_characterBuffer existingCompactCopyPreservingLength:self.rawSpaceUsed];
+    if (!spilled.isSpilled) {
+        spilled = [_characterBuffer spilledCopyToFile:file preservingLength:self.rawSpaceUsed];
+    }
+    return [self setCompactCharacterBuffer:spilled];
+}
+
+- (BOOL)adoptCompactCharacterBuffer {
+    if (_characterBuffer.isPacked) {
+        return YES;
+    }
+    return [self setCompactCharacterBuffer:[_characterBuffer existingCompactCopyPreservingLength:self.rawSpaceUsed]];
+}
+
+- (BOOL)setCompactCharacterBuffer:(iTermCharacterBuffer *)compact {
+    // The contents don't change, so this isn't a mutation and doesn't need a certificate. Copies
+    // that share the old buffer keep it.
+    if (!compact) {
+        return NO;
+    }
+    if (!self.hasBeenCopied) {
+        _characterBuffer = compact;
+        return YES;
+    }
+    std::lock_guard<std::recursive_mutex> lock(gLineBlockMutex);
+    _characterBuffer = compact;
+    return YES;
+}
+
+- (BOOL)characterBufferIsPacked {
+    return _characterBuffer.isPacked;
+}
+
+- (BOOL)characterBufferIsSpilled {
+    return _characterBuffer.isSpilled;
+}
+
+- (NSInteger)characterBufferMemoryUsage {
+    return _characterBuffer.memoryUsage;
+}
+
+- (int)characterBufferLastAccess {
+    return _characterBuffer.lastAccess;
+}
+
 - (int)dropLines:(int)orig_n withWidth:(int)width chars:(int *)charsDropped {
     // Note that there's no mutation certificate because we aren't touching the character buffer.
     [_metadataArray willMutate];
@@ -1869,8 +1956,9 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
         prev = cll;
     }
 
-    // Consumed the whole buffer.
-    *charsDropped = [self rawSpaceUsed];
+    // Consumed the whole buffer. Count only what hadn't already been dropped, as when LineBuffer
+    // drops a whole block.
+    *charsDropped = [self rawSpaceUsed] - initialOffset;
     [_metadataArray reset];
     cached_numlines_width = -1;
     cll_entries = 0;
@@ -2005,6 +2093,7 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
 
 - (void)_findInRawLine:(int)entry
                 needle:(NSString*)needle
+         literalNeedle:(const CoreScreenCharNeedle *)literalNeedle
                options:(FindOptions)options
                   mode:(iTermFindMode)mode
                   skip:(int)skip
@@ -2018,27 +2107,36 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
         skip = 0;
     }
 
-    unichar *charHaystack;
-    int *deltas;
+    unichar *charHaystack = NULL;
+    int *deltas = NULL;
     const int rawOffset = [self _lineRawOffset:entry];
-    NSString *haystack = [self stringFromOffset:rawOffset
-                                         length:raw_line_length
-                                   backingStore:&charHaystack
-                                         deltas:&deltas];
+    NSArray<ResultRange *> *marginalResults = nil;
+    if (literalNeedle) {
+        // Avoids building a string for lines that are entirely ASCII, which is most of them.
+        marginalResults = CoreScreenCharSearch(literalNeedle,
+                                               _characterBuffer.pointer + rawOffset,
+                                               raw_line_length);
+    }
+    if (!marginalResults) {
+        NSString *haystack = [self stringFromOffset:rawOffset
+                                             length:raw_line_length
+                                       backingStore:&charHaystack
+                                             deltas:&deltas];
 
 #ifdef DEBUG_SEARCH
-    SearchLog(@"Searching rawline %@", [self prettyRawLine:_characterBuffer.pointer + rawOffset
-                                                    length:raw_line_length]);
-    SearchLog(@"Deltas: %@", [self prettyDeltas:deltas length:haystack.length]);
+        SearchLog(@"Searching rawline %@", [self prettyRawLine:_characterBuffer.pointer + rawOffset
+                                                        length:raw_line_length]);
+        SearchLog(@"Deltas: %@", [self prettyDeltas:deltas length:haystack.length]);
 #endif
-    CoreSearchRequest request = {
-        .needle = needle,
-        .options = options,
-        .mode = mode,
-        .haystack = haystack,
-        .deltas = deltas
-    };
-    NSArray<ResultRange *> *marginalResults = CoreSearch(&request);
+        CoreSearchRequest request = {
+            .needle = needle,
+            .options = options,
+            .mode = mode,
+            .haystack = haystack,
+            .deltas = deltas
+        };
+        marginalResults = CoreSearch(&request);
+    }
     if (options & FindOptBackwards) {
         marginalResults = [marginalResults filteredArrayUsingBlock:^BOOL(ResultRange *rr) {
             return rr.position <= skip;
@@ -2070,6 +2168,13 @@ int OffsetOfWrappedLine(const screen_char_t* p, int n, int length, int width, BO
     return cumulative_line_lengths[anIndex] - prev;
 }
 
+- (void)addToTrigramSignature:(iTermTrigramSignature *)signature {
+    const screen_char_t *buffer = _characterBuffer.pointer;
+    for (int entry = _firstEntry; entry < cll_entries; entry++) {
+        [signature addCells:buffer + [self _lineRawOffset:entry] length:[self _lineLength:entry]];
+    }
+}
+
 - (int) _findEntryBeforeOffset:(int)offset {
     if (offset < self.bufferStartOffset) {
         return -1;
@@ -2100,6 +2205,32 @@ includesPartialLastLine:(BOOL *)includesPartialLastLine {
         // The purpose of the find option is to avoid having to do this in the normal case.
         splitLines = [substring componentsSeparatedByString:@"\n"];
     }
+    CoreScreenCharNeedle literalNeedle;
+    const BOOL haveLiteralNeedle = (!(options & FindOptMultiLine) &&
+                                    CoreScreenCharNeedleInit(&literalNeedle, substring, options, mode));
+    [self findSubstring:substring
+                options:options
+                   mode:mode
+               atOffset:offset
+             splitLines:splitLines
+          literalNeedle:haveLiteralNeedle ? &literalNeedle : NULL
+                results:results
+        multipleResults:multipleResults
+includesPartialLastLine:includesPartialLastLine];
+    if (haveLiteralNeedle) {
+        CoreScreenCharNeedleFree(&literalNeedle);
+    }
+}
+
+- (void)findSubstring:(NSString *)substring
+              options:(FindOptions)options
+                 mode:(iTermFindMode)mode
+             atOffset:(int)offset
+           splitLines:(NSArray<NSString *> *)splitLines
+        literalNeedle:(const CoreScreenCharNeedle *)literalNeedle
+              results:(NSMutableArray *)results
+      multipleResults:(BOOL)multipleResults
+includesPartialLastLine:(BOOL *)includesPartialLastLine {
     int entry;
     int limit;
     int dir;
@@ -2147,6 +2278,7 @@ includesPartialLastLine:(BOOL *)includesPartialLastLine {
                         DLog(@"Search the `%@`th line for the `%@`th line in the substring.", @(entry + i), @(i));
                         [self _findInRawLine:entry + i
                                       needle:splitLines[i]
+                               literalNeedle:NULL
                                      options:options
                                         mode:mode
                                         skip:skipped
@@ -2218,6 +2350,7 @@ includesPartialLastLine:(BOOL *)includesPartialLastLine {
             DLog(@"Single-line search");
             [self _findInRawLine:entry
                           needle:substring
+                   literalNeedle:literalNeedle
                          options:options
                             mode:mode
                             skip:skipped
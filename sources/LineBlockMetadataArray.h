@@ -14,46 +14,20 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+// The number of wrapped lines a raw line occupies at one width. A width of 0 means unknown.
 typedef struct {
-    iTermMetadata lineMetadata;
-    screen_char_t continuation;
-    int number_of_wrapped_lines;
-    int width_for_number_of_wrapped_lines;
+    int width;
+    int count;
+} LineBlockWrappedLineCount;
 
-    iTermDoubleWidthCharacterCache *_Nullable doubleWidthCharacters;
-    iTermBidiDisplayInfo *_Nullable bidi_display_info;
-} LineBlockMetadata;
-
-typedef struct {
-    LineBlockMetadata *metadata;
-    iTermBidiDisplayInfo *_Nullable mutableBidiDisplayInfo;
-} LineBlockMutableMetadata;
-
-// Don't access this directly. Use the functions below.
-typedef struct {
-    LineBlockMetadata *_metadata;
-    void (^_Nullable _willMutate)(void);
-} iTermLineBlockMetadataProvider;
-
-NS_INLINE const LineBlockMetadata *iTermLineBlockMetadataProviderGetImmutable(iTermLineBlockMetadataProvider provider) {
-    return provider._metadata;
-}
-
-NS_INLINE LineBlockMutableMetadata iTermLineBlockMetadataProvideGetMutable(iTermLineBlockMetadataProvider provider) {
-    if (provider._willMutate) {
-        provider._willMutate();
-        provider._willMutate = nil;
-    }
-    return (LineBlockMutableMetadata) {
-        .metadata = provider._metadata,
-        .mutableBidiDisplayInfo = provider._metadata->bidi_display_info,
-    };
-}
-
-
-// Stores an array of `LineBlockMetadata`. Offers copy-on-write. This is maybe
-// more like a dequeue because it also tracks number of items at the head of
-// the list that are invalid.
+// Stores metadata for each raw line of a LineBlock. Offers copy-on-write. This
+// is maybe more like a dequeue because it also tracks number of items at the
+// head of the list that are invalid.
+//
+// Values are stored in columns rather than one struct per line. Appending a
+// line writes its timestamp, RTL flag, and continuation. Columns for external
+// attributes, bidi info, and caches aren't allocated until some line in the
+// block has a value for them.
 @interface LineBlockMetadataArray: NSObject
 
 // Keep a cache of double-width characters? This used to be experimental but
@@ -98,9 +72,15 @@ migrationIndex:(iTermExternalAttributeIndex * _Nullable)migrationIndex
 
 #pragma mark - Reading
 
-// precondition: i >= first && i < numEntries
-- (const LineBlockMetadata *)metadataAtIndex:(int)i;
+// precondition for methods taking an index: i >= first && i < numEntries
 - (iTermImmutableMetadata)immutableLineMetadataAtIndex:(int)i;
+- (screen_char_t)continuationAtIndex:(int)i;
+- (BOOL)rtlFoundAtIndex:(int)i;
+- (iTermBidiDisplayInfo * _Nullable)bidiDisplayInfoAtIndex:(int)i;
+
+// Caches. Changing an entry clears them and cowCopy doesn't copy them.
+- (iTermDoubleWidthCharacterCache * _Nullable)doubleWidthCharacterCacheAtIndex:(int)i;
+- (LineBlockWrappedLineCount)wrappedLineCountAtIndex:(int)i;
 
 // precondition: numEntries > 0
 - (screen_char_t)lastContinuation;
@@ -130,9 +110,10 @@ migrationIndex:(iTermExternalAttributeIndex * _Nullable)migrationIndex
 - (void)append:(iTermImmutableMetadata)lineMetadata
   continuation:(screen_char_t)continuation;
 
-// Appends to the last entry already in the array.
+// Appends to the last entry already in the array. Returns whether the amended
+// entry has RTL text.
 // numEntries > first
-- (const iTermMetadata *)appendToLastLine:(const iTermImmutableMetadata *)metadataToAppend
+- (BOOL)appendToLastLine:(const iTermImmutableMetadata *)metadataToAppend
                            originalLength:(int)originalLength
                          additionalLength:(int)additionalLength
                              continuation:(screen_char_t)continuation;
@@ -141,9 +122,10 @@ migrationIndex:(iTermExternalAttributeIndex * _Nullable)migrationIndex
              atLine:(int)line
            rtlFound:(BOOL)rtlFound;
 
-// Returns a provider for the `i`th entry. From the provider, you can get a mutable object.
+// These fill caches, so unlike other mutations they may be called while reading.
 // i >= first && i < numEntries
-- (iTermLineBlockMetadataProvider)metadataProviderAtIndex:(int)i;
+- (void)setDoubleWidthCharacterCache:(iTermDoubleWidthCharacterCache * _Nullable)cache atIndex:(int)i;
+- (void)setWrappedLineCount:(LineBlockWrappedLineCount)count atIndex:(int)i;
 
 // Replace the external attributes in the last entry.
 // numEntries > first
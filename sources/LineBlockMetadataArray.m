@@ -66,71 +66,154 @@
 
 @end
 
+
 // The underlying data for LineBlockMetadataArray.
-// This has no logic except for how to copy and free memory.
+// This has no logic except for how to allocate, copy, and free columns.
 @interface LineBlockMetadataArrayGuts: NSObject {
     // Members are public for performance.
 @public
-    LineBlockMetadata *_array;
+    // Every entry has a value in these columns.
+    NSTimeInterval *_timestamps;
+    BOOL *_rtlFound;
+    screen_char_t *_continuations;
+
+    // These are NULL until an entry needs them.
+    __strong iTermExternalAttributeIndex **_externalAttributes;
+    __strong iTermBidiDisplayInfo **_bidiDisplayInfos;
+    __strong iTermDoubleWidthCharacterCache **_doubleWidthCharacters;
+    LineBlockWrappedLineCount *_wrappedLineCounts;
+
     int _numEntries;  // Inclusive of _first.
     int _first;
-    int _firstCheck;
     BOOL _useDWCCache;
     int _capacity;
 }
 
+- (instancetype)initWithCapacity:(int)capacity useDWCCache:(BOOL)useDWCCache;
 - (instancetype)copy;
+- (void)growTo:(int)newCapacity;
+- (void)ensureExternalAttributes;
+- (void)ensureBidiDisplayInfos;
+- (void)ensureDoubleWidthCharacters;
+- (void)ensureWrappedLineCounts;
 
 @end
 
 @implementation LineBlockMetadataArrayGuts
 
+- (instancetype)initWithCapacity:(int)capacity useDWCCache:(BOOL)useDWCCache {
+    self = [super init];
+    if (self) {
+        _useDWCCache = useDWCCache;
+        _capacity = capacity;
+        _timestamps = (NSTimeInterval *)iTermCalloc(capacity, sizeof(NSTimeInterval));
+        _rtlFound = (BOOL *)iTermCalloc(capacity, sizeof(BOOL));
+        _continuations = (screen_char_t *)iTermCalloc(capacity, sizeof(screen_char_t));
+    }
+    return self;
+}
+
 - (instancetype)copy {
-    LineBlockMetadataArrayGuts *copy = [[LineBlockMetadataArrayGuts alloc] init];
-    copy->_array = (LineBlockMetadata *)iTermCalloc(sizeof(LineBlockMetadata), _capacity);
+    LineBlockMetadataArrayGuts *copy = [[LineBlockMetadataArrayGuts alloc] initWithCapacity:_capacity
+                                                                                useDWCCache:_useDWCCache];
     copy->_numEntries = _numEntries;
     copy->_first = _first;
-    copy->_useDWCCache = _useDWCCache;
-    copy->_capacity = _capacity;
-
-    for (int i = 0; i < _numEntries; i++) {
-        const LineBlockMetadata *value = &_array[i];
-        LineBlockMetadata *destination = &copy->_array[i];
-
-        iTermExternalAttributeIndex *index = iTermMetadataGetExternalAttributesIndex(value->lineMetadata);
-        iTermExternalAttributeIndex *indexCopy = [index copy];
-        iTermMetadataInit(&destination->lineMetadata,
-                          value->lineMetadata.timestamp,
-                          value->lineMetadata.rtlFound,
-                          indexCopy);
-
-        destination->continuation = value->continuation;
-        destination->number_of_wrapped_lines = 0;
-        destination->width_for_number_of_wrapped_lines = 0;
-        if (_useDWCCache) {
-            destination->doubleWidthCharacters = nil;
+
+    memcpy(copy->_timestamps, _timestamps, sizeof(NSTimeInterval) * _numEntries);
+    memcpy(copy->_rtlFound, _rtlFound, sizeof(BOOL) * _numEntries);
+    memcpy(copy->_continuations, _continuations, sizeof(screen_char_t) * _numEntries);
+    if (_externalAttributes) {
+        [copy ensureExternalAttributes];
+        for (int i = 0; i < _numEntries; i++) {
+            copy->_externalAttributes[i] = [_externalAttributes[i] copy];
         }
-        destination->bidi_display_info = value->bidi_display_info;
     }
-
+    if (_bidiDisplayInfos) {
+        [copy ensureBidiDisplayInfos];
+        for (int i = 0; i < _numEntries; i++) {
+            copy->_bidiDisplayInfos[i] = _bidiDisplayInfos[i];
+        }
+    }
+    // Caches are not copied.
     return copy;
 }
 
-- (void)dealloc {
-    if (!_array) {
-        return;
+- (void)growTo:(int)newCapacity {
+    const int formerCapacity = _capacity;
+    _capacity = newCapacity;
+    _timestamps = (NSTimeInterval *)iTermZeroingRealloc(_timestamps, formerCapacity, newCapacity, sizeof(NSTimeInterval));
+    _rtlFound = (BOOL *)iTermZeroingRealloc(_rtlFound, formerCapacity, newCapacity, sizeof(BOOL));
+    _continuations = (screen_char_t *)iTermZeroingRealloc(_continuations, formerCapacity, newCapacity, sizeof(screen_char_t));
+    if (_externalAttributes) {
+        _externalAttributes = (__strong iTermExternalAttributeIndex **)iTermZeroingRealloc((void *)_externalAttributes,
+                                                                                           formerCapacity,
+                                                                                           newCapacity,
+                                                                                           sizeof(id));
     }
-    if (_useDWCCache) {
-        for (int i = 0; i < _numEntries; i++) {
-            _array[i].doubleWidthCharacters = nil;
-            _array[i].bidi_display_info = nil;
-        }
+    if (_bidiDisplayInfos) {
+        _bidiDisplayInfos = (__strong iTermBidiDisplayInfo **)iTermZeroingRealloc((void *)_bidiDisplayInfos,
+                                                                                  formerCapacity,
+                                                                                  newCapacity,
+                                                                                  sizeof(id));
     }
-    for (int i = 0; i < _numEntries; i++) {
-        iTermMetadataRelease(_array[i].lineMetadata);
+    if (_doubleWidthCharacters) {
+        _doubleWidthCharacters = (__strong iTermDoubleWidthCharacterCache **)iTermZeroingRealloc((void *)_doubleWidthCharacters,
+                                                                                                 formerCapacity,
+                                                                                                 newCapacity,
+                                                                                                 sizeof(id));
+    }
+    if (_wrappedLineCounts) {
+        _wrappedLineCounts = (LineBlockWrappedLineCount *)iTermZeroingRealloc(_wrappedLineCounts,
+                                                                              formerCapacity,
+                                                                              newCapacity,
+                                                                              sizeof(LineBlockWrappedLineCount));
+    }
+}
+
+- (void)ensureExternalAttributes {
+    if (!_externalAttributes) {
+        _externalAttributes = (__strong iTermExternalAttributeIndex **)iTermCalloc(_capacity, sizeof(id));
+    }
+}
+
+- (void)ensureBidiDisplayInfos {
+    if (!_bidiDisplayInfos) {
+        _bidiDisplayInfos = (__strong iTermBidiDisplayInfo **)iTermCalloc(_capacity, sizeof(id));
+    }
+}
+
+- (void)ensureDoubleWidthCharacters {
+    if (!_doubleWidthCharacters) {
+        _doubleWidthCharacters = (__strong iTermDoubleWidthCharacterCache **)iTermCalloc(_capacity, sizeof(id));
+    }
+}
+
+- (void)ensureWrappedLineCounts {
+    if (!_wrappedLineCounts) {
+        _wrappedLineCounts = (LineBlockWrappedLineCount *)iTermCalloc(_capacity, sizeof(LineBlockWrappedLineCount));
+    }
+}
+
+- (void)dealloc {
+    // Release objects before freeing the memory that holds the strong references.
+    for (int i = 0; i < _capacity; i++) {
+        if (_externalAttributes) {
+            _externalAttributes[i] = nil;
+        }
+        if (_bidiDisplayInfos) {
+            _bidiDisplayInfos[i] = nil;
+        }
+        if (_doubleWidthCharacters) {
+            _doubleWidthCharacters[i] = nil;
+        }
     }
-    free(_array);
-    _array = (LineBlockMetadata *)0xdeadbeef;
+    free(_timestamps);
+    free(_rtlFound);
+    free(_continuations);
+    free((void *)_externalAttributes);
+    free((void *)_bidiDisplayInfos);
+    free((void *)_doubleWidthCharacters);
+    free(_wrappedLineCounts);
 }
 
 @end
@@ -148,10 +231,7 @@
     self = [super init];
     if (self) {
         _ref = [[CopyOnWriteRefCount alloc] init];
-        _guts = [[LineBlockMetadataArrayGuts alloc] init];
-        _guts->_useDWCCache = useDWCCache;
-        _guts->_array = (LineBlockMetadata *)iTermCalloc(sizeof(LineBlockMetadata), capacity);
-        _guts->_capacity = capacity;
+        _guts = [[LineBlockMetadataArrayGuts alloc] initWithCapacity:capacity useDWCCache:useDWCCache];
     }
     return self;
 }
@@ -201,11 +281,12 @@
     _guts->_numEntries += 1;
 
     int j = 0;
-    _guts->_array[i].continuation.code = [components[j++] unsignedShortValue];
-    _guts->_array[i].continuation.backgroundColor = [components[j++] unsignedCharValue];
-    _guts->_array[i].continuation.bgGreen = [components[j++] unsignedCharValue];
-    _guts->_array[i].continuation.bgBlue = [components[j++] unsignedCharValue];
-    _guts->_array[i].continuation.backgroundColorMode = [components[j++] unsignedCharValue];
+    screen_char_t *continuation = &_guts->_continuations[i];
+    continuation->code = [components[j++] unsignedShortValue];
+    continuation->backgroundColor = [components[j++] unsignedCharValue];
+    continuation->bgGreen = [components[j++] unsignedCharValue];
+    continuation->bgBlue = [components[j++] unsignedCharValue];
+    continuation->backgroundColorMode = [components[j++] unsignedCharValue];
 
     NSNumber *timestamp = components.count > j ? components[j++] : @0;
 
@@ -223,15 +304,12 @@
     }
     NSNumber *rtlFound = components.count > j ? components[j++] : @NO;
 
-    iTermMetadataInit(&_guts->_array[i].lineMetadata,
-                      timestamp.doubleValue,
-                      rtlFound.boolValue,
-                      eaIndex);
-    _guts->_array[i].number_of_wrapped_lines = 0;
-    if (_guts->_useDWCCache) {
-        _guts->_array[i].doubleWidthCharacters = nil;
-    }
-    // Search forwards for the end-of-metadata delimiter. Additional LineBlockMetadata fields will be found there, if any.
+    _guts->_timestamps[i] = timestamp.doubleValue;
+    _guts->_rtlFound[i] = rtlFound.boolValue;
+    [self setExternalAttributes:eaIndex atIndex:i];
+    [self clearCachesAtIndex:i];
+
+    // Search forwards for the end-of-metadata delimiter. Additional fields will be found there, if any.
     while (j < components.count && ![@[] isEqual:components[j]]) {
         j++;
     }
@@ -239,7 +317,7 @@
         j++;
     }
     if (components.count > j) {
-        _guts->_array[i].bidi_display_info = [[iTermBidiDisplayInfo alloc] initWithDictionary:components[j++]];
+        [self setBidiDisplayInfo:[[iTermBidiDisplayInfo alloc] initWithDictionary:components[j++]] atIndex:i];
     }
 }
 
@@ -265,26 +343,56 @@
     }];
 }
 
-- (const LineBlockMetadata *)metadataAtIndex:(int)i {
-    ITAssertWithMessage(i >= 0 && i < _guts->_numEntries, @"i=%@ < 0 || i < numEntries=%@", @(i), @(_guts->_numEntries));
-    return &_guts->_array[i];
-}
+#pragma mark - Reading
 
 - (iTermImmutableMetadata)immutableLineMetadataAtIndex:(int)i {
-    iTermMetadataRetainAutorelease(_guts->_array[i].lineMetadata);
-    return iTermMetadataMakeImmutable(_guts->_array[i].lineMetadata);
+    ITAssertWithMessage(i >= 0 && i < _guts->_numEntries, @"i=%@ < 0 || i >= numEntries=%@", @(i), @(_guts->_numEntries));
+    iTermImmutableMetadata result;
+    iTermImmutableMetadataInit(&result,
+                               _guts->_timestamps[i],
+                               _guts->_rtlFound[i],
+                               [self externalAttributesAtIndex:i]);
+    return iTermImmutableMetadataAutorelease(result);
+}
+
+- (screen_char_t)continuationAtIndex:(int)i {
+    ITAssertWithMessage(i >= 0 && i < _guts->_numEntries, @"i=%@ < 0 || i >= numEntries=%@", @(i), @(_guts->_numEntries));
+    return _guts->_continuations[i];
+}
+
+- (BOOL)rtlFoundAtIndex:(int)i {
+    return _guts->_rtlFound[i];
+}
+
+- (iTermBidiDisplayInfo *)bidiDisplayInfoAtIndex:(int)i {
+    return _guts->_bidiDisplayInfos ? _guts->_bidiDisplayInfos[i] : nil;
+}
+
+- (iTermDoubleWidthCharacterCache *)doubleWidthCharacterCacheAtIndex:(int)i {
+    return _guts->_doubleWidthCharacters ? _guts->_doubleWidthCharacters[i] : nil;
+}
+
+- (LineBlockWrappedLineCount)wrappedLineCountAtIndex:(int)i {
+    if (!_guts->_wrappedLineCounts) {
+        return (LineBlockWrappedLineCount){ 0 };
+    }
+    return _guts->_wrappedLineCounts[i];
+}
+
+- (iTermExternalAttributeIndex *)externalAttributesAtIndex:(int)i {
+    return _guts->_externalAttributes ? _guts->_externalAttributes[i] : nil;
 }
 
 - (screen_char_t)lastContinuation {
     ITAssertWithMessage(_guts->_numEntries > 0, @"numEntries=%@ <= 0", @(_guts->_numEntries));
-    return _guts->_array[_guts->_numEntries - 1].continuation;
+    return _guts->_continuations[_guts->_numEntries - 1];
 }
 
 - (id<iTermExternalAttributeIndexReading>)lastExternalAttributeIndex {
     if (_guts->_numEntries == 0) {
         return nil;
     }
-    return iTermMetadataGetExternalAttributesIndex(_guts->_array[_guts->_numEntries - 1].lineMetadata);
+    return [self externalAttributesAtIndex:_guts->_numEntries - 1];
 }
 
 - (NSArray *)encodedArray {
@@ -294,18 +402,20 @@
         // which may be arrays). Optionally, it may be followed by an empty array followed by a
         // dictionary containing bidi display info. The empty array is used as a delimiter for the
         // end of metadata objets.
-        NSArray *baseObjects = @[ @(_guts->_array[i].continuation.code),
-                                  @(_guts->_array[i].continuation.backgroundColor),
-                                  @(_guts->_array[i].continuation.bgGreen),
-                                  @(_guts->_array[i].continuation.bgBlue),
-                                  @(_guts->_array[i].continuation.backgroundColorMode) ];
-        NSArray *metadataObjects = iTermMetadataEncodeToArray(_guts->_array[i].lineMetadata);
+        const screen_char_t continuation = _guts->_continuations[i];
+        NSArray *baseObjects = @[ @(continuation.code),
+                                  @(continuation.backgroundColor),
+                                  @(continuation.bgGreen),
+                                  @(continuation.bgBlue),
+                                  @(continuation.backgroundColorMode) ];
+        NSArray *metadataObjects = iTermImmutableMetadataEncodeToArray([self immutableLineMetadataAtIndex:i]);
 
         NSMutableArray *combined = [baseObjects mutableCopy];
         [combined addObjectsFromArray:metadataObjects];
-        if (_guts->_array[i].bidi_display_info != nil) {
+        iTermBidiDisplayInfo *bidiInfo = [self bidiDisplayInfoAtIndex:i];
+        if (bidiInfo != nil) {
             [combined addObject:@[]];
-            [combined addObject:_guts->_array[i].bidi_display_info.dictionaryValue];
+            [combined addObject:bidiInfo.dictionaryValue];
         }
         [metadataArray addObject:combined];
     }
@@ -314,24 +424,30 @@
 
 #pragma mark - Mutation
 
-- (void)setEntry:(int)i value:(const LineBlockMetadata *)value {
-    [self willMutate];
-    LineBlockMetadata *destination = (LineBlockMetadata *)&_guts->_array[i];
+// These don't call willMutate. Optional columns are allocated only to store a non-nil value.
+- (void)setExternalAttributes:(iTermExternalAttributeIndex *)eaIndex atIndex:(int)i {
+    if (!eaIndex && !_guts->_externalAttributes) {
+        return;
+    }
+    [_guts ensureExternalAttributes];
+    _guts->_externalAttributes[i] = eaIndex;
+}
 
-    iTermExternalAttributeIndex *index = iTermMetadataGetExternalAttributesIndex(value->lineMetadata);
-    iTermExternalAttributeIndex *indexCopy = [index copy];
-    iTermMetadataInit(&destination->lineMetadata,
-                      value->lineMetadata.timestamp,
-                      value->lineMetadata.rtlFound,
-                      indexCopy);
+- (void)setBidiDisplayInfo:(iTermBidiDisplayInfo *)bidiInfo atIndex:(int)i {
+    if (!bidiInfo && !_guts->_bidiDisplayInfos) {
+        return;
+    }
+    [_guts ensureBidiDisplayInfos];
+    _guts->_bidiDisplayInfos[i] = bidiInfo;
+}
 
-    destination->continuation = value->continuation;
-    destination->number_of_wrapped_lines = 0;
-    destination->width_for_number_of_wrapped_lines = 0;
-    if (_guts->_useDWCCache) {
-        destination->doubleWidthCharacters = nil;
+- (void)clearCachesAtIndex:(int)i {
+    if (_guts->_wrappedLineCounts) {
+        _guts->_wrappedLineCounts[i] = (LineBlockWrappedLineCount){ 0 };
+    }
+    if (_guts->_doubleWidthCharacters) {
+        _guts->_doubleWidthCharacters[i] = nil;
     }
-    destination->bidi_display_info = value->bidi_display_info;
 }
 
 - (void)append:(iTermImmutableMetadata)lineMetadata continuation:(screen_char_t)continuation {
@@ -339,34 +455,45 @@
     ITAssertWithMessage(_guts->_capacity > 0, @"capacity=%@ <= 0", @(_guts->_capacity));
     ITAssertWithMessage(_guts->_numEntries < _guts->_capacity, @"numEntries=%@ >= capacity=%@", @(_guts->_numEntries), @(_guts->_capacity));
 
-    iTermMetadataAutorelease(_guts->_array[_guts->_numEntries].lineMetadata);
-    _guts->_array[_guts->_numEntries].lineMetadata = iTermImmutableMetadataMutableCopy(lineMetadata);
-    _guts->_array[_guts->_numEntries].continuation = continuation;
-    _guts->_array[_guts->_numEntries].number_of_wrapped_lines = 0;
+    const int i = _guts->_numEntries;
+    _guts->_timestamps[i] = lineMetadata.timestamp;
+    _guts->_rtlFound[i] = lineMetadata.rtlFound;
+    _guts->_continuations[i] = continuation;
+    [self setExternalAttributes:[iTermImmutableMetadataGetExternalAttributesIndex(lineMetadata) mutableCopyWithZone:nil]
+                        atIndex:i];
+    [self clearCachesAtIndex:i];
 
     _guts->_numEntries += 1;
 }
 
-- (const iTermMetadata *)appendToLastLine:(const iTermImmutableMetadata *)metadataToAppend
-                           originalLength:(int)originalLength
-                         additionalLength:(int)additionalLength 
-                             continuation:(screen_char_t)continuation {
+- (BOOL)appendToLastLine:(const iTermImmutableMetadata *)metadataToAppend
+          originalLength:(int)originalLength
+        additionalLength:(int)additionalLength
+            continuation:(screen_char_t)continuation {
     [self willMutate];
     ITAssertWithMessage(_guts->_numEntries > 0, @"numEntries=%@ <= 0", @(_guts->_numEntries));
     ITAssertWithMessage(_guts->_numEntries > _guts->_first, @"numEntries=%@ <= first=%@", @(_guts->_numEntries), @(_guts->_first));
 
-    iTermMetadataAppend(&_guts->_array[_guts->_numEntries - 1].lineMetadata,
+    const int i = _guts->_numEntries - 1;
+    iTermMetadata lineMetadata;
+    iTermMetadataInit(&lineMetadata,
+                      _guts->_timestamps[i],
+                      _guts->_rtlFound[i],
+                      [self externalAttributesAtIndex:i]);
+    iTermMetadataAppend(&lineMetadata,
                         originalLength,
                         metadataToAppend,
                         additionalLength);
-    _guts->_array[_guts->_numEntries - 1].continuation = continuation;
-    _guts->_array[_guts->_numEntries - 1].number_of_wrapped_lines = 0;
-    if (_guts->_useDWCCache) {
-        // TODO: Would be nice to add on to the index set instead of deleting it.
-        _guts->_array[_guts->_numEntries - 1].doubleWidthCharacters = nil;
-    }
-    _guts->_array[_guts->_numEntries - 1].bidi_display_info = nil;
-    return &_guts->_array[_guts->_numEntries - 1].lineMetadata;
+    _guts->_timestamps[i] = lineMetadata.timestamp;
+    _guts->_rtlFound[i] = lineMetadata.rtlFound;
+    [self setExternalAttributes:iTermMetadataGetExternalAttributesIndex(lineMetadata) atIndex:i];
+    iTermMetadataRelease(lineMetadata);
+
+    _guts->_continuations[i] = continuation;
+    // TODO: Would be nice to add on to the double-width character cache instead of deleting it.
+    [self clearCachesAtIndex:i];
+    [self setBidiDisplayInfo:nil atIndex:i];
+    return _guts->_rtlFound[i];
 }
 
 - (void)increaseCapacityTo:(int)newCapacity {
@@ -374,31 +501,36 @@
         return;
     }
     [self willMutate];
-    const int formerCapacity = _guts->_capacity;
-    _guts->_capacity = newCapacity;
-    _guts->_array = (LineBlockMetadata *)iTermZeroingRealloc((void *)_guts->_array,
-                                                         formerCapacity,
-                                                      _guts->_capacity,
-                                                         sizeof(LineBlockMetadata));
+    [_guts growTo:newCapacity];
+}
+
+- (void)setDoubleWidthCharacterCache:(iTermDoubleWidthCharacterCache *)cache atIndex:(int)i {
+    [self willMutate];
+    if (!cache && !_guts->_doubleWidthCharacters) {
+        return;
+    }
+    [_guts ensureDoubleWidthCharacters];
+    _guts->_doubleWidthCharacters[i] = cache;
 }
 
-- (iTermLineBlockMetadataProvider)metadataProviderAtIndex:(int)i {
-    return (iTermLineBlockMetadataProvider){
-        ._metadata = &_guts->_array[i],
-        ._willMutate = ^{ [self willMutate]; }
-    };
+- (void)setWrappedLineCount:(LineBlockWrappedLineCount)count atIndex:(int)i {
+    [self willMutate];
+    [_guts ensureWrappedLineCounts];
+    _guts->_wrappedLineCounts[i] = count;
 }
 
 - (void)removeLast {
     [self willMutate];
     ITAssertWithMessage(_guts->_numEntries > 0, @"numEntries=%@ <= 0", @(_guts->_numEntries));
     _guts->_numEntries -= 1;
-    _guts->_array[_guts->_numEntries].number_of_wrapped_lines = 0;
-    if (_guts->_useDWCCache) {
-        _guts->_array[_guts->_numEntries].doubleWidthCharacters = nil;
-        iTermMetadataSetExternalAttributes(&_guts->_array[_guts->_numEntries].lineMetadata, nil);
-    }
-    _guts->_array[_guts->_numEntries].bidi_display_info = nil;
+    [self clearEntryAtIndex:_guts->_numEntries];
+}
+
+// Releases the objects an entry that is no longer used refers to.
+- (void)clearEntryAtIndex:(int)i {
+    [self clearCachesAtIndex:i];
+    [self setExternalAttributes:nil atIndex:i];
+    [self setBidiDisplayInfo:nil atIndex:i];
 }
 
 - (void)eraseLastLineCache {
@@ -406,20 +538,18 @@
         return;
     }
     [self willMutate];
-    _guts->_array[_guts->_numEntries - 1].number_of_wrapped_lines = 0;
-    if (_guts->_useDWCCache) {
-        _guts->_array[_guts->_numEntries - 1].doubleWidthCharacters = nil;
-    }
-    _guts->_array[_guts->_numEntries - 1].bidi_display_info = nil;
+    [self clearCachesAtIndex:_guts->_numEntries - 1];
+    [self setBidiDisplayInfo:nil atIndex:_guts->_numEntries - 1];
 }
 
 - (void)eraseFirstLineCache {
     [self willMutate];
     if (_guts->_numEntries > _guts->_first) {
-        _guts->_array[_guts->_first].width_for_number_of_wrapped_lines = 0;
-        _guts->_array[_guts->_first].number_of_wrapped_lines = 0;
+        if (_guts->_wrappedLineCounts) {
+            _guts->_wrappedLineCounts[_guts->_first] = (LineBlockWrappedLineCount){ 0 };
+        }
         // TODO: Figure out why I don't reset double_width_characters here. seems sktch
-        _guts->_array[_guts->_numEntries - 1].bidi_display_info = nil;
+        [self setBidiDisplayInfo:nil atIndex:_guts->_numEntries - 1];
     }
 }
 
@@ -428,22 +558,20 @@
     ITAssertWithMessage(_guts->_numEntries > 0, @"numEntries=%@ <= 0", @(_guts->_numEntries));
     ITAssertWithMessage(_guts->_numEntries > _guts->_first, @"numEntries=%@ <= first=%@", @(_guts->_numEntries), @(_guts->_first));
 
-    iTermMetadataSetExternalAttributes(&_guts->_array[_guts->_numEntries - 1].lineMetadata,
-                                       eaIndex);
-
+    [self setExternalAttributes:eaIndex atIndex:_guts->_numEntries - 1];
 }
 
 - (void)setRTLFound:(BOOL)rtlFound atIndex:(NSInteger)index {
     [self willMutate];
-    _guts->_array[index].lineMetadata.rtlFound = rtlFound;
+    _guts->_rtlFound[index] = rtlFound;
 }
 
 - (void)setBidiInfo:(iTermBidiDisplayInfo *)bidiInfo
              atLine:(int)index
            rtlFound:(BOOL)rtlFound {
     [self willMutate];
-    _guts->_array[index].lineMetadata.rtlFound = rtlFound;
-    _guts->_array[index].bidi_display_info = bidiInfo;
+    _guts->_rtlFound[index] = rtlFound;
+    [self setBidiDisplayInfo:bidiInfo atIndex:index];
 }
 
 - (void)removeFirst {
@@ -455,14 +583,8 @@
     for (int i = 0; i < n; i++) {
         const int first = _guts->_first;
         ITAssertWithMessage(_guts->_numEntries >= first, @"numEntries=%@ < first=%@", @(_guts->_numEntries), @(first));
-        // This is just paranoia. The entry is no longer used after this point.
-        _guts->_array[first].width_for_number_of_wrapped_lines = 0;
-        _guts->_array[first].number_of_wrapped_lines = 0;
-        if (_guts->_useDWCCache) {
-            _guts->_array[first].doubleWidthCharacters = nil;
-        }
-        _guts->_array[first].bidi_display_info = nil;
-        iTermMetadataSetExternalAttributes(&_guts->_array[first].lineMetadata, nil);
+        // The entry is no longer used after this point.
+        [self clearEntryAtIndex:first];
         _guts->_first += 1;
         ITAssertWithMessage(_guts->_first <= _guts->_numEntries,
                             @"first=%@ > numEntries=%@", @(_guts->_first), @(_guts->_numEntries));
@@ -472,13 +594,10 @@
 - (void)reset {
     [self willMutate];
     for (int i = 0; i < _guts->_numEntries; i++) {
-        iTermMetadataSetExternalAttributes(&_guts->_array[i].lineMetadata, nil);
-        _guts->_array[i].doubleWidthCharacters = nil;
-        _guts->_array[i].bidi_display_info = nil;
+        [self clearEntryAtIndex:i];
     }
     _guts->_numEntries = 0;
     _guts->_first = 0;
 }
 
 @end
-
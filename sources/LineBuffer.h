@@ -175,6 +175,18 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)storeLocationOfAbsPos:(long long)absPos
                     inContext:(FindContext * _Nonnull)context;
 
+// Calls `block` with the raw lines at or after `start`, a position from -firstPosition or from a
+// previous call, until about `maxCells` cells have been passed. A raw line is split only if it
+// doesn't fit; `continuesLine` is set for a piece that doesn't start its line and `endsLine` for one
+// that finishes it. The last line isn't ended while it is partial. If lines at `start` have been
+// dropped, enumeration begins at the first line that remains. Returns the position to resume from.
+// yOffset in positions counts the empty lines already passed at that absolute position.
+- (LineBufferPosition *)enumerateRawLinesFromPosition:(LineBufferPosition *)start
+                                             maxCells:(int)maxCells
+                                                block:(void (^ NS_NOESCAPE)(ScreenCharArray *chars,
+                                                                            BOOL continuesLine,
+                                                                            BOOL endsLine))block;
+
 - (NSString * _Nonnull)debugString;
 - (void)dumpWrappedToWidth:(int)width;
 - (NSString * _Nonnull)compactLineDumpWithWidth:(int)width andContinuationMarks:(BOOL)continuationMarks;
@@ -211,6 +223,9 @@ NS_ASSUME_NONNULL_BEGIN
 - (iTermBidiDisplayInfo * _Nullable)bidiInfoForLine:(int)line width:(int)width;
 
 - (NSInteger)numberOfUnwrappedLinesInRange:(VT100GridRange)range width:(int)width;
+
+// How much memory packed and unpacked blocks use, for debug logs.
+@property(nonatomic, readonly) NSString *characterMemoryDescription;
 @end
 
 // A LineBuffer represents an ordered collection of strings of screen_char_t. Each string forms a
@@ -231,6 +246,16 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic) BOOL dirty;
 @property(nonatomic) BOOL maintainBidiInfo;
 
+// If set, blocks are moved to a temporary file instead of being packed when they're sealed or
+// go unread, and are mapped back in when needed. Meant for unlimited scrollback. Reverts to NO if
+// the file can't be created. Not copied.
+@property(nonatomic) BOOL spillsToDisk;
+
+// If set, blocks are added to a trigram index as they're sealed, which lets searches skip blocks
+// that can't contain a match. Copies share the index. Defaults to the indexScrollbackForSearch
+// advanced setting.
+@property(nonatomic) BOOL indexesForSearch;
+
 - (LineBuffer * _Nonnull)initWithBlockSize:(int)bs;
 - (LineBuffer * _Nullable)initWithDictionary:(NSDictionary * _Nonnull)dictionary
                             maintainBidiInfo:(BOOL)maintainBidiInfo;
@@ -309,9 +334,20 @@ NS_ASSUME_NONNULL_BEGIN
 // Ensure it's fast to append to the buffer.
 - (void)ensureLastBlockUncopied;
 
+// Also picks up blocks that `source` packed since the last merge.
 - (void)mergeFrom:(LineBuffer *)source;
 - (void)forceMergeFrom:(LineBuffer *)source;
 
+// Picks up blocks that `source` packed or spilled since the last merge. Use this when `source`
+// isn't dirty and so doesn't need a full merge.
+- (void)adoptCompactBlocksFrom:(LineBuffer *)source;
+
+// Packs blocks that haven't been read recently to save memory. See
+// -[iTermLineBlockArray packBlocksIdleFor:keepingMostRecent:limit:]. Returns the number packed.
+- (NSInteger)packBlocksIdleFor:(int)idleTicks
+              keepingMostRecent:(NSInteger)keep
+                          limit:(NSInteger)limit;
+
 - (void)performBlockWithTemporaryChanges:(void (^ NS_NOESCAPE)(void))block;
 
 - (void)clear;
@@ -36,6 +36,8 @@
 #import "iTermLineBlockArray.h"
 #import "iTermMalloc.h"
 #import "iTermOrderedDictionary.h"
+#import "iTermScrollbackSearchIndex.h"
+#import "iTermScrollbackSpillFile.h"
 #import "LineBlock.h"
 #import "LineBufferSorting.h"
 #import "NSArray+iTerm.h"
@@ -110,6 +112,18 @@ static const NSInteger kUnicodeVersion = 9;
     BOOL _wantsSeal;
     int _deferSanityCheck;
     atomic_llong _generation;
+
+    // Incremented when blocks get packed. Packing doesn't make the buffer dirty, so copies
+    // compare this to the value they last saw to decide whether to adopt packed blocks.
+    NSInteger _packGeneration;
+    NSInteger _sourcePackGeneration;
+
+    // Created the first time a block is spilled. Not shared with copies, which adopt spilled
+    // blocks instead of spilling their own.
+    iTermScrollbackSpillFile *_spillFile;
+
+    // Created the first time a block is indexed. Shared with copies.
+    iTermScrollbackSearchIndex *_searchIndex;
 }
 
 @synthesize mayHaveDoubleWidthCharacter = _mayHaveDoubleWidthCharacter;
@@ -129,11 +143,78 @@ static const NSInteger kUnicodeVersion = 9;
     // buffers are.
     [_lineBlocks.lastBlock shrinkToFit];
     [self commitLastBlock];
+    [self compactSealedBlock:_lineBlocks.lastBlock];
     return [_lineBlocks addBlockOfSize:size
                                 number:self.nextBlockNumber
            mayHaveDoubleWidthCharacter:self.mayHaveDoubleWidthCharacter];
 }
 
+- (void)compactSealedBlock:(LineBlock *)block {
+    // Index first since it has to read every character.
+    [self indexSealedBlock:block];
+    iTermScrollbackSpillFile *spillFile = [self spillFileIfEnabled];
+    if (spillFile && [block spillCharacterBufferToFile:spillFile]) {
+        return;
+    }
+    if ([iTermAdvancedSettingsModel packScrollback]) {
+        [block packCharacterBuffer];
+    }
+}
+
+- (void)indexSealedBlock:(LineBlock *)block {
+    if (!_indexesForSearch || !block) {
+        return;
+    }
+    if (!_searchIndex) {
+        _searchIndex = [[iTermScrollbackSearchIndex alloc] init];
+    }
+    iTermTrigramSignature *signature = [[iTermTrigramSignature alloc] init];
+    [block addToTrigramSignature:signature];
+    [_searchIndex setSignature:signature
+                forBlockNumber:block.absoluteBlockNumber
+                    generation:block.generation];
+}
+
+- (void)setIndexesForSearch:(BOOL)indexesForSearch {
+    _indexesForSearch = indexesForSearch;
+    if (!indexesForSearch) {
+        _searchIndex = nil;
+    }
+}
+
+// YES unless the search index shows that no line in the block can match.
+- (BOOL)block:(LineBlock *)block mayContainMatchForContext:(FindContext *)context {
+    if (!_searchIndex) {
+        return YES;
+    }
+    iTermTrigramQuery *query = [_searchIndex queryWithString:context.substring
+                                                     options:context.options
+                                                        mode:context.mode];
+    if (!query) {
+        return YES;
+    }
+    iTermTrigramSignature *signature = [_searchIndex signatureForBlockNumber:block.absoluteBlockNumber
+                                                                  generation:block.generation];
+    if (!signature) {
+        return YES;
+    }
+    return [query mayMatchSignature:signature];
+}
+
+- (iTermScrollbackSpillFile *)spillFileIfEnabled {
+    if (!_spillsToDisk) {
+        return nil;
+    }
+    if (!_spillFile) {
+        _spillFile = [iTermScrollbackSpillFile spillFile];
+        if (!_spillFile) {
+            DLog(@"Couldn't create a spill file. Keeping scrollback in memory.");
+            _spillsToDisk = NO;
+        }
+    }
+    return _spillFile;
+}
+
 - (long long)nextBlockNumber {
     return num_dropped_blocks + _lineBlocks.count;
 }
@@ -157,6 +238,7 @@ static const NSInteger kUnicodeVersion = 9;
     max_lines = -1;
     num_wrapped_lines_width = -1;
     num_dropped_blocks = 0;
+    _indexesForSearch = [iTermAdvancedSettingsModel indexScrollbackForSearch];
 }
 
 // The designated initializer. We prefer not to expose the notion of block sizes to
@@ -203,6 +285,10 @@ static const NSInteger kUnicodeVersion = 9;
                 // prior to display.
                 [block eraseRTLStatusInAllCharacters];
             }
+            if ([iTermAdvancedSettingsModel packScrollback]) {
+                // Blocks are spilled later, once the owner says whether it wants that.
+                [_lineBlocks.lastBlock packCharacterBuffer];
+            }
             [_lineBlocks addBlock:block];
             // We do not call commitLastBlock because the block can restore all of its state.
         }
@@ -383,6 +469,7 @@ static int RawNumLines(LineBuffer* buffer, int width) {
         num_wrapped_lines_cache = total_lines;
     }
     if (blocksToDealloc.count) {
+        [_searchIndex removeSignaturesBeforeBlockNumber:num_dropped_blocks];
         dispatch_async(gDeallocQueue, ^{
             // LineBlock's dealloc is surprsingly slow considering how little it does, taking over
             // 1% of total time in a benchmark of printing a large ascii file.
@@ -1338,13 +1425,15 @@ NS_INLINE int TotalNumberOfRawLines(LineBuffer *self) {
     const NSRange blockAbsolutePositions = NSMakeRange([self absPositionOfAbsBlock:blockIndex + num_dropped_blocks],
                                                        block.rawSpaceUsed);
     BOOL includesPartialLastLine = NO;
-    [block findSubstring:context.substring
-                 options:context.options
-                    mode:context.mode
-                atOffset:context.offset
-                 results:context.results
-         multipleResults:((context.options & FindMultipleResults) != 0)
- includesPartialLastLine:&includesPartialLastLine];
+    if ([self block:block mayContainMatchForContext:context]) {
+        [block findSubstring:context.substring
+                     options:context.options
+                        mode:context.mode
+                    atOffset:context.offset
+                     results:context.results
+             multipleResults:((context.options & FindMultipleResults) != 0)
+     includesPartialLastLine:&includesPartialLastLine];
+    }
     context.lastAbsPositionsSearched = blockAbsolutePositions;
     context.includesPartialLastLine = includesPartialLastLine && (blockIndex + 1 == numBlocks);
     NSMutableArray* filtered = [NSMutableArray arrayWithCapacity:[context.results count]];
@@ -1800,6 +1889,66 @@ NS_INLINE int TotalNumberOfRawLines(LineBuffer *self) {
     context.offset = MAX(0, absPos - absOffset);
 }
 
+- (LineBufferPosition *)enumerateRawLinesFromPosition:(LineBufferPosition *)start
+                                             maxCells:(int)maxCells
+                                                block:(void (^ NS_NOESCAPE)(ScreenCharArray *chars,
+                                                                            BOOL continuesLine,
+                                                                            BOOL endsLine))block {
+    // Measure from the start of the first block's buffer, including its dropped prefix, so that
+    // dropping lines doesn't move the lines that remain.
+    long long blockStart = droppedChars - _lineBlocks.firstBlock.startOffset;
+    long long position = start.absolutePosition;
+    int emptyLinesToSkip = start.yOffset;
+    if (position < droppedChars) {
+        position = droppedChars;
+        emptyLinesToSkip = 0;
+    }
+    int budget = MAX(1, maxCells);
+    for (LineBlock *lineBlock in _lineBlocks.blocks) {
+        const int used = lineBlock.rawSpaceUsed;
+        if (position > blockStart + used || budget <= 0) {
+            blockStart += used;
+            continue;
+        }
+        const int firstEntry = lineBlock.firstEntry;
+        const int lastEntry = firstEntry + lineBlock.numRawLines - 1;
+        for (int i = firstEntry; i <= lastEntry && budget > 0; i++) {
+            const int length = [lineBlock lengthOfRawLine:i];
+            const long long lineStart = blockStart + (i == firstEntry ? lineBlock.startOffset : [lineBlock offsetOfRawLine:i]);
+            const long long lineEnd = lineStart + length;
+            if (lineEnd < position || (length > 0 && lineEnd == position)) {
+                continue;
+            }
+            if (length == 0 && emptyLinesToSkip > 0) {
+                emptyLinesToSkip--;
+                continue;
+            }
+            const BOOL partial = (i == lastEntry && lineBlock.hasPartial);
+            if (length == 0 && partial) {
+                continue;
+            }
+            const int x = (int)MAX(0, position - lineStart);
+            const int n = MIN(length - x, budget);
+            ScreenCharArray *sca = [lineBlock screenCharArrayForRawLine:i];
+            block([sca subArrayWithRange:NSMakeRange(x, n)],
+                  x > 0,
+                  x + n == length && !partial);
+            budget -= MAX(1, n);
+            if (n == 0) {
+                emptyLinesToSkip++;
+            } else {
+                position = lineStart + x + n;
+                emptyLinesToSkip = 0;
+            }
+        }
+        blockStart += used;
+    }
+    LineBufferPosition *result = [LineBufferPosition position];
+    result.absolutePosition = position;
+    result.yOffset = emptyLinesToSkip;
+    return result;
+}
+
 - (long long)numberOfDroppedChars {
     return droppedChars;
 }
@@ -1818,11 +1967,17 @@ NS_INLINE int TotalNumberOfRawLines(LineBuffer *self) {
     __block BOOL truncated = NO;
     __block NSInteger numLines = 0;
 
+    LineBlock *tail = _lineBlocks.lastBlock;
     iTermOrderedDictionary<NSString *, LineBlock *> *index =
     [iTermOrderedDictionary byMappingEnumerator:_lineBlocks.blocks.reverseObjectEnumerator
                                           block:^id _Nonnull(NSUInteger index,
                                                              LineBlock *_Nonnull block) {
         DLog(@"Maybe encode block %p with guid %@", block, block.stringUniqueIdentifier);
+        if (block == tail) {
+            // The tail is stored inline and sealed blocks as blobs. Sealing a block doesn't change
+            // its generation, so give the tail its own identifier to get it re-encoded once sealed.
+            return [block.stringUniqueIdentifier stringByAppendingString:@".tail"];
+        }
         return block.stringUniqueIdentifier;
     }];
     [encoder encodeArrayWithKey:kLineBufferBlocksKey
@@ -1840,7 +1995,12 @@ NS_INLINE int TotalNumberOfRawLines(LineBuffer *self) {
                                           block:^BOOL(id<iTermEncoderAdapter>  _Nonnull encoder) {
             assert(!truncated);
             DLog(@"Really encode block %p with guid %@", block, block.stringUniqueIdentifier);
-            [encoder mergeDictionary:block.dictionary];
+            if (block == tail) {
+                // The tail changes on nearly every save so there's no point storing it separately.
+                [encoder mergeDictionary:block.dictionary];
+            } else if (![encoder mergeBlob:block.dictionary]) {
+                return NO;
+            }
             // This caps the amount of data at a reasonable but arbitrary size.
             numLines += [block getNumLinesWithWrapWidth:80];
             if (numLines >= maxLines) {
@@ -1976,6 +2136,10 @@ NS_INLINE int TotalNumberOfRawLines(LineBuffer *self) {
     theCopy->droppedChars = droppedChars;
     theCopy->_mayHaveDoubleWidthCharacter = _mayHaveDoubleWidthCharacter;
     theCopy->_maintainBidiInfo = _maintainBidiInfo;
+    theCopy->_packGeneration = _packGeneration;
+    theCopy->_sourcePackGeneration = _packGeneration;
+    theCopy->_indexesForSearch = _indexesForSearch;
+    theCopy->_searchIndex = _searchIndex;
     [theCopy sanityCheck];
 
     return theCopy;
@@ -2113,6 +2277,39 @@ NS_INLINE int TotalNumberOfRawLines(LineBuffer *self) {
     [self mergeFrom:source];
 }
 
+- (NSInteger)packBlocksIdleFor:(int)idleTicks
+              keepingMostRecent:(NSInteger)keep
+                          limit:(NSInteger)limit {
+    const NSInteger count = [_lineBlocks packBlocksIdleFor:idleTicks
+                                          keepingMostRecent:keep
+                                                      limit:limit
+                                                  spillFile:[self spillFileIfEnabled]];
+    if (count > 0) {
+        _packGeneration += 1;
+    }
+    return count;
+}
+
+- (void)adoptCompactBlocksFrom:(LineBuffer *)source {
+    if (source->_packGeneration == _sourcePackGeneration) {
+        return;
+    }
+    _sourcePackGeneration = source->_packGeneration;
+    const NSInteger count = [_lineBlocks adoptCompactCharacterBuffers];
+    DLog(@"Adopted %@ packed or spilled blocks", @(count));
+    if (count > 0) {
+        _packGeneration += 1;
+    }
+}
+
+- (NSString *)characterMemoryDescription {
+    const iTermLineBlockArrayMemoryUsage usage = [_lineBlocks memoryUsage];
+    return [NSString stringWithFormat:@"%@ packed blocks using %@ bytes (%@ bytes unpacked), %@ unpacked blocks using %@ bytes, %@ spilled blocks with %@ bytes on disk",
+            @(usage.packedBlocks), @(usage.packedBytes), @(usage.packedRawBytes),
+            @(usage.unpackedBlocks), @(usage.unpackedBytes),
+            @(usage.spilledBlocks), @(usage.spilledBytes)];
+}
+
 - (void)mergeFrom:(LineBuffer *)source {
     _deferSanityCheck++;
     [self reallyMergeFrom:source];
@@ -2138,6 +2335,8 @@ NS_INLINE int TotalNumberOfRawLines(LineBuffer *self) {
     }
 
     assert(source != nil);
+    [self adoptCompactBlocksFrom:source];
+    _searchIndex = source->_searchIndex;
     if (!source.dirty) {
         return;
     }
@@ -1086,6 +1086,8 @@ webViewConfiguration:(WKWebViewConfiguration *)webViewConfiguration
                     completion:(void (^)(ITMGetPromptResponse *response))completion;
 - (void)handleListPromptsRequest:(ITMListPromptsRequest *)request
                       completion:(void (^)(ITMListPromptsResponse *response))completion;
+- (void)handleExportScrollbackRequest:(ITMExportScrollbackRequest *)request
+                           completion:(void (^)(ITMExportScrollbackResponse *response))completion;
 - (ITMNotificationResponse *)handleAPINotificationRequest:(ITMNotificationRequest *)request
                                             connectionKey:(NSString *)connectionKey;
 
@@ -69,6 +69,8 @@
 #import "iTermOpenDirectory.h"
 #import "iTermPreferences.h"
 #import "iTermRateLimitedUpdate.h"
+#import "iTermScreenUpdateSubscription.h"
+#import "iTermScrollbackExporter.h"
 #import "iTermScriptConsole.h"
 #import "iTermScriptHistory.h"
 #import "iTermSharedImageStore.h"
@@ -207,6 +209,10 @@
 static const NSInteger kMinimumUnicodeVersion = 8;
 static const NSInteger kMaximumUnicodeVersion = 9;
 
+// A screen update subscriber whose connection has more than this many bytes waiting to be sent
+// stops getting deltas until it catches up, and then gets a full refresh.
+static const NSInteger iTermScreenUpdateDeltaMaximumBacklog = 1024 * 1024;
+
 static NSString *const PTYSessionDidRepairSavedArrangement = @"PTYSessionDidRepairSavedArrangement";
 
 NSString *const PTYSessionCreatedNotification = @"PTYSessionCreatedNotification";
@@ -513,6 +519,8 @@ typedef NS_ENUM(NSUInteger, PTYSessionTurdType) {
     NSMutableDictionary<id, ITMNotificationRequest *> *_keystrokeSubscriptions;
     NSMutableDictionary<id, ITMNotificationRequest *> *_keyboardFilterSubscriptions;
     NSMutableDictionary<id, ITMNotificationRequest *> *_updateSubscriptions;
+    // Subset of _updateSubscriptions that asked for deltas.
+    NSMutableDictionary<id, iTermScreenUpdateSubscription *> *_screenUpdateDeltaSubscriptions;
     NSMutableDictionary<id, ITMNotificationRequest *> *_promptSubscriptions;
     NSMutableDictionary<id, ITMNotificationRequest *> *_customEscapeSequenceNotifications;
 
@@ -800,6 +808,7 @@ typedef NS_ENUM(NSUInteger, PTYSessionTurdType) {
         _keystrokeSubscriptions = [[NSMutableDictionary alloc] init];
         _keyboardFilterSubscriptions = [[NSMutableDictionary alloc] init];
         _updateSubscriptions = [[NSMutableDictionary alloc] init];
+        _screenUpdateDeltaSubscriptions = [[NSMutableDictionary alloc] init];
         _promptSubscriptions = [[NSMutableDictionary alloc] init];
         _customEscapeSequenceNotifications = [[NSMutableDictionary alloc] init];
         _metalDisabledTokens = [[NSMutableSet alloc] init];
@@ -1023,6 +1032,7 @@ ITERM_WEAKLY_REFERENCEABLE
     [_keystrokeSubscriptions release];
     [_keyboardFilterSubscriptions release];
     [_updateSubscriptions release];
+    [_screenUpdateDeltaSubscriptions release];
     [_promptSubscriptions release];
     [_customEscapeSequenceNotifications release];
 
@@ -3841,6 +3851,14 @@ webViewConfiguration:(WKWebViewConfiguration *)webViewConfiguration
     [_screen threadedReadTask:buffer length:length];
 }
 
+- (char *)threadedReadTaskBufferWithMinimumLength:(int)minimumLength available:(int *)available {
+    return [_screen threadedReadBufferWithMinimumLength:minimumLength available:available];
+}
+
+- (void)threadedReadTaskDidFillBuffer:(char *)buffer length:(int)length {
+    [_screen threadedReadTaskDidFillBufferWithLength:length];
+}
+
 - (BOOL)haveResizedRecently {
     const NSTimeInterval kGracePeriodAfterResize = 0.25;
     return [NSDate timeIntervalSinceReferenceDate] < _lastResize + kGracePeriodAfterResize;
@@ -6826,6 +6844,7 @@ static NSString *const PTYSessionComposerPrefixUserDataKeyDetectedByTrigger = @"
     [_keystrokeSubscriptions removeAllObjects];
     [_keyboardFilterSubscriptions removeAllObjects];
     [_updateSubscriptions removeAllObjects];
+    [_screenUpdateDeltaSubscriptions removeAllObjects];
     [_customEscapeSequenceNotifications removeAllObjects];
 }
 
@@ -6834,6 +6853,7 @@ static NSString *const PTYSessionComposerPrefixUserDataKeyDetectedByTrigger = @"
     [_keystrokeSubscriptions removeObjectForKey:notification.object];
     [_keyboardFilterSubscriptions removeObjectForKey:notification.object];
     [_updateSubscriptions removeObjectForKey:notification.object];
+    [_screenUpdateDeltaSubscriptions removeObjectForKey:notification.object];
     [_customEscapeSequenceNotifications removeObjectForKey:notification.object];
 }
 
@@ -11538,12 +11558,19 @@ typedef NS_ENUM(NSUInteger, PTYSessionTmuxReport) {
     }
 }
 
-- (void)textViewDidFindDirtyRects {
+- (void)textViewDidFindDirtyRects:(NSData *)dirtyRanges {
     if (_updateSubscriptions.count) {
         ITMNotification *notification = [[[ITMNotification alloc] init] autorelease];
         notification.screenUpdateNotification = [[[ITMScreenUpdateNotification alloc] init] autorelease];
         notification.screenUpdateNotification.session = self.guid;
         [_updateSubscriptions enumerateKeysAndObjectsUsingBlock:^(id  _Nonnull key, ITMNotificationRequest * _Nonnull obj, BOOL * _Nonnull stop) {
+            iTermScreenUpdateSubscription *subscription = _screenUpdateDeltaSubscriptions[key];
+            if (subscription) {
+                [self postScreenUpdateDeltaForSubscription:subscription
+                                             connectionKey:key
+                                               dirtyRanges:dirtyRanges];
+                return;
+            }
             [[iTermAPIHelper sharedInstance] postAPINotification:notification
                                                  toConnectionKey:key];
         }];
@@ -18904,6 +18931,77 @@ static const NSTimeInterval PTYSessionFocusReportBellSquelchTimeIntervalThreshol
     return VT100GridAbsWindowedRangeMake(VT100GridAbsCoordRangeMake(0, range.location, 0, NSMaxRange(range)), 0, 0);
 }
 
+// Sends a screen update notification with a delta to a subscriber that asked for them.
+// `dirtyRanges` has a VT100GridRange for each line of the screen, or is nil if all of it changed.
+- (void)postScreenUpdateDeltaForSubscription:(iTermScreenUpdateSubscription *)subscription
+                               connectionKey:(id)connectionKey
+                                 dirtyRanges:(NSData *)dirtyRanges {
+    if ([[iTermAPIHelper sharedInstance] unsentByteCountForConnectionKey:connectionKey] > iTermScreenUpdateDeltaMaximumBacklog) {
+        // The client isn't keeping up. Rather than queue more deltas behind the ones it hasn't
+        // received, drop this one and send everything once the backlog clears. Deltas skipped
+        // this way don't consume a sequence number.
+        DLog(@"Skip screen update delta for %@ because its connection is backed up", connectionKey);
+        [subscription setNeedsFullRefresh];
+        return;
+    }
+    const VT100GridSize size = VT100GridSizeMake(_screen.width, _screen.height);
+    const long long firstLineNumber = _screen.numberOfScrollbackLines + _screen.totalScrollbackOverflow;
+    const BOOL fullRefresh = [subscription beginDeltaWithSize:size firstLineNumber:firstLineNumber];
+    if (dirtyRanges.length < size.height * sizeof(VT100GridRange)) {
+        dirtyRanges = nil;
+    }
+    const VT100GridRange *dirtyRangesPerLine = dirtyRanges.bytes;
+
+    ITMScreenUpdateDelta *delta = [[[ITMScreenUpdateDelta alloc] init] autorelease];
+    delta.sequenceNumber = subscription.sequenceNumber;
+    delta.fullRefresh = fullRefresh;
+    delta.size.width = size.width;
+    delta.size.height = size.height;
+    delta.firstLineNumber = firstLineNumber;
+    for (int y = 0; y < size.height; y++) {
+        VT100GridRange range = VT100GridRangeMake(0, size.width);
+        if (!fullRefresh && dirtyRangesPerLine) {
+            range = dirtyRangesPerLine[y];
+            if (range.length <= 0) {
+                continue;
+            }
+        }
+        ScreenCharArray *sca = [_screen screenCharArrayAtScreenIndex:y];
+        range.location = MAX(0, MIN(range.location, sca.length));
+        range.length = MAX(0, MIN(range.length, sca.length - range.location));
+
+        ITMScreenLineDelta *lineDelta = [[[ITMScreenLineDelta alloc] init] autorelease];
+        lineDelta.y = y;
+        lineDelta.x = range.location;
+        lineDelta.length = range.length;
+        ITMLineContents *lineContents = lineDelta.contents;
+        lineContents.text = [self stringForLine:sca.line + range.location
+                                         length:range.length
+                                        eaIndex:[sca.eaIndex subAttributesFromIndex:range.location]
+                                      cppsArray:lineContents.codePointsPerCellArray
+                                    stylesArray:subscription.includeStyles ? lineContents.styleArray : nil];
+        switch (sca.eol) {
+            case EOL_HARD:
+                lineContents.continuation = ITMLineContents_Continuation_ContinuationHardEol;
+                break;
+
+            case EOL_SOFT:
+            case EOL_DWC:
+                lineContents.continuation = ITMLineContents_Continuation_ContinuationSoftEol;
+                break;
+        }
+        [delta.linesArray addObject:lineDelta];
+    }
+    delta.cursor.x = _screen.currentGrid.cursor.x;
+    delta.cursor.y = _screen.currentGrid.cursor.y + firstLineNumber;
+
+    ITMNotification *notification = [[[ITMNotification alloc] init] autorelease];
+    notification.screenUpdateNotification.session = self.guid;
+    notification.screenUpdateNotification.delta = delta;
+    [[iTermAPIHelper sharedInstance] postAPINotification:notification
+                                         toConnectionKey:connectionKey];
+}
+
 - (ITMGetBufferResponse *)handleGetBufferRequest:(ITMGetBufferRequest *)request {
     ITMGetBufferResponse *response = [[[ITMGetBufferResponse alloc] init] autorelease];
 
@@ -18988,6 +19086,32 @@ static const NSTimeInterval PTYSessionFocusReportBellSquelchTimeIntervalThreshol
     completion(response);
 }
 
++ (dispatch_queue_t)scrollbackExportQueue {
+    static dispatch_queue_t queue;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        queue = dispatch_queue_create("com.iterm2.scrollback-export", DISPATCH_QUEUE_SERIAL);
+    });
+    return queue;
+}
+
+- (void)handleExportScrollbackRequest:(ITMExportScrollbackRequest *)request
+                           completion:(void (^)(ITMExportScrollbackResponse *))completion {
+    // Chunks can be large, so encode them from a copy of history off the main thread.
+    LineBuffer *lineBuffer = [_screen lineBufferSnapshot];
+    dispatch_async([PTYSession scrollbackExportQueue], ^{
+        ITMExportScrollbackResponse *response =
+            [iTermScrollbackExporter responseForRequest:request
+                                             lineBuffer:lineBuffer
+                                          styleProvider:^ITMCellStyle *(screen_char_t c, iTermExternalAttribute *ea) {
+                return [self protoStyleForCharacter:c externalAttributes:ea];
+            }];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(response);
+        });
+    });
+}
+
 - (void)handleGetPromptRequest:(ITMGetPromptRequest *)request completion:(void (^)(ITMGetPromptResponse *response))completion {
     id<VT100ScreenMarkReading> mark;
     if (request.hasUniquePromptId) {
@@ -20102,16 +20226,36 @@ static const NSTimeInterval PTYSessionFocusReportBellSquelchTimeIntervalThreshol
     }
     if (request.subscribe) {
         if (subscriptions[connectionKey]) {
+            iTermScreenUpdateSubscription *deltaSubscription = nil;
+            if (subscriptions == _updateSubscriptions && request.screenUpdateMonitorRequest.resync) {
+                deltaSubscription = _screenUpdateDeltaSubscriptions[connectionKey];
+            }
+            if (deltaSubscription) {
+                [deltaSubscription setNeedsFullRefresh];
+                [self postScreenUpdateDeltaForSubscription:deltaSubscription
+                                             connectionKey:connectionKey
+                                               dirtyRanges:nil];
+                response.status = ITMNotificationResponse_Status_Ok;
+                return response;
+            }
             response.status = ITMNotificationResponse_Status_AlreadySubscribed;
             return response;
         }
         subscriptions[connectionKey] = request;
+        if (subscriptions == _updateSubscriptions && request.screenUpdateMonitorRequest.deltas) {
+            iTermScreenUpdateSubscription *deltaSubscription =
+                [[[iTermScreenUpdateSubscription alloc] initWithIncludeStyles:request.screenUpdateMonitorRequest.includeStyles] autorelease];
+            _screenUpdateDeltaSubscriptions[connectionKey] = deltaSubscription;
+        }
     } else {
         if (!subscriptions[connectionKey]) {
             response.status = ITMNotificationResponse_Status_NotSubscribed;
             return response;
         }
         [subscriptions removeObjectForKey:connectionKey];
+        if (subscriptions == _updateSubscriptions) {
+            [_screenUpdateDeltaSubscriptions removeObjectForKey:connectionKey];
+        }
     }
 
     response.status = ITMNotificationResponse_Status_Ok;
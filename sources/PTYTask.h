@@ -23,6 +23,14 @@
 // thread before kicking off a possibly async task in the main thread.
 - (void)threadedReadTask:(char *)buffer length:(int)length;
 
+// Zero-copy alternative to -threadedReadTask:length:, called on the same thread. Returns a buffer
+// with room for at least `minimumLength` bytes (the actual size goes in `*available`) that read()
+// may fill directly, or NULL to use -threadedReadTask:length: instead. After filling it, call
+// -threadedReadTaskDidFillBuffer:length:, even if nothing was read, since the buffer is reserved until
+// then.
+- (char *)threadedReadTaskBufferWithMinimumLength:(int)minimumLength available:(int *)available;
+- (void)threadedReadTaskDidFillBuffer:(char *)buffer length:(int)length;
+
 // Runs in the same background task as -threadedReadTask:length:.
 - (void)threadedTaskBrokenPipe;
 - (void)brokenPipe;  // Called in main thread
@@ -22,6 +22,7 @@
 #import "iTermOpenDirectory.h"
 #import "iTermOrphanServerAdopter.h"
 #import "iTermThreadSafety.h"
+#import "iTermThroughputEstimator.h"
 #import "iTermTmuxJobManager.h"
 #import "NSDictionary+iTerm.h"
 
@@ -32,6 +33,7 @@
 #include "legacy_server.h"
 #include <dlfcn.h>
 #include <libproc.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -44,6 +46,18 @@
 #include <unistd.h>
 #include <util.h>
 
+// processRead switches between two modes based on the session's recent output. In low-latency
+// mode it delivers whatever the first few reads return, which is what you want for echo. In
+// high-throughput mode it keeps reading until it has a large batch or a short interval has
+// passed, so each round trip through the parser covers much more than the tty driver's 1024 bytes.
+// There are separate thresholds for entering and leaving high-throughput mode so it doesn't
+// flap.
+static const NSInteger kHighThroughputReadsEnterBytesPerSecond = 256 * 1024;
+static const NSInteger kHighThroughputReadsExitBytesPerSecond = 64 * 1024;
+static const int kLowLatencyReadLimit = MAXRW * 4;
+static const int kHighThroughputReadLimit = 64 * 1024;
+static const suseconds_t kHighThroughputCoalescingMicroseconds = 500;
+
 @interface PTYTask(WinSizeControllerDelegate)<iTermWinSizeControllerDelegate>
 @end
 
@@ -72,6 +86,12 @@ static void HandleSigChld(int n) {
 
     dispatch_queue_t _jobManagerQueue;
     BOOL _isTmuxTask;
+
+    // These are only used by processRead, which never runs concurrently with itself.
+    iTermThroughputEstimator *_readThroughputEstimator;  // nil if reads aren't adaptive
+    BOOL _highThroughputReads;
+    // Holds reads when the delegate can't provide a buffer. kHighThroughputReadLimit bytes.
+    char *_readArena;
 }
 
 - (instancetype)init {
@@ -83,6 +103,10 @@ static void HandleSigChld(int n) {
         _winSizeController.delegate = self;
         writeBuffer = [[NSMutableData alloc] init];
         writeLock = [[NSLock alloc] init];
+        if ([iTermAdvancedSettingsModel adaptivePTYReads]) {
+            _readThroughputEstimator = [[iTermThroughputEstimator alloc] initWithHistoryOfDuration:5.0 / 30.0
+                                                                                   secondsPerBucket:1 / 30.0];
+        }
         if ([iTermAdvancedSettingsModel runJobsInServers]) {
             if ([iTermMultiServerJobManager available]) {
                 self.jobManager = [[iTermMultiServerJobManager alloc] initWithQueue:_jobManagerQueue];
@@ -114,6 +138,7 @@ static void HandleSigChld(int n) {
     @synchronized (self) {
         [[self coprocess] mainProcessDidTerminate];
     }
+    free(_readArena);
 }
 
 - (NSString *)description {
@@ -415,28 +440,56 @@ static void HandleSigChld(int n) {
 // with the next 1024 bytes. That becomes the stead state. Consequently, the semaphore that
 // defines the depth of our queue also determines (in the steady state) how much data can be
 // buffered and it's 1024 bytes * initial semaphore count.
+//
+// High-throughput mode gets around this by waiting briefly for the PTY to refill instead of
+// returning as soon as it's empty.
 - (void)processRead {
-    int iterations = 4;
-    int bytesRead = 0;
+    const BOOL highThroughput = [self shouldUseHighThroughputReads];
+    const int limit = highThroughput ? kHighThroughputReadLimit : kLowLatencyReadLimit;
+
+    // Read directly into the parser's stream if possible to avoid copying the data there later.
+    // It's contiguous even when it wraps around, so one read() fills it as well as readv() could.
+    int available = 0;
+    char *streamBuffer = [self.delegate threadedReadTaskBufferWithMinimumLength:limit
+                                                                      available:&available];
+    char *buffer = streamBuffer;
+    int capacity = MIN(available, limit);
+    if (!buffer) {
+        if (!_readArena) {
+            _readArena = iTermMalloc(kHighThroughputReadLimit);
+        }
+        buffer = _readArena;
+        capacity = limit;
+    }
 
-    char buffer[MAXRW * iterations];
-    for (int i = 0; i < iterations; ++i) {
-        // Only read up to MAXRW*iterations bytes, then release control
-        ssize_t n = read(self.fd, buffer + bytesRead, MAXRW);
+    int bytesRead = 0;
+    struct timeval deadline = { 0 };
+    while (bytesRead < capacity) {
+        ssize_t n = read(self.fd, buffer + bytesRead, capacity - bytesRead);
         if (n < 0) {
             // There was a read error.
             if (errno != EAGAIN && errno != EINTR) {
                 // It was a serious error.
+                if (streamBuffer) {
+                    // Hand back the parser's stream, which is reserved until it's filled.
+                    [self readTaskInPlace:streamBuffer length:bytesRead];
+                }
                 [self brokenPipe];
                 return;
-            } else {
-                // We could read again in the case of EINTR but it would
-                // complicate the code with little advantage. Just bail out.
-                n = 0;
             }
+            // We could read again in the case of EINTR but it would
+            // complicate the code with little advantage. Just bail out unless
+            // we're willing to wait for more.
+            if (!highThroughput || ![self waitForMoreOutputUntil:&deadline]) {
+                break;
+            }
+            continue;
+        }
+        if (n == 0) {
+            break;
         }
         bytesRead += n;
-        if (n < MAXRW) {
+        if (!highThroughput && n < MAXRW) {
             // If we read fewer bytes than expected, return. For some apparently
             // undocumented reason, read() never returns more than 1024 bytes
             // (at least on OS 10.6), so that's what MAXRW is set to. If that
@@ -444,11 +497,57 @@ static void HandleSigChld(int n) {
             break;
         }
     }
+    [_readThroughputEstimator addByteCount:bytesRead];
 
     hasOutput = YES;
 
     // Send data to the terminal
-    [self readTask:buffer length:bytesRead];
+    if (streamBuffer) {
+        [self readTaskInPlace:streamBuffer length:bytesRead];
+    } else {
+        [self readTask:buffer length:bytesRead];
+    }
+}
+
+- (BOOL)shouldUseHighThroughputReads {
+    if (!_readThroughputEstimator) {
+        return NO;
+    }
+    const NSInteger throughput = _readThroughputEstimator.estimatedThroughput;
+    const NSInteger threshold = (_highThroughputReads ?
+                                 kHighThroughputReadsExitBytesPerSecond :
+                                 kHighThroughputReadsEnterBytesPerSecond);
+    const BOOL highThroughput = throughput >= threshold;
+    if (highThroughput != _highThroughputReads) {
+        DLog(@"%@ switching to %@ reads at %@ bytes/sec",
+             self, highThroughput ? @"high-throughput" : @"low-latency", @(throughput));
+        _highThroughputReads = highThroughput;
+    }
+    return highThroughput;
+}
+
+// Waits for the fd to become readable. `deadline` is set on the first call and the wait never
+// extends past it. Returns NO if it was reached without more output arriving.
+- (BOOL)waitForMoreOutputUntil:(struct timeval *)deadline {
+    const int fd = self.fd;
+    if (fd < 0) {
+        return NO;
+    }
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    if (deadline->tv_sec == 0 && deadline->tv_usec == 0) {
+        const struct timeval interval = { 0, kHighThroughputCoalescingMicroseconds };
+        timeradd(&now, &interval, deadline);
+    }
+    if (!timercmp(&now, deadline, <)) {
+        return NO;
+    }
+    struct timeval timeout;
+    timersub(deadline, &now, &timeout);
+    // Round up so a wait of less than a millisecond doesn't become a busy poll.
+    const int timeoutMS = (int)(timeout.tv_sec * 1000 + (timeout.tv_usec + 999) / 1000);
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    return poll(&pfd, 1, timeoutMS) > 0;
 }
 
 - (void)processWrite {
@@ -882,6 +981,25 @@ static void HandleSigChld(int n) {
     }
 }
 
+// The bytes in buffer were just read from the fd into the delegate's parser stream.
+- (void)readTaskInPlace:(char *)buffer length:(int)length {
+    if (self.loggingHelper) {
+        [self.loggingHelper logData:[NSData dataWithBytes:buffer
+                                                   length:length]];
+    }
+
+    // Copy the data for the coprocess first because parsing may modify the buffer.
+    @synchronized (self) {
+        if (coprocess_ && !self.sshIntegrationActive) {
+            [self writeToCoprocess:[NSData dataWithBytes:buffer length:length]];
+        }
+    }
+
+    // The delegate is responsible for parsing VT100 tokens here and sending them off to the
+    // main thread for execution. If its queues get too large, it can block.
+    [self.delegate threadedReadTaskDidFillBuffer:buffer length:length];
+}
+
 // The bytes in data were just read from the fd.
 - (void)readTask:(char *)buffer length:(int)length {
     if (self.loggingHelper) {
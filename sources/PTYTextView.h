@@ -165,7 +165,9 @@ extern const CGFloat PTYTextViewMarginClickGraceWidth;
 - (void)textViewStopCoprocess;
 - (void)textViewPostTabContentsChangedNotification;
 - (void)textViewInvalidateRestorableState;
-- (void)textViewDidFindDirtyRects;
+// `dirtyRanges` holds a VT100GridRange for each line of the screen giving the cells that changed.
+// It is nil when the whole screen changed.
+- (void)textViewDidFindDirtyRects:(NSData *)dirtyRanges;
 - (void)textViewBeginDrag;
 - (void)textViewMovePane;
 - (void)textViewSwapPane;
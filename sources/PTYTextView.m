@@ -2380,6 +2380,7 @@ static NSString *iTermStringForEventPhase(NSEventPhase eventPhase) {
 
     // Remove results from dirty lines and mark parts of the view as needing display.
     NSMutableIndexSet *cleanLines = [NSMutableIndexSet indexSet];
+    NSMutableData *dirtyRanges = nil;
 
     // We must update the margin color, which in minimal can cause the window chrome color to change.
     // That can trigger a layout pass, which is not safe to do here because it runs in a
@@ -2403,11 +2404,14 @@ static NSString *iTermStringForEventPhase(NSEventPhase eventPhase) {
         [_findOnPageHelper removeSearchResultsInRange:range];
         [self requestDelegateRedraw];
     } else {
+        dirtyRanges = [NSMutableData dataWithLength:MAX(0, lineEnd - lineStart) * sizeof(VT100GridRange)];
+        VT100GridRange *dirtyRangesPerLine = dirtyRanges.mutableBytes;
         for (int y = lineStart; y < lineEnd; y++) {
             VT100GridRange range = [_dataSource dirtyRangeForLine:y - lineStart];
             if (y == cursorLines[0] || y == cursorLines[1]) {
                 range = VT100GridRangeMake(0, width);
             }
+            dirtyRangesPerLine[y - lineStart] = range;
             if (range.length > 0) {
                 DLog(@"Line %d is dirty", y);
                 foundDirty = YES;
@@ -2442,7 +2446,7 @@ static NSString *iTermStringForEventPhase(NSEventPhase eventPhase) {
         DLog(@"updateDirtyRects found dirty characters");
         [_dataSource saveToDvr:cleanLines];
         [_delegate textViewInvalidateRestorableState];
-        [_delegate textViewDidFindDirtyRects];
+        [_delegate textViewDidFindDirtyRects:dirtyRanges];
     }
 
     if (foundDirty && [_dataSource shouldSendContentsChangedNotification]) {
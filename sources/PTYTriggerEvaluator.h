@@ -16,6 +16,7 @@ NS_ASSUME_NONNULL_BEGIN
 @class PTYTriggerEvaluator;
 @class iTermStringLine;
 @class iTermSlownessDetector;
+@class iTermTokenExecutorUnpauser;
 
 extern NSString *const PTYSessionSlownessEventExecute;
 
@@ -34,6 +35,9 @@ extern NSString *const PTYSessionSlownessEventExecute;
 - (void)triggerEvaluatorOfferToDisableTriggersInInteractiveApps:(PTYTriggerEvaluator *)evaluator;
 - (void)triggerEvaluatorScheduleSideEffect:(PTYTriggerEvaluator *)evaluator
                                      block:(void (^)(void))block;
+// Stop executing tokens until the returned object is unpaused. Used to keep lines from piling up
+// faster than the trigger worker can match them.
+- (iTermTokenExecutorUnpauser *)triggerEvaluatorPauseTokenExecution:(PTYTriggerEvaluator *)evaluator;
 @end
 
 @interface PTYTriggerEvaluator : NSObject
@@ -9,11 +9,15 @@
 
 #import "DebugLogging.h"
 #import "NSArray+iTerm.h"
+#import "NSDate+iTerm.h"
+#import "NSObject+iTerm.h"
 #import "RegexKitLite.h"
 #import "iTerm2SharedARC-Swift.h"
 #import "iTermAdvancedSettingsModel.h"
 #import "iTermRateLimitedUpdate.h"
 #import "iTermTextExtractor.h"
+#import "iTermTriggerPrefilter.h"
+#import "iTermTriggerWorker.h"
 
 // Rate limit for checking instant (partial-line) triggers, in seconds.
 static NSTimeInterval kMinimumPartialLineTriggerCheckInterval = 0.5;
@@ -29,6 +33,20 @@ NSString *const PTYSessionSlownessEventExecute = @"execute";
 
 @implementation PTYTriggerEvaluator {
     iTermRateLimitedUpdate *_idempotentTriggerRateLimit;
+    // Built from _triggers' regexes so a line only needs to be given to the triggers that might
+    // match it. Nil if disabled.
+    iTermTriggerPrefilter *_prefilter;
+    // Matches lines against _triggers on a background queue. Nil if triggers are evaluated
+    // synchronously.
+    iTermTriggerWorker *_worker;
+    // Lines whose triggers are being evaluated by _worker and whose actions have not yet been
+    // performed. Reported in -stats.
+    NSInteger _numberOfPendingLines;
+    // Lines _worker has matched, in the order they were queued, waiting to have their actions
+    // performed.
+    NSMutableArray<void (^)(void)> *_matchedLines;
+    // Holds token execution while too many lines are pending, so the worker can catch up.
+    iTermTokenExecutorUnpauser *_backpressureUnpauser;
 }
 
 - (instancetype)initWithQueue:(dispatch_queue_t)queue {
@@ -38,10 +56,15 @@ NSString *const PTYSessionSlownessEventExecute = @"execute";
         _triggerLineNumber = -1;
         _expect = [[iTermExpect alloc] initDry:NO];
         _triggersSlownessDetector = [[iTermSlownessDetector alloc] init];
+        _matchedLines = [NSMutableArray array];
     }
     return self;
 }
 
+- (void)dealloc {
+    [_backpressureUnpauser unpause];
+}
+
 - (void)setExpect:(iTermExpect *)expect {
     const BOOL mayNeedReset = !_triggers.count && !_expect.maybeHasExpectations;
     _expect = expect;
@@ -84,7 +107,19 @@ NSString *const PTYSessionSlownessEventExecute = @"execute";
                            trigger.name, trigger.regex];
         [trigger.performanceHistogram addTo:formatter precision:2 units:@"µs" label:label];
     }
-    return [formatter formattedAsText];
+    for (Trigger *trigger in _triggers) {
+        if (trigger.latencyHistogram.count == 0) {
+            continue;
+        }
+        NSString *label = [NSString stringWithFormat:@"Latency of trigger “%@” with regex “%@”",
+                           trigger.name, trigger.regex];
+        [trigger.latencyHistogram addTo:formatter precision:2 units:@"ms" label:label];
+    }
+    if (!_worker) {
+        return [formatter formattedAsText];
+    }
+    return [[formatter formattedAsText] stringByAppendingFormat:@"\nLines awaiting trigger actions: %@\n",
+            @(_numberOfPendingLines)];
 }
 
 - (void)resetRateLimit {
@@ -145,12 +180,153 @@ NSString *const PTYSessionSlownessEventExecute = @"execute";
         return;
     }
 
+    if (_worker) {
+        [self enqueueStringLine:stringLine
+                    partialLine:partial
+                     lineNumber:startAbsLineNumber];
+        return;
+    }
     [self reallyCheckTriggersOnPartialLine:partial
                                 stringLine:stringLine
                                 lineNumber:startAbsLineNumber
                         requireIdempotency:NO];
 }
 
+// Expectations are still checked right away. Triggers are matched by the worker and their actions
+// are performed on this queue once it's done, in the order lines were queued. If lines come faster
+// than the worker can match them, token execution is paused rather than blocking this queue.
+- (void)enqueueStringLine:(iTermStringLine *)stringLine
+              partialLine:(BOOL)partial
+               lineNumber:(long long)startAbsLineNumber {
+    if (self.evaluating) {
+        DLog(@"Already evaluating");
+        return;
+    }
+    self.evaluating = YES;
+    @try {
+        [self checkExpectationsInStringLine:stringLine];
+    }
+    @finally {
+        self.evaluating = NO;
+    }
+
+    NSArray<Trigger *> *triggers = _triggers;
+    if (!triggers.count || !stringLine) {
+        return;
+    }
+    _numberOfPendingLines += 1;
+    if (_numberOfPendingLines >= _worker.capacity && !_backpressureUnpauser) {
+        DLog(@"%@ lines pending. Pause token execution until the trigger worker catches up.",
+             @(_numberOfPendingLines));
+        _backpressureUnpauser = [self.delegate triggerEvaluatorPauseTokenExecution:self];
+    }
+    const NSTimeInterval queuedTime = [NSDate it_timeSinceBoot];
+    dispatch_queue_t queue = _queue;
+    __weak __typeof(self) weakSelf = self;
+    [_worker addStringLine:stringLine
+                  triggers:triggers
+                 prefilter:_prefilter
+               partialLine:partial
+                completion:^(NSArray *results) {
+        dispatch_async(queue, ^{
+            [weakSelf didMatchLine:^{
+                [weakSelf performActionsForMatchResults:results
+                                               triggers:triggers
+                                             stringLine:stringLine
+                                            partialLine:partial
+                                             lineNumber:startAbsLineNumber
+                                             queuedTime:queuedTime];
+            }];
+        });
+    }];
+}
+
+// Lines arrive in the order they were queued since the worker's queue and this one are both
+// serial.
+- (void)didMatchLine:(void (^)(void))performActions {
+    [_matchedLines addObject:[performActions copy]];
+    [self performActionsForMatchedLines];
+}
+
+- (void)performActionsForMatchedLines {
+    if (self.evaluating) {
+        DLog(@"Already evaluating. Perform actions for %@ matched lines later.", @(_matchedLines.count));
+        __weak __typeof(self) weakSelf = self;
+        dispatch_async(_queue, ^{
+            [weakSelf performActionsForMatchedLines];
+        });
+        return;
+    }
+    while (_matchedLines.count > 0) {
+        void (^performActions)(void) = _matchedLines.firstObject;
+        [_matchedLines removeObjectAtIndex:0];
+        performActions();
+    }
+}
+
+- (void)releaseBackpressureIfPossible {
+    if (_backpressureUnpauser && (!_worker || _numberOfPendingLines < _worker.capacity)) {
+        DLog(@"Trigger worker caught up. Resume token execution.");
+        [_backpressureUnpauser unpause];
+        _backpressureUnpauser = nil;
+    }
+}
+
+- (void)performActionsForMatchResults:(NSArray *)results
+                             triggers:(NSArray<Trigger *> *)triggers
+                           stringLine:(iTermStringLine *)stringLine
+                          partialLine:(BOOL)partial
+                           lineNumber:(long long)startAbsLineNumber
+                           queuedTime:(NSTimeInterval)queuedTime {
+    _numberOfPendingLines -= 1;
+    [self releaseBackpressureIfPossible];
+    if (triggers != _triggers || self.sessionExited) {
+        DLog(@"Triggers changed or session exited since line %@ was queued", @(startAbsLineNumber));
+        return;
+    }
+    self.evaluating = YES;
+    @try {
+        [_triggersSlownessDetector measureEvent:PTYSessionSlownessEventTriggers block:^{
+            NSUInteger i = 0;
+            for (Trigger *trigger in triggers) {
+                iTermTriggerMatchResult *matchResult = [iTermTriggerMatchResult castFrom:results[i++]];
+                if (!matchResult) {
+                    [trigger skipStringOnPartialLine:partial];
+                    continue;
+                }
+                BOOL stop = [trigger tryString:stringLine
+                                     inSession:self.delegate
+                                   partialLine:partial
+                                    lineNumber:startAbsLineNumber
+                              useInterpolation:_triggerParametersUseInterpolatedStrings
+                                   matchResult:matchResult];
+                [trigger.latencyHistogram addValue:([NSDate it_timeSinceBoot] - queuedTime) * 1000];
+                if (stop || self.sessionExited || (_triggers != triggers)) {
+                    DLog(@"Stopping");
+                    break;
+                }
+            }
+        }];
+        [self maybeWarnAboutSlowTriggers];
+    }
+    @finally {
+        self.evaluating = NO;
+    }
+}
+
+- (void)checkExpectationsInStringLine:(iTermStringLine *)stringLine {
+    for (iTermExpectation *expectation in [_expect.expectations copy]) {
+        NSArray<NSString *> *capture = [stringLine.stringValue captureComponentsMatchedByRegex:expectation.regex];
+        if (capture.count) {
+            DLog(@"Expectation %@ matched %@", expectation, stringLine.stringValue);
+            [expectation didMatchWithCaptureGroups:capture
+                                        dispatcher:^(void (^closure)(void)) {
+                DLog(@"Run expectation closure");
+                [self.delegate triggerEvaluatorScheduleSideEffect:self block:closure];
+            }];
+        }
+    }
+}
 
 - (void)reallyCheckTriggersOnPartialLine:(BOOL)partial
                               stringLine:(iTermStringLine *)stringLine
@@ -163,27 +339,26 @@ NSString *const PTYSessionSlownessEventExecute = @"execute";
     }
     self.evaluating = YES;
     @try {
-        for (iTermExpectation *expectation in [_expect.expectations copy]) {
-            NSArray<NSString *> *capture = [stringLine.stringValue captureComponentsMatchedByRegex:expectation.regex];
-            if (capture.count) {
-                DLog(@"Expectation %@ matched %@", expectation, stringLine.stringValue);
-                [expectation didMatchWithCaptureGroups:capture
-                                            dispatcher:^(void (^closure)(void)) {
-                    DLog(@"Run expectation closure");
-                    [self.delegate triggerEvaluatorScheduleSideEffect:self block:closure];
-                }];
-            }
-        }
+        [self checkExpectationsInStringLine:stringLine];
 
         NSArray<Trigger *> *triggers = _triggers;
+        iTermTriggerPrefilter *prefilter = _prefilter;
 
         DLog(@"Start checking triggers");
         [_triggersSlownessDetector measureEvent:PTYSessionSlownessEventTriggers block:^{
+            NSIndexSet *candidates = [prefilter indexesOfPatternsThatMayMatchString:stringLine.stringValue];
+            NSUInteger i = 0;
             for (Trigger *trigger in triggers) {
+                const NSUInteger index = i++;
                 DLog(@"Consider %@", trigger);
                 if (requireIdempotency && !trigger.isIdempotent) {
                     continue;
                 }
+                if (candidates && ![candidates containsIndex:index]) {
+                    DLog(@"Prefilter rules out %@", trigger);
+                    [trigger skipStringOnPartialLine:partial];
+                    continue;
+                }
                 BOOL stop = [trigger tryString:stringLine
                                      inSession:self.delegate
                                    partialLine:partial
@@ -270,6 +445,21 @@ NSString *const PTYSessionSlownessEventExecute = @"execute";
     }] filteredArrayUsingBlock:^BOOL(Trigger *trigger) {
         return !trigger.isBrowserTrigger;
     }];
+    if ([iTermAdvancedSettingsModel prefilterTriggers] && _triggers.count > 0) {
+        _prefilter = [[iTermTriggerPrefilter alloc] initWithPatterns:[_triggers mapWithBlock:^id(Trigger *trigger) {
+            return trigger.regex ?: @"";
+        }]];
+    } else {
+        _prefilter = nil;
+    }
+    if ([iTermAdvancedSettingsModel evaluateTriggersAsynchronously] && _triggers.count > 0) {
+        if (!_worker) {
+            _worker = [[iTermTriggerWorker alloc] initWithCapacity:[iTermAdvancedSettingsModel triggerWorkerQueueDepth]];
+        }
+    } else {
+        _worker = nil;
+        [self releaseBackpressureIfPossible];
+    }
     if (mayNeedReset && _triggers.count > 0) {
         DLog(@"loadFromProfileArray: Reset triggerLineNumber");
         _triggerLineNumber = -1;
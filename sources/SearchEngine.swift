@@ -500,6 +500,22 @@ class SearchOperation: Pausable {
     // reduces the throughput of searching.
     private var pauseCount = 0
     private var lastLocationSearched: LineBufferPosition?
+    private let bytesScanned = iTermAtomicInt64Create()
+
+    // Size of the cells in the request's line range (or the whole line buffer, if it has none)
+    // when the search began. Wrapping around means every cell is searched once, so this is the
+    // total amount of work.
+    let bytesToSearch: Int64
+
+    // Size of all the cells in the line buffer when the search began, regardless of range.
+    let bytesInSnapshot: Int64
+
+    // Bytes of cells searched so far, including blocks the search index allowed us to skip.
+    // Whole blocks are counted, so this is capped at bytesToSearch for searches of a range.
+    // Safe to call on any thread.
+    var bytesSearched: Int64 {
+        return min(iTermAtomicInt64Get(bytesScanned), bytesToSearch)
+    }
 
     // When we've already collected too many results, this will be true. We
     // won't resume searching until the result queue is under the max size.
@@ -590,6 +606,24 @@ class SearchOperation: Pausable {
         self.queue = queue
         self.snapshot = snapshot
         self.request = request
+        let lineBuffer = snapshot.lineBuffer
+        let first = lineBuffer.firstPosition().absolutePosition
+        let last = lineBuffer.lastPosition().absolutePosition
+        let stride = Int64(MemoryLayout<screen_char_t>.stride)
+        bytesInSnapshot = max(0, last - first) * stride
+        if let absLineRange = request.absLineRange, !absLineRange.isEmpty {
+            // Positions of the first cell of a line. Lines past the end are clamped to the end.
+            func position(absLine: Int64) -> Int64 {
+                let y = Int32(clamping: max(0, absLine - snapshot.cumulativeOverflow))
+                let position = lineBuffer.position(forCoordinate: VT100GridCoord(x: 0, y: y),
+                                                   width: snapshot.width(),
+                                                   offset: 0)
+                return min(max(position?.absolutePosition ?? last, first), last)
+            }
+            bytesToSearch = max(0, position(absLine: absLineRange.upperBound) - position(absLine: absLineRange.lowerBound)) * stride
+        } else {
+            bytesToSearch = bytesInSnapshot
+        }
         snapshot.lineBuffer.prepareToSearch(for: request.query,
                                             startingAt: positions.start,
                                             options: request.findOptions,
@@ -598,6 +632,10 @@ class SearchOperation: Pausable {
         SELog("Begin search. positions=\(self.positions)")
     }
 
+    deinit {
+        iTermAtomicInt64Free(bytesScanned)
+    }
+
     // Returns (-1, -1) if the context's position doesn't exist.
     private func absCoord(context: FindContext,
                           lineBuffer: LineBuffer,
@@ -626,7 +664,12 @@ class SearchOperation: Pausable {
                                           overflow: snapshot.cumulativeOverflow)
         SELog("Searching block \(context.absBlockNum). Position of context is \(snapshot.lineBuffer.position(of: context, width: snapshot.width())), coordinate \(rangeSearchedStart). Will stop at \(positions.stop)")
 
+        // LineBuffer only sets this when it gets as far as a block, so clear it to tell whether one
+        // was searched.
+        context.lastAbsPositionsSearched = NSRange(location: NSNotFound, length: 0)
         snapshot.lineBuffer.findSubstring(context, stopAt: positions.stop)
+        iTermAtomicInt64Add(bytesScanned,
+                            Int64(context.lastAbsPositionsSearched.length) * Int64(MemoryLayout<screen_char_t>.stride))
 
         let rangeSearchedEnd = absCoord(context: context,
                                         lineBuffer: snapshot.lineBuffer,
@@ -964,6 +1007,13 @@ class SearchEngineUnpauser: NSObject, UnpauserProtocol {
 class SearchEngine: Pausable {
     fileprivate private(set) var operation: SearchOperation?
     private static let regularQueue = DispatchQueue(label: "com.iterm2.search")
+    // Searches that are meant to run alongside each other, like a global search over many
+    // sessions, are spread over this pool instead. Each queue is serial so an operation still only
+    // runs on its own queue.
+    private static let concurrentQueues = (0..<max(1, ProcessInfo.processInfo.activeProcessorCount - 1)).map { i in
+        DispatchQueue(label: "com.iterm2.search-concurrent-\(i)", qos: .userInitiated)
+    }
+    private static let nextConcurrentQueue = iTermAtomicInt64Create()
     private let queue: MockableQueue
     private(set) var snapshot: TerminalContentSnapshot?
 
@@ -975,6 +1025,11 @@ class SearchEngine: Pausable {
         self.queue = queue
     }
 
+    static func makeConcurrent() -> SearchEngine {
+        let i = Int(iTermAtomicInt64Add(nextConcurrentQueue, 1))
+        return SearchEngine(queue: concurrentQueues[i % concurrentQueues.count])
+    }
+
     var havePendingResults: Bool {
         return operation?.havePendingResults ?? false
     }
@@ -1108,6 +1163,9 @@ class iTermSearchEngine: NSObject, Pausable {
     // engine added to the sync distributor.
     @objc var automaticallySynchronize = true
     @objc var maxConsumeCount: Int = Int.max
+    // Set this before searching to run on a pool of queues shared with other concurrent engines
+    // rather than the one queue that ordinary searches share.
+    @objc var searchesConcurrently = false
 
     override var debugDescription: String {
         return "<iTermSearchEngine: \(it_addressString) delegate=\(addressString(delegate)) dataSource=\(addressString(dataSource)) query=\(String(describing: query)) mode=\(mode) options=\(options) operation=\(addressString(impl?.operation))"
@@ -1149,6 +1207,20 @@ class iTermSearchEngine: NSObject, Pausable {
     
     @objc private(set) var progress = Double(0)
     private var lastStart: LineBufferPosition?
+
+    // Bytes of cells searched so far. Unlike `progress`, this advances while blocks without
+    // results are searched.
+    @objc var bytesSearched: Int64 {
+        impl?.operation?.bytesSearched ?? 0
+    }
+
+    @objc var bytesToSearch: Int64 {
+        impl?.operation?.bytesToSearch ?? 0
+    }
+
+    @objc var bytesInSnapshot: Int64 {
+        impl?.operation?.bytesInSnapshot ?? 0
+    }
     
     @objc
     var query: String? {
@@ -1199,7 +1271,7 @@ class iTermSearchEngine: NSObject, Pausable {
                 snapshot: TerminalContentSnapshot) -> LineBufferPosition? {
         SELog("search request=\(request.debugDescription)")
         cancel()
-        impl = SearchEngine()
+        impl = searchesConcurrently ? SearchEngine.makeConcurrent() : SearchEngine()
         return impl?.beginSearch(snapshot: snapshot, request: request)
     }
 
@@ -1,4 +1,6 @@
-// This implements a select loop that runs in a special thread.
+// This implements a loop that waits on task file descriptors (with kqueue or select) in a special
+// thread. When the parser pool is enabled, reads (and the parsing they trigger) are handed off to
+// iTermParserPool.
 
 #import <Foundation/Foundation.h>
 
@@ -47,6 +49,12 @@ extern NSString *const kCoprocessStatusChangeNotification;
 
 - (void)notifyCoprocessChange;
 
+// Describes the parser pool's utilization since the last call, for debug logs.
+- (NSString *)parserPoolDescription;
+
+// "kqueue" or "select", for debug logs.
+- (NSString *)fileDescriptorMonitorName;
+
 - (void)lock;
 - (void)unlock;
 
@@ -9,9 +9,11 @@
 #import "TaskNotifier.h"
 #import "Coprocess.h"
 #import "DebugLogging.h"
+#import "iTermAdvancedSettingsModel.h"
+#import "iTermFileDescriptorMonitor.h"
+#import "iTermParserPool.h"
 
 #include <sys/time.h>
-#include <sys/select.h>
 
 #define PtyTaskDebugLog(args...)
 
@@ -30,6 +32,12 @@ static int unblockPipeW;
 
     // A set of NSNumber*s holding pids of tasks that need to be wait()ed on
     NSMutableSet* deadpool;
+
+    // If set, reads are performed on this pool instead of the select thread.
+    iTermParserPool *_parserPool;
+
+    // Waits for task and coprocess file descriptors to become ready. Only used on the run thread.
+    iTermFileDescriptorMonitor *_monitor;
 }
 
 
@@ -52,6 +60,9 @@ static int unblockPipeW;
         _tasks = [[NSMutableArray alloc] init];
         tasksLock = [[NSRecursiveLock alloc] init];
         tasksChanged = NO;
+        if ([iTermAdvancedSettingsModel parallelizeParsing]) {
+            _parserPool = [[iTermParserPool sharedInstance] retain];
+        }
 
         int unblockPipe[2];
         if (pipe(unblockPipe) != 0) {
@@ -67,6 +78,8 @@ static int unblockPipeW;
         }
         unblockPipeR = unblockPipe[0];
         unblockPipeW = unblockPipe[1];
+        _monitor = [[iTermFileDescriptorMonitor monitorWithWakeupFileDescriptor:unblockPipeR
+                                                                   preferKqueue:[iTermAdvancedSettingsModel useKqueueForTaskNotifier]] retain];
     }
     return self;
 }
@@ -75,6 +88,8 @@ static int unblockPipeW;
     [_tasks release];
     [tasksLock release];
     [deadpool release];
+    [_parserPool release];
+    [_monitor release];
     close(unblockPipeR);
     close(unblockPipeW);
     [super dealloc];
@@ -138,24 +153,43 @@ void UnblockTaskNotifier(void) {
     write(unblockPipeW, &dummy, 1);
 }
 
-- (BOOL)handleReadOnFileDescriptor:(int)fd task:(id<iTermTask>)task fdSet:(fd_set *)fdSet {
-    if (FD_ISSET(fd, fdSet)) {
-        PtyTaskDebugLog(@"run/processRead: unlock");
-        [tasksLock unlock];
-        [task processRead];
-        PtyTaskDebugLog(@"run/processRead: lock");
-        [tasksLock lock];
-        if (tasksChanged) {
-            PtyTaskDebugLog(@"Restart iteration\n");
-            tasksChanged = NO;
-            return YES;
-        }
+- (NSString *)parserPoolDescription {
+    return _parserPool.utilizationDescription ?: @"disabled";
+}
+
+- (NSString *)fileDescriptorMonitorName {
+    return _monitor.name;
+}
+
+- (BOOL)handleReadOnFileDescriptor:(int)fd task:(id<iTermTask>)task {
+    if (![_monitor isReadable:fd]) {
+        return NO;
+    }
+    if (_parserPool) {
+        // Wake up the loop when the read finishes so the fd can be monitored (or read) again.
+        iTermFileDescriptorMonitor *monitor = _monitor;
+        [_parserPool scheduleReadForTask:task completion:^{
+            [monitor didReadFromFileDescriptor:fd];
+            UnblockTaskNotifier();
+        }];
+        return NO;
+    }
+    PtyTaskDebugLog(@"run/processRead: unlock");
+    [tasksLock unlock];
+    [task processRead];
+    [_monitor didReadFromFileDescriptor:fd];
+    PtyTaskDebugLog(@"run/processRead: lock");
+    [tasksLock lock];
+    if (tasksChanged) {
+        PtyTaskDebugLog(@"Restart iteration\n");
+        tasksChanged = NO;
+        return YES;
     }
     return NO;
 }
 
-- (BOOL)handleWriteOnFileDescriptor:(int)fd task:(id<iTermTask>)task fdSet:(fd_set *)fdSet {
-    if (FD_ISSET(fd, fdSet)) {
+- (BOOL)handleWriteOnFileDescriptor:(int)fd task:(id<iTermTask>)task {
+    if ([_monitor isWritable:fd]) {
         PtyTaskDebugLog(@"run/processWrite: unlock");
         [tasksLock unlock];
         [task retain];
@@ -172,8 +206,10 @@ void UnblockTaskNotifier(void) {
     return NO;
 }
 
-- (BOOL)handleErrorOnFileDescriptor:(int)fd task:(id<iTermTask>)task fdSet:(fd_set *)fdSet {
-    if (FD_ISSET(fd, fdSet)) {
+- (BOOL)handleErrorOnFileDescriptor:(int)fd task:(id<iTermTask>)task {
+    // If a read is in flight it will either find the error itself or the fd will be monitored
+    // again once it finishes.
+    if ([_monitor hasError:fd] && ![_parserPool taskHasReadInFlight:task]) {
         PtyTaskDebugLog(@"run/brokenPipe: unlock");
         [tasksLock unlock];
         // brokenPipe will call deregisterTask and add the pid to
@@ -192,29 +228,27 @@ void UnblockTaskNotifier(void) {
 
 - (void)handleReadOnFileDescriptor:(int)fd
                               task:(id<iTermTask>)task
-                     withCoprocess:(Coprocess *)coprocess
-                             fdSet:(fd_set *)fdSet {
-    if (![coprocess eof] && FD_ISSET(fd, fdSet)) {
+                     withCoprocess:(Coprocess *)coprocess {
+    if (![coprocess eof] && [_monitor isReadable:fd]) {
         PtyTaskDebugLog(@"Reading from coprocess");
         [coprocess read];
+        [_monitor didReadFromFileDescriptor:fd];
         [task writeTask:coprocess.inputBuffer coprocess:YES];
         [coprocess.inputBuffer setLength:0];
     }
 }
 
 - (void)handleErrorOnFileDescriptor:(int)fd
-                      withCoprocess:(Coprocess *)coprocess
-                              fdSet:(fd_set *)fdSet {
-    if (FD_ISSET(fd, fdSet)) {
+                      withCoprocess:(Coprocess *)coprocess {
+    if ([_monitor hasError:fd]) {
         PtyTaskDebugLog(@"EOF on coprocess %@", coprocess);
         coprocess.eof = YES;
     }
 }
 
 - (void)handleWriteOnFileDescriptor:(int)coprocessWriteFd
-                      withCoprocess:(Coprocess *)coprocess
-                              fdSet:(fd_set *)fdSet {
-    if (FD_ISSET(coprocessWriteFd, fdSet)) {
+                      withCoprocess:(Coprocess *)coprocess {
+    if ([_monitor isWritable:coprocessWriteFd]) {
         if (![coprocess eof]) {
             PtyTaskDebugLog(@"Write to coprocess %@", coprocess);
             [coprocess write];
@@ -223,23 +257,13 @@ void UnblockTaskNotifier(void) {
 }
 
 - (void)run {
-    fd_set rfds;
-    fd_set wfds;
-    fd_set efds;
-    int highfd;
     NSEnumerator *iter;
     NSAutoreleasePool *autoreleasePool = [[NSAutoreleasePool alloc] init];
 
-    // FIXME: replace this with something better...
     for(;;) {
-
-        FD_ZERO(&rfds);
-        FD_ZERO(&wfds);
-        FD_ZERO(&efds);
-
-        // Unblock pipe to interrupt select() whenever a PTYTask register/unregisters
-        highfd = unblockPipeR;
-        FD_SET(unblockPipeR, &rfds);
+        // The monitor always watches the unblock pipe to interrupt the wait whenever a PTYTask
+        // registers/unregisters.
+        [_monitor beginUpdate];
         NSMutableSet *handledFds = [[NSMutableSet alloc] initWithCapacity:256];
 
         // Add all the PTYTask pipes
@@ -283,7 +307,7 @@ void UnblockTaskNotifier(void) {
             deadpool = [newDeadpool retain];
         }
 
-        // Figure out the file descriptors to select on.
+        // Figure out the file descriptors to monitor.
         PtyTaskDebugLog(@"Begin enumeration over %lu tasks\n", (unsigned long)[_tasks count]);
         for (id<iTermTask> task in _tasks) {
             PtyTaskDebugLog(@"Got task %@\n", task);
@@ -291,42 +315,33 @@ void UnblockTaskNotifier(void) {
             if (fd < 0) {
                 PtyTaskDebugLog(@"Task has fd of %d\n", fd);
             } else {
-                // PtyTaskDebugLog(@"Select on fd %d\n", fd);
-                if (fd > highfd) {
-                    highfd = fd;
-                }
-                if ([task wantsRead]) {
-                    FD_SET(fd, &rfds);
+                // Don't monitor a task being read on the parser pool unless reads are
+                // edge-triggered. It would stay readable until the read finishes, causing a busy
+                // loop. With edge triggering, data that arrives during the read is picked up by
+                // -didReadFromFileDescriptor: when it finishes.
+                const BOOL readInFlight = [_parserPool taskHasReadInFlight:task];
+                if ([task wantsRead] && (!readInFlight || _monitor.readsAreEdgeTriggered)) {
+                    [_monitor addReadInterest:fd owner:task];
                 }
                 if ([task wantsWrite]) {
-                    FD_SET(fd, &wfds);
+                    [_monitor addWriteInterest:fd owner:task];
+                }
+                if (!readInFlight) {
+                    [_monitor addErrorInterest:fd owner:task];
                 }
-                FD_SET(fd, &efds);
             }
 
             @synchronized (task) {
                 Coprocess *coprocess = [task coprocess];
                 if (coprocess) {
                     if ([coprocess wantToRead] && [task writeBufferHasRoom]) {
-                        int rfd = [coprocess readFileDescriptor];
-                        if (rfd > highfd) {
-                            highfd = rfd;
-                        }
-                        FD_SET(rfd, &rfds);
+                        [_monitor addReadInterest:[coprocess readFileDescriptor] owner:coprocess];
                     }
                     if ([coprocess wantToWrite]) {
-                        int wfd = [coprocess writeFileDescriptor];
-                        if (wfd > highfd) {
-                            highfd = wfd;
-                        }
-                        FD_SET(wfd, &wfds);
+                        [_monitor addWriteInterest:[coprocess writeFileDescriptor] owner:coprocess];
                     }
                     if (![coprocess eof]) {
-                        int rfd = [coprocess readFileDescriptor];
-                        if (rfd > highfd) {
-                            highfd = rfd;
-                        }
-                        FD_SET(rfd, &efds);
+                        [_monitor addErrorInterest:[coprocess readFileDescriptor] owner:coprocess];
                     }
                 }
             }
@@ -339,22 +354,8 @@ void UnblockTaskNotifier(void) {
         autoreleasePool = [[NSAutoreleasePool alloc] init];
 
         // Poll...
-        if (select(highfd+1, &rfds, &wfds, &efds, NULL) <= 0) {
-            switch(errno) {
-                case EAGAIN:
-                case EINTR:
-                default:
-                    goto breakloop;
-                    // If the file descriptor is closed in the main thread there's a race where sometimes you'll get an EBADF.
-            }
-        }
-
-        // Interrupted?
-        if (FD_ISSET(unblockPipeR, &rfds)) {
-            char dummy[32];
-            do {
-                read(unblockPipeR, dummy, sizeof(dummy));
-            } while (errno != EAGAIN);
+        if (![_monitor wait]) {
+            goto breakloop;
         }
 
         // Check for read events on PTYTask pipes
@@ -382,13 +383,13 @@ void UnblockTaskNotifier(void) {
                 [[task retain] autorelease];
                 [handledFds addObject:@(fd)];
 
-                if ([self handleReadOnFileDescriptor:fd task:task fdSet:&rfds]) {
+                if ([self handleReadOnFileDescriptor:fd task:task]) {
                     iter = [_tasks objectEnumerator];
                 }
-                if ([self handleWriteOnFileDescriptor:fd task:task fdSet:&wfds]) {
+                if ([self handleWriteOnFileDescriptor:fd task:task]) {
                     iter = [_tasks objectEnumerator];
                 }
-                if ([self handleErrorOnFileDescriptor:fd task:task fdSet:&efds]) {
+                if ([self handleErrorOnFileDescriptor:fd task:task]) {
                     iter = [_tasks objectEnumerator];
                 }
                 // Move input around between coprocess and main process.
@@ -403,8 +404,8 @@ void UnblockTaskNotifier(void) {
                             }
                             [handledFds addObject:@(fd)];
 
-                            [self handleReadOnFileDescriptor:fd task:task withCoprocess:coprocess fdSet:&rfds];
-                            [self handleErrorOnFileDescriptor:fd withCoprocess:coprocess fdSet:&efds];
+                            [self handleReadOnFileDescriptor:fd task:task withCoprocess:coprocess];
+                            [self handleErrorOnFileDescriptor:fd withCoprocess:coprocess];
 
                             // Handle writes
                             int coprocessWriteFd = [coprocess writeFileDescriptor];
@@ -413,7 +414,7 @@ void UnblockTaskNotifier(void) {
                                 continue;
                             }
                             [handledFds addObject:@(coprocessWriteFd)];
-                            [self handleWriteOnFileDescriptor:coprocessWriteFd withCoprocess:coprocess fdSet:&wfds];
+                            [self handleWriteOnFileDescriptor:coprocessWriteFd withCoprocess:coprocess];
 
                             if ([coprocess eof]) {
                                 [deadpool addObject:@([coprocess pid])];
@@ -10,6 +10,7 @@
 #import "iTerm2SharedARC-Swift.h"
 #import "iTermApplicationDelegate.h"
 #import "iTermAdvancedSettingsModel.h"
+#import "iTermTmuxOutputDecoder.h"
 #import "TmuxController.h"
 #import "NSArray+iTerm.h"
 #import "NSStringITerm.h"
@@ -142,166 +143,31 @@ static NSString *kCommandTimestamp = @"timestamp";
     [self.delegate tmuxDoubleAttachForSessionGUID:sessionGuid];
 }
 
-- (NSData *)decodeEscapedOutput:(const char *)bytes
-{
-    NSMutableData *data = [NSMutableData data];
-    unsigned char c;
-    for (int i = 0; bytes[i]; i++) {
-        c = bytes[i];
-        if (c < ' ') {
-            continue;
-        }
-        if (c == '\\') {
-            // Read exactly three bytes of octal values, or else set c to '?'.
-            c = 0;
-            for (int j = 0; j < 3; j++) {
-                i++;
-                if (bytes[i] == '\r') {
-                    // Ignore \r's that the line driver sprinkles in at its pleasure.
-                    continue;
-                }
-                if (bytes[i] < '0' || bytes[i] > '7') {
-                    c = '?';
-                    i--;  // Back up in case bytes[i] is a null; we don't want to go off the end.
-                    break;
-                }
-                c *= 8;
-                c += bytes[i] - '0';
-            }
-        }
-        [data appendBytes:&c length:1];
-    }
-    return data;
-}
-
+// %output %<pane id> <data...><newline>
 // %extended-output %<pane id> <latency> [more args?] : <data...><newline>
-- (void)parseExtendedOutputCommandData:(NSData *)input {
-    // Null terminate so we can do some string parsing without too much pain.
-    NSMutableData *data = [NSMutableData dataWithData:input];
-    [data appendBytes:"" length:1];
-
-    // This one is tricky to parse because the string version of the command could have bogus UTF-8.
-    // 3.1 and earlier:
-    //   %output %<pane id> <data...><newline>
-    // 3.2 and later, when pause mode is enabled:
-    //   %output %<pane id> <latency> <data...><newline>
-    const char *command = [data bytes];
-    char *space = strchr(command, ' ');
-    if (!space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    const char *outputCommand = "%extended-output";
-    if (strncmp(outputCommand, command, strlen(outputCommand))) {
-        [self parsingFailedForCommand:command];
+// These arrive for every line a pane prints, so the header is parsed and the payload decoded in
+// place from the line's bytes. This is tricky to do with strings since the line could have bogus
+// UTF-8.
+- (void)parseOutputCommandData:(NSData *)data extended:(BOOL)extended {
+    const unsigned char *bytes = data.bytes;
+    iTermTmuxOutputLine line;
+    if (!iTermTmuxParseOutputLine(bytes, data.length, extended, &line)) {
+        [self parsingFailedForCommand:data];
         return;
     }
+    NSData *decodedData = iTermTmuxDecodedOutput(bytes + line.payload.location, line.payload.length);
+    NSNumber *ms = extended ? @(line.latency / 1000.0) : nil;
 
-    // Pane ID
-    const char *paneId = space + 1;
-    if (*paneId != '%') {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    paneId++;
-    space = strchr(paneId, ' ');
-    if (!space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    char *endptr = NULL;
-    int windowPane = strtol(paneId, &endptr, 10);
-    if (windowPane < 0 || endptr != space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
+    TmuxLog(@"Run tmux command: \"%s \"%%%d\" %@ %.*s",
+            extended ? "%extended-output" : "%output",
+            line.windowPane, ms, (int)[decodedData length], (const char *)[decodedData bytes]);
 
-    // Latency
-    const char *latency = space + 1;
-    space = strchr(latency, ' ');
-    if (!space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    endptr = NULL;
-    NSNumber *ms = @(strtoll(latency, &endptr, 10));
-    ms = @(ms.doubleValue / 1000.0);
-    if (endptr != space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-
-    // Skip unknown params
-    const char *colon = strchr(space + 1, ':');
-    if (!colon) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    if (colon[1] != ' ') {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-
-    const char *encodedData = colon + 2;
-
-    // Payload
-    NSData *decodedData = [self decodeEscapedOutput:encodedData];
-
-    TmuxLog(@"Run tmux command: \"%%extended-output \"%%%d\" %@ %.*s",
-            windowPane, ms, (int)[decodedData length], (const char *)[decodedData bytes]);
-
-    [delegate_ tmuxReadTask:decodedData windowPane:windowPane latency:ms];
-}
-
-- (void)parsingFailedForCommand:(const char *)command {
-    [self abortWithErrorMessage:[NSString stringWithFormat:@"Malformed command (expected %%num data): \"%s\"", command]];
+    [delegate_ tmuxReadTask:decodedData windowPane:line.windowPane latency:ms];
 }
 
-// %output %<pane id> <data...><newline>
-- (void)parseOutputCommandData:(NSData *)input {
-    // Null terminate so we can do some string parsing without too much pain.
-    NSMutableData *data = [NSMutableData dataWithData:input];
-    [data appendBytes:"" length:1];
-
-    // This one is tricky to parse because the string version of the command could have bogus UTF-8.
-    const char *command = [data bytes];
-    char *space = strchr(command, ' ');
-    if (!space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    const char *outputCommand = "%output";
-    if (strncmp(outputCommand, command, strlen(outputCommand))) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-
-    // Pane ID
-    const char *paneId = space + 1;
-    if (*paneId != '%') {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    paneId++;
-    space = strchr(paneId, ' ');
-    if (!space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-    char *endptr = NULL;
-    int windowPane = strtol(paneId, &endptr, 10);
-    if (windowPane < 0 || endptr != space) {
-        [self parsingFailedForCommand:command];
-        return;
-    }
-
-    // Payload
-    NSData *decodedData = [self decodeEscapedOutput:space + 1];
-
-    TmuxLog(@"Run tmux command: \"%%output \"%%%d\" %.*s",
-            windowPane, (int)[decodedData length], (const char *)[decodedData bytes]);
-
-    [delegate_ tmuxReadTask:decodedData windowPane:windowPane latency:nil];
+- (void)parsingFailedForCommand:(NSData *)command {
+    [self abortWithErrorMessage:[NSString stringWithFormat:@"Malformed command (expected %%num data): \"%.*s\"",
+                                 (int)command.length, (const char *)command.bytes]];
 }
 
 - (NSNumber *)layoutIsZoomedInLayoutChange:(NSString *)args {
@@ -747,9 +613,9 @@ static NSString *kCommandTimestamp = @"timestamp";
         [currentCommandData_ appendData:data];
         [currentCommandData_ appendBytes:"\n" length:1];
     } else if ([command hasPrefix:@"%output "]) {
-        if (acceptNotifications_) [self parseOutputCommandData:data];
+        if (acceptNotifications_) [self parseOutputCommandData:data extended:NO];
     } else if ([command hasPrefix:@"%extended-output "]) {
-        if (acceptNotifications_) [self parseExtendedOutputCommandData:data];
+        if (acceptNotifications_) [self parseOutputCommandData:data extended:YES];
     } else if ([command hasPrefix:@"%layout-change "]) {
         if (acceptNotifications_) [self parseLayoutChangeCommand:command];
     } else if ([command hasPrefix:@"%window-add"]) {
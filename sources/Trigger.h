@@ -39,6 +39,16 @@ extern NSString * const kTriggerPartialLineKey;
 extern NSString * const kTriggerDisabledKey;
 extern NSString * const kTriggerNameKey;
 
+// The matches of a trigger's regex in one line, found ahead of time so the trigger's actions can be
+// performed later without running the regex again. Immutable.
+@interface iTermTriggerMatchResult : NSObject
+// Time spent finding the matches, in seconds.
+@property (nonatomic, readonly) NSTimeInterval duration;
+@property (nonatomic, readonly) NSUInteger count;
+
+- (instancetype)init NS_UNAVAILABLE;
+@end
+
 @protocol iTermTriggerDelegate<NSObject>
 - (void)triggerDidChangeParameterOptions:(Trigger *)trigger;
 @end
@@ -139,6 +149,9 @@ extern NSString * const kTriggerNameKey;
 @property (nullable, nonatomic, readonly) NSString *helpText;
 @property (nonatomic, readonly) NSSet<NSNumber *> *allowedMatchTypes;
 @property (nonatomic, strong) iTermHistogram *performanceHistogram;
+// Milliseconds from when a line was queued for asynchronous evaluation until this trigger's actions
+// for it were performed. Only updated on the mutation queue.
+@property (nonatomic, readonly) iTermHistogram *latencyHistogram;
 @property (nonatomic, readonly) BOOL isBrowserTrigger;
 
 + (nullable NSSet<NSString *> *)synonyms;
@@ -183,6 +196,21 @@ extern NSString * const kTriggerNameKey;
        lineNumber:(long long)lineNumber
  useInterpolation:(BOOL)useInterpolation;
 
+// Like -tryString:... but performs actions for matches already found by -matchResultForString:.
+- (BOOL)tryString:(iTermStringLine *)stringLine
+        inSession:(id<iTermTriggerSession>)aSession
+      partialLine:(BOOL)partialLine
+       lineNumber:(long long)lineNumber
+ useInterpolation:(BOOL)useInterpolation
+      matchResult:(iTermTriggerMatchResult * _Nullable)matchResult;
+
+// Runs the regex without performing any actions. Safe to call on any thread.
+- (iTermTriggerMatchResult *)matchResultForString:(iTermStringLine *)stringLine;
+
+// Call instead of -tryString:... when the line is known not to match the regex. Keeps the
+// bookkeeping for partial lines the same as if it had been tried.
+- (void)skipStringOnPartialLine:(BOOL)partialLine;
+
 // Subclasses must override this. Return YES if it can fire again on this line.
 - (BOOL)performActionWithCapturedStrings:(NSArray<NSString *> *)stringArray
                           capturedRanges:(const NSRange *)capturedRanges
@@ -28,9 +28,54 @@ NSString * const kTriggerDisabledKey = @"disabled";
 NSString * const kTriggerNameKey = @"name";
 NSString * const kTriggerPerformanceKey = @"performance";
 
+@interface iTermTriggerMatchResult()
+- (instancetype)initWithCaptures:(NSArray<NSArray<NSString *> *> *)captures
+                          ranges:(NSArray<NSData *> *)ranges
+                        duration:(NSTimeInterval)duration NS_DESIGNATED_INITIALIZER;
+- (void)enumerateMatchesUsingBlock:(void (^)(NSArray<NSString *> *capturedStrings,
+                                             const NSRange *capturedRanges,
+                                             BOOL *stop))block;
+@end
+
 @interface Trigger()
 @end
 
+@implementation iTermTriggerMatchResult {
+    NSArray<NSArray<NSString *> *> *_captures;
+    // Each element holds one NSRange per capture.
+    NSArray<NSData *> *_ranges;
+}
+
+- (instancetype)initWithCaptures:(NSArray<NSArray<NSString *> *> *)captures
+                          ranges:(NSArray<NSData *> *)ranges
+                        duration:(NSTimeInterval)duration {
+    self = [super init];
+    if (self) {
+        _captures = [captures copy];
+        _ranges = [ranges copy];
+        _duration = duration;
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _captures.count;
+}
+
+- (void)enumerateMatchesUsingBlock:(void (^)(NSArray<NSString *> *capturedStrings,
+                                             const NSRange *capturedRanges,
+                                             BOOL *stop))block {
+    for (NSUInteger i = 0; i < _captures.count; i++) {
+        BOOL stop = NO;
+        block(_captures[i], _ranges[i].bytes, &stop);
+        if (stop) {
+            return;
+        }
+    }
+}
+
+@end
+
 @implementation Trigger {
     // The last absolute line number on which this trigger fired for a partial
     // line. -1 means it has not fired on the current line.
@@ -89,6 +134,7 @@ NSString * const kTriggerPerformanceKey = @"performance";
     if (self) {
         _lastLineNumber = -1;
         _stats = [[iTermMovingHistogram alloc] initWithBucketSize:100 numberOfBuckets:10];
+        _latencyHistogram = [[iTermHistogram alloc] init];
     }
     return self;
 }
@@ -253,6 +299,20 @@ NSString * const kTriggerPerformanceKey = @"performance";
       partialLine:(BOOL)partialLine
        lineNumber:(long long)lineNumber
  useInterpolation:(BOOL)useInterpolation {
+    return [self tryString:stringLine
+                 inSession:aSession
+               partialLine:partialLine
+                lineNumber:lineNumber
+          useInterpolation:useInterpolation
+               matchResult:nil];
+}
+
+- (BOOL)tryString:(iTermStringLine *)stringLine
+        inSession:(id<iTermTriggerSession>)aSession
+      partialLine:(BOOL)partialLine
+       lineNumber:(long long)lineNumber
+ useInterpolation:(BOOL)useInterpolation
+      matchResult:(iTermTriggerMatchResult *)matchResult {
     if (self.disabled) {
         return NO;
     }
@@ -276,18 +336,42 @@ NSString * const kTriggerPerformanceKey = @"performance";
                              inSession:aSession
                            partialLine:partialLine
                             lineNumber:lineNumber
-                      useInterpolation:useInterpolation];
+                      useInterpolation:useInterpolation
+                           matchResult:matchResult];
     }];
-    [_stats addValue:duration * 1000000];
+    [_stats addValue:(duration + matchResult.duration) * 1000000];
     return result;
 }
 
-- (BOOL)reallyTryString:(iTermStringLine *)stringLine
-              inSession:(id<iTermTriggerSession>)aSession
-            partialLine:(BOOL)partialLine
-             lineNumber:(long long)lineNumber
-       useInterpolation:(BOOL)useInterpolation {
-    __block BOOL stopFutureTriggersFromRunningOnThisLine = NO;
+- (void)skipStringOnPartialLine:(BOOL)partialLine {
+    if (self.disabled) {
+        return;
+    }
+    if (!partialLine) {
+        _lastLineNumber = -1;
+    }
+}
+
+- (iTermTriggerMatchResult *)matchResultForString:(iTermStringLine *)stringLine {
+    NSMutableArray<NSArray<NSString *> *> *captures = [NSMutableArray array];
+    NSMutableArray<NSData *> *ranges = [NSMutableArray array];
+    const NSTimeInterval duration = [NSDate durationOfBlock:^{
+        [self enumerateMatchesInStringLine:stringLine block:^(NSArray<NSString *> *stringArray,
+                                                              const NSRange *capturedRanges,
+                                                              BOOL *stop) {
+            [captures addObject:stringArray];
+            [ranges addObject:[NSData dataWithBytes:capturedRanges
+                                             length:stringArray.count * sizeof(NSRange)]];
+        }];
+    }];
+    return [[iTermTriggerMatchResult alloc] initWithCaptures:captures ranges:ranges duration:duration];
+}
+
+// Safe to call on any thread.
+- (void)enumerateMatchesInStringLine:(iTermStringLine *)stringLine
+                               block:(void (^)(NSArray<NSString *> *capturedStrings,
+                                               const NSRange *capturedRanges,
+                                               BOOL *stop))block {
     NSString *s = stringLine.stringValue;
     DLog(@"Search for regex %@ in string %@", regex_, s);
     if (![iTermAdvancedSettingsModel fastTriggerRegexes]) {
@@ -297,37 +381,46 @@ NSString * const kTriggerPerformanceKey = @"performance";
                                             NSString *const __unsafe_unretained *capturedStrings,
                                             const NSRange *capturedRanges,
                                             volatile BOOL *const stopEnumerating) {
-            self->_lastLineNumber = lineNumber;
-            DLog(@"Trigger %@ matched string %@", self, s);
             NSArray<NSString *> *stringArray = [[NSArray alloc] initWithObjects:capturedStrings
                                                                           count:captureCount];
-            if (![self performActionWithCapturedStrings:stringArray
-                                         capturedRanges:capturedRanges
-                                              inSession:aSession
-                                               onString:stringLine
-                                   atAbsoluteLineNumber:lineNumber
-                                       useInterpolation:useInterpolation
-                                                   stop:&stopFutureTriggersFromRunningOnThisLine]) {
+            BOOL stop = NO;
+            block(stringArray, capturedRanges, &stop);
+            if (stop) {
                 *stopEnumerating = YES;
             }
         }];
     } else if (s != nil) {
         DLog(@"Use NSRegularExpression");
-        [self enumerateMatchesInString:s block:^(NSArray<NSString *> *stringArray,
-                                                 const NSRange *capturedRanges,
-                                                 BOOL *stopEnumerating) {
-            self->_lastLineNumber = lineNumber;
-            DLog(@"Trigger %@ matched string %@", self, s);
-            if (![self performActionWithCapturedStrings:stringArray
-                                         capturedRanges:capturedRanges
-                                              inSession:aSession
-                                               onString:stringLine
-                                   atAbsoluteLineNumber:lineNumber
-                                       useInterpolation:useInterpolation
-                                                   stop:&stopFutureTriggersFromRunningOnThisLine]) {
-                *stopEnumerating = YES;
-            }
-        }];
+        [self enumerateMatchesInString:s block:block];
+    }
+}
+
+- (BOOL)reallyTryString:(iTermStringLine *)stringLine
+              inSession:(id<iTermTriggerSession>)aSession
+            partialLine:(BOOL)partialLine
+             lineNumber:(long long)lineNumber
+       useInterpolation:(BOOL)useInterpolation
+            matchResult:(iTermTriggerMatchResult *)matchResult {
+    __block BOOL stopFutureTriggersFromRunningOnThisLine = NO;
+    void (^handler)(NSArray<NSString *> *, const NSRange *, BOOL *) = ^(NSArray<NSString *> *stringArray,
+                                                                        const NSRange *capturedRanges,
+                                                                        BOOL *stopEnumerating) {
+        self->_lastLineNumber = lineNumber;
+        DLog(@"Trigger %@ matched string %@", self, stringLine.stringValue);
+        if (![self performActionWithCapturedStrings:stringArray
+                                     capturedRanges:capturedRanges
+                                          inSession:aSession
+                                           onString:stringLine
+                               atAbsoluteLineNumber:lineNumber
+                                   useInterpolation:useInterpolation
+                                               stop:&stopFutureTriggersFromRunningOnThisLine]) {
+            *stopEnumerating = YES;
+        }
+    };
+    if (matchResult) {
+        [matchResult enumerateMatchesUsingBlock:handler];
+    } else {
+        [self enumerateMatchesInStringLine:stringLine block:handler];
     }
     if (!partialLine) {
         _lastLineNumber = -1;
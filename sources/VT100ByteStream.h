@@ -11,28 +11,64 @@
 
 #define kDefaultStreamSize 100000
 
+// After this many resets, the largest amount of data held during them becomes the steady state
+// and the stream may be shrunk to fit it.
+#define kByteStreamSteadyStateResetCount 256
+
 typedef struct {
     unsigned char *stream;
 
     // Used space in `stream`, including already-processed bytes at the head.
+    // When `mirrored` is set this may exceed `totalLength` (but never 2 * `totalLength`).
     int currentLength;
 
     // Allocated capacity of `stream`.
     int totalLength;
 
     // Number of bytes at the head of `stream` that have already been consumed.
+    // When `mirrored` is set this is always less than `totalLength`.
     int offset;
+
+    // If set, `stream` is followed by a second virtual mapping of the same pages, so it acts as a
+    // ring buffer in which any `totalLength` bytes starting before `totalLength` are contiguous.
+    // Data never needs to be moved to the front and the buffer does not need to be reallocated
+    // until more than `totalLength` bytes are pending.
+    BOOL mirrored;
+
+    // Memory statistics. These are the largest number of unconsumed bytes held at once, ever and
+    // in the last complete window of kByteStreamSteadyStateResetCount resets.
+    int peakRemaining;
+    int peakCapacity;
+    int steadyStateRemaining;
+    int windowRemaining;
+    int resetsInWindow;
+
+    // Bytes after `currentLength` handed out by VT100ByteStreamGetWritableSpace and not yet
+    // committed. While this is nonzero the caller may be writing there without a lock, so the
+    // stream must not move, reallocate, or append into that space.
+    int reserved;
+
+    // Bytes appended while space was reserved. They follow the reserved bytes once those are
+    // committed.
+    unsigned char *deferred;
+    int deferredLength;
 } VT100ByteStream;
 
+// Allocates `*capacity` bytes, rounding it up as needed. Returns a mirrored mapping if possible,
+// setting `*mirrored` accordingly. Free with VT100ByteStreamDeallocate.
+unsigned char *VT100ByteStreamAllocate(int *capacity, BOOL *mirrored);
+void VT100ByteStreamDeallocate(unsigned char *stream, int capacity, BOOL mirrored);
+
 NS_INLINE void VT100ByteStreamInit(VT100ByteStream *self) {
+    memset(self, 0, sizeof(*self));
     self->totalLength = kDefaultStreamSize;
-    self->stream = iTermMalloc(self->totalLength);
-    self->currentLength = 0;
-    self->offset = 0;
+    self->stream = VT100ByteStreamAllocate(&self->totalLength, &self->mirrored);
+    self->peakCapacity = self->totalLength;
 }
 
 NS_INLINE void VT100ByteStreamFree(VT100ByteStream *self) {
-    free(self->stream);
+    VT100ByteStreamDeallocate(self->stream, self->totalLength, self->mirrored);
+    free(self->deferred);
 }
 
 NS_INLINE int VT100ByteStreamGetCapacity(VT100ByteStream *self) {
@@ -52,52 +88,167 @@ NS_INLINE NSData *VT100ByteStreamMakeData(VT100ByteStream *self) {
                           length:VT100ByteStreamGetRemainingSize(self)];
 }
 
+// In a mirrored stream, once the head passes the end of the first mapping both indices move back
+// by a full lap. The bytes they refer to are the same.
+NS_INLINE void VT100ByteStreamWrapIfNeeded(VT100ByteStream *self) {
+    if (self->mirrored && self->offset >= self->totalLength) {
+        self->offset -= self->totalLength;
+        self->currentLength -= self->totalLength;
+    }
+}
+
 NS_INLINE void VT100ByteStreamConsumeAll(VT100ByteStream *self) {
     self->offset = self->currentLength;
     ITAssertWithMessage(self->offset >= 0, @"Negative offset");
+    VT100ByteStreamWrapIfNeeded(self);
 }
 
 NS_INLINE void VT100ByteStreamConsume(VT100ByteStream *self, int count) {
     self->offset += count;
     ITAssertWithMessage(self->offset >= 0, @"Negative offset after consuming %d", count);
     ITAssertWithMessage(self->offset <= self->currentLength, @"Offset too big");
+    VT100ByteStreamWrapIfNeeded(self);
+}
+
+NS_INLINE void VT100ByteStreamReplaceStorage(VT100ByteStream *self, int capacity) {
+    const int remaining = VT100ByteStreamGetRemainingSize(self);
+    int newCapacity = capacity;
+    BOOL mirrored = NO;
+    unsigned char *newStream = VT100ByteStreamAllocate(&newCapacity, &mirrored);
+    memcpy(newStream, self->stream + self->offset, remaining);
+    VT100ByteStreamDeallocate(self->stream, self->totalLength, self->mirrored);
+    self->stream = newStream;
+    self->totalLength = newCapacity;
+    self->mirrored = mirrored;
+    self->offset = 0;
+    self->currentLength = remaining;
+    self->peakCapacity = MAX(self->peakCapacity, newCapacity);
 }
 
 NS_INLINE void VT100ByteStreamReset(VT100ByteStream *self) {
+    if (self->reserved > 0) {
+        // Moving the write position back to the start would strand the reserved space.
+        return;
+    }
     self->offset = 0;
     self->currentLength = 0;
 
-    if (VT100ByteStreamGetCapacity(self) >= kDefaultStreamSize * 2) {
-        // We are done with this stream. Get rid of it and allocate a new one
-        // to avoid allowing this to grow too big.
-        free(self->stream);
-        self->totalLength = kDefaultStreamSize;
-        self->stream = iTermMalloc(self->totalLength);
+    self->resetsInWindow += 1;
+    if (self->resetsInWindow < kByteStreamSteadyStateResetCount) {
+        return;
+    }
+    self->steadyStateRemaining = self->windowRemaining;
+    self->windowRemaining = 0;
+    self->resetsInWindow = 0;
+
+    if (VT100ByteStreamGetCapacity(self) >= kDefaultStreamSize * 2 &&
+        self->steadyStateRemaining < kDefaultStreamSize / 2) {
+        // The burst that grew this stream is over. Give the memory back, but only after a whole
+        // window of quiet so that bursty output doesn't free and reallocate over and over.
+        VT100ByteStreamReplaceStorage(self, kDefaultStreamSize);
     }
 }
 
-NS_INLINE void VT100ByteStreamAppend(VT100ByteStream *self, const unsigned char *bytes, int length) {
-    if (self->currentLength + length > self->totalLength) {
-        // Grow the stream if needed. Don't grow too fast so the xterm parser can catch overflow.
-        int n = MIN(500, (length + self->currentLength) / kDefaultStreamSize);
-
-        // Make sure it grows enough to hold this.
-        NSInteger proposedSize = self->totalLength;
-        proposedSize += MAX(n * kDefaultStreamSize, length);
-        if (proposedSize >= INT_MAX) {
-            DLog(@"Stream too big!");
-            return;
-        }
+// Ensures at least `length` more bytes can be written after the pending data.
+NS_INLINE BOOL VT100ByteStreamReserve(VT100ByteStream *self, int length) {
+    const int used = self->mirrored ? VT100ByteStreamGetRemainingSize(self) : self->currentLength;
+    if (used + length <= self->totalLength) {
+        return YES;
+    }
+    // Grow the stream if needed. Don't grow too fast so the xterm parser can catch overflow.
+    int n = MIN(500, (length + used) / kDefaultStreamSize);
+
+    // Make sure it grows enough to hold this.
+    NSInteger proposedSize = self->totalLength;
+    proposedSize += MAX(n * kDefaultStreamSize, length);
+    // A mirrored stream maps its pages twice, so it can address only half as much.
+    if (proposedSize >= (self->mirrored ? INT_MAX / 2 : INT_MAX)) {
+        DLog(@"Stream too big!");
+        return NO;
+    }
+    if (self->mirrored) {
+        VT100ByteStreamReplaceStorage(self, (int)proposedSize);
+    } else {
         self->totalLength = proposedSize;
         self->stream = iTermRealloc(self->stream, self->totalLength, 1);
+        self->peakCapacity = MAX(self->peakCapacity, self->totalLength);
     }
+    return YES;
+}
 
-    memcpy(self->stream + self->currentLength, bytes, length);
+// Call after adding `length` bytes at the end of the stream.
+NS_INLINE void VT100ByteStreamCommit(VT100ByteStream *self, int length) {
     self->currentLength += length;
     assert(self->currentLength >= 0);
     if (self->currentLength == 0) {
         self->offset = 0;
     }
+    const int remaining = VT100ByteStreamGetRemainingSize(self);
+    self->peakRemaining = MAX(self->peakRemaining, remaining);
+    self->windowRemaining = MAX(self->windowRemaining, remaining);
+}
+
+NS_INLINE void VT100ByteStreamAppend(VT100ByteStream *self, const unsigned char *bytes, int length) {
+    if (self->reserved > 0) {
+        self->deferred = iTermRealloc(self->deferred, self->deferredLength + length, 1);
+        memcpy(self->deferred + self->deferredLength, bytes, length);
+        self->deferredLength += length;
+        return;
+    }
+    if (!VT100ByteStreamReserve(self, length)) {
+        return;
+    }
+    memcpy(self->stream + self->currentLength, bytes, length);
+    VT100ByteStreamCommit(self, length);
+}
+
+// Returns a pointer to free space at the end of the stream with room for at least `minimum`
+// bytes, or NULL if the stream can't grow that much. The amount of space is stored in
+// `*available`. Data can be written there directly (e.g., by read()), even without holding the
+// lock that guards the stream, and then made part of the stream with
+// VT100ByteStreamCommitReservation. That saves a copy compared to VT100ByteStreamAppend. Until
+// then the space stays reserved: the stream keeps it in place and defers appends.
+NS_INLINE unsigned char *VT100ByteStreamGetWritableSpace(VT100ByteStream *self,
+                                                         int minimum,
+                                                         int *available) {
+    ITAssertWithMessage(self->reserved == 0, @"Space is already reserved");
+    if (!VT100ByteStreamReserve(self, minimum)) {
+        *available = 0;
+        return NULL;
+    }
+    if (self->mirrored) {
+        *available = self->totalLength - VT100ByteStreamGetRemainingSize(self);
+    } else {
+        *available = self->totalLength - self->currentLength;
+    }
+    self->reserved = *available;
+    return self->stream + self->currentLength;
+}
+
+// Adds the first `length` bytes of the reserved space to the stream and releases the rest, then
+// appends whatever was deferred in the meantime.
+NS_INLINE void VT100ByteStreamCommitReservation(VT100ByteStream *self, int length) {
+    ITAssertWithMessage(length <= self->reserved, @"Committed %d bytes of %d reserved", length, self->reserved);
+    self->reserved = 0;
+    VT100ByteStreamCommit(self, length);
+    if (self->deferredLength > 0) {
+        unsigned char *deferred = self->deferred;
+        const int deferredLength = self->deferredLength;
+        self->deferred = NULL;
+        self->deferredLength = 0;
+        VT100ByteStreamAppend(self, deferred, deferredLength);
+        free(deferred);
+    }
+}
+
+NS_INLINE NSString *VT100ByteStreamMemoryDescription(const VT100ByteStream *self) {
+    return [NSString stringWithFormat:@"capacity=%d mirrored=%@ pending=%d peakPending=%d steadyStatePending=%d peakCapacity=%d",
+            self->totalLength,
+            self->mirrored ? @"yes" : @"no",
+            self->currentLength - self->offset,
+            self->peakRemaining,
+            self->steadyStateRemaining,
+            self->peakCapacity];
 }
 
 #pragma mark - Cursor
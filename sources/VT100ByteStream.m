@@ -0,0 +1,73 @@
+//
+//  VT100ByteStream.m
+//  iTerm2
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "VT100ByteStream.h"
+
+#include <mach/mach.h>
+#include <mach/mach_vm.h>
+
+// Reserves 2 * size bytes of address space and maps the first half's pages into the second half.
+static unsigned char *VT100ByteStreamAllocateMirroredPages(mach_vm_size_t size) {
+    // Another thread could map something into the hole between deallocating the second half and
+    // remapping it, so retry a few times.
+    for (int attempt = 0; attempt < 3; attempt++) {
+        mach_vm_address_t address = 0;
+        kern_return_t kr = mach_vm_allocate(mach_task_self(), &address, size * 2, VM_FLAGS_ANYWHERE);
+        if (kr != KERN_SUCCESS) {
+            DLog(@"mach_vm_allocate failed: %d", kr);
+            return NULL;
+        }
+        kr = mach_vm_deallocate(mach_task_self(), address + size, size);
+        if (kr != KERN_SUCCESS) {
+            DLog(@"mach_vm_deallocate failed: %d", kr);
+            mach_vm_deallocate(mach_task_self(), address, size * 2);
+            return NULL;
+        }
+        mach_vm_address_t mirror = address + size;
+        vm_prot_t currentProtection;
+        vm_prot_t maxProtection;
+        kr = mach_vm_remap(mach_task_self(),
+                           &mirror,
+                           size,
+                           0,
+                           VM_FLAGS_FIXED,
+                           mach_task_self(),
+                           address,
+                           FALSE,
+                           &currentProtection,
+                           &maxProtection,
+                           VM_INHERIT_DEFAULT);
+        if (kr == KERN_SUCCESS) {
+            return (unsigned char *)address;
+        }
+        DLog(@"mach_vm_remap failed: %d", kr);
+        mach_vm_deallocate(mach_task_self(), address, size);
+    }
+    return NULL;
+}
+
+unsigned char *VT100ByteStreamAllocate(int *capacity, BOOL *mirrored) {
+    const mach_vm_size_t size = mach_vm_round_page(*capacity);
+    if (size * 2 < INT_MAX) {
+        unsigned char *result = VT100ByteStreamAllocateMirroredPages(size);
+        if (result) {
+            *capacity = (int)size;
+            *mirrored = YES;
+            return result;
+        }
+    }
+    *mirrored = NO;
+    return iTermMalloc(*capacity);
+}
+
+void VT100ByteStreamDeallocate(unsigned char *stream, int capacity, BOOL mirrored) {
+    if (!mirrored) {
+        free(stream);
+        return;
+    }
+    mach_vm_deallocate(mach_task_self(), (mach_vm_address_t)stream, (mach_vm_size_t)capacity * 2);
+}
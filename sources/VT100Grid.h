@@ -52,6 +52,8 @@
 @property(nonatomic, readonly) NSArray<VT100LineInfo *> *metadataArray;
 @property(nonatomic, readonly) screen_char_t defaultChar;
 
+// The copy shares characters with this grid until one of them changes a line, so it is cheap to
+// keep a copy as a snapshot.
 - (id<VT100GridReading>)copy;
 
 - (const screen_char_t *)immutableScreenCharsAtLineNumber:(int)lineNumber;
@@ -272,6 +274,12 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft;
 // Scroll regions are ignored.
 - (int)scrollWholeScreenUpIntoLineBuffer:(LineBuffer *)lineBuffer
                      unlimitedScrollback:(BOOL)unlimitedScrollback;
+
+// Same as calling the above |count| times, but the lines are not moved. Returns the number of lines
+// dropped.
+- (int)scrollWholeScreenUpByLines:(int)count
+                   intoLineBuffer:(LineBuffer *)lineBuffer
+              unlimitedScrollback:(BOOL)unlimitedScrollback;
 - (void)fastPathScrollLinesAtAndAboveCursorIntoLineBuffer:(LineBuffer *)lineBuffer;
 
 // Scroll the scroll region down by one line.
@@ -296,7 +304,8 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft;
 // Same as above, but for runs.
 - (void)setCharsInRun:(VT100GridRun)run toChar:(unichar)c externalAttributes:(iTermExternalAttribute *)ea;
 
-// Copy everything from another grid if needed.
+// Copy everything from another grid if needed. Characters are shared with the other grid rather
+// than copied, so this is cheap even when every line changed.
 - (void)copyDirtyFromGrid:(VT100Grid *)otherGrid didScroll:(BOOL)didScroll;
 
 // Append a string starting from the cursor's current position.
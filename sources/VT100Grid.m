@@ -11,6 +11,7 @@
 #import "DebugLogging.h"
 #import "iTermEncoderAdapter.h"
 #import "iTermExternalAttributeIndex.h"
+#import "iTermMalloc.h"
 #import "iTermMetadata.h"
 #import "CVector.h"
 #import "LineBuffer.h"
@@ -21,6 +22,7 @@
 #import "VT100GridTypes.h"
 #import "VT100LineInfo.h"
 #import "VT100Terminal.h"
+#import <stdatomic.h>
 
 static NSString *const kGridCursorKey = @"Cursor";
 static NSString *const kGridScrollRegionRowsKey = @"Scroll Region Rows";
@@ -30,15 +32,48 @@ static NSString *const kGridSizeKey = @"Size";
 
 #define MEDIAN(min_, mid_, max_) MAX(MIN(mid_, max_), min_)
 
-@interface VT100Grid ()
-@property(nonatomic, readonly) NSArray *lines;  // Warning: not in order found on screen!
-@end
+// Rows are stored in reference-counted chunks of this many rows so that copies of a grid (such as
+// the one the main thread draws from) can share them. A chunk is copied before it is modified if
+// any other grid refers to it.
+static const int VT100GridRowsPerChunk = 16;
+
+typedef struct {
+    _Atomic int refcount;
+    screen_char_t cells[];
+} VT100GridChunk;
+
+static VT100GridChunk *VT100GridChunkCreate(int width) {
+    const size_t count = (size_t)VT100GridRowsPerChunk * (width + 1);
+    VT100GridChunk *chunk = iTermMalloc(sizeof(VT100GridChunk) + count * sizeof(screen_char_t));
+    atomic_init(&chunk->refcount, 1);
+    return chunk;
+}
+
+static VT100GridChunk *VT100GridChunkRetain(VT100GridChunk *chunk) {
+    atomic_fetch_add_explicit(&chunk->refcount, 1, memory_order_relaxed);
+    return chunk;
+}
+
+static void VT100GridChunkRelease(VT100GridChunk *chunk) {
+    if (chunk && atomic_fetch_sub_explicit(&chunk->refcount, 1, memory_order_acq_rel) == 1) {
+        free(chunk);
+    }
+}
+
+static int VT100GridChunkCount(int height) {
+    return (height + VT100GridRowsPerChunk - 1) / VT100GridRowsPerChunk;
+}
 
 @implementation VT100Grid {
     VT100GridSize size_;
-    int screenTop_;  // Index into lines_ and dirty_ of first line visible in the grid.
-    NSMutableArray<NSMutableData *> *lines_;  // Array of NSMutableData. Each data has size_.width+1 screen_char_t's.
-    NSMutableArray<VT100LineInfo *> *lineInfos_;  // Array of VT100LineInfo.
+    int screenTop_;  // Index of the row in _chunks, _dirtyRows, and lineInfos_ of first line visible in the grid.
+    // size_.height rows of size_.width+1 screen_char_t's each, used as a ring starting at screenTop_.
+    // Scrolling the whole screen moves screenTop_ instead of the characters. Row i is row
+    // i % VT100GridRowsPerChunk of chunk i / VT100GridRowsPerChunk.
+    VT100GridChunk **_chunks;
+    // One bit per row. A set bit means the whole row is dirty.
+    uint64_t *_dirtyRows;
+    NSMutableArray<VT100LineInfo *> *lineInfos_;  // Array of VT100LineInfo, indexed like rows.
     __weak id<VT100GridDelegate> delegate_;
     VT100GridCoord cursor_;
     VT100GridRange scrollRegionRows_;
@@ -60,11 +95,99 @@ static NSString *const kGridSizeKey = @"Size";
 @synthesize scrollRegionCols = scrollRegionCols_;
 @synthesize useScrollRegionCols = useScrollRegionCols_;
 @synthesize allDirty = allDirty_;
-@synthesize lines = lines_;
 @synthesize savedDefaultChar = savedDefaultChar_;
 @synthesize cursor = cursor_;
 @synthesize delegate = delegate_;
 
+NS_INLINE const screen_char_t *VT100GridImmutableRowAtIndex(VT100Grid *self, int index) {
+    return self->_chunks[index / VT100GridRowsPerChunk]->cells + (size_t)(index % VT100GridRowsPerChunk) * (self->size_.width + 1);
+}
+
+// Gives this grid its own copy of a chunk that another grid also refers to.
+static VT100GridChunk *VT100GridUnshareChunk(VT100Grid *self, int chunkIndex) {
+    VT100GridChunk *shared = self->_chunks[chunkIndex];
+    VT100GridChunk *chunk = VT100GridChunkCreate(self->size_.width);
+    memmove(chunk->cells,
+            shared->cells,
+            (size_t)VT100GridRowsPerChunk * (self->size_.width + 1) * sizeof(screen_char_t));
+    self->_chunks[chunkIndex] = chunk;
+    VT100GridChunkRelease(shared);
+    return chunk;
+}
+
+NS_INLINE screen_char_t *VT100GridRowAtIndex(VT100Grid *self, int index) {
+    const int chunkIndex = index / VT100GridRowsPerChunk;
+    VT100GridChunk *chunk = self->_chunks[chunkIndex];
+    if (atomic_load_explicit(&chunk->refcount, memory_order_acquire) > 1) {
+        chunk = VT100GridUnshareChunk(self, chunkIndex);
+    }
+    return chunk->cells + (size_t)(index % VT100GridRowsPerChunk) * (self->size_.width + 1);
+}
+
+// Clears the row including its continuation mark, which becomes a hard newline.
+NS_INLINE void VT100GridClearRow(VT100Grid *self, screen_char_t *row) {
+    memset(row, 0, (self->size_.width + 1) * sizeof(*row));
+    row[self->size_.width].code = EOL_HARD;
+}
+
+NS_INLINE int VT100GridDirtyWordCount(int height) {
+    return (height + 63) / 64;
+}
+
+NS_INLINE BOOL VT100GridRowIsDirty(VT100Grid *self, int index) {
+    return (self->_dirtyRows[index / 64] >> (index % 64)) & 1;
+}
+
+NS_INLINE void VT100GridSetRowDirty(VT100Grid *self, int index, BOOL dirty) {
+    const uint64_t mask = 1ULL << (index % 64);
+    if (dirty) {
+        self->_dirtyRows[index / 64] |= mask;
+    } else {
+        self->_dirtyRows[index / 64] &= ~mask;
+    }
+}
+
+static int VT100GridIndex(int screenTop, int lineNumber, int height) {
+    if (lineNumber >= 0 && lineNumber < height) {
+        return (screenTop + lineNumber) % height;
+    } else {
+        return -1;
+    }
+}
+
+NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
+    return VT100GridIndex(self->screenTop_, lineNumber, self->size_.height);
+}
+
+NS_INLINE screen_char_t *VT100GridScreenCharsAtLine(VT100Grid *self, int lineNumber) {
+#if DEBUG
+    assert(lineNumber >= 0);
+#endif
+    const int i = (self->screenTop_ + lineNumber) % self->size_.height;
+    return VT100GridRowAtIndex(self, i);
+}
+
+// Use this when you won't modify the line so a shared chunk isn't copied needlessly.
+NS_INLINE const screen_char_t *VT100GridImmutableScreenCharsAtLine(VT100Grid *self, int lineNumber) {
+#if DEBUG
+    assert(lineNumber >= 0);
+#endif
+    const int i = (self->screenTop_ + lineNumber) % self->size_.height;
+    return VT100GridImmutableRowAtIndex(self, i);
+}
+
+// Releases this grid's chunks and refers to another grid's instead. Both must have the same size.
+static void VT100GridShareChunks(VT100Grid *self, VT100Grid *other) {
+    const int count = VT100GridChunkCount(self->size_.height);
+    for (int i = 0; i < count; i++) {
+        if (self->_chunks[i] == other->_chunks[i]) {
+            continue;
+        }
+        VT100GridChunkRelease(self->_chunks[i]);
+        self->_chunks[i] = VT100GridChunkRetain(other->_chunks[i]);
+    }
+}
+
 - (instancetype)initWithSize:(VT100GridSize)size delegate:(id<VT100GridDelegate>)delegate {
     self = [super init];
     if (self) {
@@ -92,33 +215,36 @@ static NSString *const kGridSizeKey = @"Size";
         assert(size_.width > 0 && size_.height > 0);
         
         NSMutableDictionary<NSNumber *, iTermExternalAttributeIndex *> *migrationIndexes = nil;
+        NSArray<NSData *> *lines = nil;
         if (dictionary[@"lines v3"]) {
             // 3.5.0beta6+ path
-            lines_ = [[NSArray castFrom:dictionary[@"lines v3"]] mutableCopy];
+            lines = [NSArray castFrom:dictionary[@"lines v3"]];
         } else if (dictionary[@"lines v2"]) {
             // 3.5.0beta3+ path
-            lines_ = [[[NSArray castFrom:dictionary[@"lines v2"]] mapWithBlock:^id _Nonnull(NSData *data) {
+            lines = [[NSArray castFrom:dictionary[@"lines v2"]] mapWithBlock:^id _Nonnull(NSData *data) {
                 return [data migrateV2ToV3];
-            }] mutableCopy];
+            }];
         } else if (dictionary[@"lines"]) {
             // Migration code path for v1 -> v3 - upgrade legacy_screen_char_t.
             NSArray<NSData *> *legacyLines = [NSArray castFrom:dictionary[@"lines"]];
             if (!legacyLines) {
                 return nil;
             }
-            lines_ = [[NSMutableArray alloc] init];
+            NSMutableArray<NSData *> *migratedLines = [[NSMutableArray alloc] init];
             migrationIndexes = [NSMutableDictionary dictionary];
             [legacyLines enumerateObjectsUsingBlock:^(NSData * _Nonnull legacyData, NSUInteger idx, BOOL * _Nonnull stop) {
                 iTermExternalAttributeIndex *migrationIndex = nil;
-                [lines_ addObject:[[legacyData migrateV1ToV3:&migrationIndex] mutableCopy]];
+                [migratedLines addObject:[legacyData migrateV1ToV3:&migrationIndex]];
                 if (migrationIndex) {
                     migrationIndexes[@(idx)] = migrationIndex;
                 }
             }];
+            lines = migratedLines;
         }
-        if (!lines_) {
+        if (!lines) {
             return nil;
         }
+        [self setLinesFromData:lines];
 
         // Deprecated: migration code path. Modern dicts have `metadata` instead.
         [[NSArray castFrom:dictionary[@"timestamps"]] enumerateObjectsUsingBlock:^(NSNumber *timestamp,
@@ -142,6 +268,9 @@ static NSString *const kGridSizeKey = @"Size";
             [lineInfos_[idx] decodeMetadataArray:entry];
         }];
         [migrationIndexes enumerateKeysAndObjectsUsingBlock:^(NSNumber * _Nonnull idx, iTermExternalAttributeIndex * _Nonnull ea, BOOL * _Nonnull stop) {
+            if (idx.integerValue >= lineInfos_.count) {
+                return;
+            }
             [lineInfos_[idx.integerValue] setExternalAttributeIndex:ea];
         }];
         cursor_ = [NSDictionary castFrom:dictionary[@"cursor"]].gridCoord;
@@ -158,6 +287,22 @@ static NSString *const kGridSizeKey = @"Size";
     return self;
 }
 
+- (void)dealloc {
+    [self freeChunks];
+    free(_dirtyRows);
+}
+
+// Copies lines as saved by -encode: into the grid. Missing lines are left empty and extra lines are
+// ignored.
+- (void)setLinesFromData:(NSArray<NSData *> *)lines {
+    const size_t rowSize = (size_.width + 1) * sizeof(screen_char_t);
+    const int count = MIN(size_.height, (int)lines.count);
+    for (int i = 0; i < count; i++) {
+        NSData *data = [NSData castFrom:lines[i]];
+        memmove(VT100GridScreenCharsAtLine(self, i), data.bytes, MIN(rowSize, data.length));
+    }
+}
+
 - (BOOL)canTakeFastPath {
     if (self.haveScrollRegion) {
         return NO;
@@ -176,9 +321,11 @@ static NSString *const kGridSizeKey = @"Size";
     _knownDWCFreeLines = 0;
 }
 
-- (NSMutableData *)lineDataAtLineNumber:(int)lineNumber {
+// Returns a copy of the line, including its continuation mark.
+- (NSData *)lineDataAtLineNumber:(int)lineNumber {
     if (lineNumber >= 0 && lineNumber < size_.height) {
-        return [lines_ objectAtIndex:(screenTop_ + lineNumber) % size_.height];
+        return [NSData dataWithBytes:VT100GridImmutableScreenCharsAtLine(self, lineNumber)
+                              length:(size_.width + 1) * sizeof(screen_char_t)];
     } else {
         return nil;
     }
@@ -217,16 +364,8 @@ NS_INLINE iTermExternalAttributeIndex *VT100GridGetExternalAttributes(VT100Grid
     info.metadata = metadata;
 }
 
-NS_INLINE screen_char_t *VT100GridScreenCharsAtLine(VT100Grid *self, int lineNumber) {
-#if DEBUG
-    assert(lineNumber >= 0);
-#endif
-    const int i = (self->screenTop_ + lineNumber) % self->size_.height;
-    return self->lines_[i].mutableBytes;
-}
-
 - (const screen_char_t *)immutableScreenCharsAtLineNumber:(int)lineNumber {
-    return VT100GridScreenCharsAtLine(self, lineNumber);
+    return VT100GridImmutableScreenCharsAtLine(self, lineNumber);
 }
 
 - (screen_char_t *)screenCharsAtLineNumber:(int)lineNumber {
@@ -251,18 +390,6 @@ NS_INLINE screen_char_t *VT100GridScreenCharsAtLine(VT100Grid *self, int lineNum
     return sum;
 }
 
-static int VT100GridIndex(int screenTop, int lineNumber, int height) {
-    if (lineNumber >= 0 && lineNumber < height) {
-        return (screenTop + lineNumber) % height;
-    } else {
-        return -1;
-    }
-}
-
-NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
-    return VT100GridIndex(self->screenTop_, lineNumber, self->size_.height);
-}
-
 - (VT100LineInfo *)lineInfoAtLineNumber:(int)lineNumber {
     const int index = VT100GridIndex(screenTop_, lineNumber, size_.height);
     if (index < 0) {
@@ -285,10 +412,13 @@ NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
     if (!dirty) {
         allDirty_ = NO;
     }
-    VT100LineInfo *lineInfo = [self lineInfoAtLineNumber:coord.y];
-    [lineInfo setDirty:dirty
-               inRange:VT100GridRangeMake(coord.x, 1)
-     updateTimestampTo:updateTimestamp ? self.currentDate : 0];
+    const int index = VT100GridLineInfoIndex(self, coord.y);
+    if (index >= 0) {
+        VT100GridSetRowDirty(self, index, dirty);
+        if (dirty && updateTimestamp) {
+            [lineInfos_[index] updateTimestamp:self.currentDate];
+        }
+    }
     _hasChanged = YES;
 }
 
@@ -298,16 +428,16 @@ NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
     if (!dirty) {
         allDirty_ = NO;
     }
-    const VT100GridRange xrange = VT100GridRangeMake(from.x, to.x - from.x + 1);
-    const NSTimeInterval timestamp = self.currentDate;
+    const NSTimeInterval timestamp = dirty ? self.currentDate : 0;
     for (int y = from.y; y <= to.y; y++) {
         const int index = VT100GridIndex(screenTop_, y, size_.height);
         if (index < 0) {
             continue;
         }
-        [lineInfos_[index] setDirty:dirty
-                            inRange:xrange
-                  updateTimestampTo:dirty ? timestamp : 0];
+        VT100GridSetRowDirty(self, index, dirty);
+        if (dirty) {
+            [lineInfos_[index] updateTimestamp:timestamp];
+        }
     }
     _hasChanged = YES;
 }
@@ -317,7 +447,6 @@ NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
 
     if (dirty) {
         // Fast path
-        const VT100GridRange horizontalRange = VT100GridRangeMake(0, size_.width);
         const NSTimeInterval timestamp = self.currentDate;
         if (allDirty_ && (!updateTimestamps || _allDirtyTimestamp == timestamp)) {
             // Nothing changed.
@@ -327,9 +456,12 @@ NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
         if (updateTimestamps) {
             _allDirtyTimestamp = timestamp;
         }
-        [lineInfos_ enumerateObjectsUsingBlock:^(VT100LineInfo * _Nonnull lineInfo, NSUInteger idx, BOOL * _Nonnull stop) {
-            [lineInfo setDirty:YES inRange:horizontalRange updateTimestampTo:updateTimestamps ? timestamp : 0];
-        }];
+        memset(_dirtyRows, 0xff, VT100GridDirtyWordCount(size_.height) * sizeof(*_dirtyRows));
+        if (updateTimestamps) {
+            for (VT100LineInfo *lineInfo in lineInfos_) {
+                [lineInfo updateTimestamp:timestamp];
+            }
+        }
         return;
     }
     _hasChanged = YES;
@@ -355,25 +487,34 @@ NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
     if (allDirty_) {
         return YES;
     }
-    VT100LineInfo *lineInfo = [self lineInfoAtLineNumber:coord.y];
-    return [lineInfo isDirtyAtOffset:coord.x];
+    const int index = VT100GridLineInfoIndex(self, coord.y);
+    return index >= 0 && VT100GridRowIsDirty(self, index);
 }
 
 - (NSIndexSet *)dirtyIndexesOnLine:(int)line {
     if (allDirty_) {
         return [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, self.size.width)];
     }
-    VT100LineInfo *lineInfo = [self lineInfoAtLineNumber:line];
-    return [lineInfo dirtyIndexes];
+    const int index = VT100GridLineInfoIndex(self, line);
+    if (index < 0 || !VT100GridRowIsDirty(self, index)) {
+        return [NSIndexSet indexSet];
+    }
+    return [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, self.size.width)];
 }
 
 - (BOOL)isAnyCharDirty {
     if (allDirty_) {
         return YES;
     }
-    for (int y = 0; y < size_.height; y++) {
-        VT100LineInfo *lineInfo = [self lineInfoAtLineNumber:y];
-        if ([lineInfo anyCharIsDirty]) {
+    // Bits past the last row may be set, so mask them off in the last word.
+    const int height = size_.height;
+    const int count = VT100GridDirtyWordCount(height);
+    for (int i = 0; i < count; i++) {
+        uint64_t word = _dirtyRows[i];
+        if (i == count - 1 && height % 64) {
+            word &= (1ULL << (height % 64)) - 1;
+        }
+        if (word) {
             return YES;
         }
     }
@@ -384,8 +525,11 @@ NS_INLINE int VT100GridLineInfoIndex(VT100Grid *self, int lineNumber) {
     if (allDirty_) {
         return VT100GridRangeMake(0, self.size.width);
     }
-    VT100LineInfo *lineInfo = [self lineInfoAtLineNumber:y];
-    return [lineInfo dirtyRange];
+    const int index = VT100GridLineInfoIndex(self, y);
+    if (index < 0 || !VT100GridRowIsDirty(self, index)) {
+        return VT100GridRangeMake(-1, -1);
+    }
+    return VT100GridRangeMake(0, self.size.width);
 }
 
 - (int)cursorX {
@@ -619,7 +763,7 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
     const int width = self.size.width;
     CTVectorCreate(&items, y);
     for (int i = 0; i < y; i++) {
-        const screen_char_t *line = VT100GridScreenCharsAtLine(self, i);
+        const screen_char_t *line = VT100GridImmutableScreenCharsAtLine(self, i);
         const screen_char_t continuation = line[width];
         iTermAppendItem item = {
             .buffer = line,
@@ -636,7 +780,7 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
     const int x = self.cursor.x;
     if (x > 0) {
         // Append partial line with cursor
-        screen_char_t *line = VT100GridScreenCharsAtLine(self, y);
+        const screen_char_t *line = VT100GridImmutableScreenCharsAtLine(self, y);
         const screen_char_t continuation = line[width];
         iTermAppendItem item = {
             .buffer = line,
@@ -691,14 +835,8 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
     screenTop_ = (screenTop_ + 1) % size_.height;
     _haveScrolled = YES;
     // Empty contents of last line on screen.
-    NSMutableData *lastLineData = [self lineDataAtLineNumber:(size_.height - 1)];
-    if (lastLineData) {  // This if statement is just to quiet the analyzer.
-        [self clearLineDataBytes:lastLineData.mutableBytes count:lastLineData.length / sizeof(screen_char_t)];
-        const int i = VT100GridLineInfoIndex(self, size_.height - 1);
-        if (i >= 0) {
-            [lineInfos_[i] resetMetadata];
-        }
-    }
+    VT100GridClearRow(self, VT100GridScreenCharsAtLine(self, size_.height - 1));
+    [lineInfos_[VT100GridLineInfoIndex(self, size_.height - 1)] resetMetadata];
 
     // Mark new line at bottom of screen dirty and update its timestamp.
     [self markCharsDirty:YES
@@ -713,6 +851,47 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
     return numLinesDropped;
 }
 
+- (int)scrollWholeScreenUpByLines:(int)count
+                   intoLineBuffer:(LineBuffer *)lineBuffer
+              unlimitedScrollback:(BOOL)unlimitedScrollback {
+    const int height = size_.height;
+    count = MIN(count, height);
+    if (count <= 0) {
+        return 0;
+    }
+    if (_knownDWCFreeLines < height) {
+        [self resetDWCFreeCount];
+    }
+    if (cursor_.x < size_.width) {
+        [self markCharDirty:YES at:cursor_ updateTimestamp:YES];
+    }
+
+    int numLinesDropped = 0;
+    for (int i = 0; i < count; i++) {
+        numLinesDropped += [self appendLineNumber:i
+                                     toLineBuffer:lineBuffer
+                              unlimitedScrollback:unlimitedScrollback];
+    }
+
+    // Move the head of the ring instead of the lines.
+    screenTop_ = (screenTop_ + count) % height;
+    _haveScrolled = YES;
+    for (int i = height - count; i < height; i++) {
+        VT100GridClearRow(self, VT100GridScreenCharsAtLine(self, i));
+        [lineInfos_[VT100GridLineInfoIndex(self, i)] resetMetadata];
+    }
+
+    [self markCharsDirty:YES
+              inRectFrom:VT100GridCoordMake(0, height - count)
+                      to:VT100GridCoordMake(size_.width - 1, height - 1)];
+    if (!lineBuffer) {
+        [self markAllCharsDirty:YES updateTimestamps:NO];
+    }
+
+    DLog(@"scrolled screen up by %d lines", count);
+    return numLinesDropped;
+}
+
 - (int)scrollUpIntoLineBuffer:(LineBuffer *)lineBuffer
           unlimitedScrollback:(BOOL)unlimitedScrollback
       useScrollbackWithRegion:(BOOL)useScrollbackWithRegion
@@ -782,14 +961,11 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
     } else {
         numLinesToScroll = [self lineNumberOfLastNonEmptyLine] + 1;
     }
-    int numLinesDropped = 0;
-    for (int i = 0; i < numLinesToScroll; i++) {
-        numLinesDropped += [self scrollUpIntoLineBuffer:lineBuffer
-                                    unlimitedScrollback:unlimitedScrollback
-                                useScrollbackWithRegion:NO
-                                              softBreak:NO
-                                       sentToLineBuffer:nil];
-    }
+    // There is no scroll region now so this is the same as scrolling the whole screen up one line
+    // at a time.
+    const int numLinesDropped = [self scrollWholeScreenUpByLines:numLinesToScroll
+                                                  intoLineBuffer:lineBuffer
+                                             unlimitedScrollback:unlimitedScrollback];
     self.cursor = VT100GridCoordMake(0, 0);
 
     const VT100GridCoord topLeft = VT100GridCoordMake(0, preserveCursorLine ? 1 + additionalLinesToSave : 0);
@@ -807,9 +983,7 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
         return;  // Not sure how this would happen, but the old code in -[VT100Screen clearScreen] had this check.
     }
     int sourceLineNumber = [self cursorLineNumberIncludingPrecedingWrappedLines];
-    for (int i = 0; i < sourceLineNumber; i++) {
-        [self scrollWholeScreenUpIntoLineBuffer:nil unlimitedScrollback:NO];
-    }
+    [self scrollWholeScreenUpByLines:sourceLineNumber intoLineBuffer:nil unlimitedScrollback:NO];
     self.cursorY = cursor_.y - sourceLineNumber;
 }
 
@@ -955,7 +1129,7 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
     int left = MAX(0, range.start.x);
     for (int y = MAX(0, range.start.y); y <= MIN(range.end.y, size_.height - 1); y++) {
         const int right = MAX(left, y == range.end.y ? range.end.x : size_.width);
-        screen_char_t *line = [self lineDataAtLineNumber:y].mutableBytes;
+        screen_char_t *line = VT100GridScreenCharsAtLine(self, y);
         iTermExternalAttributeIndex *eaIndex = [self externalAttributesOnLine:y createIfNeeded:NO];
         [self markCharsDirty:YES inRun:VT100GridRunMake(left, y, right - left)];
         for (int x = left; x < right; x++) {
@@ -1204,23 +1378,42 @@ makeCursorLineSoft:(BOOL)makeCursorLineSoft {
     [self resetDWCFreeCount];
     const BOOL sizeChanged = !VT100GridSizeEquals(self.size, otherGrid.size);
     [self setSize:otherGrid.size];
-    for (int i = 0; i < size_.height; i++) {
-        const VT100GridRange dirtyRange = [otherGrid dirtyRangeForLine:i];
-        if (!didScroll && !sizeChanged && dirtyRange.length <= 0) {
+    const int height = size_.height;
+    const int words = VT100GridDirtyWordCount(height);
+    const BOOL moved = screenTop_ != otherGrid->screenTop_;
+    if (moved) {
+        // Adopt the other grid's ring layout. Lines that were already dirty here stay dirty.
+        uint64_t *oldDirtyRows = _dirtyRows;
+        const int oldScreenTop = screenTop_;
+        _dirtyRows = iTermCalloc(words, sizeof(*_dirtyRows));
+        screenTop_ = otherGrid->screenTop_;
+        for (int i = 0; i < height; i++) {
+            const int oldIndex = (oldScreenTop + i) % height;
+            if ((oldDirtyRows[oldIndex / 64] >> (oldIndex % 64)) & 1) {
+                VT100GridSetRowDirty(self, VT100GridLineInfoIndex(self, i), YES);
+            }
+        }
+        free(oldDirtyRows);
+    }
+    const BOOL copyAllLines = didScroll || sizeChanged || moved || otherGrid->allDirty_;
+    for (int i = 0; i < height; i++) {
+        if (!copyAllLines && !VT100GridRowIsDirty(otherGrid, i)) {
             continue;
         }
-        screen_char_t *dest = [self screenCharsAtLineNumber:i];
-        const screen_char_t *source = [otherGrid immutableScreenCharsAtLineNumber:i];
-        memmove(dest,
-                source,
-                sizeof(screen_char_t) * (size_.width + 1));
-        iTermMetadata metadata = iTermMetadataCopy([otherGrid metadataAtLineNumber:i]);
-        [self setMetadata:metadata forLineNumber:i];
+        iTermMetadata metadata = iTermMetadataCopy(otherGrid->lineInfos_[i].metadata);
+        lineInfos_[i].metadata = metadata;
         iTermMetadataRelease(metadata);
-        if (dirtyRange.length > 0) {
-            [[self lineInfoAtLineNumber:i] setDirty:YES inRange:dirtyRange updateTimestampTo:0];
+    }
+    if (otherGrid->allDirty_) {
+        memset(_dirtyRows, 0xff, words * sizeof(*_dirtyRows));
+    } else {
+        for (int i = 0; i < words; i++) {
+            _dirtyRows[i] |= otherGrid->_dirtyRows[i];
         }
     }
+    // Characters are never copied here. Both grids refer to the same chunks until one of them
+    // changes a chunk, at which point it gets its own copy.
+    VT100GridShareChunks(self, otherGrid);
     _hasChanged = YES;
     [otherGrid copyMiscellaneousStateTo:self];
     [otherGrid resetBidiDirty];
@@ -1762,8 +1955,10 @@ externalAttributeIndex:(iTermExternalAttributeIndex *)ea {
                                  sourceIndex >= 0 &&
                                  destIndex >= 0);
              iteration++) {
-            const screen_char_t *sourceLine = [self immutableScreenCharsAtLineNumber:sourceIndex];
+            // Get the target first: it may unshare a chunk that the source line is also in, which
+            // would leave a source pointer taken earlier pointing into the copy we let go of.
             screen_char_t *targetLine = [self screenCharsAtLineNumber:destIndex];
+            const screen_char_t *sourceLine = [self immutableScreenCharsAtLineNumber:sourceIndex];
 
             const int length = rect.size.width + continuation;
             memmove(targetLine + rect.origin.x,
@@ -2494,8 +2689,7 @@ externalAttributeIndex:(iTermExternalAttributeIndex *)ea {
                     block:(void (^NS_NOESCAPE)(VT100GridCoord, screen_char_t *, iTermExternalAttribute **, BOOL *))block {
     [self resetDWCFreeCount];
     for (int y = MAX(0, rect.origin.y); y < MIN(size_.height, rect.origin.y + rect.size.height); y++) {
-        NSMutableData *data = [self lineDataAtLineNumber:y];
-        screen_char_t *line = (screen_char_t *)data.mutableBytes;
+        screen_char_t *line = VT100GridScreenCharsAtLine(self, y);
         iTermExternalAttributeIndex *eaIndex = [self externalAttributesOnLine:y
                                                                createIfNeeded:NO];
         const int left = MAX(0, rect.origin.x);
@@ -2522,8 +2716,7 @@ externalAttributeIndex:(iTermExternalAttributeIndex *)ea {
 
 - (void)enumerateCellsInRect:(VT100GridRect)rect block:(void (^)(VT100GridCoord, screen_char_t, iTermExternalAttribute *, BOOL *))block {
     for (int y = MAX(0, rect.origin.y); y < MIN(size_.height, rect.origin.y + rect.size.height); y++) {
-        NSMutableData *data = [self lineDataAtLineNumber:y];
-        screen_char_t *line = (screen_char_t *)data.mutableBytes;
+        const screen_char_t *line = VT100GridImmutableScreenCharsAtLine(self, y);
         iTermExternalAttributeIndex *eaIndex = [self externalAttributesOnLine:y
                                                                createIfNeeded:NO];
         const int left = MAX(0, rect.origin.x);
@@ -2641,14 +2834,6 @@ externalAttributeIndex:(iTermExternalAttributeIndex *)ea {
 
 #pragma mark - Private
 
-- (NSMutableArray *)linesWithSize:(VT100GridSize)size {
-    NSMutableArray *lines = [[NSMutableArray alloc] init];
-    for (int i = 0; i < size.height; i++) {
-        [lines addObject:[[self defaultLineOfWidth:size.width] mutableCopy]];
-    }
-    return lines;
-}
-
 - (NSMutableArray *)lineInfosWithSize:(VT100GridSize)size {
     NSMutableArray *dirty = [NSMutableArray array];
     for (int i = 0; i < size.height; i++) {
@@ -2690,6 +2875,33 @@ static const screen_char_t *VT100GridDefaultLine(VT100Grid *self, int width) {
     return cachedDefaultLine_;
 }
 
+- (void)freeChunks {
+    const int count = VT100GridChunkCount(size_.height);
+    for (int i = 0; _chunks && i < count; i++) {
+        VT100GridChunkRelease(_chunks[i]);
+    }
+    free(_chunks);
+    _chunks = NULL;
+}
+
+// Replaces the ring with empty lines and nothing dirty. size_ must still be the old size.
+- (void)allocateCellsWithSize:(VT100GridSize)size {
+    [self freeChunks];
+    free(_dirtyRows);
+    const size_t rowSize = (size.width + 1) * sizeof(screen_char_t);
+    const screen_char_t *defaultLine = VT100GridDefaultLine(self, size.width);
+    const int count = VT100GridChunkCount(size.height);
+    _chunks = iTermCalloc(count, sizeof(*_chunks));
+    for (int i = 0; i < count; i++) {
+        _chunks[i] = VT100GridChunkCreate(size.width);
+        for (int j = 0; j < VT100GridRowsPerChunk; j++) {
+            memmove(_chunks[i]->cells + (size_t)j * (size.width + 1), defaultLine, rowSize);
+        }
+    }
+    _dirtyRows = iTermCalloc(VT100GridDirtyWordCount(size.height), sizeof(*_dirtyRows));
+    screenTop_ = 0;
+}
+
 - (void)clearLineDataBytes:(screen_char_t *)dest count:(NSInteger)length {
     memset(dest, 0, length * sizeof(*dest));
     dest[length].code = EOL_HARD;
@@ -2698,10 +2910,16 @@ static const screen_char_t *VT100GridDefaultLine(VT100Grid *self, int width) {
 // Returns number of lines dropped from line buffer because it exceeded its size (always 0 or 1).
 - (int)appendLineToLineBuffer:(LineBuffer *)lineBuffer
           unlimitedScrollback:(BOOL)unlimitedScrollback {
+    return [self appendLineNumber:0 toLineBuffer:lineBuffer unlimitedScrollback:unlimitedScrollback];
+}
+
+- (int)appendLineNumber:(int)lineNumber
+           toLineBuffer:(LineBuffer *)lineBuffer
+    unlimitedScrollback:(BOOL)unlimitedScrollback {
     if (!lineBuffer) {
         return 0;
     }
-    const screen_char_t *line = [self immutableScreenCharsAtLineNumber:0];
+    const screen_char_t *line = [self immutableScreenCharsAtLineNumber:lineNumber];
     int len = [self lengthOfLine:line];
     int continuationMark = line[size_.width].code;
     if (continuationMark == EOL_DWC && len == size_.width) {
@@ -2711,7 +2929,7 @@ static const screen_char_t *VT100GridDefaultLine(VT100Grid *self, int width) {
                     length:len
                    partial:(continuationMark != EOL_HARD)
                      width:size_.width
-                  metadata:[[self lineInfoAtLineNumber:0] immutableMetadata]
+                  metadata:[[self lineInfoAtLineNumber:lineNumber] immutableMetadata]
               continuation:line[size_.width]];
     int dropped;
     if (!unlimitedScrollback) {
@@ -2765,8 +2983,8 @@ static const screen_char_t *VT100GridDefaultLine(VT100Grid *self, int width) {
 - (void)setSize:(VT100GridSize)newSize withSideEffects:(BOOL)withSideEffects {
     if (newSize.width != size_.width || newSize.height != size_.height) {
         DLog(@"Grid for %@ resized to %@", self.delegate, VT100GridSizeDescription(newSize));
+        [self allocateCellsWithSize:newSize];
         size_ = newSize;
-        lines_ = [self linesWithSize:newSize];
         lineInfos_ = [self lineInfosWithSize:newSize];
 
         scrollRegionRows_.location = MIN(scrollRegionRows_.location, size_.height - 1);
@@ -3080,10 +3298,8 @@ static void DumpBuf(screen_char_t* p, int n) {
 - (id)copyWithZone:(NSZone *)zone {
     VT100Grid *theCopy = [[VT100Grid alloc] initWithSize:size_
                                                 delegate:delegate_];
-    theCopy->lines_ = [[NSMutableArray alloc] init];
-    for (NSObject *line in lines_) {
-        [theCopy->lines_ addObject:[line mutableCopy]];
-    }
+    VT100GridShareChunks(theCopy, self);
+    memmove(theCopy->_dirtyRows, _dirtyRows, VT100GridDirtyWordCount(size_.height) * sizeof(*_dirtyRows));
     theCopy->lineInfos_ = [[NSMutableArray alloc] init];
     for (VT100LineInfo *line in lineInfos_) {
         [theCopy->lineInfos_ addObject:[line copy]];
@@ -15,10 +15,6 @@
 @protocol VT100LineInfoReading<NSObject>
 @property(nonatomic, readonly) iTermImmutableMetadata immutableMetadata;
 
-- (BOOL)isDirtyAtOffset:(int)x;
-- (BOOL)anyCharIsDirty;
-- (VT100GridRange)dirtyRange;
-- (NSIndexSet *)dirtyIndexes;
 - (NSArray *)encodedMetadata;
 @end
 
@@ -29,11 +25,8 @@
 
 - (instancetype)initWithWidth:(int)width;
 // Does nothing if now=0. This was super-hot when profiling spam.cc so make it direct. Good luck future me.
-- (void)setDirty:(BOOL)dirty inRange:(VT100GridRange)range updateTimestampTo:(NSTimeInterval)now __attribute__((objc_direct));
-- (BOOL)isDirtyAtOffset:(int)x;
-- (BOOL)anyCharIsDirty;
-- (VT100GridRange)dirtyRange;
-- (NSIndexSet *)dirtyIndexes;
+// Dirtiness is tracked by the grid, which calls this when it marks the line dirty.
+- (void)updateTimestamp:(NSTimeInterval)now __attribute__((objc_direct));
 - (void)setTimestamp:(NSTimeInterval)timestamp;
 - (void)setRTLFound:(BOOL)rtlFound;
 - (void)decodeMetadataArray:(NSArray *)array;
@@ -10,7 +10,6 @@
 
 @implementation VT100LineInfo {
     int width_;
-    BOOL _dirty;
     NSData *_cachedEncodedMetadata;
 }
 
@@ -18,8 +17,6 @@
     self = [super init];
     if (self) {
         width_ = width;
-        _dirty = NO;
-        [self setDirty:NO inRange:VT100GridRangeMake(0, width) updateTimestampTo:0];
         iTermMetadataInit(&_metadata, 0, NO, nil);
     }
     return self;
@@ -29,34 +26,14 @@
     iTermMetadataRelease(_metadata);
 }
 
-- (void)setDirty:(BOOL)dirty inRange:(VT100GridRange)range updateTimestampTo:(NSTimeInterval)now {
-#ifdef ITERM_DEBUG
-    assert(range.location >= 0);
-    assert(range.length >= 0);
-    assert(range.location + range.length <= width_);
-#endif
-    if (dirty && now) {
-        [self updateTimestamp:now];
-    }
-    _dirty = dirty;
-}
-
 - (iTermImmutableMetadata)immutableMetadata {
     return iTermMetadataMakeImmutable(self.metadata);
 }
 
-- (VT100GridRange)dirtyRange {
-    if (_dirty) {
-        return VT100GridRangeMake(0, width_);
-    } else {
-        return VT100GridRangeMake(-1, -1);
+- (void)updateTimestamp:(NSTimeInterval)now {
+    if (!now) {
+        return;
     }
-}
-
-- (void)updateTimestamp:(NSTimeInterval)now __attribute__((objc_direct)) {
-#ifdef ITERM_DEBUG
-    assert(now > 0);
-#endif
     // Issue 10633 revealed some instability in timestamps that I was never able to track down so
     // I fixed it by rounding the value to the nearest second. When adding relative timestamps
     // I needed ms precision, so we'll still round it but just to the ms. If I'm right that it
@@ -66,27 +43,8 @@
     _cachedEncodedMetadata = nil;
 }
 
-- (BOOL)isDirtyAtOffset:(int)x {
-#if ITERM_DEBUG
-    assert(x >= 0 && x < width_);
-#endif
-    return _dirty;
-}
-
-- (NSIndexSet *)dirtyIndexes {
-    if (_dirty) {
-        return [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, width_)];
-    }
-    return [NSIndexSet indexSet];
-}
-
-- (BOOL)anyCharIsDirty {
-    return _dirty;
-}
-
 - (id)copyWithZone:(NSZone *)zone {
     VT100LineInfo *theCopy = [[VT100LineInfo alloc] initWithWidth:width_];
-    theCopy->_dirty = _dirty;
     iTermMetadataRelease(theCopy->_metadata);
     theCopy->_metadata = iTermMetadataCopy(_metadata);
 
@@ -19,7 +19,19 @@
 @property(nonatomic, readonly) int streamLength;
 @property(atomic) BOOL literalMode;
 
+// Describes the stream's current, peak, and steady-state memory use.
+@property(nonatomic, readonly) NSString *streamMemoryDescription;
+
 - (void)putStreamData:(const char *)bytes length:(int)length;
+
+// Zero-copy alternative to putStreamData:length:. Returns space at the end of the stream for at
+// least `minimumLength` bytes (the actual amount is stored in `*available`) which the caller may
+// fill, e.g. with read(). Then call didWriteStreamBytes: with the number of bytes written. The
+// space is reserved in between: the stream won't move it, and data put with putStreamData:length:
+// is added after the committed bytes. Only one reservation may be open at a time. If this returns
+// NULL there is nothing to commit.
+- (char *)writableStreamBufferWithMinimumLength:(int)minimumLength available:(int *)available;
+- (void)didWriteStreamBytes:(int)length;
 - (void)clearStream;
 - (void)forceUnhookDCS:(NSString *)uniqueID;
 - (void)startTmuxRecoveryModeWithID:(NSString *)dcsID;
@@ -90,7 +90,7 @@
 
     VT100ByteStreamCursor position = { 0 };
     int length = 0;
-    const int initialOffset = _byteStream.offset;
+    const int initialRemaining = VT100ByteStreamGetRemainingSize(&_byteStream);
     BOOL isSignaling = NO;
     if (VT100ByteStreamCursorGetSize(&cursor) == 0) {
         DLog(@"datalen is 0");
@@ -302,7 +302,7 @@
 
 
         if (VT100ByteStreamConsumerGetConsumed(&consumer) > 0) {
-            ITAssertWithMessage(VT100ByteStreamGetCapacity(&_byteStream) >= VT100ByteStreamGetConsumed(&_byteStream) + VT100ByteStreamConsumerGetConsumed(&consumer),
+            ITAssertWithMessage(VT100ByteStreamGetRemainingSize(&_byteStream) >= VT100ByteStreamConsumerGetConsumed(&consumer),
                                 @"Consumed more bytes than are available");
             // mark our current position in the stream
             VT100ByteStreamConsume(&_byteStream, VT100ByteStreamConsumerGetConsumed(&consumer));
@@ -349,7 +349,7 @@
             CVectorAppend(vector, token);
         }
         if (!isSignaling) {
-            *nonSignalingCountPtr += (_byteStream.offset - initialOffset);
+            *nonSignalingCountPtr += (initialRemaining - VT100ByteStreamGetRemainingSize(&_byteStream));
         }
         return YES;
     } else {
@@ -367,6 +367,25 @@
     }
 }
 
+// The space is reserved in the stream, so it stays put while the caller fills it without the lock.
+- (char *)writableStreamBufferWithMinimumLength:(int)minimumLength available:(int *)available {
+    @synchronized(self) {
+        return (char *)VT100ByteStreamGetWritableSpace(&_byteStream, minimumLength, available);
+    }
+}
+
+- (void)didWriteStreamBytes:(int)length {
+    @synchronized(self) {
+        VT100ByteStreamCommitReservation(&_byteStream, length);
+    }
+}
+
+- (NSString *)streamMemoryDescription {
+    @synchronized(self) {
+        return VT100ByteStreamMemoryDescription(&_byteStream);
+    }
+}
+
 - (int)streamLength {
     @synchronized(self) {
         return VT100ByteStreamGetRemainingSize(&_byteStream);
@@ -253,6 +253,10 @@ typedef NS_ENUM(NSUInteger, VT100ScreenTriggerCheckType) {
 - (void)setEchoProbeDelegate:(id<iTermEchoProbeDelegate>)echoProbeDelegate;
 - (void)resetEchoProbe;
 - (void)threadedReadTask:(char *)buffer length:(int)length;
+- (char *)threadedReadBufferWithMinimumLength:(int)minimumLength available:(int *)available;
+- (void)threadedReadTaskDidFillBufferWithLength:(int)length;
+- (NSString *)parserStreamMemoryDescription;
+- (NSString *)scrollbackMemoryDescription;
 
 - (void)destructivelySetScreenWidth:(int)width
                              height:(int)height
@@ -267,6 +271,8 @@ typedef NS_ENUM(NSUInteger, VT100ScreenTriggerCheckType) {
 - (void)pauseAtNextPrompt:(void (^)(void))paused;
 - (long long)absLineNumberOfLastLineInLineBuffer;
 - (iTermTerminalContentSnapshot *)snapshotForcingPrimaryGrid:(BOOL)forcePrimary;
+// A copy of scrollback history, not including the screen, that may be read on another thread.
+- (LineBuffer *)lineBufferSnapshot;
 - (LineBufferPosition *)positionForTailSearchOfScreen;
 - (void)foldAbsLineRange:(NSRange)range;
 - (NSString *)intervalTreeDump;
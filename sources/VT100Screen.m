@@ -202,6 +202,10 @@ const NSInteger VT100ScreenBigFileDownloadThreshold = 1024 * 1024 * 1024;
 
 }
 
+- (LineBuffer *)lineBufferSnapshot {
+    return [[_state.linebuffer copy] autorelease];
+}
+
 - (LineBufferPosition *)positionForTailSearchOfScreen {
     return _state.linebuffer.lastPosition;
 }
@@ -1684,6 +1688,23 @@ additionalWordCharacters:(NSString *)additionalWordCharacters
     [_mutableState threadedReadTask:buffer length:length];
 }
 
+- (char *)threadedReadBufferWithMinimumLength:(int)minimumLength available:(int *)available {
+    return [_mutableState threadedReadBufferWithMinimumLength:minimumLength available:available];
+}
+
+- (void)threadedReadTaskDidFillBufferWithLength:(int)length {
+    [_mutableState threadedReadTaskDidFillBufferWithLength:length];
+}
+
+// The parser synchronizes access to its stream so this is safe on any thread.
+- (NSString *)parserStreamMemoryDescription {
+    return [_mutableState.terminal.parser streamMemoryDescription];
+}
+
+- (NSString *)scrollbackMemoryDescription {
+    return _state.linebuffer.characterMemoryDescription;
+}
+
 - (long long)lastPromptLine {
     return _state.lastPromptLine;
 }
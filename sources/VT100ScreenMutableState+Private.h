@@ -17,6 +17,7 @@
 #import "iTerm2SharedARC-Swift.h"
 #import "iTermEchoProbe.h"
 #import "iTermMark.h"
+#import "iTermScrollbackCompactor.h"
 #import "iTermTemporaryDoubleBufferedGridController.h"
 
 extern const int64_t VT100ScreenMutableStateSideEffectFlagDidReceiveLineFeed;
@@ -36,6 +37,7 @@ iTermLineBufferDelegate,
 iTermMarkDelegate,
 iTermPathSnifferDelegate,
 iTermPromptStateMachineDelegate,
+iTermScrollbackCompactorClient,
 iTermStatFileProtocol,
 iTermTemporaryDoubleBufferedGridControllerDelegate,
 iTermTokenExecutorDelegate,
@@ -364,6 +364,9 @@ basedAtAbsoluteLineNumber:(long long)absoluteLineNumber
 @property (nonatomic) BOOL suppressAllOutput;
 
 - (void)threadedReadTask:(char *)buffer length:(int)length;
+// Zero-copy version of threadedReadTask:length:. See -[VT100Parser writableStreamBufferWithMinimumLength:available:].
+- (char *)threadedReadBufferWithMinimumLength:(int)minimumLength available:(int *)available;
+- (void)threadedReadTaskDidFillBufferWithLength:(int)length;
 - (void)addTokens:(CVector)vector
       lengthTotal:(int)lengthTotal
 lengthExcludingInBandSignaling:(int)lengthExcludingInBandSignaling
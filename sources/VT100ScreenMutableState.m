@@ -132,6 +132,7 @@ static const int64_t VT100ScreenMutableStateSideEffectFlagLineBufferDidDropLines
         _promptStateMachine.delegate = self;
         _kittyImageController = [[iTermKittyImageController alloc] init];
         _kittyImageController.delegate = self;
+        [[iTermScrollbackCompactor sharedInstance] addClient:self];
     }
     return self;
 }
@@ -464,6 +465,7 @@ static const int64_t VT100ScreenMutableStateSideEffectFlagLineBufferDidDropLines
             [self incrementOverflowBy:[self.linebuffer dropExcessLinesWithWidth:self.currentGrid.size.width]];
         }
     }
+    [self updateLineBufferSpilling];
     if (config.useLineStyleMarks) {
         [self movePromptUnderComposerIfNeeded];
     }
@@ -4525,7 +4527,21 @@ basedAtAbsoluteLineNumber:(long long)absoluteLineNumber
 - (void)threadedReadTask:(char *)buffer length:(int)length {
     // Pass the input stream to the parser.
     [self.terminal.parser putStreamData:buffer length:length];
+    [self threadedParseStreamAfterReadingLength:length];
+}
+
+- (char *)threadedReadBufferWithMinimumLength:(int)minimumLength available:(int *)available {
+    return [self.terminal.parser writableStreamBufferWithMinimumLength:minimumLength
+                                                             available:available];
+}
+
+- (void)threadedReadTaskDidFillBufferWithLength:(int)length {
+    // The data is already in the parser's stream.
+    [self.terminal.parser didWriteStreamBytes:length];
+    [self threadedParseStreamAfterReadingLength:length];
+}
 
+- (void)threadedParseStreamAfterReadingLength:(int)length {
     // Parse the input stream into an array of tokens.
     CVector vector;
     CVectorCreate(&vector, 100);
@@ -5713,6 +5729,10 @@ lengthExcludingInBandSignaling:data.length
     } name:@"trigger side effect"];
 }
 
+- (iTermTokenExecutorUnpauser *)triggerEvaluatorPauseTokenExecution:(PTYTriggerEvaluator *)evaluator {
+    return [_tokenExecutor pause];
+}
+
 - (void)triggerEvaluatorOfferToDisableTriggersInInteractiveApps:(PTYTriggerEvaluator *)evaluator {
     // Use unmanaged concurrency because this will be rare and it can't run as a regular side-
     // effect since it modifies the profile.
@@ -6544,6 +6564,35 @@ launchCoprocessWithCommand:(NSString *)command
     }
 }
 
+#pragma mark - iTermScrollbackCompactorClient
+
+- (void)scrollbackCompactorDidRequestPackingBlocksIdleFor:(int)idleTicks
+                                        keepingMostRecent:(NSInteger)keep
+                                                    limit:(NSInteger)limit {
+    __weak __typeof(self) weakSelf = self;
+    dispatch_async(_queue, ^{
+        [weakSelf packScrollbackBlocksIdleFor:idleTicks keepingMostRecent:keep limit:limit];
+    });
+}
+
+- (void)packScrollbackBlocksIdleFor:(int)idleTicks
+                  keepingMostRecent:(NSInteger)keep
+                              limit:(NSInteger)limit {
+    // The line buffer may have been replaced since the config was last set.
+    [self updateLineBufferSpilling];
+    // VT100Screen's copy of the line buffer adopts the packed blocks the next time it syncs.
+    const NSInteger count = [self.linebuffer packBlocksIdleFor:idleTicks
+                                             keepingMostRecent:keep
+                                                         limit:limit];
+    DLog(@"Packed %@ idle blocks", @(count));
+}
+
+// Only unlimited scrollback spills to disk. Limited scrollback is bounded already.
+- (void)updateLineBufferSpilling {
+    self.linebuffer.spillsToDisk = (self.unlimitedScrollback &&
+                                    [iTermAdvancedSettingsModel spillUnlimitedScrollbackToDisk]);
+}
+
 #pragma mark - iTermPromptStateMachineDelegate
 
 - (VT100GridAbsCoord)promptStateMachineCursorAbsCoord {
@@ -389,6 +389,7 @@ static NSRange NSRangeFromBounds(NSInteger lowerBound, NSInteger upperBound) {
         [_linebuffer mergeFrom:source.linebuffer];
     } else {
         DLog(@"line buffer not dirty");
+        [_linebuffer adoptCompactBlocksFrom:source.linebuffer];
     }
     //  NSString *mine = [_linebuffer debugString];
     //  NSString *theirs = [source.linebuffer debugString];
@@ -12,32 +12,151 @@
 #import "NSStringITerm.h"
 #import "ScreenChar.h"
 
+#if defined(__ARM_NEON)
+#import <arm_neon.h>
+#elif defined(__SSE2__)
+#import <emmintrin.h>
+#endif
+
+// Returns the length of the longest prefix of `bytes` whose bytes all have the high bit set. Every
+// byte of a multi-byte UTF-8 sequence does, so this bounds the run DecodeUTF8Bytes can decode
+// without looking for ASCII.
+static inline int VT100StringParserNonASCIIPrefixLength(const unsigned char *bytes, int length) {
+    int i = 0;
+#if defined(__ARM_NEON)
+    const int8x16_t zero = vdupq_n_s8(0);
+    while (i + 16 <= length) {
+        const uint8x16_t high = vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + i)), zero);
+        const uint64_t nibbles = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(high), 4)), 0);
+        if (nibbles != UINT64_MAX) {
+            return i + (__builtin_ctzll(~nibbles) >> 2);
+        }
+        i += 16;
+    }
+#elif defined(__SSE2__)
+    while (i + 16 <= length) {
+        const int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)));
+        if (mask != 0xffff) {
+            return i + __builtin_ctz(~mask);
+        }
+        i += 16;
+    }
+#endif
+    while (i < length && bytes[i] >= 0x80) {
+        i++;
+    }
+    return i;
+}
+
+// Decodes a well-formed UTF-8 sequence of 2 to 4 bytes (per table 3-7 of the Unicode standard)
+// that lies entirely within `bytes`. Returns its length, or 0 if the sequence is ill-formed or
+// truncated. In that case decode_utf8_char must be consulted, since it knows how to report errors.
+static inline int VT100StringParserDecodeMultibyteUTF8(const unsigned char *bytes,
+                                                       int length,
+                                                       int *codePoint) {
+    const unsigned char c = bytes[0];
+    if (c < 0xc2) {
+        return 0;
+    }
+    if (c < 0xe0) {
+        if (length < 2 || (bytes[1] & 0xc0) != 0x80) {
+            return 0;
+        }
+        *codePoint = ((c & 0x1f) << 6) | (bytes[1] & 0x3f);
+        return 2;
+    }
+    if (c < 0xf0) {
+        if (length < 3 || (bytes[1] & 0xc0) != 0x80 || (bytes[2] & 0xc0) != 0x80) {
+            return 0;
+        }
+        const int value = ((c & 0x0f) << 12) | ((bytes[1] & 0x3f) << 6) | (bytes[2] & 0x3f);
+        if (value < 0x800 || (value >= 0xd800 && value <= 0xdfff)) {
+            return 0;
+        }
+        *codePoint = value;
+        return 3;
+    }
+    if (c < 0xf5) {
+        if (length < 4 ||
+            (bytes[1] & 0xc0) != 0x80 ||
+            (bytes[2] & 0xc0) != 0x80 ||
+            (bytes[3] & 0xc0) != 0x80) {
+            return 0;
+        }
+        const int value = (((c & 0x07) << 18) |
+                           ((bytes[1] & 0x3f) << 12) |
+                           ((bytes[2] & 0x3f) << 6) |
+                           (bytes[3] & 0x3f));
+        if (value < 0x10000 || value > 0x10ffff) {
+            return 0;
+        }
+        *codePoint = value;
+        return 4;
+    }
+    return 0;
+}
+
+// Validates and decodes in a single pass, writing UTF-16 directly into the token so that no
+// NSString needs to be created from the raw bytes afterwards.
 static void DecodeUTF8Bytes(VT100ByteStreamConsumer *consumer,
                             VT100Token *token) {
-    int utf8DecodeResult;
+    int utf8DecodeResult = 0;
     int consumed = 0;
 
     VT100ByteStreamCursor cursor = VT100ByteStreamConsumerGetCursor(consumer);
-
-    while (true) {
+    const unsigned char *bytes = VT100ByteStreamCursorGetPointer(&cursor);
+    const int length = VT100ByteStreamCursorGetSize(&cursor);
+
+    // A run of non-ASCII bytes starting at `consumed` ends at `runEnd`.
+    int runEnd = 0;
+    unichar *utf16 = NULL;
+    int utf16Length = 0;
+    int utf16Capacity = 0;
+
+    while (consumed < length) {
+        if (consumed == runEnd) {
+            runEnd = consumed + VT100StringParserNonASCIIPrefixLength(bytes + consumed,
+                                                                      length - consumed);
+        }
         int codePoint = 0;
-        utf8DecodeResult = decode_utf8_char(
-            VT100ByteStreamCursorGetPointer(&cursor),
-            VT100ByteStreamCursorGetSize(&cursor),
-            &codePoint
-        );
-        // Stop on error or end of stream.
-        if (utf8DecodeResult <= 0) {
-            break;
+        int sequenceLength = 0;
+        if (consumed < runEnd) {
+            sequenceLength = VT100StringParserDecodeMultibyteUTF8(bytes + consumed,
+                                                                  runEnd - consumed,
+                                                                  &codePoint);
         }
-        // Intentionally break out at ASCII characters. They are
-        // processed separately, e.g. they might get converted into
-        // line drawing characters.
-        if (codePoint < 0x80) {
-            break;
+        if (sequenceLength == 0) {
+            // Slow path for errors, partial sequences, and ASCII.
+            utf8DecodeResult = decode_utf8_char(bytes + consumed,
+                                                length - consumed,
+                                                &codePoint);
+            // Stop on error or end of stream.
+            if (utf8DecodeResult <= 0) {
+                break;
+            }
+            // Intentionally break out at ASCII characters. They are
+            // processed separately, e.g. they might get converted into
+            // line drawing characters.
+            if (codePoint < 0x80) {
+                break;
+            }
+            sequenceLength = utf8DecodeResult;
         }
-        VT100ByteStreamCursorAdvance(&cursor, utf8DecodeResult);
-        consumed += utf8DecodeResult;
+
+        const int needed = utf16Length + (codePoint > 0xffff ? 2 : 1);
+        if (needed > utf16Capacity) {
+            // A code point never takes more UTF-16 code units than it has UTF-8 bytes, so the
+            // remaining length is an upper bound.
+            utf16Capacity = MAX(needed, MIN(length, MAX(256, utf16Capacity * 2)));
+            utf16 = [token utf16BufferWithCapacity:utf16Capacity length:utf16Length];
+        }
+        if (codePoint > 0xffff) {
+            utf16[utf16Length++] = ((codePoint - 0x10000) >> 10) + 0xd800;
+            utf16[utf16Length++] = (codePoint & 0x3ff) + 0xdc00;
+        } else {
+            utf16[utf16Length++] = codePoint;
+        }
+        consumed += sequenceLength;
     }
 
     if (consumed > 0) {
@@ -45,6 +164,7 @@ static void DecodeUTF8Bytes(VT100ByteStreamConsumer *consumer,
         // and ignore the error or end of stream for now.
         VT100ByteStreamConsumerSetConsumed(consumer, consumed);
         assert(consumed >= 0);
+        [token setUTF16Length:utf16Length];
         token->type = VT100_STRING;
     } else {
         // Report error or waiting state.
@@ -264,30 +384,79 @@ static void DecodeOtherBytes(VT100ByteStreamConsumer *consumer,
     }
 }
 
+// Returns the length of the longest prefix of `bytes` consisting only of bytes in [0x20, 0x7f].
+// Bytes in that range are exactly the ones that are positive when reinterpreted as signed and
+// greater than 0x1f, so a single signed compare classifies 16 bytes at a time.
+static inline int VT100StringParserPrintableASCIIPrefixLength(const unsigned char *bytes, int length) {
+    int i = 0;
+#if defined(__ARM_NEON)
+    const int8x16_t limit = vdupq_n_s8(0x1f);
+    // Check 64 bytes per iteration while everything is printable. This is the common case when
+    // catting a big file.
+    while (i + 64 <= length) {
+        const uint8x16_t a = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + i)), limit);
+        const uint8x16_t b = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + i + 16)), limit);
+        const uint8x16_t c = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + i + 32)), limit);
+        const uint8x16_t d = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + i + 48)), limit);
+        if (vminvq_u8(vandq_u8(vandq_u8(a, b), vandq_u8(c, d))) != 0xff) {
+            break;
+        }
+        i += 64;
+    }
+    while (i + 16 <= length) {
+        const uint8x16_t ok = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + i)), limit);
+        // Narrow each byte of the mask to a nibble so the first failing lane can be found with ctz.
+        const uint64_t nibbles = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(ok), 4)), 0);
+        if (nibbles != UINT64_MAX) {
+            return i + (__builtin_ctzll(~nibbles) >> 2);
+        }
+        i += 16;
+    }
+#elif defined(__SSE2__)
+    const __m128i limit = _mm_set1_epi8(0x1f);
+    while (i + 64 <= length) {
+        const __m128i a = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)), limit);
+        const __m128i b = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(bytes + i + 16)), limit);
+        const __m128i c = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(bytes + i + 32)), limit);
+        const __m128i d = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(bytes + i + 48)), limit);
+        if (_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(a, b), _mm_and_si128(c, d))) != 0xffff) {
+            break;
+        }
+        i += 64;
+    }
+    while (i + 16 <= length) {
+        const int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)), limit));
+        if (mask != 0xffff) {
+            return i + __builtin_ctz(~mask);
+        }
+        i += 16;
+    }
+#endif
+    while (i < length && isAsciiString(bytes[i])) {
+        i++;
+    }
+    return i;
+}
+
 // Mixed ASCII ascii with CRLFs.
 // This is a huge performance win for handling big files of mostly plain ascii text.
 static void DecodeMixedASCIIBytes(VT100ByteStreamConsumer *consumer,
                                   VT100Token *token) {
     int consumed = 0;
 
-    // I tried the ideas mentioned here:
-    // http://stackoverflow.com/questions/22218605/is-this-function-a-good-candidate-for-simd-on-intel
-    // (using 8-bytes-at-a-time bit twiddling and SIMD)
-    // and although this while loop completed faster, the overall benchmark speed on spam.cc did
-    // not improve.
+    // Printable runs are found with VT100StringParserPrintableASCIIPrefixLength, which examines
+    // up to 64 bytes per iteration, so the only per-byte work left is at CRLFs.
     VT100ByteStreamCursor cursor = VT100ByteStreamConsumerGetCursor(consumer);
+    const unsigned char *bytes = VT100ByteStreamCursorGetPointer(&cursor);
+    const int length = VT100ByteStreamCursorGetSize(&cursor);
     CTVector(int) *crlfs = nil;
-    while (VT100ByteStreamCursorGetSize(&cursor) > 0) {
-        unsigned char c = VT100ByteStreamCursorPeek(&cursor);
-        if (c >= 0x20 && c <= 0x7f) {
-            VT100ByteStreamCursorAdvance(&cursor, 1);
-            consumed++;
-        } else if (c == 13 && VT100ByteStreamCursorDoublePeek(&cursor) == 10) {
+    while (consumed < length) {
+        consumed += VT100StringParserPrintableASCIIPrefixLength(bytes + consumed, length - consumed);
+        if (consumed + 1 < length && bytes[consumed] == 13 && bytes[consumed + 1] == 10) {
             if (!crlfs) {
                 [token realizeCRLFsWithCapacity:40];  // This is a wild-ass guess
                 crlfs = token.crlfs;
             }
-            VT100ByteStreamCursorAdvance(&cursor, 2);
             CTVectorAppend(crlfs, consumed);
             consumed++;
             CTVectorAppend(crlfs, consumed);
@@ -355,23 +524,17 @@ void ParseString(VT100ByteStreamConsumer *consumer,
         VT100ByteStreamConsumerWriteHead(consumer, ONECHAR_UNKNOWN);
         result.string = ReplacementString();
         result->type = VT100_STRING;
-    } else if (result->type != VT100_WAIT && !isAscii) {
+    } else if (result->type != VT100_WAIT && !isAscii && encoding != NSUTF8StringEncoding) {
+        // UTF-8 tokens already hold their decoded characters. Other encodings are converted here.
         VT100ByteStreamCursor cursor = VT100ByteStreamConsumerGetCursor(consumer);
         result.string = VT100ByteStreamCursorMakeString(&cursor, consumedCount, encoding);
 
         if (result.string == nil) {
             // Invalid bytes, can't encode.
-            int i;
-            if (encoding == NSUTF8StringEncoding) {
-                // I am 98% sure this is unreachable because the UTF-8 decoder isn't buggy enough
-                // to claim success but then leave us unable to create an NSString from it.
-                result.string = [@"\uFFFD" stringRepeatedTimes:consumedCount];
-            } else {
-                // Replace every byte with ?, the replacement char for non-unicode encodings.
-                for (i = consumedCount - 1; i >= 0 && !result.string; i--) {
-                    VT100ByteStreamCursorWrite(&cursor, ONECHAR_UNKNOWN);
-                    result.string = VT100ByteStreamCursorMakeString(&cursor, consumedCount, encoding);
-                }
+            // Replace every byte with ?, the replacement char for non-unicode encodings.
+            for (int i = consumedCount - 1; i >= 0 && !result.string; i--) {
+                VT100ByteStreamCursorWrite(&cursor, ONECHAR_UNKNOWN);
+                result.string = VT100ByteStreamCursorMakeString(&cursor, consumedCount, encoding);
             }
         }
     }
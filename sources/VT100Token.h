@@ -349,7 +349,9 @@ NS_INLINE NSString *SSHInfoDescription(SSHInfo info) {
     unsigned char code;  // For VT100_UNKNOWNCHAR, VT100CSI_SCS0...SCS3, and VT100_LITERAL.
 }
 
-// For VT100_STRING
+// For VT100_STRING. When the token was produced by the UTF-8 decoder this is created lazily from
+// the UTF-16 buffer (see -utf16BufferWithCapacity:) and takes ownership of it, so the bytes are
+// only decoded once.
 @property(nonatomic, retain) NSString *string;
 @property(nonatomic, readonly) CTVector(int) *crlfs;
 
@@ -387,6 +389,12 @@ NS_INLINE NSString *SSHInfoDescription(SSHInfo info) {
 
 - (void)realizeCRLFsWithCapacity:(int)capacity;
 
+// Returns a buffer with room for at least `capacity` UTF-16 code units, preserving the first
+// `length` units already written. Call -setUTF16Length: when done writing. The buffer becomes
+// the backing store of `string`, which must not have been set.
+- (unichar *)utf16BufferWithCapacity:(int)capacity length:(int)length;
+- (void)setUTF16Length:(int)length;
+
 // This is meant for swift code in tests. Everyone else should modify the vector directly.
 - (void)appendCRLF:(int)value;
 
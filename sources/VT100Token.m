@@ -23,6 +23,11 @@
     AsciiData _asciiData;
     ScreenChars _screenChars;
     CTVector(int) _crlfs;
+
+    // Decoded characters for VT100_STRING, owned by the token until -string is called.
+    unichar *_utf16;
+    int _utf16Length;
+    int _utf16Capacity;
 }
 
 + (instancetype)token {
@@ -76,6 +81,7 @@ void iTermAsciiDataSet(AsciiData *asciiData, const char *bytes, int length, Scre
     }
 
     [_string release];
+    free(_utf16);
     [_kvpKey release];
     [_kvpValue release];
     [_savedData release];
@@ -342,6 +348,12 @@ void iTermAsciiDataSet(AsciiData *asciiData, const char *bytes, int length, Scre
     }
     if (_string) {
         [params appendFormat:@" string=“%@”", _string];
+    } else if (_utf16) {
+        // Describe the decoded characters without handing the buffer to -string.
+        [params appendFormat:@" string=“%@”",
+         [[[NSString alloc] initWithCharactersNoCopy:_utf16
+                                              length:_utf16Length
+                                        freeWhenDone:NO] autorelease]];
     }
     if (_asciiData.length) {
         [params appendFormat:@" asciiData=“%.*s”", _asciiData.length, _asciiData.buffer];
@@ -465,4 +477,42 @@ void iTermAsciiDataSet(AsciiData *asciiData, const char *bytes, int length, Scre
     CTVectorAppend(&_crlfs, value);
 }
 
+- (NSString *)string {
+    if (!_string && _utf16) {
+        // Hand the buffer to the string rather than copying it.
+        _string = [[NSString alloc] initWithCharactersNoCopy:_utf16
+                                                      length:_utf16Length
+                                                freeWhenDone:YES];
+        _utf16 = NULL;
+        _utf16Length = 0;
+        _utf16Capacity = 0;
+    }
+    return _string;
+}
+
+- (void)setString:(NSString *)string {
+    free(_utf16);
+    _utf16 = NULL;
+    _utf16Length = 0;
+    _utf16Capacity = 0;
+    [_string autorelease];
+    _string = [string retain];
+}
+
+- (unichar *)utf16BufferWithCapacity:(int)capacity length:(int)length {
+    assert(!_string);
+    assert(length <= _utf16Capacity);
+    if (capacity > _utf16Capacity) {
+        _utf16 = iTermRealloc(_utf16, capacity, sizeof(unichar));
+        _utf16Capacity = capacity;
+    }
+    _utf16Length = length;
+    return _utf16;
+}
+
+- (void)setUTF16Length:(int)length {
+    assert(length <= _utf16Capacity);
+    _utf16Length = length;
+}
+
 @end
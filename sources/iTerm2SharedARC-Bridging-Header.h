@@ -22,6 +22,7 @@
 #import "PseudoTerminal+Private.h"
 #import "PseudoTerminal+WindowStyle.h"
 #import "AtomicHelpers.h"
+#import "iTermAPINotificationCoalescer.h"
 #import "iTermAnnouncementView.h"
 #import "iTermAnnouncementViewController.h"
 #import "iTermApplicationDelegate.h"
@@ -46,6 +47,8 @@
 #import "iTermGCD.h"
 #import "iTermGenericEvaluator.h"
 #import "iTermGlobalSearchResult.h"
+#import "iTermGraphDatabase.h"
+#import "iTermHTTPConnection.h"
 #import "iTermHistogram.h"
 #import "iTermImageInfo.h"
 #import "iTermImageMark.h"
@@ -90,12 +93,15 @@
 #import "iTermPublisher.h"
 #import "iTermPythonRuntimeDownloader.h"
 #import "iTermRateLimitedUpdate.h"
+#import "iTermRegexLiterals.h"
 #import "iTermScriptArchive.h"
 #import "SIGIdentity.h"
 #import "iTermSSHHelpers.h"
 #import "iTermScriptExporter.h"
 #import "iTermScriptFunctionCall.h"
 #import "iTermScriptHistory.h"
+#import "iTermScreenUpdateSubscription.h"
+#import "iTermScrollbackSearchIndex.h"
 #import "iTermScriptImporter.h"
 #import "iTermSecureKeyboardEntryController.h"
 #import "iTermSelection.h"
@@ -122,6 +128,9 @@
 #import "iTermTextExtractor.h"
 #import "iTermTextViewContextMenuHelper.h"
 #import "iTermThroughputEstimator.h"
+#import "iTermTmuxOutputDecoder.h"
+#import "iTermTriggerPrefilter.h"
+#import "iTermTriggerWorker.h"
 #import "iTermTuple.h"
 #import "iTermURLStore.h"
 #import "iTermUserDefaults.h"
@@ -131,6 +140,8 @@
 #import "iTermVariables.h"
 #import "iTermVirtualOffset.h"
 #import "iTermWarning.h"
+#import "iTermWebSocketConnection.h"
+#import "iTermWebSocketFrame.h"
 #import "iTermWorkingDirectoryPoller.h"
 #import "iTermWorkingDirectoryProvider.h"
 #import "WindowControllerInterface.h"
@@ -207,6 +218,7 @@
 #import "VT100ScreenMutableState.h"
 #import "VT100ScreenMutableState+Resizing.h"
 #import "VT100ScreenMutableState+TerminalDelegate.h"
+#import "VT100StringParser.h"
 #import "VT100Terminal.h"
 #import "charmaps.h"
 #import "SSKeychain.h"
@@ -80,6 +80,7 @@ typedef NS_ENUM(NSUInteger, iTermNoAuthStatus) {
 + (void)reportFunctionCallError:(NSError *)error forInvocation:(NSString *)invocation origin:(NSString *)origin window:(NSWindow *)window;
 
 - (void)postAPINotification:(ITMNotification *)notification toConnectionKey:(NSString *)connectionKey;
+- (NSInteger)unsentByteCountForConnectionKey:(NSString *)connectionKey;
 
 - (void)dispatchRPCWithName:(NSString *)name
                   arguments:(NSDictionary *)arguments
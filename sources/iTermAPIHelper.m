@@ -9,6 +9,7 @@
 
 #import "CVector.h"
 #import "DebugLogging.h"
+#import "iTermAPINotificationCoalescer.h"
 #import "iTermAdvancedSettingsModel.h"
 #import "iTermBuriedSessions.h"
 #import "iTermBuiltInFunctions.h"
@@ -350,6 +351,8 @@ static BOOL iTermAPIHelperLastApplescriptAuthRequiredSetting;
     // WARNING: These can exist after the block has been removed from
     // _serverOriginatedRPCCompletionBlocks if it times out.
     NSMutableDictionary<NSString *, NSMutableSet<NSString *> *> *_outstandingRPCs;
+    // Applies subscriptions' coalescing_window_ms and max_rate.
+    iTermAPINotificationCoalescer *_notificationCoalescer;
 }
 
 + (instancetype)sharedInstance {
@@ -653,6 +656,14 @@ static BOOL iTermAPIHelperLastApplescriptAuthRequiredSetting;
             _apiServer.delegate = self;
         }
 
+        __weak __typeof(self) weakSelf = self;
+        _notificationCoalescer = [[iTermAPINotificationCoalescer alloc] initWithDelivery:^(ITMNotification *notification,
+                                                                                            id connectionKey,
+                                                                                            NSInteger coalescedCount) {
+            [weakSelf deliverAPINotification:notification
+                             toConnectionKey:connectionKey
+                              coalescedCount:coalescedCount];
+        }];
         _serverOriginatedRPCCompletionBlocks = [NSMutableDictionary dictionary];
         _outstandingRPCs = [NSMutableDictionary dictionary];
         _allSessionsSubscriptions = [NSMutableArray array];
@@ -810,9 +821,74 @@ static BOOL iTermAPIHelperLastApplescriptAuthRequiredSetting;
 }
 
 - (void)postAPINotification:(ITMNotification *)notification toConnectionKey:(NSString *)connectionKey {
+    ITMNotificationType type = 0;
+    NSString *coalescingKey = [self coalescingKeyForNotification:notification type:&type];
+    [_notificationCoalescer postObject:notification
+                              category:[@(type) stringValue]
+                         coalescingKey:coalescingKey
+                         connectionKey:connectionKey];
+}
+
+- (void)deliverAPINotification:(ITMNotification *)notification
+               toConnectionKey:(NSString *)connectionKey
+                coalescedCount:(NSInteger)coalescedCount {
+    if (coalescedCount > 0) {
+        // The same notification may be posted to several connections.
+        notification = [notification copy];
+        notification.coalescedCount = (uint32_t)MIN(coalescedCount, UINT32_MAX);
+    }
     [_apiServer postAPINotification:notification toConnectionKey:connectionKey];
 }
 
+// Returns nil for notifications that report an event rather than the latest state of something.
+// Those are never coalesced.
+- (NSString *)coalescingKeyForNotification:(ITMNotification *)notification type:(ITMNotificationType *)typePtr {
+    if (notification.hasScreenUpdateNotification) {
+        *typePtr = ITMNotificationType_NotifyOnScreenUpdate;
+        if (notification.screenUpdateNotification.hasDelta) {
+            // Deltas must all be delivered for the client to reconstruct the screen.
+            return nil;
+        }
+        return notification.screenUpdateNotification.session;
+    }
+    if (notification.hasVariableChangedNotification) {
+        *typePtr = ITMNotificationType_NotifyOnVariableChange;
+        ITMVariableChangedNotification *change = notification.variableChangedNotification;
+        return [NSString stringWithFormat:@"%@/%@/%@", @(change.scope), change.identifier, change.name];
+    }
+    if (notification.hasLayoutChangedNotification) {
+        *typePtr = ITMNotificationType_NotifyOnLayoutChange;
+        return @"";
+    }
+    if (notification.hasBroadcastDomainsChanged) {
+        *typePtr = ITMNotificationType_NotifyOnBroadcastChange;
+        return @"";
+    }
+    if (notification.hasProfileChangedNotification) {
+        *typePtr = ITMNotificationType_NotifyOnProfileChange;
+        return notification.profileChangedNotification.guid;
+    }
+    return nil;
+}
+
+- (void)updateNotificationRateLimitForRequest:(ITMNotificationRequest *)request
+                                connectionKey:(NSString *)connectionKey {
+    if (!request.subscribe) {
+        return;
+    }
+    NSTimeInterval interval = request.coalescingWindowMs / 1000.0;
+    if (request.maxRate > 0) {
+        interval = MAX(interval, 1.0 / request.maxRate);
+    }
+    [_notificationCoalescer setMinimumInterval:interval
+                                   forCategory:[@(request.notificationType) stringValue]
+                                 connectionKey:connectionKey];
+}
+
+- (NSInteger)unsentByteCountForConnectionKey:(NSString *)connectionKey {
+    return [_apiServer unsentByteCountForConnectionKey:connectionKey];
+}
+
 - (void)didCreateTerminalWindow:(NSNotification *)notification {
     PseudoTerminal *term = notification.object;
     for (iTermAllObjectsSubscription *sub in _allWindowsSubscriptions) {
@@ -1596,6 +1672,18 @@ static BOOL iTermAPIHelperLastApplescriptAuthRequiredSetting;
     }
 }
 
+- (void)apiServerExportScrollback:(ITMExportScrollbackRequest *)request
+                          handler:(void (^)(ITMExportScrollbackResponse *))handler {
+    PTYSession *session = [self sessionForAPIIdentifier:request.session includeBuriedSessions:YES];
+    if (!session) {
+        ITMExportScrollbackResponse *response = [[ITMExportScrollbackResponse alloc] init];
+        response.status = ITMExportScrollbackResponse_Status_SessionNotFound;
+        handler(response);
+    } else {
+        [session handleExportScrollbackRequest:request completion:handler];
+    }
+}
+
 - (BOOL)rpcNotificationRequestIsValid:(ITMNotificationRequest *)request
                         connectionKey:(NSString *)connectionKey {
     if (request.argumentsOneOfCase != ITMNotificationRequest_Arguments_OneOfCase_RpcRegistrationRequest) {
@@ -2017,7 +2105,15 @@ static BOOL iTermAPIHelperLastApplescriptAuthRequiredSetting;
 
 - (void)apiServerNotification:(ITMNotificationRequest *)request
                 connectionKey:(NSString *)connectionKey
-                      handler:(void (^)(ITMNotificationResponse *))handler {
+                      handler:(void (^)(ITMNotificationResponse *))originalHandler {
+    __weak __typeof(self) weakSelf = self;
+    void (^handler)(ITMNotificationResponse *) = ^(ITMNotificationResponse *response) {
+        if (response.status == ITMNotificationResponse_Status_Ok ||
+            response.status == ITMNotificationResponse_Status_AlreadySubscribed) {
+            [weakSelf updateNotificationRateLimitForRequest:request connectionKey:connectionKey];
+        }
+        originalHandler(response);
+    };
     if (request.notificationType == ITMNotificationType_NotifyOnVariableChange) {
         handler([self handleVariableChangeNotificationRequest:request
                                                 connectionKey:connectionKey]);
@@ -2049,6 +2145,7 @@ static BOOL iTermAPIHelperLastApplescriptAuthRequiredSetting;
 }
 
 - (void)removeAllSubscriptionsForConnectionKey:(id)connectionKey {
+    [_notificationCoalescer removeConnectionKey:connectionKey];
     // Remove all notification subscriptions.
     // RPCs are special.
     NSInteger rpcsRemoved = [self removeServerOriginatedRPCSubscriptionsPasstingTest:
@@ -0,0 +1,50 @@
+//
+//  iTermAPINotificationCoalescer.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Called with the object to deliver and the number of objects it replaced since the last delivery
+// for the same key.
+typedef void (^iTermAPINotificationCoalescerDelivery)(id object,
+                                                      id connectionKey,
+                                                      NSInteger coalescedCount);
+
+// Limits how often notifications that describe state reach an API connection. Within a category
+// that has a minimum interval, notifications with the same coalescing key are delivered at most
+// once per interval; when several arrive too soon only the latest is delivered, once the interval
+// has passed. Main thread only.
+@interface iTermAPINotificationCoalescer : NSObject
+
+- (instancetype)initWithDelivery:(iTermAPINotificationCoalescerDelivery)delivery NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+// An interval of 0 removes the limit and delivers anything that was waiting for it.
+- (void)setMinimumInterval:(NSTimeInterval)interval
+               forCategory:(NSString *)category
+             connectionKey:(id)connectionKey;
+
+- (NSTimeInterval)minimumIntervalForCategory:(NSString *)category
+                               connectionKey:(id)connectionKey;
+
+// Forgets the connection's limits and drops its undelivered notifications.
+- (void)removeConnectionKey:(id)connectionKey;
+
+// Number of coalescing keys being tracked for the connection.
+- (NSInteger)testOnlyNumberOfEntriesForConnectionKey:(id)connectionKey;
+
+// Objects without a coalescing key, or in a category without a limit, are delivered immediately.
+- (void)postObject:(id)object
+          category:(NSString *)category
+     coalescingKey:(nullable NSString *)coalescingKey
+     connectionKey:(id)connectionKey
+NS_SWIFT_NAME(post(_:category:coalescingKey:connectionKey:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,178 @@
+//
+//  iTermAPINotificationCoalescer.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermAPINotificationCoalescer.h"
+
+#import "DebugLogging.h"
+#import "NSDate+iTerm.h"
+
+@interface iTermAPINotificationCoalescerEntry : NSObject
+@property (nonatomic, copy) NSString *category;
+@property (nonatomic) NSTimeInterval lastDelivery;
+@property (nonatomic, strong) id pendingObject;
+@property (nonatomic) NSInteger coalescedCount;
+@property (nonatomic) BOOL scheduled;
+@end
+
+@implementation iTermAPINotificationCoalescerEntry
+@end
+
+@implementation iTermAPINotificationCoalescer {
+    iTermAPINotificationCoalescerDelivery _delivery;
+    // connection key -> category -> minimum interval
+    NSMutableDictionary<id, NSMutableDictionary<NSString *, NSNumber *> *> *_intervals;
+    // connection key -> category and coalescing key -> entry
+    NSMutableDictionary<id, NSMutableDictionary<NSString *, iTermAPINotificationCoalescerEntry *> *> *_entries;
+}
+
+- (instancetype)initWithDelivery:(iTermAPINotificationCoalescerDelivery)delivery {
+    self = [super init];
+    if (self) {
+        _delivery = [delivery copy];
+        _intervals = [NSMutableDictionary dictionary];
+        _entries = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (void)setMinimumInterval:(NSTimeInterval)interval
+               forCategory:(NSString *)category
+             connectionKey:(id)connectionKey {
+    if (interval > 0) {
+        if (!_intervals[connectionKey]) {
+            _intervals[connectionKey] = [NSMutableDictionary dictionary];
+        }
+        _intervals[connectionKey][category] = @(interval);
+        return;
+    }
+    [_intervals[connectionKey] removeObjectForKey:category];
+    if (_intervals[connectionKey].count == 0) {
+        [_intervals removeObjectForKey:connectionKey];
+    }
+
+    // Don't leave anything waiting on a limit that no longer exists.
+    NSMutableDictionary<NSString *, iTermAPINotificationCoalescerEntry *> *entries = _entries[connectionKey];
+    for (NSString *key in [entries allKeys]) {
+        iTermAPINotificationCoalescerEntry *entry = entries[key];
+        if (![entry.category isEqualToString:category]) {
+            continue;
+        }
+        [entries removeObjectForKey:key];
+        if (entry.pendingObject) {
+            [self deliverEntry:entry connectionKey:connectionKey];
+        }
+    }
+    if (entries.count == 0) {
+        [_entries removeObjectForKey:connectionKey];
+    }
+}
+
+- (NSTimeInterval)minimumIntervalForCategory:(NSString *)category
+                               connectionKey:(id)connectionKey {
+    return _intervals[connectionKey][category].doubleValue;
+}
+
+- (void)removeConnectionKey:(id)connectionKey {
+    [_intervals removeObjectForKey:connectionKey];
+    [_entries removeObjectForKey:connectionKey];
+}
+
+- (NSInteger)testOnlyNumberOfEntriesForConnectionKey:(id)connectionKey {
+    return _entries[connectionKey].count;
+}
+
+- (void)postObject:(id)object
+          category:(NSString *)category
+     coalescingKey:(NSString *)coalescingKey
+     connectionKey:(id)connectionKey {
+    const NSTimeInterval interval = [self minimumIntervalForCategory:category connectionKey:connectionKey];
+    if (interval <= 0 || !coalescingKey) {
+        _delivery(object, connectionKey, 0);
+        return;
+    }
+
+    NSString *key = [NSString stringWithFormat:@"%@\n%@", category, coalescingKey];
+    if (!_entries[connectionKey]) {
+        _entries[connectionKey] = [NSMutableDictionary dictionary];
+    }
+    iTermAPINotificationCoalescerEntry *entry = _entries[connectionKey][key];
+    if (!entry) {
+        entry = [[iTermAPINotificationCoalescerEntry alloc] init];
+        entry.category = category;
+        entry.lastDelivery = -INFINITY;
+        _entries[connectionKey][key] = entry;
+    }
+    if (entry.pendingObject) {
+        // A delivery is already scheduled. It will carry the latest object instead.
+        entry.pendingObject = object;
+        entry.coalescedCount = entry.coalescedCount + 1;
+        return;
+    }
+    entry.pendingObject = object;
+    const NSTimeInterval now = [NSDate it_timeSinceBoot];
+    if (now - entry.lastDelivery >= interval) {
+        [self deliverEntry:entry connectionKey:connectionKey];
+    }
+    // Either delivers the pending object or, once the interval has passed, forgets the entry.
+    [self scheduleEntry:entry key:key connectionKey:connectionKey interval:interval now:now];
+}
+
+#pragma mark - Private
+
+- (void)scheduleEntry:(iTermAPINotificationCoalescerEntry *)entry
+                  key:(NSString *)key
+        connectionKey:(id)connectionKey
+             interval:(NSTimeInterval)interval
+                  now:(NSTimeInterval)now {
+    if (entry.scheduled) {
+        return;
+    }
+    entry.scheduled = YES;
+    const NSTimeInterval delay = MAX(0, entry.lastDelivery + interval - now);
+    __weak __typeof(self) weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)),
+                   dispatch_get_main_queue(), ^{
+        [weakSelf flushEntry:entry key:key connectionKey:connectionKey];
+    });
+}
+
+- (void)flushEntry:(iTermAPINotificationCoalescerEntry *)entry
+               key:(NSString *)key
+     connectionKey:(id)connectionKey {
+    entry.scheduled = NO;
+    if (_entries[connectionKey][key] != entry) {
+        DLog(@"Entry for %@ on %@ was removed before it could be flushed", key, connectionKey);
+        return;
+    }
+    const NSTimeInterval interval = [self minimumIntervalForCategory:entry.category
+                                                       connectionKey:connectionKey];
+    const NSTimeInterval now = [NSDate it_timeSinceBoot];
+    if (!entry.pendingObject && now - entry.lastDelivery >= interval) {
+        // Nothing arrived during the interval, so the next object can go out immediately and
+        // there's no reason to remember this key.
+        [_entries[connectionKey] removeObjectForKey:key];
+        if (_entries[connectionKey].count == 0) {
+            [_entries removeObjectForKey:connectionKey];
+        }
+        return;
+    }
+    if (entry.pendingObject) {
+        [self deliverEntry:entry connectionKey:connectionKey];
+    }
+    [self scheduleEntry:entry key:key connectionKey:connectionKey interval:interval now:now];
+}
+
+- (void)deliverEntry:(iTermAPINotificationCoalescerEntry *)entry connectionKey:(id)connectionKey {
+    id object = entry.pendingObject;
+    const NSInteger count = entry.coalescedCount;
+    entry.pendingObject = nil;
+    entry.coalescedCount = 0;
+    entry.lastDelivery = [NSDate it_timeSinceBoot];
+    _delivery(object, connectionKey, count);
+}
+
+@end
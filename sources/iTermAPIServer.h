@@ -26,6 +26,7 @@ extern NSString *const iTermAPIServerConnectionClosed;
 - (void)apiServerGetBuffer:(ITMGetBufferRequest *)request handler:(void (^)(ITMGetBufferResponse *))handler;
 - (void)apiServerGetPrompt:(ITMGetPromptRequest *)request handler:(void (^)(ITMGetPromptResponse *))handler;
 - (void)apiServerListPrompts:(ITMListPromptsRequest *)request handler:(void (^)(ITMListPromptsResponse *))handler;
+- (void)apiServerExportScrollback:(ITMExportScrollbackRequest *)request handler:(void (^)(ITMExportScrollbackResponse *))handler;
 - (void)apiServerNotification:(ITMNotificationRequest *)request
                 connectionKey:(NSString *)connectionKey
                       handler:(void (^)(ITMNotificationResponse *))handler;
@@ -100,6 +101,8 @@ extern NSString *const iTermAPIServerConnectionClosed;
 
 - (void)postAPINotification:(ITMNotification *)notification toConnectionKey:(NSString *)connectionKey;
 - (NSString *)websocketKeyForConnectionKey:(NSString *)connectionKey;
+// Bytes of messages to the connection that haven't been written to its socket yet.
+- (NSInteger)unsentByteCountForConnectionKey:(NSString *)connectionKey;
 
 - (void)stop;
 
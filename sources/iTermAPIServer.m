@@ -18,10 +18,12 @@
 #import "iTermSocket.h"
 #import "iTermSocketAddress.h"
 #import "NSArray+iTerm.h"
+#import "NSDate+iTerm.h"
 #import "NSFileManager+iTerm.h"
 #import "NSObject+iTerm.h"
 
 #import <objc/runtime.h>
+#include <os/lock.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -133,6 +135,21 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
     NSMutableDictionary<id, iTermWebSocketConnection *> *_connections;  // _queue
     dispatch_queue_t _executionQueue;
     NSMutableArray<iTermHTTPConnection *> *_pendingConnections;  // _queue
+
+    // iTermAPIServerWillSendMessage notifications waiting to be posted. Messages sent in quick
+    // succession share one trip to the main queue.
+    os_unfair_lock _willSendLock;
+    NSMutableArray<NSArray *> *_pendingWillSendMessages;  // Guarded by _willSendLock
+
+    // For -statisticsDescription. Maps connection guid to request ID to the time since boot it was
+    // received.
+    os_unfair_lock _statisticsLock;
+    NSMutableDictionary<NSString *, NSMutableDictionary<NSNumber *, NSNumber *> *> *_requestStartTimes;  // Guarded by _statisticsLock
+    uint64_t _requestsCompleted;  // Guarded by _statisticsLock
+    NSTimeInterval _totalLatency;  // Guarded by _statisticsLock
+    NSTimeInterval _maxLatency;  // Guarded by _statisticsLock
+    // Traffic of connections that have closed.
+    iTermWebSocketConnectionStatistics _closedConnectionStatistics;  // Guarded by _statisticsLock
 }
 
 + (instancetype)sharedInstance {
@@ -163,6 +180,10 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
             return nil;
         }
         _pendingConnections = [NSMutableArray array];
+        _willSendLock = OS_UNFAIR_LOCK_INIT;
+        _pendingWillSendMessages = [NSMutableArray array];
+        _statisticsLock = OS_UNFAIR_LOCK_INIT;
+        _requestStartTimes = [NSMutableDictionary dictionary];
         _queue = dispatch_queue_create("com.iterm2.apisockets", NULL);
         _executionQueue = dispatch_queue_create("com.iterm2.apiexec", DISPATCH_QUEUE_SERIAL);
 
@@ -249,6 +270,85 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
 
 }
 
+- (NSInteger)unsentByteCountForConnectionKey:(NSString *)connectionKey {
+    __block NSInteger result = 0;
+    dispatch_sync(_queue, ^{
+        result = self->_connections[connectionKey].unsentByteCount;
+    });
+    return result;
+}
+
+static void iTermWebSocketConnectionStatisticsAdd(iTermWebSocketConnectionStatistics *sum,
+                                                  const iTermWebSocketConnectionStatistics *stats) {
+    sum->framesReceived += stats->framesReceived;
+    sum->bytesReceived += stats->bytesReceived;
+    sum->framesSent += stats->framesSent;
+    sum->bytesSent += stats->bytesSent;
+    sum->writes += stats->writes;
+}
+
+static NSString *iTermWebSocketConnectionStatisticsDescription(const iTermWebSocketConnectionStatistics *stats) {
+    return [NSString stringWithFormat:@"received=%llu frames/%llu bytes sent=%llu frames/%llu bytes in %llu writes",
+            stats->framesReceived, stats->bytesReceived,
+            stats->framesSent, stats->bytesSent, stats->writes];
+}
+
+// _queue
+// Traffic totals and request latency over all connections since launch.
+- (NSString *)statisticsDescription {
+    iTermWebSocketConnectionStatistics totals = { 0 };
+    for (iTermWebSocketConnection *connection in _connections.allValues) {
+        const iTermWebSocketConnectionStatistics stats = connection.statistics;
+        iTermWebSocketConnectionStatisticsAdd(&totals, &stats);
+    }
+    os_unfair_lock_lock(&_statisticsLock);
+    iTermWebSocketConnectionStatisticsAdd(&totals, &_closedConnectionStatistics);
+    const uint64_t requests = _requestsCompleted;
+    const NSTimeInterval meanLatency = requests > 0 ? _totalLatency / requests : 0;
+    const NSTimeInterval maxLatency = _maxLatency;
+    os_unfair_lock_unlock(&_statisticsLock);
+    return [NSString stringWithFormat:@"open connections=%@ %@ requests=%llu latency mean=%.2fms max=%.2fms",
+            @(_connections.count),
+            iTermWebSocketConnectionStatisticsDescription(&totals),
+            requests, meanLatency * 1000, maxLatency * 1000];
+}
+
+// Any queue
+- (void)noteRequest:(ITMClientOriginatedMessage *)request receivedOnConnection:(iTermWebSocketConnection *)webSocketConnection {
+    if (!request.hasId_p) {
+        return;
+    }
+    const NSTimeInterval now = [NSDate it_timeSinceBoot];
+    os_unfair_lock_lock(&_statisticsLock);
+    NSMutableDictionary<NSNumber *, NSNumber *> *startTimes = _requestStartTimes[webSocketConnection.guid];
+    if (!startTimes) {
+        startTimes = [NSMutableDictionary dictionary];
+        _requestStartTimes[webSocketConnection.guid] = startTimes;
+    }
+    startTimes[@(request.id_p)] = @(now);
+    os_unfair_lock_unlock(&_statisticsLock);
+}
+
+// Any queue
+- (void)noteResponse:(ITMServerOriginatedMessage *)response sentOnConnection:(iTermWebSocketConnection *)webSocketConnection {
+    if (!response.hasId_p) {
+        return;
+    }
+    const NSTimeInterval now = [NSDate it_timeSinceBoot];
+    os_unfair_lock_lock(&_statisticsLock);
+    NSMutableDictionary<NSNumber *, NSNumber *> *startTimes = _requestStartTimes[webSocketConnection.guid];
+    NSNumber *key = @(response.id_p);
+    NSNumber *start = startTimes[key];
+    if (start) {
+        [startTimes removeObjectForKey:key];
+        const NSTimeInterval latency = now - start.doubleValue;
+        _requestsCompleted += 1;
+        _totalLatency += latency;
+        _maxLatency = MAX(_maxLatency, latency);
+    }
+    os_unfair_lock_unlock(&_statisticsLock);
+}
+
 - (void)didAcceptConnectionOnFileDescriptor:(int)fd
                                 fromAddress:(iTermSocketAddress *)address
                                        euid:(NSNumber *)euid
@@ -428,14 +528,38 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
 // queue
 - (void)sendResponse:(ITMServerOriginatedMessage *)response onConnection:(iTermWebSocketConnection *)webSocketConnection {
     DLog(@"Sending response %@", response);
-    dispatch_async(dispatch_get_main_queue(), ^{
-        [[NSNotificationCenter defaultCenter] postNotificationName:iTermAPIServerWillSendMessage
-                                                            object:webSocketConnection.key
-                                                          userInfo:@{ @"message": response }];
-    });
+    [self postWillSendMessage:response key:webSocketConnection.key];
+    [self noteResponse:response sentOnConnection:webSocketConnection];
     [webSocketConnection sendBinary:[response data] completion:nil];
 }
 
+// Any queue
+- (void)postWillSendMessage:(ITMServerOriginatedMessage *)message key:(id)key {
+    os_unfair_lock_lock(&_willSendLock);
+    const BOOL needsFlush = (_pendingWillSendMessages.count == 0);
+    [_pendingWillSendMessages addObject:@[ key ?: [NSNull null], message ]];
+    os_unfair_lock_unlock(&_willSendLock);
+    if (needsFlush) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self flushWillSendMessages];
+        });
+    }
+}
+
+// Main queue
+- (void)flushWillSendMessages {
+    os_unfair_lock_lock(&_willSendLock);
+    NSArray<NSArray *> *pending = _pendingWillSendMessages;
+    _pendingWillSendMessages = [NSMutableArray array];
+    os_unfair_lock_unlock(&_willSendLock);
+    for (NSArray *tuple in pending) {
+        id key = [tuple[0] nilIfNull];
+        [[NSNotificationCenter defaultCenter] postNotificationName:iTermAPIServerWillSendMessage
+                                                            object:key
+                                                          userInfo:@{ @"message": tuple[1] }];
+    }
+}
+
 #pragma mark - Transactions
 
 // Runs on execution queue
@@ -589,6 +713,19 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
     }];
 }
 
+- (void)handleExportScrollbackRequest:(ITMClientOriginatedMessage *)request connection:(iTermWebSocketConnection *)webSocketConnection {
+    ITMServerOriginatedMessage *response = [self newResponseForRequest:request];
+
+    __block BOOL handled = NO;
+    __weak __typeof(self) weakSelf = self;
+    [_delegate apiServerExportScrollback:request.exportScrollbackRequest handler:^(ITMExportScrollbackResponse *exportScrollbackResponse) {
+        assert(!handled);
+        handled = YES;
+        response.exportScrollbackResponse = exportScrollbackResponse;
+        [weakSelf finishHandlingRequestWithResponse:response onConnection:webSocketConnection];
+    }];
+}
+
 - (void)handleNotificationRequest:(ITMClientOriginatedMessage *)request connection:(iTermWebSocketConnection *)webSocketConnection {
     ITMServerOriginatedMessage *response = [self newResponseForRequest:request];
 
@@ -1052,6 +1189,10 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
             [self handleListPromptsRequest:request connection:webSocketConnection];
             break;
 
+        case ITMClientOriginatedMessage_Submessage_OneOfCase_ExportScrollbackRequest:
+            [self handleExportScrollbackRequest:request connection:webSocketConnection];
+            break;
+
         case ITMClientOriginatedMessage_Submessage_OneOfCase_NotificationRequest:
             [self handleNotificationRequest:request connection:webSocketConnection];
             break;
@@ -1211,7 +1352,17 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
 // _queue
 - (void)webSocketConnectionDidTerminate:(iTermWebSocketConnection *)webSocketConnection {
     DLog(@"Private queue: Connection terminated - begin");
+    // Take its counters before it's removed so they aren't lost from the totals.
+    const iTermWebSocketConnectionStatistics stats = webSocketConnection.statistics;
     [self->_connections removeObjectForKey:webSocketConnection.guid];
+    os_unfair_lock_lock(&_statisticsLock);
+    iTermWebSocketConnectionStatisticsAdd(&_closedConnectionStatistics, &stats);
+    [_requestStartTimes removeObjectForKey:webSocketConnection.guid];
+    os_unfair_lock_unlock(&_statisticsLock);
+    DLog(@"Connection %@ closed after %@. All connections: %@",
+         webSocketConnection.guid,
+         iTermWebSocketConnectionStatisticsDescription(&stats),
+         [self statisticsDescription]);
     dispatch_async(self->_executionQueue, ^{
         if (self.transaction.connection == webSocketConnection) {
             iTermAPITransaction *transaction = self.transaction;
@@ -1229,11 +1380,25 @@ NSString *const iTermAPIServerConnectionClosed = @"iTermAPIServerConnectionClose
     DLog(@"Private queue: Connection terminated - done");
 }
 
+// The connection's queue
+- (id)webSocketConnection:(iTermWebSocketConnection *)webSocketConnection decodeFrame:(iTermWebSocketFrame *)frame {
+    if (frame.opcode != iTermWebSocketOpcodeBinary) {
+        return nil;
+    }
+    ITMClientOriginatedMessage *request = [ITMClientOriginatedMessage parseFromData:frame.payload error:nil];
+    if (request) {
+        [self noteRequest:request receivedOnConnection:webSocketConnection];
+    }
+    return request;
+}
+
 // _queue
-- (void)webSocketConnection:(iTermWebSocketConnection *)webSocketConnection didReadFrame:(iTermWebSocketFrame *)frame {
+- (void)webSocketConnection:(iTermWebSocketConnection *)webSocketConnection
+               didReadFrame:(iTermWebSocketFrame *)frame
+              decodedObject:(id)decodedObject {
     DLog(@"Private queue: didReadFrame - begin");
     if (frame.opcode == iTermWebSocketOpcodeBinary) {
-        ITMClientOriginatedMessage *request = [ITMClientOriginatedMessage parseFromData:frame.payload error:nil];
+        ITMClientOriginatedMessage *request = decodedObject;
         DLog(@"Dispatch %@", request);
         if (request) {
             DLog(@"Received request: %@", request);
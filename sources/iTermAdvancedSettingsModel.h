@@ -48,6 +48,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (BOOL)acceptOSC7;
 + (double)activeUpdateCadence;
 + (int)adaptiveFrameRateThroughputThreshold;
++ (BOOL)adaptivePTYReads;
 + (BOOL)addUtilitiesToPATH;
 + (BOOL)advancedPasteWaitsForPromptByDefault;
 + (BOOL)aggressiveBaseCharacterDetection;
@@ -187,6 +188,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (BOOL)enableUnderlineSemanticHistoryOnCmdHover;
 + (BOOL)enableZoomMenu;
 + (BOOL)escapeWithQuotes;
++ (BOOL)evaluateTriggersAsynchronously;
 + (BOOL)excludeBackgroundColorsFromCopiedStyle;
 + (BOOL)excludeUtunFromNetworkUtilization;
 + (BOOL)experimentalKeyHandling;
@@ -229,6 +231,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (BOOL)ignoreHardNewlinesInURLs;
 + (BOOL)includePasteHistoryInAdvancedPaste;
 + (BOOL)includeShortcutInWindowsMenu;
++ (BOOL)indexScrollbackForSearch;
 + (BOOL)indicateBellsInDockBadgeLabel;
 + (double)indicatorFlashInitialAlpha;
 + (double)invalidateShadowTimesPerSecond;
@@ -328,6 +331,9 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (int)optimumTabWidth;
 + (BOOL)oscColorReport16Bits;
 + (BOOL)p3;
++ (BOOL)packScrollback;
++ (BOOL)parallelizeGlobalSearch;
++ (BOOL)parallelizeParsing;
 + (int)pasteHistoryMaxOptions;
 + (BOOL)pastingClearsSelection;
 + (NSString *)pathsToIgnore;
@@ -342,6 +348,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (BOOL)postFakeFlagsChangedEvents;
 + (BOOL)preferSpeedToFullLigatureSupport;
 + (NSString *)preferredBaseDir;
++ (BOOL)prefilterTriggers;
 + (const BOOL *)preventEscapeSequenceFromClearingHistory;
 + (BOOL)prioritizeSmartSelectionActions;
 + (BOOL)saveScrollBufferWhenClearing;
@@ -374,6 +381,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (BOOL)rightJustifyRTLLines;
 + (BOOL)runJobsInServers;
 + (BOOL)saveToPasteHistoryWhenSecureInputEnabled;
++ (double)scrollbackIdleTimeBeforePacking;
 + (double)scrollWheelAcceleration;
 + (NSString *)searchCommand;
 + (void)setSearchCommand:(NSString *)newValue;
@@ -419,6 +427,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (BOOL)smartLoggingWithAutoComposer;
 + (int)smartSelectionRadius;
 + (BOOL)solidUnderlines;
++ (BOOL)spillUnlimitedScrollbackToDisk;
 + (NSString *)splitPaneColor;
 + (NSString *)splitPaneSourceFillColor;
 + (NSString *)splitPaneSourceBorderColor;
@@ -472,6 +481,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (NSString *)trailingPunctuationMarks;
 + (BOOL)translateScreenToXterm;
 + (int)triggerRadius;
++ (int)triggerWorkerQueueDepth;
 + (BOOL)trimWhitespaceOnCopy;
 + (BOOL)typingClearsSelection;
 + (NSString *)unameCommand;
@@ -492,6 +502,7 @@ extern NSString *const iTermAdvancedSettingsDidChange;
 + (BOOL)useDivorcedProfileToSplit;
 + (BOOL)useExperimentalFontMetrics;
 + (BOOL)useGCDUpdateTimer;
++ (BOOL)useKqueueForTaskNotifier;
 
 #if ENABLE_LOW_POWER_GPU_DETECTION
 + (BOOL)useLowPowerGPUWhenUnplugged;
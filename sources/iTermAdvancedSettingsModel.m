@@ -784,6 +784,17 @@ DEFINE_BOOL(useExperimentalFontMetrics, NO, SECTION_EXPERIMENTAL @"Use a more th
 DEFINE_BOOL(fastForegroundJobUpdates, YES, SECTION_EXPERIMENTAL @"Enable low-latency updates of the current foreground job");
 
 // Experiments currently under test
+DEFINE_BOOL(packScrollback, YES, SECTION_EXPERIMENTAL @"Store scrollback history compactly.\nCharacters that have scrolled off are kept as code points plus runs of attributes until they’re next needed, which takes several times less memory for typical output.");
+DEFINE_FLOAT(scrollbackIdleTimeBeforePacking, 30, SECTION_EXPERIMENTAL @"Seconds before scrollback that was unpacked to be read is packed again.\nRequires “Store scrollback history compactly”. The most recently read blocks stay unpacked so scrolling and searching nearby don’t repeatedly unpack them. Everything is packed right away when the system is low on memory. Use 0 to repack only when memory is low.");
+DEFINE_BOOL(spillUnlimitedScrollbackToDisk, NO, SECTION_EXPERIMENTAL @"Keep unlimited scrollback history in a temporary file.\nOnly recently viewed history stays in memory; the rest is read back from disk as needed. The file is readable only by you and is deleted when the session ends. Applies to sessions with unlimited scrollback.");
+DEFINE_BOOL(indexScrollbackForSearch, NO, SECTION_EXPERIMENTAL @"Index scrollback history so searches can skip parts that can’t match.\nEach block of history is summarized by the three-character sequences it contains as it scrolls off, using about 1% more memory. Only searches for text or regular expressions that contain at least three literal characters benefit.");
+DEFINE_BOOL(adaptivePTYReads, YES, SECTION_EXPERIMENTAL @"Batch reads from sessions that produce a lot of output.\nWhen a session’s throughput is high, its reads wait up to half a millisecond for more output so it can be parsed in larger batches. Interactive sessions are not affected.");
+DEFINE_BOOL(useKqueueForTaskNotifier, YES, SECTION_EXPERIMENTAL @"Use kqueue instead of select() to wait for output from sessions.\nRegistrations persist between waits, so the cost of waking up for output doesn’t grow with the number of sessions. You must restart iTerm2 for this change to take effect.");
+DEFINE_BOOL(parallelizeParsing, YES, SECTION_EXPERIMENTAL @"Read and parse output from multiple sessions in parallel.\nWork is spread over a pool of threads sized to the number of CPU cores. Each session’s output is still parsed in order. You must restart iTerm2 for this change to take effect.");
+DEFINE_BOOL(parallelizeGlobalSearch, YES, SECTION_EXPERIMENTAL @"Search all sessions at once in global search.\nEach session’s history is searched on a pool of threads sized to the number of CPU cores, and results are shown in batches. Otherwise all searches share one thread and results are collected from one session at a time.");
+DEFINE_BOOL(prefilterTriggers, YES, SECTION_EXPERIMENTAL @"Check each line for text that triggers require before running their regular expressions.\nAll triggers are checked in one pass over the line, and only triggers whose required text is present are run. Triggers whose regular expressions use alternation or inline flags are always run.");
+DEFINE_BOOL(evaluateTriggersAsynchronously, NO, SECTION_EXPERIMENTAL @"Evaluate triggers on a separate thread.\nLines are matched against triggers’ regular expressions in the background and their actions are performed shortly afterwards, in order, so slow triggers don’t hold up output. Output waits only when too many lines are queued.");
+DEFINE_INT(triggerWorkerQueueDepth, 256, SECTION_EXPERIMENTAL @"Maximum number of lines waiting to be checked against triggers.\nRequires “Evaluate triggers on a separate thread”. When this many lines are queued, processing of output pauses until one has been checked.");
 DEFINE_BOOL(tmuxVariableWindowSizesSupported, YES, SECTION_EXPERIMENTAL @"Allow variable window sizes in tmux integration.\nRequres tmux version 2.9 or later.");
 DEFINE_BOOL(aggressiveBaseCharacterDetection, YES, SECTION_EXPERIMENTAL @"Detect base unicode characters with lookup table.\nApple's algorithm for segmenting composed characters makes bad choices, such as for Tamil. Enable this to reduce text overlapping.");
 DEFINE_BOOL(escapeWithQuotes, NO, SECTION_EXPERIMENTAL @"Escape file names with single quotes instead of backslashes.\nThis is intended for users of xonsh, which does not accept backslash escaping.");
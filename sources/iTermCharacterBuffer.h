@@ -10,20 +10,68 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class iTermScrollbackSpillFile;
+
 // Stores a chunk of `screen_char_t`s for LineBlock. Many line blocks may reference the same
 // character buffer. When one is modified, it gets a private copy to avoid disturbing the others.
+//
+// A buffer may instead be packed: code points are kept in their own array and everything else is
+// kept in a table of runs of identical attributes. Most text is long runs of the same style, so
+// this is several times smaller. Reading with `pointer` expands the `screen_char_t`s into a cache
+// kept alongside the packed form, so a compact copy can be had again without repacking. Only
+// `mutablePointer` and `resize:` replace the packed form.
+//
+// A buffer may also be spilled to an iTermScrollbackSpillFile, in which case it takes no memory
+// until it's used. Reading it maps the file.
 @interface iTermCharacterBuffer: NSObject
 @property(nonatomic, readonly) int size;
 @property(nonatomic, readonly) screen_char_t *mutablePointer;
 @property(nonatomic, readonly) const screen_char_t *pointer;
 @property(nonatomic, readonly) NSData *data;
 @property(nonatomic, readonly) NSString *shortDescription;
+// YES if the characters aren't materialized because the buffer is packed or spilled and hasn't
+// been read since.
+@property(nonatomic, readonly) BOOL isPacked;
+@property(nonatomic, readonly) BOOL isSpilled;
+
+// Bytes of heap memory used for characters.
+@property(nonatomic, readonly) NSInteger memoryUsage;
+
+// Value of +accessClock the last time the characters were read or written.
+@property(nonatomic, readonly) int lastAccess;
+
+// A coarse clock used to tell which buffers have been idle. It starts at 0 and is advanced by
+// iTermScrollbackCompactor.
+@property(class, nonatomic, readonly) int accessClock;
++ (void)advanceAccessClock;
 
 - (instancetype)initWithSize:(int)size;
 - (instancetype)initWithData:(NSData *)data;
 
+// Calls `block` with the characters. If the buffer is packed or spilled and hasn't been read, they
+// are expanded into temporary storage that's freed afterwards instead of into the read cache, and
+// the access doesn't count toward -lastAccess. For scans that shouldn't undo compaction.
+- (void)readCharactersWithoutCaching:(void (^ NS_NOESCAPE)(const screen_char_t *characters))block;
+
 - (void)resize:(int)newSize;
 - (iTermCharacterBuffer *)clone;
+
+// Returns a packed copy, or nil if packing wouldn't at least halve the memory used. Characters at
+// and after `length` are unused space; they become zeros in the copy.
+- (iTermCharacterBuffer * _Nullable)packedCopyPreservingLength:(int)length;
+
+// Returns a spilled copy, or nil if writing to the file failed. Only the first `length` characters
+// are written. If this buffer was materialized from a record in `file` and hasn't changed since,
+// the copy uses the same record and nothing is written.
+- (iTermCharacterBuffer * _Nullable)spilledCopyToFile:(iTermScrollbackSpillFile *)file
+                                     preservingLength:(int)length;
+
+// Returns the copy most recently made by -packedCopyPreservingLength: or
+// -spilledCopyToFile:preservingLength: if something still holds a reference to it and it preserved
+// at least `length` characters. This lets copies of a line block on other threads share one
+// compact buffer without packing or spilling again. A packed or spilled buffer that has been read
+// returns a copy without its read cache.
+- (iTermCharacterBuffer * _Nullable)existingCompactCopyPreservingLength:(int)length;
 - (BOOL)deepIsEqual:(id)object;
 
 @end
@@ -6,15 +6,88 @@
 //
 
 #import "iTermCharacterBuffer.h"
+#import "DebugLogging.h"
 #import "iTermMalloc.h"
+#import "iTermScrollbackSpillFile.h"
+
+#import <sys/mman.h>
+
+// A run of characters that are identical except for their code.
+typedef struct {
+    // Index of the first character in the run. Runs are sorted by start.
+    int start;
+    // `code` is always 0. Padding is preserved so that materializing is exact.
+    screen_char_t style;
+} iTermCharacterBufferRun;
+
+static int gAccessClock;
+
+NS_INLINE screen_char_t iTermCharacterBufferStyle(const screen_char_t *c) {
+    screen_char_t style = *c;
+    style.code = 0;
+    return style;
+}
 
 @implementation iTermCharacterBuffer {
+    // NULL while packed or spilled. Published with release semantics because a shared buffer may
+    // be materialized by any thread that reads it.
     screen_char_t *_buffer;
     int _size;
+    // _buffer is a private mapping of the spill file rather than a heap allocation.
+    BOOL _bufferIsMapped;
+
+    // Expanded characters for reading while packed or spilled. The compact form is kept alongside,
+    // so reading doesn't undo packing, and compact copies leave this behind. Published like
+    // _buffer and never freed before -dealloc because readers may still be using it. Becomes
+    // _buffer if the characters are modified.
+    screen_char_t *_readCache;
+    // _readCache is a private mapping of the spill file rather than a heap allocation.
+    BOOL _readCacheIsMapped;
+
+    // Packed form. Only valid while _buffer is NULL.
+    unichar *_codes;
+    iTermCharacterBufferRun *_runs;
+    int _numberOfRuns;
+
+    // If set, a record in this file at this offset holds exactly our characters. While _buffer
+    // and _codes are NULL it's the only copy of them.
+    iTermScrollbackSpillFile *_spillFile;
+    long long _spillOffset;
+
+    // Updated without a lock. It's only a hint for deciding what to pack.
+    int _lastAccess;
+
+    // The result of the last call to -packedCopyPreservingLength: or -spilledCopyToFile:... and
+    // the length it preserved.
+    __weak iTermCharacterBuffer *_compactCopy;
+    int _compactCopyLength;
+    BOOL _hasCompactCopy;
+
+    // Packing didn't save enough memory. Don't try again until the contents change.
+    BOOL _incompressible;
+}
+
++ (int)accessClock {
+    return __atomic_load_n(&gAccessClock, __ATOMIC_RELAXED);
+}
+
++ (void)advanceAccessClock {
+    __atomic_add_fetch(&gAccessClock, 1, __ATOMIC_RELAXED);
+}
+
+static void iTermCharacterBufferFreeCharacters(screen_char_t *characters, int size, BOOL mapped) {
+    if (mapped) {
+        munmap(characters, (size_t)size * sizeof(screen_char_t));
+    } else {
+        free(characters);
+    }
 }
 
 - (void)dealloc {
-    free(_buffer);
+    iTermCharacterBufferFreeCharacters(_buffer, _size, _bufferIsMapped);
+    iTermCharacterBufferFreeCharacters(_readCache, _size, _readCacheIsMapped);
+    free(_codes);
+    free(_runs);
 }
 
 - (NSString *)description {
@@ -34,15 +107,103 @@
 }
 
 - (screen_char_t *)mutablePointer {
-    return _buffer;
+    // Materialize first because a spilled buffer needs its record to do so.
+    screen_char_t *buffer = [self materializeForWriting];
+    [self contentsWillChange];
+    return buffer;
 }
 
 - (const screen_char_t *)pointer {
-    return _buffer;
+    [self noteAccess];
+    screen_char_t *buffer = __atomic_load_n(&_buffer, __ATOMIC_ACQUIRE);
+    if (buffer) {
+        return buffer;
+    }
+    buffer = __atomic_load_n(&_readCache, __ATOMIC_ACQUIRE);
+    if (buffer) {
+        return buffer;
+    }
+    @synchronized(self) {
+        if (_buffer) {
+            return _buffer;
+        }
+        if (!_readCache) {
+            BOOL mapped = NO;
+            buffer = [self expandedCharactersMapped:&mapped];
+            _readCacheIsMapped = mapped;
+            __atomic_store_n(&_readCache, buffer, __ATOMIC_RELEASE);
+        }
+        return _readCache;
+    }
+}
+
+- (void)readCharactersWithoutCaching:(void (^ NS_NOESCAPE)(const screen_char_t *))block {
+    const screen_char_t *existing = __atomic_load_n(&_buffer, __ATOMIC_ACQUIRE) ?: __atomic_load_n(&_readCache, __ATOMIC_ACQUIRE);
+    if (existing) {
+        block(existing);
+        return;
+    }
+    BOOL mapped = NO;
+    screen_char_t *characters = NULL;
+    int size = 0;
+    @synchronized(self) {
+        existing = _buffer ?: _readCache;
+        if (!existing) {
+            characters = [self expandedCharactersMapped:&mapped];
+            size = _size;
+        }
+    }
+    if (existing) {
+        block(existing);
+        return;
+    }
+    block(characters);
+    iTermCharacterBufferFreeCharacters(characters, size, mapped);
+}
+
+- (BOOL)isPacked {
+    return (__atomic_load_n(&_buffer, __ATOMIC_ACQUIRE) == NULL &&
+            __atomic_load_n(&_readCache, __ATOMIC_ACQUIRE) == NULL);
+}
+
+- (BOOL)isSpilled {
+    @synchronized(self) {
+        return !_buffer && !_readCache && _spillFile;
+    }
+}
+
+- (NSInteger)memoryUsage {
+    @synchronized(self) {
+        if (_buffer) {
+            return (NSInteger)_size * sizeof(screen_char_t);
+        }
+        const NSInteger cacheUsage = (_readCache && !_readCacheIsMapped) ? (NSInteger)_size * sizeof(screen_char_t) : 0;
+        if (_spillFile) {
+            return cacheUsage;
+        }
+        return cacheUsage + (NSInteger)_size * sizeof(unichar) + (NSInteger)_numberOfRuns * sizeof(iTermCharacterBufferRun);
+    }
+}
+
+- (int)lastAccess {
+    return __atomic_load_n(&_lastAccess, __ATOMIC_RELAXED);
 }
 
 - (NSData *)data {
-    return [NSData dataWithBytes:(void *)_buffer length:_size * sizeof(screen_char_t)];
+    @synchronized(self) {
+        const screen_char_t *characters = _buffer ?: _readCache;
+        if (characters) {
+            return [NSData dataWithBytes:(void *)characters length:_size * sizeof(screen_char_t)];
+        }
+        // Don't materialize just to save it.
+        NSMutableData *data = [NSMutableData dataWithLength:_size * sizeof(screen_char_t)];
+        if (_spillFile) {
+            [self readSpilledCharactersInto:data.mutableBytes];
+        } else {
+            [self expandInto:data.mutableBytes];
+        }
+        return data;
+    }
 }
 
 - (instancetype)initWithSize:(int)size {
@@ -50,32 +211,295 @@
     if (self) {
         _buffer = iTermUninitializedCalloc(size, sizeof(screen_char_t));
         _size = size;
+        _lastAccess = iTermCharacterBuffer.accessClock;
     }
     return self;
 }
 
 - (instancetype)initWithData:(NSData *)data {
-    return [self initWithChars:(screen_char_t *)data.bytes 
+    return [self initWithChars:(screen_char_t *)data.bytes
                           size:data.length / sizeof(screen_char_t)];
 }
 
 // Makes a copy
-- (instancetype)initWithChars:(screen_char_t *)source size:(int)size {
+- (instancetype)initWithChars:(const screen_char_t *)source size:(int)size {
     self = [super init];
     if (self) {
         _buffer = iTermMemdup(source, size, sizeof(screen_char_t));
         _size = size;
+        _lastAccess = iTermCharacterBuffer.accessClock;
+    }
+    return self;
+}
+
+// Takes ownership of `codes` and `runs`.
+- (instancetype)initWithCodes:(unichar *)codes
+                         runs:(iTermCharacterBufferRun *)runs
+                 numberOfRuns:(int)numberOfRuns
+                         size:(int)size {
+    self = [super init];
+    if (self) {
+        _codes = codes;
+        _runs = runs;
+        _numberOfRuns = numberOfRuns;
+        _size = size;
+        _lastAccess = iTermCharacterBuffer.accessClock;
+    }
+    return self;
+}
+
+- (instancetype)initWithSpillFile:(iTermScrollbackSpillFile *)spillFile
+                           offset:(long long)offset
+                             size:(int)size {
+    self = [super init];
+    if (self) {
+        _spillFile = spillFile;
+        _spillOffset = offset;
+        _size = size;
+        _lastAccess = iTermCharacterBuffer.accessClock;
     }
     return self;
 }
 
 - (void)resize:(int)newSize {
-    _buffer = iTermRealloc(_buffer, newSize, sizeof(screen_char_t));
-    _size = newSize;
+    screen_char_t *buffer = [self materializeForWriting];
+    [self contentsWillChange];
+    @synchronized(self) {
+        if (_bufferIsMapped) {
+            // A mapping can't be reallocated.
+            screen_char_t *copy = iTermMemdup(buffer, _size, sizeof(screen_char_t));
+            munmap(buffer, (size_t)_size * sizeof(screen_char_t));
+            buffer = copy;
+            _bufferIsMapped = NO;
+        }
+        __atomic_store_n(&_buffer, iTermRealloc(buffer, newSize, sizeof(screen_char_t)), __ATOMIC_RELEASE);
+        _size = newSize;
+    }
 }
 
 - (iTermCharacterBuffer *)clone {
-    return [[iTermCharacterBuffer alloc] initWithChars:_buffer size:_size];
+    @synchronized(self) {
+        if (_buffer) {
+            return [[iTermCharacterBuffer alloc] initWithChars:_buffer size:_size];
+        }
+        return [self compactClone];
+    }
+}
+
+// Must be packed or spilled and hold the lock. The copy doesn't get the read cache.
+- (iTermCharacterBuffer *)compactClone {
+    if (_spillFile) {
+        // Records are never modified so they can be shared.
+        return [[iTermCharacterBuffer alloc] initWithSpillFile:_spillFile
+                                                        offset:_spillOffset
+                                                          size:_size];
+    }
+    return [[iTermCharacterBuffer alloc] initWithCodes:iTermMemdup(_codes, _size, sizeof(*_codes))
+                                                  runs:iTermMemdup(_runs, _numberOfRuns, sizeof(*_runs))
+                                          numberOfRuns:_numberOfRuns
+                                                  size:_size];
+}
+
+- (iTermCharacterBuffer *)packedCopyPreservingLength:(int)length {
+    @synchronized(self) {
+        length = MAX(0, MIN(length, _size));
+        if (!_buffer || _size == 0 || _incompressible) {
+            return nil;
+        }
+        const NSInteger budget = (NSInteger)_size * sizeof(screen_char_t) / 2 - (NSInteger)_size * sizeof(unichar);
+        const int maxRuns = (int)MIN(INT_MAX, budget / (NSInteger)sizeof(iTermCharacterBufferRun));
+        if (maxRuns < 1) {
+            _incompressible = YES;
+            return nil;
+        }
+        iTermCharacterBufferRun *runs = iTermMalloc(maxRuns * sizeof(iTermCharacterBufferRun));
+        int numberOfRuns = 0;
+        for (int i = 0; i < _size; i++) {
+            // Unused space at the end may be uninitialized. Treat it as zeros.
+            const screen_char_t style = i < length ? iTermCharacterBufferStyle(&_buffer[i]) : (screen_char_t){ 0 };
+            if (numberOfRuns > 0 && !memcmp(&runs[numberOfRuns - 1].style, &style, sizeof(style))) {
+                if (i >= length) {
+                    break;
+                }
+                continue;
+            }
+            if (numberOfRuns == maxRuns) {
+                free(runs);
+                _incompressible = YES;
+                return nil;
+            }
+            runs[numberOfRuns++] = (iTermCharacterBufferRun){ .start = i, .style = style };
+        }
+        unichar *codes = iTermCalloc(_size, sizeof(unichar));
+        for (int i = 0; i < length; i++) {
+            codes[i] = _buffer[i].code;
+        }
+        iTermCharacterBuffer *packed =
+        [[iTermCharacterBuffer alloc] initWithCodes:codes
+                                               runs:iTermRealloc(runs, numberOfRuns, sizeof(*runs))
+                                       numberOfRuns:numberOfRuns
+                                               size:_size];
+        [self setCompactCopy:packed length:length];
+        return packed;
+    }
+}
+
+- (iTermCharacterBuffer *)spilledCopyToFile:(iTermScrollbackSpillFile *)file
+                           preservingLength:(int)length {
+    @synchronized(self) {
+        length = MAX(0, MIN(length, _size));
+        if (_size == 0) {
+            return nil;
+        }
+        long long offset = _spillOffset;
+        if (_spillFile != file) {
+            if (!_buffer && !_codes) {
+                // Spilled to some other file. Leave it there.
+                return nil;
+            }
+            const size_t usedBytes = (size_t)length * sizeof(screen_char_t);
+            const size_t unusedBytes = (size_t)(_size - length) * sizeof(screen_char_t);
+            if (_buffer) {
+                offset = [file appendBytes:_buffer length:usedBytes zeroPadding:unusedBytes];
+            } else {
+                screen_char_t *temp = iTermMalloc((size_t)_size * sizeof(screen_char_t));
+                [self expandInto:temp];
+                offset = [file appendBytes:temp length:usedBytes zeroPadding:unusedBytes];
+                free(temp);
+            }
+            if (offset < 0) {
+                return nil;
+            }
+            if (_buffer) {
+                // Remember the record so spilling again after the next read is free. Unused space
+                // in the record is zeros, unlike ours, which is fine because it's unused.
+                _spillFile = file;
+                _spillOffset = offset;
+            }
+        }
+        iTermCharacterBuffer *spilled = [[iTermCharacterBuffer alloc] initWithSpillFile:file
+                                                                                 offset:offset
+                                                                                   size:_size];
+        [self setCompactCopy:spilled length:length];
+        return spilled;
+    }
+}
+
+- (void)setCompactCopy:(iTermCharacterBuffer *)copy length:(int)length {
+    _compactCopy = copy;
+    _compactCopyLength = length;
+    _hasCompactCopy = YES;
+}
+
+- (iTermCharacterBuffer *)existingCompactCopyPreservingLength:(int)length {
+    @synchronized(self) {
+        if (!_buffer) {
+            if (!_readCache) {
+                return nil;
+            }
+            // Still compact underneath. A copy without the read cache is free to make.
+            iTermCharacterBuffer *copy = _compactCopy ?: [self compactClone];
+            [self setCompactCopy:copy length:_size];
+            return copy;
+        }
+        if (!_hasCompactCopy || _compactCopyLength < MIN(length, _size)) {
+            return nil;
+        }
+        return _compactCopy;
+    }
+}
+
+// The contents are about to change, so what was learned by packing or spilling them no longer
+// applies.
+- (void)contentsWillChange {
+    if (!_hasCompactCopy && !_incompressible && !_spillFile) {
+        return;
+    }
+    @synchronized(self) {
+        _compactCopy = nil;
+        _hasCompactCopy = NO;
+        _incompressible = NO;
+        // A mapped buffer stays valid; the mapping is private.
+        _spillFile = nil;
+    }
+}
+
+// Must be spilled.
+- (void)readSpilledCharactersInto:(screen_char_t *)destination {
+    if (![_spillFile readRecordAtOffset:_spillOffset
+                                 length:(size_t)_size * sizeof(screen_char_t)
+                                   into:destination]) {
+        DLog(@"Failed to read spilled characters. Leaving them blank.");
+        memset(destination, 0, (size_t)_size * sizeof(screen_char_t));
+    }
+}
+
+// Must be packed.
+- (void)expandInto:(screen_char_t *)destination {
+    for (int r = 0; r < _numberOfRuns; r++) {
+        const int start = _runs[r].start;
+        const int end = r + 1 < _numberOfRuns ? _runs[r + 1].start : _size;
+        const screen_char_t style = _runs[r].style;
+        for (int i = start; i < end; i++) {
+            destination[i] = style;
+            destination[i].code = _codes[i];
+        }
+    }
+}
+
+- (void)noteAccess {
+    const int now = __atomic_load_n(&gAccessClock, __ATOMIC_RELAXED);
+    if (__atomic_load_n(&_lastAccess, __ATOMIC_RELAXED) != now) {
+        __atomic_store_n(&_lastAccess, now, __ATOMIC_RELAXED);
+    }
+}
+
+// Must be packed or spilled and hold the lock. Returns a new copy of the characters, which is a
+// mapping of the spill file if `mapped` is set on return.
+- (screen_char_t *)expandedCharactersMapped:(BOOL *)mapped {
+    *mapped = NO;
+    if (_spillFile) {
+        screen_char_t *buffer = [_spillFile mapRecordAtOffset:_spillOffset length:(size_t)_size * sizeof(screen_char_t)];
+        if (buffer) {
+            *mapped = YES;
+            return buffer;
+        }
+        buffer = iTermUninitializedCalloc(MAX(1, _size), sizeof(screen_char_t));
+        [self readSpilledCharactersInto:buffer];
+        return buffer;
+    }
+    screen_char_t *buffer = iTermUninitializedCalloc(MAX(1, _size), sizeof(screen_char_t));
+    [self expandInto:buffer];
+    return buffer;
+}
+
+// Converts a packed or spilled buffer to plain storage so it can be modified, reusing the read
+// cache if there is one. The buffer isn't shared at this point, but other threads may still ask
+// whether it's packed, so the storage is swapped under the lock.
+- (screen_char_t *)materializeForWriting {
+    [self noteAccess];
+    screen_char_t *buffer = __atomic_load_n(&_buffer, __ATOMIC_ACQUIRE);
+    if (buffer) {
+        return buffer;
+    }
+    @synchronized(self) {
+        if (_buffer) {
+            return _buffer;
+        }
+        BOOL mapped = _readCacheIsMapped;
+        buffer = _readCache ?: [self expandedCharactersMapped:&mapped];
+        _bufferIsMapped = mapped;
+        __atomic_store_n(&_readCache, NULL, __ATOMIC_RELEASE);
+        _readCacheIsMapped = NO;
+        // Keep _spillFile. It's still a copy of our characters until they change.
+        free(_codes);
+        _codes = NULL;
+        free(_runs);
+        _runs = NULL;
+        _numberOfRuns = 0;
+        __atomic_store_n(&_buffer, buffer, __ATOMIC_RELEASE);
+        return buffer;
+    }
 }
 
 - (BOOL)deepIsEqual:(id)object {
@@ -86,7 +510,7 @@
     if (!other) {
         return NO;
     }
-    return _size == other->_size && !memcmp(_buffer, other->_buffer, _size * sizeof(screen_char_t));
+    return _size == other->_size && !memcmp(self.pointer, other.pointer, _size * sizeof(screen_char_t));
 }
 
 @end
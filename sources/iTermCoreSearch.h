@@ -8,6 +8,7 @@
 #import <Foundation/Foundation.h>
 #import "FindContext.h"
 #import "LineBufferHelpers.h"
+#import "ScreenChar.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -21,4 +22,31 @@ typedef struct {
 
 NSArray<ResultRange *> *CoreSearch(const CoreSearchRequest *request);
 
+// A substring query prepared for CoreScreenCharSearch(). Prepare it once per search rather than
+// once per line.
+typedef struct {
+    // Lowercased if caseInsensitive.
+    unichar *characters;
+    int length;
+    BOOL caseInsensitive;
+    BOOL backwards;
+} CoreScreenCharNeedle;
+
+// Returns NO if the query can't be searched for with CoreScreenCharSearch(): regexes, empty
+// queries, and queries with anything but printable ASCII. Otherwise, release it with
+// CoreScreenCharNeedleFree().
+BOOL CoreScreenCharNeedleInit(CoreScreenCharNeedle *needle,
+                              NSString *query,
+                              FindOptions options,
+                              iTermFindMode mode);
+void CoreScreenCharNeedleFree(CoreScreenCharNeedle *needle);
+
+// Searches cells directly, without converting them to a string. Gives the same results as
+// CoreSearch() would for the same line. Returns nil if the line has anything but plain ASCII
+// cells (complex characters, images, double-width or tab filler cells, or non-ASCII code points),
+// since case, diacritic, and width folding could then apply; use CoreSearch() for those.
+NSArray<ResultRange *> * _Nullable CoreScreenCharSearch(const CoreScreenCharNeedle *needle,
+                                                        const screen_char_t *haystack,
+                                                        int length);
+
 NS_ASSUME_NONNULL_END
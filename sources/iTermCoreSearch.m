@@ -8,6 +8,7 @@
 #import "iTermCoreSearch.h"
 #import "DebugLogging.h"
 #import "iTermCache.h"
+#import "iTermMalloc.h"
 #import "NSArray+iTerm.h"
 #import "RegexKitLite.h"
 #import "ScreenChar.h"
@@ -189,6 +190,137 @@ NSArray<ResultRange *> *CoreSearch(const CoreSearchRequest *request) {
     }
 }
 
+#pragma mark - Searching cells directly
+
+BOOL CoreScreenCharNeedleInit(CoreScreenCharNeedle *needle,
+                              NSString *query,
+                              FindOptions options,
+                              iTermFindMode mode) {
+    memset(needle, 0, sizeof(*needle));
+    if (iTermFilterModeIsRegularExpression(mode)) {
+        return NO;
+    }
+    const NSInteger length = query.length;
+    if (length == 0 || length > INT_MAX) {
+        return NO;
+    }
+    unichar *characters = iTermMalloc(length * sizeof(unichar));
+    [query getCharacters:characters range:NSMakeRange(0, length)];
+    BOOL hasUppercase = NO;
+    for (NSInteger i = 0; i < length; i++) {
+        const unichar c = characters[i];
+        if (c < ' ' || c > '~') {
+            free(characters);
+            return NO;
+        }
+        if (c >= 'A' && c <= 'Z') {
+            hasUppercase = YES;
+        }
+    }
+    // Must agree with CoreSubstringSearch().
+    BOOL caseInsensitive = (mode == iTermFindModeCaseInsensitiveSubstring);
+    if (mode == iTermFindModeSmartCaseSensitivity && !hasUppercase) {
+        caseInsensitive = YES;
+    }
+    if (caseInsensitive) {
+        for (NSInteger i = 0; i < length; i++) {
+            characters[i] = tolower(characters[i]);
+        }
+    }
+    needle->characters = characters;
+    needle->length = (int)length;
+    needle->caseInsensitive = caseInsensitive;
+    needle->backwards = !!(options & FindOptBackwards);
+    return YES;
+}
+
+void CoreScreenCharNeedleFree(CoreScreenCharNeedle *needle) {
+    free(needle->characters);
+    needle->characters = NULL;
+}
+
+// Plain ASCII cells convert to exactly one unichar with the same value, so string indices and cell
+// indices coincide and there's nothing for case-insensitive search to fold except ASCII letters.
+NS_INLINE BOOL CoreScreenCharIsPlainASCII(const screen_char_t *c) {
+    return (c->code < 0x80 &&
+            !c->complexChar &&
+            !c->image &&
+            !(c->code >= ITERM2_PRIVATE_BEGIN && c->code <= ITERM2_PRIVATE_END));
+}
+
+NS_INLINE unichar CoreScreenCharFoldedCode(const screen_char_t *c, BOOL caseInsensitive) {
+    const unichar code = c->code;
+    if (caseInsensitive && code >= 'A' && code <= 'Z') {
+        return code + ('a' - 'A');
+    }
+    return code;
+}
+
+NS_INLINE BOOL CoreScreenCharMatchesAt(const CoreScreenCharNeedle *needle,
+                                       const screen_char_t *haystack,
+                                       int i) {
+    // The first character was already checked by the caller.
+    for (int j = 1; j < needle->length; j++) {
+        if (CoreScreenCharFoldedCode(&haystack[i + j], needle->caseInsensitive) != needle->characters[j]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+NSArray<ResultRange *> *CoreScreenCharSearch(const CoreScreenCharNeedle *needle,
+                                             const screen_char_t *haystack,
+                                             int length) {
+    // Check everything up front. A single non-ASCII cell anywhere could match under folding, so
+    // a line can't be partially searched this way.
+    for (int i = 0; i < length; i++) {
+        if (!CoreScreenCharIsPlainASCII(&haystack[i])) {
+            return nil;
+        }
+    }
+    const int n = needle->length;
+    if (length < n) {
+        return @[];
+    }
+    // Filter on the first character and only compare the rest where it matches. Like
+    // -it_rangesOfString:options:, matches don't overlap and backwards searches find them from the
+    // end of the line.
+    const unichar first = needle->characters[0];
+    const BOOL caseInsensitive = needle->caseInsensitive;
+    NSMutableArray<ResultRange *> *results = nil;
+    if (needle->backwards) {
+        int i = length - n;
+        while (i >= 0) {
+            if (CoreScreenCharFoldedCode(&haystack[i], caseInsensitive) == first &&
+                CoreScreenCharMatchesAt(needle, haystack, i)) {
+                if (!results) {
+                    results = [NSMutableArray array];
+                }
+                [results addObject:[[ResultRange alloc] initWithPosition:i length:n]];
+                i -= n;
+            } else {
+                i -= 1;
+            }
+        }
+    } else {
+        const int limit = length - n;
+        int i = 0;
+        while (i <= limit) {
+            if (CoreScreenCharFoldedCode(&haystack[i], caseInsensitive) == first &&
+                CoreScreenCharMatchesAt(needle, haystack, i)) {
+                if (!results) {
+                    results = [NSMutableArray array];
+                }
+                [results addObject:[[ResultRange alloc] initWithPosition:i length:n]];
+                i += n;
+            } else {
+                i += 1;
+            }
+        }
+    }
+    return results ?: @[];
+}
+
 @implementation NSString(CoreSearchAdditions)
 
 - (NSArray<NSValue *> *)it_rangesOfString:(NSString *)needle
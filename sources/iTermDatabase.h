@@ -47,6 +47,9 @@ withNonOptionalArguments:(NSArray *)arguments
 - (void)commit;
 - (void)rollback;
 
+// Keep statements prepared for reuse when the same SQL is executed again.
+@property (nonatomic) BOOL shouldCacheStatements;
+
 // If set the timeout handler will be called and can return YES to erase the db when it takes
 // too long to initialize or NO to keep trying.
 @property (nonatomic, copy) BOOL (^timeoutHandler)(void);
@@ -365,6 +365,14 @@ typedef enum {
     return [_db lastError];
 }
 
+- (BOOL)shouldCacheStatements {
+    return _db.shouldCacheStatements;
+}
+
+- (void)setShouldCacheStatements:(BOOL)shouldCacheStatements {
+    _db.shouldCacheStatements = shouldCacheStatements;
+}
+
 - (void)beginDeferredTransaction {
     [_db beginDeferredTransaction];
 }
@@ -22,6 +22,9 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)setObject:(id _Nullable)obj forKeyedSubscript:(NSString *)key;
 - (void)setObject:(id _Nullable)obj forKey:(NSString *)key;
 - (void)mergeDictionary:(NSDictionary *)dictionary;
+// Merges a big dictionary that the graph database stores once rather than on every save that
+// touches this node. Other encoders merge it like any other dictionary.
+- (BOOL)mergeBlob:(NSDictionary *)dictionary;
 
 - (BOOL)encodePropertyList:(id)plist withKey:(NSString *)key;
 
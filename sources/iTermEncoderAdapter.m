@@ -83,6 +83,10 @@
     [_encoder mergeDictionary:dictionary];
 }
 
+- (BOOL)mergeBlob:(NSDictionary *)dictionary {
+    return [_encoder mergeBlob:dictionary];
+}
+
 @end
 
 @implementation iTermMutableDictionaryEncoderAdapter
@@ -180,4 +184,9 @@
     }];
 }
 
+- (BOOL)mergeBlob:(NSDictionary *)dictionary {
+    [self mergeDictionary:dictionary];
+    return YES;
+}
+
 @end
@@ -12,6 +12,14 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class iTermChangeTrackingDictionary;
 
+// The POD key under which a record names the blob merged into it.
+extern NSString *const iTermEncoderGraphRecordBlobKey;
+
+// Provides blobs that have already been written out so records don't have to keep them in memory.
+@protocol iTermGraphBlobStore<NSObject>
+- (NSData * _Nullable)dataForBlobWithIdentifier:(NSString *)identifier;
+@end
+
 @interface iTermEncoderGraphRecord: NSObject
 @property (nonatomic, readonly) NSDictionary<NSString *, id> *pod;
 @property (nonatomic, readonly) NSArray<iTermEncoderGraphRecord *> *graphRecords;
@@ -24,6 +32,15 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, readonly) NSData *data;  // encoded pod
 @property (nonatomic, readonly) NSString *compactDescription;
 
+// Non-nil if a dictionary was merged in with -[iTermGraphEncoder mergeBlob:].
+// Only the identifier is part of `pod` and `data`; the blob itself is stored separately and merged
+// back in by propertyListValue, loading it from blobStore the first time it is needed. If the blob
+// can't be loaded the record can't be decoded and propertyListValue is nil.
+@property (nullable, nonatomic, readonly) NSString *blobIdentifier;
+// Archived dictionary. Nil after it has been saved, after which blobStore provides it.
+@property (nullable, atomic, strong) NSData *blobData;
+@property (nullable, atomic, weak) id<iTermGraphBlobStore> blobStore;
+
 + (instancetype)withPODs:(NSDictionary<NSString *, id> *)pod
                   graphs:(NSArray<iTermEncoderGraphRecord *> *)graphRecords
               generation:(NSInteger)generation
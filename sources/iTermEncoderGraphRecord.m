@@ -15,6 +15,8 @@
 #import "NSDictionary+iTerm.h"
 #import "NSObject+iTerm.h"
 
+NSString *const iTermEncoderGraphRecordBlobKey = @"__blob";
+
 @implementation iTermEncoderGraphRecord {
     NSMutableDictionary<iTermTuple<NSString *, NSString *> *, iTermEncoderGraphRecord *> *_index;
 }
@@ -56,6 +58,35 @@
     return self;
 }
 
+- (NSString *)blobIdentifier {
+    return [NSString castFrom:_pod[iTermEncoderGraphRecordBlobKey]];
+}
+
+// The POD with the blob, if any, merged in. Nil if the blob is missing (e.g., the database was
+// invalidated or a save was lost) or can't be unarchived. The record then can't be decoded, and
+// its value is nil rather than whatever was stored inline.
+- (NSDictionary<NSString *, id> *)resolvedPOD {
+    NSString *blobIdentifier = self.blobIdentifier;
+    if (!blobIdentifier) {
+        return self.pod;
+    }
+    NSData *data = self.blobData ?: [self.blobStore dataForBlobWithIdentifier:blobIdentifier];
+    if (!data) {
+        DLog(@"Missing blob %@ for %@", blobIdentifier, self.compactDescription);
+        return nil;
+    }
+    NSError *error = nil;
+    NSDictionary *blob = [NSDictionary castFrom:[data it_unarchivedObjectOfBasicClassesWithError:&error]];
+    if (!blob) {
+        DLog(@"Failed to unarchive blob %@ for %@: %@", blobIdentifier, self.compactDescription, error);
+        return nil;
+    }
+    NSMutableDictionary<NSString *, id> *result = [self.pod mutableCopy];
+    [result removeObjectForKey:iTermEncoderGraphRecordBlobKey];
+    [result it_mergeFrom:blob];
+    return result;
+}
+
 - (void)dump {
     [self dumpWithIndent:@""];
 }
@@ -281,10 +312,11 @@
 
 - (NSDictionary *)dictionaryValue {
     assert([self.key isEqualToString:@"__dict"]);
-    if (self.graphRecords.count == 0) {
-        return self.pod;
+    NSDictionary *pod = self.resolvedPOD;
+    if (self.graphRecords.count == 0 || !pod) {
+        return pod;
     }
-    NSMutableDictionary *dict = [self.pod mutableCopy];
+    NSMutableDictionary *dict = [pod mutableCopy];
     for (iTermEncoderGraphRecord *graph in self.graphRecords) {
         if ([graph.key isEqualToString:@"__array"] || [graph.key isEqualToString:@"__dict"]) {
             dict[graph.identifier] = graph.propertyListValue;
@@ -298,10 +330,11 @@
 // Was not originally encoded as a dictionary, but we can make one from it nonetheless.
 // This is meant as a fallback and may lose information because it ignores identifiers.
 - (NSDictionary *)implicitDictionaryValue {
-    if (self.graphRecords.count == 0) {
-        return self.pod;
+    NSDictionary *pod = self.resolvedPOD;
+    if (self.graphRecords.count == 0 || (!pod && self.blobIdentifier)) {
+        return pod;
     }
-    NSMutableDictionary *result = [self.pod ?: @{} mutableCopy];
+    NSMutableDictionary *result = [pod ?: @{} mutableCopy];
     [self.graphRecords enumerateObjectsUsingBlock:^(iTermEncoderGraphRecord * _Nonnull child,
                                                     NSUInteger idx,
                                                     BOOL * _Nonnull stop) {
@@ -325,7 +358,7 @@
         return nil;
     }
     if (self.graphRecords.count == 0) {
-        return self.pod;
+        return self.resolvedPOD;
     }
     if ([self.key isEqualToString:@"__dict"]) {
         return [self dictionaryValue];
@@ -0,0 +1,56 @@
+//
+//  iTermFileDescriptorMonitor.h
+//  iTerm2
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Waits for file descriptors to become ready on behalf of TaskNotifier. Each iteration of its
+// loop declares the complete set of interests, calls -wait, and then queries readiness.
+//
+// An owner accompanies each interest. It identifies who the fd belongs to so that a closed fd
+// that gets reused by someone else is noticed even though its number doesn't change. It is
+// compared by pointer and not retained.
+@interface iTermFileDescriptorMonitor : NSObject
+
+// "select" or "kqueue", for debug logs.
+@property (nonatomic, readonly) NSString *name;
+
+// If set, a readable fd is reported once per arrival of new data rather than on every -wait
+// until it's drained. It's then safe to keep read interest in an fd while another thread reads
+// from it.
+@property (nonatomic, readonly) BOOL readsAreEdgeTriggered;
+
+// Returns a kqueue-based monitor if `preferKqueue` is set and a kqueue can be created, otherwise
+// one based on select(). `wakeupFileDescriptor` is the read end of a non-blocking self-pipe.
+// It's always monitored, and -wait drains it.
++ (instancetype)monitorWithWakeupFileDescriptor:(int)wakeupFileDescriptor
+                                   preferKqueue:(BOOL)preferKqueue;
+
+// Call these before each -wait. Interests do not carry over from the previous iteration.
+- (void)beginUpdate;
+- (void)addReadInterest:(int)fd owner:(id)owner;
+- (void)addWriteInterest:(int)fd owner:(id)owner;
+- (void)addErrorInterest:(int)fd owner:(id)owner;
+
+// Blocks until a file descriptor of interest is ready or the wakeup pipe is written to. Returns
+// NO if waiting failed, in which case the loop should start over.
+- (BOOL)wait;
+
+// Valid after -wait returns YES.
+- (BOOL)isReadable:(int)fd;
+- (BOOL)isWritable:(int)fd;
+- (BOOL)hasError:(int)fd;
+
+// Call after reading from a readable fd. Reads are edge-triggered in the kqueue monitor, so a
+// read that leaves data behind would otherwise not be reported again until more arrives.
+// Thread-safe, so it may be called by the parser pool before it unblocks TaskNotifier.
+- (void)didReadFromFileDescriptor:(int)fd;
+
+@end
+
+NS_ASSUME_NONNULL_END
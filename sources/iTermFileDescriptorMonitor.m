@@ -0,0 +1,478 @@
+//
+//  iTermFileDescriptorMonitor.m
+//  iTerm2
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermFileDescriptorMonitor.h"
+
+#import "DebugLogging.h"
+
+#include <os/lock.h>
+#include <poll.h>
+#include <sys/event.h>
+#include <sys/select.h>
+
+// Reads the nonblocking wakeup pipe until it is empty, it is closed, or it fails for any reason
+// other than a signal.
+static void iTermFileDescriptorMonitorDrain(int fd) {
+    char dummy[32];
+    ssize_t n;
+    do {
+        n = read(fd, dummy, sizeof(dummy));
+    } while (n > 0 || (n < 0 && errno == EINTR));
+}
+
+#pragma mark - select
+
+// Rebuilds fd_sets on each iteration. The kernel scans every fd up to the highest one on each
+// call, and fds at or above FD_SETSIZE can't be monitored at all.
+@interface iTermSelectFileDescriptorMonitor : iTermFileDescriptorMonitor
+- (instancetype)initWithWakeupFileDescriptor:(int)wakeupFileDescriptor;
+@end
+
+@implementation iTermSelectFileDescriptorMonitor {
+    int _wakeupFileDescriptor;
+    int _highfd;
+    fd_set _rfds;
+    fd_set _wfds;
+    fd_set _efds;
+}
+
+- (instancetype)initWithWakeupFileDescriptor:(int)wakeupFileDescriptor {
+    self = [super init];
+    if (self) {
+        _wakeupFileDescriptor = wakeupFileDescriptor;
+        [self beginUpdate];
+    }
+    return self;
+}
+
+- (NSString *)name {
+    return @"select";
+}
+
+- (BOOL)readsAreEdgeTriggered {
+    return NO;
+}
+
+- (void)beginUpdate {
+    FD_ZERO(&_rfds);
+    FD_ZERO(&_wfds);
+    FD_ZERO(&_efds);
+    _highfd = _wakeupFileDescriptor;
+    FD_SET(_wakeupFileDescriptor, &_rfds);
+}
+
+- (void)add:(int)fd to:(fd_set *)fdSet {
+    if (fd < 0 || fd >= FD_SETSIZE) {
+        return;
+    }
+    _highfd = MAX(_highfd, fd);
+    FD_SET(fd, fdSet);
+}
+
+- (void)addReadInterest:(int)fd owner:(id)owner {
+    [self add:fd to:&_rfds];
+}
+
+- (void)addWriteInterest:(int)fd owner:(id)owner {
+    [self add:fd to:&_wfds];
+}
+
+- (void)addErrorInterest:(int)fd owner:(id)owner {
+    [self add:fd to:&_efds];
+}
+
+- (BOOL)wait {
+    // If the file descriptor is closed in the main thread there's a race where sometimes you'll
+    // get an EBADF.
+    if (select(_highfd + 1, &_rfds, &_wfds, &_efds, NULL) <= 0) {
+        return NO;
+    }
+    if (FD_ISSET(_wakeupFileDescriptor, &_rfds)) {
+        iTermFileDescriptorMonitorDrain(_wakeupFileDescriptor);
+    }
+    return YES;
+}
+
+- (BOOL)isSet:(int)fd in:(fd_set *)fdSet {
+    return fd >= 0 && fd < FD_SETSIZE && FD_ISSET(fd, fdSet);
+}
+
+- (BOOL)isReadable:(int)fd {
+    return [self isSet:fd in:&_rfds];
+}
+
+- (BOOL)isWritable:(int)fd {
+    return [self isSet:fd in:&_wfds];
+}
+
+- (BOOL)hasError:(int)fd {
+    return [self isSet:fd in:&_efds];
+}
+
+- (void)didReadFromFileDescriptor:(int)fd {
+}
+
+@end
+
+#pragma mark - kqueue
+
+typedef struct {
+    // Owners of this iteration's interests. NULL for no interest.
+    const void *wantedRead;
+    const void *wantedWrite;
+    BOOL wantsError;
+
+    // Owners of the filters registered with the kqueue.
+    const void *registeredRead;
+    const void *registeredWrite;
+} iTermKqueueSlot;
+
+// Registrations persist across iterations, so each -wait only tells the kernel about interests
+// that changed and only hears back about fds that are ready. Reads use EV_CLEAR, so an fd is
+// reported once per arrival of new data rather than on every wait until it's drained. Writes are
+// level-triggered because interest in them is dropped as soon as the write buffer empties.
+@interface iTermKqueueFileDescriptorMonitor : iTermFileDescriptorMonitor
+- (nullable instancetype)initWithWakeupFileDescriptor:(int)wakeupFileDescriptor;
+@end
+
+@implementation iTermKqueueFileDescriptorMonitor {
+    int _kq;
+    int _wakeupFileDescriptor;
+
+    // Indexed by fd.
+    iTermKqueueSlot *_slots;
+    int _numberOfSlots;
+
+    NSMutableIndexSet *_wantedFds;
+    NSMutableIndexSet *_registeredFds;
+
+    struct kevent *_changes;
+    int _changesCapacity;
+    struct kevent _events[256];
+
+    NSMutableIndexSet *_readable;
+    NSMutableIndexSet *_writable;
+    NSMutableIndexSet *_errors;
+
+    // Fds that still had data after a read. Reported as readable by the next -wait.
+    os_unfair_lock _pendingLock;
+    NSMutableIndexSet *_pendingReads;  // Guarded by _pendingLock
+}
+
+- (instancetype)initWithWakeupFileDescriptor:(int)wakeupFileDescriptor {
+    self = [super init];
+    if (self) {
+        _kq = kqueue();
+        if (_kq < 0) {
+            DLog(@"kqueue() failed: %s", strerror(errno));
+            [self release];
+            return nil;
+        }
+        fcntl(_kq, F_SETFD, FD_CLOEXEC);
+        _wakeupFileDescriptor = wakeupFileDescriptor;
+        struct kevent change;
+        EV_SET(&change, wakeupFileDescriptor, EVFILT_READ, EV_ADD, 0, 0, NULL);
+        if (kevent(_kq, &change, 1, NULL, 0, NULL) < 0) {
+            DLog(@"Failed to register wakeup pipe with kqueue: %s", strerror(errno));
+            [self release];
+            return nil;
+        }
+        _wantedFds = [[NSMutableIndexSet alloc] init];
+        _registeredFds = [[NSMutableIndexSet alloc] init];
+        _readable = [[NSMutableIndexSet alloc] init];
+        _writable = [[NSMutableIndexSet alloc] init];
+        _errors = [[NSMutableIndexSet alloc] init];
+        _pendingLock = OS_UNFAIR_LOCK_INIT;
+        _pendingReads = [[NSMutableIndexSet alloc] init];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_kq >= 0) {
+        close(_kq);
+    }
+    free(_slots);
+    free(_changes);
+    [_wantedFds release];
+    [_registeredFds release];
+    [_readable release];
+    [_writable release];
+    [_errors release];
+    [_pendingReads release];
+    [super dealloc];
+}
+
+- (NSString *)name {
+    return @"kqueue";
+}
+
+- (BOOL)readsAreEdgeTriggered {
+    return YES;
+}
+
+- (iTermKqueueSlot *)slotForFileDescriptor:(int)fd {
+    if (fd >= _numberOfSlots) {
+        const int newCount = MAX(fd + 1, MAX(64, _numberOfSlots * 2));
+        _slots = realloc(_slots, sizeof(*_slots) * newCount);
+        memset(_slots + _numberOfSlots, 0, sizeof(*_slots) * (newCount - _numberOfSlots));
+        _numberOfSlots = newCount;
+    }
+    return &_slots[fd];
+}
+
+- (void)beginUpdate {
+    [_wantedFds enumerateIndexesUsingBlock:^(NSUInteger fd, BOOL *stop) {
+        iTermKqueueSlot *slot = &_slots[fd];
+        slot->wantedRead = NULL;
+        slot->wantedWrite = NULL;
+        slot->wantsError = NO;
+    }];
+    [_wantedFds removeAllIndexes];
+}
+
+- (void)addReadInterest:(int)fd owner:(id)owner {
+    if (fd < 0) {
+        return;
+    }
+    [self slotForFileDescriptor:fd]->wantedRead = owner;
+    [_wantedFds addIndex:fd];
+}
+
+- (void)addWriteInterest:(int)fd owner:(id)owner {
+    if (fd < 0) {
+        return;
+    }
+    [self slotForFileDescriptor:fd]->wantedWrite = owner;
+    [_wantedFds addIndex:fd];
+}
+
+- (void)addErrorInterest:(int)fd owner:(id)owner {
+    if (fd < 0) {
+        return;
+    }
+    [self slotForFileDescriptor:fd]->wantsError = YES;
+    [_wantedFds addIndex:fd];
+}
+
+- (void)appendChange:(int)fd filter:(int16_t)filter flags:(uint16_t)flags count:(int *)count {
+    if (*count == _changesCapacity) {
+        _changesCapacity = MAX(64, _changesCapacity * 2);
+        _changes = realloc(_changes, sizeof(*_changes) * _changesCapacity);
+    }
+    EV_SET(&_changes[*count], fd, filter, flags | EV_RECEIPT, 0, 0, NULL);
+    *count += 1;
+}
+
+// Brings the kqueue's registrations in line with this iteration's interests.
+- (void)applyChanges {
+    NSMutableIndexSet *fds = [[_wantedFds mutableCopy] autorelease];
+    [fds addIndexes:_registeredFds];
+
+    __block int count = 0;
+    [fds enumerateIndexesUsingBlock:^(NSUInteger i, BOOL *stop) {
+        const int fd = (int)i;
+        iTermKqueueSlot *slot = &_slots[fd];
+        // A different owner means the fd was closed and reused. Closing it removed the old
+        // registration, so add it again.
+        if (slot->wantedRead != slot->registeredRead) {
+            [self appendChange:fd
+                        filter:EVFILT_READ
+                         flags:slot->wantedRead ? (EV_ADD | EV_CLEAR) : EV_DELETE
+                         count:&count];
+            slot->registeredRead = slot->wantedRead;
+        }
+        if (slot->wantedWrite != slot->registeredWrite) {
+            [self appendChange:fd
+                        filter:EVFILT_WRITE
+                         flags:slot->wantedWrite ? EV_ADD : EV_DELETE
+                         count:&count];
+            slot->registeredWrite = slot->wantedWrite;
+        }
+        if (slot->registeredRead || slot->registeredWrite) {
+            [_registeredFds addIndex:fd];
+        } else {
+            [_registeredFds removeIndex:fd];
+        }
+    }];
+    if (count == 0) {
+        return;
+    }
+
+    // With EV_RECEIPT every change gets an EV_ERROR entry back in place, so a failure doesn't
+    // prevent the rest from being applied.
+    const int n = kevent(_kq, _changes, count, _changes, count, NULL);
+    for (int i = 0; i < n; i++) {
+        const struct kevent *receipt = &_changes[i];
+        if (!(receipt->flags & EV_ERROR) || receipt->data == 0) {
+            continue;
+        }
+        // Deleting fails harmlessly if the fd was already closed. Adding fails if it was closed
+        // before the change could be made; the owner will drop it once it notices.
+        const int fd = (int)receipt->ident;
+        DLog(@"kevent change for fd %d filter %d failed: %s",
+             fd, (int)receipt->filter, strerror((int)receipt->data));
+        if (fd < _numberOfSlots) {
+            if (receipt->filter == EVFILT_READ) {
+                _slots[fd].registeredRead = NULL;
+            } else if (receipt->filter == EVFILT_WRITE) {
+                _slots[fd].registeredWrite = NULL;
+            }
+        }
+    }
+}
+
+- (BOOL)wait {
+    [_readable removeAllIndexes];
+    [_writable removeAllIndexes];
+    [_errors removeAllIndexes];
+
+    [self applyChanges];
+
+    // Reads left unfinished are reported again without waiting. Those no longer of interest are
+    // dropped: re-adding a filter checks for data already present.
+    os_unfair_lock_lock(&_pendingLock);
+    [_pendingReads enumerateIndexesUsingBlock:^(NSUInteger fd, BOOL *stop) {
+        if (fd < _numberOfSlots && _slots[fd].wantedRead) {
+            [_readable addIndex:fd];
+        }
+    }];
+    [_pendingReads removeAllIndexes];
+    os_unfair_lock_unlock(&_pendingLock);
+
+    const struct timespec zero = { 0, 0 };
+    const int n = kevent(_kq,
+                         NULL,
+                         0,
+                         _events,
+                         sizeof(_events) / sizeof(*_events),
+                         _readable.count > 0 ? &zero : NULL);
+    if (n < 0) {
+        return _readable.count > 0;
+    }
+    for (int i = 0; i < n; i++) {
+        const struct kevent *event = &_events[i];
+        const int fd = (int)event->ident;
+        if (fd == _wakeupFileDescriptor) {
+            iTermFileDescriptorMonitorDrain(fd);
+            continue;
+        }
+        if (fd >= _numberOfSlots) {
+            continue;
+        }
+        const iTermKqueueSlot *slot = &_slots[fd];
+        if (event->flags & EV_ERROR) {
+            if (slot->wantsError) {
+                [_errors addIndex:fd];
+            }
+            continue;
+        }
+        // EOF is reported as readable. The read will find it.
+        if (event->filter == EVFILT_READ && slot->wantedRead) {
+            [_readable addIndex:fd];
+        } else if (event->filter == EVFILT_WRITE && slot->wantedWrite) {
+            [_writable addIndex:fd];
+        }
+    }
+    return YES;
+}
+
+- (BOOL)isReadable:(int)fd {
+    return fd >= 0 && [_readable containsIndex:fd];
+}
+
+- (BOOL)isWritable:(int)fd {
+    return fd >= 0 && [_writable containsIndex:fd];
+}
+
+- (BOOL)hasError:(int)fd {
+    return fd >= 0 && [_errors containsIndex:fd];
+}
+
+- (void)didReadFromFileDescriptor:(int)fd {
+    if (fd < 0) {
+        return;
+    }
+    // FIONREAD on a pty master reports the wrong queue, so ask poll() instead.
+    struct pollfd pfd = { .fd = fd, .events = POLLIN, .revents = 0 };
+    if (poll(&pfd, 1, 0) <= 0 || !(pfd.revents & POLLIN)) {
+        return;
+    }
+    os_unfair_lock_lock(&_pendingLock);
+    [_pendingReads addIndex:fd];
+    os_unfair_lock_unlock(&_pendingLock);
+}
+
+@end
+
+#pragma mark - iTermFileDescriptorMonitor
+
+@implementation iTermFileDescriptorMonitor
+
++ (instancetype)monitorWithWakeupFileDescriptor:(int)wakeupFileDescriptor
+                                   preferKqueue:(BOOL)preferKqueue {
+    if (preferKqueue) {
+        iTermFileDescriptorMonitor *monitor =
+            [[[iTermKqueueFileDescriptorMonitor alloc] initWithWakeupFileDescriptor:wakeupFileDescriptor] autorelease];
+        if (monitor) {
+            return monitor;
+        }
+    }
+    return [[[iTermSelectFileDescriptorMonitor alloc] initWithWakeupFileDescriptor:wakeupFileDescriptor] autorelease];
+}
+
+- (NSString *)name {
+    [self doesNotRecognizeSelector:_cmd];
+    return nil;
+}
+
+- (BOOL)readsAreEdgeTriggered {
+    [self doesNotRecognizeSelector:_cmd];
+    return NO;
+}
+
+- (void)beginUpdate {
+    [self doesNotRecognizeSelector:_cmd];
+}
+
+- (void)addReadInterest:(int)fd owner:(id)owner {
+    [self doesNotRecognizeSelector:_cmd];
+}
+
+- (void)addWriteInterest:(int)fd owner:(id)owner {
+    [self doesNotRecognizeSelector:_cmd];
+}
+
+- (void)addErrorInterest:(int)fd owner:(id)owner {
+    [self doesNotRecognizeSelector:_cmd];
+}
+
+- (BOOL)wait {
+    [self doesNotRecognizeSelector:_cmd];
+    return NO;
+}
+
+- (BOOL)isReadable:(int)fd {
+    [self doesNotRecognizeSelector:_cmd];
+    return NO;
+}
+
+- (BOOL)isWritable:(int)fd {
+    [self doesNotRecognizeSelector:_cmd];
+    return NO;
+}
+
+- (BOOL)hasError:(int)fd {
+    [self doesNotRecognizeSelector:_cmd];
+    return NO;
+}
+
+- (void)didReadFromFileDescriptor:(int)fd {
+    [self doesNotRecognizeSelector:_cmd];
+}
+
+@end
@@ -8,6 +8,7 @@
 #import "iTermGlobalSearchEngine.h"
 
 #import "NSArray+iTerm.h"
+#import "NSDate+iTerm.h"
 
 #import "NSTimer+iTerm.h"
 #import "PTYSession.h"
@@ -15,15 +16,27 @@
 #import "VT100Screen.h"
 #import "VT100Screen+Search.h"
 #import "iTerm2SharedARC-Swift.h"
+#import "iTermAdvancedSettingsModel.h"
 #import "iTermGlobalSearchEngineCursor.h"
 #import "iTermGlobalSearchResult.h"
 #import "iTermTextExtractor.h"
 
+// In concurrent mode, how often results are collected from the cursors.
+static const NSTimeInterval iTermGlobalSearchEngineConcurrentBatchInterval = 1.0 / 30.0;
+
+// In concurrent mode, the most time spent on the main thread per batch. Cursors that don't get a
+// turn go first in the next batch.
+static const NSTimeInterval iTermGlobalSearchEngineConcurrentBatchBudget = 0.008;
+
 @implementation iTermGlobalSearchEngine {
     NSTimer *_timer;
     NSMutableArray<id<iTermGlobalSearchEngineCursorProtocol>> *_cursors;
-    NSUInteger _retiredLines;
-    NSUInteger _expectedLines;
+    // Searches run on a pool of background queues and the timer collects batches of results from
+    // every cursor that has some, instead of one cursor per tick.
+    BOOL _concurrent;
+    // Bytes scanned by cursors that have finished.
+    long long _retiredBytes;
+    long long _expectedBytes;
 }
 
 - (instancetype)initWithQuery:(NSString *)query
@@ -37,22 +50,26 @@
         _query = [query copy];
         _handler = [handler copy];
         _mode = mode;
+        _concurrent = [iTermAdvancedSettingsModel parallelizeGlobalSearch];
         __weak __typeof(self) weakSelf = self;
         _cursors = [[sessions mapWithBlock:^id(PTYSession *session) {
+            id<iTermGlobalSearchEngineCursorProtocol> result;
             if (session.isBrowserSession) {
-                iTermGlobalSearchEngineBrowserCursor *cursor = [[iTermGlobalSearchEngineBrowserCursor alloc] initWithQuery:query mode:mode session:session];
-                _expectedLines += 1000;
-                return cursor;
+                result = [[iTermGlobalSearchEngineBrowserCursor alloc] initWithQuery:query mode:mode session:session];
             } else {
-                iTermGlobalSearchEngineCursor *cursor = [[iTermGlobalSearchEngineCursor alloc] initWithQuery:query mode:mode session:session];
+                iTermGlobalSearchEngineCursor *cursor = [[iTermGlobalSearchEngineCursor alloc] initWithQuery:query
+                                                                                                          mode:mode
+                                                                                                       session:session
+                                                                                                    concurrent:_concurrent];
                 cursor.willPause = ^(iTermGlobalSearchEngineCursor *cursor) {
                     [weakSelf drain:cursor];
                 };
-                _expectedLines += cursor.expectedLines;
-                return cursor;
+                result = cursor;
             }
+            _expectedBytes += result.expectedBytes;
+            return result;
         }] mutableCopy];
-        _timer = [NSTimer scheduledWeakTimerWithTimeInterval:0
+        _timer = [NSTimer scheduledWeakTimerWithTimeInterval:_concurrent ? iTermGlobalSearchEngineConcurrentBatchInterval : 0
                                                       target:self
                                                     selector:@selector(searchMore:)
                                                     userInfo:nil
@@ -62,8 +79,7 @@
 }
 
 - (void)drain:(id<iTermGlobalSearchEngineCursorProtocol>)cursor {
-    [cursor drainFully:^(NSArray<id<iTermGlobalSearchResultProtocol>> *results, NSUInteger retired) {
-        _retiredLines += retired;
+    [cursor drainFully:^(NSArray<id<iTermGlobalSearchResultProtocol>> *results) {
         self.handler(cursor.session, results, [self progressIncludingCursor:cursor]);
     }];
 }
@@ -75,37 +91,81 @@
 }
 
 - (void)searchMore:(NSTimer *)timer {
+    if (_concurrent) {
+        [self consumeBatch];
+        return;
+    }
     id<iTermGlobalSearchEngineCursorProtocol> cursor = _cursors.firstObject;
     if (!cursor) {
         [self stop];
         return;
     }
     [_cursors removeObjectAtIndex:0];
-    const BOOL more = [cursor consumeAvailable:^(NSArray<id<iTermGlobalSearchResultProtocol>> *results, NSUInteger retired) {
-        _retiredLines += retired;
+    [self consumeFromCursor:cursor];
+    if (_cursors.count == 0) {
+        [self stop];
+    }
+}
+
+// Puts the cursor, or the one for its next pass, back at the end of _cursors unless it's done.
+- (void)consumeFromCursor:(id<iTermGlobalSearchEngineCursorProtocol>)cursor {
+    const BOOL more = [cursor consumeAvailable:^(NSArray<id<iTermGlobalSearchResultProtocol>> *results) {
         self.handler(cursor.session, results, [self progressIncludingCursor:cursor]);
     }];
     if (more) {
         [_cursors addObject:cursor];
         return;
     }
+    _retiredBytes += cursor.bytesSearched;
     cursor = [cursor instanceForNextPass];
     if (cursor) {
         [_cursors addObject:cursor];
+    }
+}
+
+// Collects results from every cursor whose background search has produced some, so each tick
+// delivers a batch from many sessions.
+- (void)consumeBatch {
+    if (_cursors.count == 0) {
+        [self stop];
         return;
     }
+    const NSTimeInterval deadline = [NSDate it_timeSinceBoot] + iTermGlobalSearchEngineConcurrentBatchBudget;
+    NSArray<id<iTermGlobalSearchEngineCursorProtocol>> *cursors = [_cursors copy];
+    [_cursors removeAllObjects];
+    BOOL reported = NO;
+    for (NSUInteger i = 0; i < cursors.count; i++) {
+        id<iTermGlobalSearchEngineCursorProtocol> cursor = cursors[i];
+        if (![cursor hasAvailableResults] || [NSDate it_timeSinceBoot] >= deadline) {
+            [_cursors addObject:cursor];
+            continue;
+        }
+        [self consumeFromCursor:cursor];
+        reported = YES;
+    }
     if (_cursors.count == 0) {
         [self stop];
+        return;
+    }
+    if (!reported) {
+        // Keep the progress indicator moving while blocks without matches are searched.
+        self.handler(_cursors.firstObject.session, @[], [self progressIncludingCursor:nil]);
     }
 }
 
 - (double)progressIncludingCursor:(id<iTermGlobalSearchEngineCursorProtocol>)additionalCursor {
-    double done = _retiredLines;
+    double done = _retiredBytes;
 
-    for (id<iTermGlobalSearchEngineCursorProtocol> cursor in [_cursors arrayByAddingObject:additionalCursor]) {
-        done += cursor.approximateLinesSearched;
+    for (id<iTermGlobalSearchEngineCursorProtocol> cursor in _cursors) {
+        done += cursor.bytesSearched;
+    }
+    if (additionalCursor && ![_cursors containsObject:additionalCursor]) {
+        done += additionalCursor.bytesSearched;
+    }
+    if (_expectedBytes <= 0) {
+        return 0;
     }
-    return MIN(1, MAX(0, done / _expectedLines));
+    return MIN(1, MAX(0, done / _expectedBytes));
 }
 
 @end
@@ -21,11 +21,15 @@ typedef NS_ENUM(NSUInteger, iTermGlobalSearchEngineCursorPass) {
 };
 
 @protocol iTermGlobalSearchEngineCursorProtocol<NSObject>
-- (void)drainFully:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *, NSUInteger))handler;
-- (BOOL)consumeAvailable:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *, NSUInteger))handler;
+- (void)drainFully:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *))handler;
+- (BOOL)consumeAvailable:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *))handler;
 - (PTYSession *)session;
 - (id<iTermGlobalSearchEngineCursorProtocol> _Nullable)instanceForNextPass;
-- (long long)approximateLinesSearched;
+// Is there anything to consume without waiting? Finishing counts.
+- (BOOL)hasAvailableResults;
+// Progress is measured in bytes of cells scanned. The expected bytes include later passes.
+- (long long)bytesSearched;
+- (long long)expectedBytes;
 @end
 
 @interface iTermGlobalSearchEngineCursor: NSObject<iTermGlobalSearchEngineCursorProtocol>
@@ -35,12 +39,15 @@ typedef NS_ENUM(NSUInteger, iTermGlobalSearchEngineCursorPass) {
 @property (nonatomic, copy) NSString *query;
 @property (nonatomic) iTermFindMode mode;
 @property (nonatomic) BOOL currentScreenIsAlternate;
-@property (nonatomic, readonly) long long expectedLines;
+@property (nonatomic, readonly) BOOL concurrent;
 @property (nonatomic, copy) void (^willPause)(iTermGlobalSearchEngineCursor *);
 
+// If concurrent is set, the search runs on a pool of queues shared with other concurrent cursors
+// so many sessions can be searched at once.
 - (instancetype)initWithQuery:(NSString *)query
                          mode:(iTermFindMode)mode
-                      session:(PTYSession *)session;
+                      session:(PTYSession *)session
+                   concurrent:(BOOL)concurrent;
 - (instancetype)init NS_UNAVAILABLE;
 
 @end
@@ -17,30 +17,36 @@
 @interface iTermGlobalSearchEngineCursor()<iTermSearchEngineDelegate>
 @end
 
+// Browser sessions don't report how much they've searched, so each counts as this much work.
+static const long long iTermGlobalSearchEngineBrowserCursorNominalBytes = 1000 * 80 * sizeof(screen_char_t);
+
 @implementation iTermGlobalSearchEngineCursor
 
 - (instancetype)initWithQuery:(NSString *)query
                          mode:(iTermFindMode)mode
-                      session:(PTYSession *)session {
+                      session:(PTYSession *)session
+                   concurrent:(BOOL)concurrent {
     iTermGlobalSearchEngineCursorPass pass;
     if (session.screen.showingAlternateScreen) {
         pass = iTermGlobalSearchEngineCursorPassMainScreen;
     } else {
         pass = iTermGlobalSearchEngineCursorPassCurrentScreen;
     }
-    return [self initWithQuery:query mode:mode session:session pass:pass];
+    return [self initWithQuery:query mode:mode session:session pass:pass concurrent:concurrent];
 }
 
 - (instancetype)initWithQuery:(NSString *)query
                          mode:(iTermFindMode)mode
                       session:(PTYSession *)session
-                         pass:(iTermGlobalSearchEngineCursorPass)pass {
+                         pass:(iTermGlobalSearchEngineCursorPass)pass
+                   concurrent:(BOOL)concurrent {
     self = [super init];
     if (self) {
         VT100Screen *screen = session.screen;
         iTermSearchEngine *searchEngine = [[iTermSearchEngine alloc] initWithDataSource:nil syncDistributor:nil];
         // Don't synchronize. Global search just searches a snapshot of state at the time it began.
         searchEngine.automaticallySynchronize = NO;
+        searchEngine.searchesConcurrently = concurrent;
         searchEngine.dataSource = screen;
         searchEngine.delegate = self;
         // Avoid blocking the main queue for too long
@@ -80,6 +86,7 @@
         self.query = query;
         self.mode = mode;
         self.currentScreenIsAlternate = screen.showingAlternateScreen;
+        _concurrent = concurrent;
     }
     return self;
 }
@@ -90,42 +97,37 @@
             return [[iTermGlobalSearchEngineCursor alloc] initWithQuery:self.query
                                                                    mode:self.mode
                                                                 session:self.session
-                                                                   pass:iTermGlobalSearchEngineCursorPassCurrentScreen];
+                                                                   pass:iTermGlobalSearchEngineCursorPassCurrentScreen
+                                                             concurrent:self.concurrent];
         case iTermGlobalSearchEngineCursorPassCurrentScreen:
             return nil;
     }
 }
 
-- (long long)expectedLines {
-    if (self.session.screen.showingAlternateScreen) {
-        const long long lastLineY = [self.session.screen absLineNumberOfLastLineInLineBuffer] - self.session.screen.totalScrollbackOverflow;
-        return self.session.screen.height + self.session.screen.numberOfLines - lastLineY;
-    } else {
-        return self.session.screen.numberOfLines;
-    }
-}
-
 #pragma mark - iTermGlobalSearchEngineCursorProtocol
 
 typedef struct iTermGlobalSearchEngineCursorSearchOutput {
     NSArray<id<iTermGlobalSearchResultProtocol>> *results;
     BOOL more;
-    NSUInteger retiredLines;
 } iTermGlobalSearchEngineCursorSearchOutput;
 
-- (void)drainFully:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *, NSUInteger))handler {
+- (void)drainFully:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *))handler {
     while (self.searchEngine.havePendingResults) {
         iTermGlobalSearchEngineCursorSearchOutput output = [self search];
-        handler(output.results, output.retiredLines);
+        handler(output.results);
     }
 }
 
-- (BOOL)consumeAvailable:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *, NSUInteger))handler {
+- (BOOL)consumeAvailable:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *))handler {
     iTermGlobalSearchEngineCursorSearchOutput output = [self search];
-    handler(output.results, output.retiredLines);
+    handler(output.results);
     return output.more;
 }
 
+- (BOOL)hasAvailableResults {
+    return self.searchEngine.havePendingResults;
+}
+
 - (iTermGlobalSearchEngineCursorSearchOutput)search {
     NSMutableArray<SearchResult *> *results = [NSMutableArray array];
     NSString *query = [self.searchEngine.query copy];
@@ -194,8 +196,7 @@ typedef struct iTermGlobalSearchEngineCursorSearchOutput {
     }];
     return (iTermGlobalSearchEngineCursorSearchOutput){
         .results = mapped,
-        .more = more,
-        .retiredLines = more ? 0 : self.session.screen.numberOfLines
+        .more = more
     };
 }
 
@@ -227,8 +228,20 @@ typedef struct iTermGlobalSearchEngineCursorSearchOutput {
                                      maximumSuffixLength:256];
 }
 
-- (long long)approximateLinesSearched {
-    return self.searchEngine.progress * self.session.screen.numberOfLines;
+- (long long)bytesSearched {
+    return self.searchEngine.bytesSearched;
+}
+
+- (long long)expectedBytes {
+    switch (self.pass) {
+        case iTermGlobalSearchEngineCursorPassMainScreen:
+            // This pass searches only the lines of the primary grid. The current screen pass
+            // that follows searches the line buffer plus the alternate grid, which is the same
+            // size as the primary grid, so it's about as big as this pass's whole snapshot.
+            return self.searchEngine.bytesToSearch + self.searchEngine.bytesInSnapshot;
+        case iTermGlobalSearchEngineCursorPassCurrentScreen:
+            return self.searchEngine.bytesToSearch;
+    }
 }
 
 #pragma mark - iTermSearchEngineDelegate
@@ -260,7 +273,7 @@ typedef struct iTermGlobalSearchEngineCursorSearchOutput {
     return self;
 }
 
-- (void)drainFully:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *, NSUInteger))handler {
+- (void)drainFully:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *))handler {
     if (_done) {
         return;
     }
@@ -272,10 +285,10 @@ typedef struct iTermGlobalSearchEngineCursorSearchOutput {
         return gsr;
     }];
     _done = _stream.done;
-    handler(results, 1000);
+    handler(results);
 }
 
-- (BOOL)consumeAvailable:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *, NSUInteger))handler {
+- (BOOL)consumeAvailable:(void (^ NS_NOESCAPE)(NSArray<id<iTermGlobalSearchResultProtocol>> *))handler {
     [self drainFully:handler];
     return !_done;
 }
@@ -284,8 +297,16 @@ typedef struct iTermGlobalSearchEngineCursorSearchOutput {
     return nil;
 }
 
-- (long long)approximateLinesSearched {
-    return _done ? 0 : 1000;
+- (BOOL)hasAvailableResults {
+    return YES;
+}
+
+- (long long)bytesSearched {
+    return _done ? iTermGlobalSearchEngineBrowserCursorNominalBytes : 0;
+}
+
+- (long long)expectedBytes {
+    return iTermGlobalSearchEngineBrowserCursorNominalBytes;
 }
 
 - (NSAttributedString *)snippetForResult:(iTermBrowserFindResult *)result {
@@ -15,6 +15,19 @@ NS_ASSUME_NONNULL_BEGIN
 @class iTermCallback;
 @class iTermThread;
 
+// Rows written by one save, which runs as a single transaction.
+typedef struct {
+    NSInteger inserts;
+    NSInteger updates;
+    NSInteger deletes;
+    // Records that were visited but didn't need to be written.
+    NSInteger unchanged;
+    NSInteger blobsWritten;
+    NSInteger blobsDeleted;
+    // Time to write the delta and commit it, on the database's thread.
+    NSTimeInterval duration;
+} iTermGraphDatabaseSaveStatistics;
+
 // Manages a SQLite database that holds an encoded graph. Loads it and updates it incrementally.
 @interface iTermGraphDatabase: NSObject
 @property (atomic, readonly) iTermEncoderGraphRecord *record;
@@ -24,6 +37,12 @@ NS_ASSUME_NONNULL_BEGIN
 // Tests only!
 @property (nonatomic, readonly) id<iTermDatabase> db;
 
+// Any queue. Describes the most recent successful save.
+@property (atomic, readonly) iTermGraphDatabaseSaveStatistics lastSaveStatistics;
+// Any queue. Totals over all successful saves since this object was created.
+@property (atomic, readonly) iTermGraphDatabaseSaveStatistics cumulativeSaveStatistics;
+@property (atomic, readonly) NSInteger numberOfSaves;
+
 - (instancetype)initWithDatabase:(id<iTermDatabase>)db NS_DESIGNATED_INITIALIZER;
 - (instancetype)init NS_UNAVAILABLE;
 
@@ -10,6 +10,7 @@
 #import "DebugLogging.h"
 #import "FMDatabase.h"
 #import "NSArray+iTerm.h"
+#import "NSDate+iTerm.h"
 #import "NSObject+iTerm.h"
 #import "iTerm2SharedARC-Swift.h"
 #import "iTermGraphDeltaEncoder.h"
@@ -38,8 +39,11 @@
 
 @end
 
-@interface iTermGraphDatabase()
+@interface iTermGraphDatabase()<iTermGraphBlobStore>
 @property (atomic, readwrite) iTermEncoderGraphRecord *record;
+@property (atomic, readwrite) iTermGraphDatabaseSaveStatistics lastSaveStatistics;
+@property (atomic, readwrite) iTermGraphDatabaseSaveStatistics cumulativeSaveStatistics;
+@property (atomic, readwrite) NSInteger numberOfSaves;
 @end
 
 @implementation iTermGraphDatabase {
@@ -82,6 +86,14 @@
     return self;
 }
 
+- (id<iTermDatabase>)db {
+    __block id<iTermDatabase> db = nil;
+    [_thread dispatchRecursiveSync:^(iTermGraphDatabaseState *state) {
+        db = state.db;
+    }];
+    return db;
+}
+
 - (void)doHousekeeping {
     [_thread dispatchAsync:^(iTermGraphDatabaseState *state) {
         // PRAGMA returns a result set, so we must use executeQuery and close it
@@ -180,10 +192,20 @@
 - (void)reallyInvalidate:(iTermGraphDatabaseState *)state {
     _invalid = YES;
     [state.db executeUpdate:@"delete from Node"];
+    [state.db executeUpdate:@"delete from Blob"];
     [state.db close];
     state.db = nil;
 }
 
+// Any queue. Records call this to lazily load blobs that were saved or loaded without their data.
+- (NSData * _Nullable)dataForBlobWithIdentifier:(NSString *)identifier {
+    __block NSData *data = nil;
+    [_thread dispatchRecursiveSync:^(iTermGraphDatabaseState *state) {
+        data = [self blobWithIdentifier:identifier db:state.db];
+    }];
+    return data;
+}
+
 - (void)whenReady:(void (^)(void))readyBlock {
     [_loadCompletePromise onQueue:dispatch_get_main_queue() then:^(id value){ readyBlock(); }];
 }
@@ -243,6 +265,8 @@
         // Erase rowIDs from the recovery encoder's record since we're treating everything as inserts.
         // The "after" records will get new rowIDs assigned during the insert.
         [encoder.record eraseRowIDs];
+        // Blobs that were already saved are only in the database we're about to delete.
+        [self loadBlobsInRecord:encoder.record db:state.db];
         DLogCyclic(_log, @"Recovery: After eraseRowIDs, encoder.record rowid=%@ (should be nil)",
                    encoder.record.rowid);
         ok = [self attemptRecovery:state encoder:encoder];
@@ -335,21 +359,87 @@
     DLogCyclic(_log, @"save");
     assert(state.db);
 
+    NSMutableArray<iTermEncoderGraphRecord *> *savedBlobs = [NSMutableArray array];
+    __block iTermGraphDatabaseSaveStatistics statistics = { 0 };
+    const NSTimeInterval start = [NSDate it_timeSinceBoot];
     const BOOL ok = [state.db transaction:^BOOL{
-        return [self reallySave:encoder state:state];
+        return [self reallySave:encoder state:state savedBlobs:savedBlobs statistics:&statistics];
     }];
     if (!ok) {
         DLogCyclic(_log, @"Commit transaction failed: %@", state.db.lastError);
+        return NO;
+    }
+    statistics.duration = [NSDate it_timeSinceBoot] - start;
+    [self recordSaveStatistics:statistics];
+    // Now that they're committed, blobs can be loaded on demand instead of kept in memory.
+    for (iTermEncoderGraphRecord *record in savedBlobs) {
+        record.blobData = nil;
+    }
+    return YES;
+}
+
+- (void)recordSaveStatistics:(iTermGraphDatabaseSaveStatistics)statistics {
+    DLogCyclic(_log, @"Saved in %.1fms: inserts=%@ updates=%@ deletes=%@ unchanged=%@ blobsWritten=%@ blobsDeleted=%@",
+               statistics.duration * 1000,
+               @(statistics.inserts),
+               @(statistics.updates),
+               @(statistics.deletes),
+               @(statistics.unchanged),
+               @(statistics.blobsWritten),
+               @(statistics.blobsDeleted));
+    iTermGraphDatabaseSaveStatistics totals = self.cumulativeSaveStatistics;
+    totals.inserts += statistics.inserts;
+    totals.updates += statistics.updates;
+    totals.deletes += statistics.deletes;
+    totals.unchanged += statistics.unchanged;
+    totals.blobsWritten += statistics.blobsWritten;
+    totals.blobsDeleted += statistics.blobsDeleted;
+    totals.duration += statistics.duration;
+    self.cumulativeSaveStatistics = totals;
+    self.lastSaveStatistics = statistics;
+    self.numberOfSaves = self.numberOfSaves + 1;
+}
+
+- (NSData * _Nullable)blobWithIdentifier:(NSString *)identifier db:(id<iTermDatabase>)db {
+    id<iTermDatabaseResultSet> rs = [db executeQuery:@"select data from Blob where key=?", identifier];
+    NSData *data = nil;
+    if ([rs next]) {
+        data = [rs dataForColumn:@"data"];
+    }
+    [rs close];
+    return data;
+}
+
+- (void)loadBlobsInRecord:(iTermEncoderGraphRecord *)record db:(id<iTermDatabase>)db {
+    if (record.blobIdentifier && !record.blobData) {
+        record.blobData = [self blobWithIdentifier:record.blobIdentifier db:db];
+    }
+    for (iTermEncoderGraphRecord *child in record.graphRecords) {
+        [self loadBlobsInRecord:child db:db];
+    }
+}
+
+- (void)setBlobStoreInRecord:(iTermEncoderGraphRecord *)record {
+    if (record.blobIdentifier) {
+        record.blobStore = self;
+    }
+    for (iTermEncoderGraphRecord *child in record.graphRecords) {
+        [self setBlobStoreInRecord:child];
     }
-    return ok;
 }
 
-// Runs within a transaction.
+// Runs within a transaction. Blobs are shared by content, so one is deleted only when no record
+// refers to it after the save. Records whose blobs were written are added to `savedBlobs`.
+// Statements are cached by SQL, so each distinct statement here is prepared once per connection.
 - (BOOL)reallySave:(iTermGraphDeltaEncoder *)encoder
-             state:(iTermGraphDatabaseState *)state {
+             state:(iTermGraphDatabaseState *)state
+        savedBlobs:(NSMutableArray<iTermEncoderGraphRecord *> *)savedBlobs
+        statistics:(iTermGraphDatabaseSaveStatistics *)statistics {
     DLog(@"Start saving");
     NSDate *start = [NSDate date];
-    const BOOL ok =
+    NSMutableSet<NSString *> *liveBlobs = [NSMutableSet set];
+    NSMutableSet<NSString *> *deadBlobs = [NSMutableSet set];
+    BOOL ok =
     [encoder enumerateRecords:^(iTermEncoderGraphRecord * _Nullable before,
                                 iTermEncoderGraphRecord * _Nullable after,
                                 NSNumber *parent,
@@ -371,11 +461,28 @@
                                            reason:reason
                                          userInfo:nil];
         }
+        if (before.blobIdentifier) {
+            [deadBlobs addObject:before.blobIdentifier];
+        }
+        if (after.blobIdentifier) {
+            [liveBlobs addObject:after.blobIdentifier];
+            after.blobStore = self;
+            if (after.blobData && ![after.blobIdentifier isEqualToString:before.blobIdentifier]) {
+                if (![state.db executeUpdate:@"insert or ignore into Blob (key, data) values (?, ?)",
+                      after.blobIdentifier, after.blobData]) {
+                    *stop = YES;
+                    return;
+                }
+                statistics->blobsWritten += 1;
+                [savedBlobs addObject:after];
+            }
+        }
         if (before && !after) {
             if (![state.db executeUpdate:@"delete from Node where rowid=?", before.rowid]) {
                 *stop = YES;
                 return;
             }
+            statistics->deletes += 1;
             return;
         }
         if (!before && after) {
@@ -384,6 +491,7 @@
                 *stop = YES;
                 return;
             }
+            statistics->inserts += 1;
             NSNumber *lastInsertRowID = state.db.lastInsertRowId;
             if (parent.integerValue == 0) {
                 DLog(@"Insert root node with path %@, rowid %@", path, lastInsertRowID);
@@ -407,20 +515,41 @@
                 if (before.generation == after.generation &&
                     after.generation != iTermGenerationAlwaysEncode) {
                     DLog(@"Don't update rowid %@ %@[%@] because it is unchanged", before.rowid, after.key, after.identifier);
+                    statistics->unchanged += 1;
                     return;
                 }
             }
             assert(before.rowid.longLongValue == after.rowid.longLongValue);
-            if ([before.data isEqual:after.data]) {
+            // A record whose generation changed is compared byte for byte. Records that are always
+            // encoded, which are most of them, compare PODs instead since -data archives the POD every
+            // time it's called. isEqual: doesn't tell @1, @1.0, and @YES apart, so for those records a
+            // value whose type changes but whose value doesn't is not written.
+            const BOOL unchanged = (after.generation == iTermGenerationAlwaysEncode ?
+                                    [before.pod isEqual:after.pod] :
+                                    [before.data isEqual:after.data]);
+            if (unchanged) {
+                statistics->unchanged += 1;
                 return;
             }
             if (![state.db executeUpdate:@"update Node set data=? where rowid=?", after.data, before.rowid]) {
                 *stop = YES;
+                return;
             }
+            statistics->updates += 1;
             return;
         }
         assert(NO);
     }];
+    [deadBlobs minusSet:liveBlobs];
+    for (NSString *identifier in deadBlobs) {
+        if (!ok) {
+            break;
+        }
+        ok = [state.db executeUpdate:@"delete from Blob where key=?", identifier];
+        if (ok) {
+            statistics->blobsDeleted += 1;
+        }
+    }
     NSDate *end = [NSDate date];
     DLogCyclic(_log, @"Save result=%@ duration=%.1fms",
                @(ok), (end.timeIntervalSinceNow - start.timeIntervalSinceNow) * 1000);
@@ -436,6 +565,9 @@
         return NO;
     }
     [state.db executeUpdate:@"create index if not exists parent_index on Node (parent)"];
+    if (![state.db executeUpdate:@"create table if not exists Blob (key text primary key, data blob)"]) {
+        return NO;
+    }
 
     // Delete nodes without parents.
     [state.db executeUpdate:
@@ -459,6 +591,8 @@
     if (![state.db open]) {
         return NO;
     }
+    // Saves execute the same few statements for every changed node.
+    state.db.shouldCacheStatements = YES;
 
     if (![self createTables:state]) {
         DLogCyclic(_log, @"Create table failed: %@", state.db.lastError);
@@ -498,6 +632,7 @@
         }
         return nil;
     }
+    [self setBlobStoreInRecord:record];
 
     return record;
 }
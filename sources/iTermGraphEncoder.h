@@ -44,6 +44,11 @@ typedef NS_OPTIONS(NSUInteger, iTermGraphEncoderArrayOptions) {
 
 - (void)mergeDictionary:(NSDictionary *)dictionary;
 
+// Like mergeDictionary: but the dictionary is archived apart from this node's POD and the database
+// stores it once, keyed by a digest of its contents. Use this for big values that rarely change so
+// saves that don't change them write nothing and loading the graph doesn't read them.
+- (BOOL)mergeBlob:(NSDictionary *)dictionary;
+
 // When encoding an array where all elements have the same key, use the identifer to distinguish
 // array elements. For example, if you have an array of [obj1, obj2, obj3] whose identifiers are
 // 1, 2, and 3 respectively and the array's value changes to [obj2, obj3, obj4] then the encoder
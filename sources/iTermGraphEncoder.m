@@ -24,6 +24,7 @@ NSInteger iTermGenerationAlwaysEncode = NSIntegerMax;
     // This is append-only, otherwise rolling back a transaction breaks.
     NSMutableArray<iTermEncoderGraphRecord *> *_children;
     iTermEncoderGraphRecord *_record;
+    NSData *_blobData;
 }
 
 - (instancetype)initWithKey:(NSString *)key
@@ -55,6 +56,7 @@ NSInteger iTermGenerationAlwaysEncode = NSIntegerMax;
     }
     encoder->_pod = [record.pod mutableCopy];
     encoder->_children = [record.graphRecords mutableCopy];
+    encoder->_blobData = record.blobData;
     return encoder;
 }
 
@@ -172,6 +174,19 @@ NSInteger iTermGenerationAlwaysEncode = NSIntegerMax;
     [_pod it_mergeFrom:dictionary];
 }
 
+- (BOOL)mergeBlob:(NSDictionary *)dictionary {
+    assert(_state == iTermGraphEncoderStateLive);
+    NSError *error = nil;
+    NSData *data = [NSData it_dataWithSecurelyArchivedObject:dictionary error:&error];
+    if (error) {
+        DLog(@"Failed to serialize blob: %@", error);
+        return NO;
+    }
+    _pod[iTermEncoderGraphRecordBlobKey] = [data.it_sha256 it_hexEncoded];
+    _blobData = data;
+    return YES;
+}
+
 - (BOOL)encodeChildWithKey:(NSString *)key
                 identifier:(NSString *)identifier
                 generation:(NSInteger)generation
@@ -258,6 +273,7 @@ NSInteger iTermGenerationAlwaysEncode = NSIntegerMax;
                                                     key:_key
                                              identifier:_identifier
                                                   rowid:nil];
+            _record.blobData = _blobData;
             _state = iTermGraphEncoderStateCommitted;
             return _record;
 
@@ -271,12 +287,14 @@ NSInteger iTermGenerationAlwaysEncode = NSIntegerMax;
 
 - (void)transaction:(BOOL (^)(void))block {
     NSMutableDictionary<NSString *, id> *savedPOD = [_pod mutableCopy];
+    NSData *savedBlobData = _blobData;
     const NSUInteger savedCount = _children.count;
     const BOOL commit = block();
     if (commit) {
         return;
     }
     _pod = savedPOD;
+    _blobData = savedBlobData;
     if (savedCount < _children.count) {
         DLog(@"Roll back from %@ to %@", @(_children.count), @(savedCount));
         [_children removeObjectsInRange:NSMakeRange(savedCount, _children.count - savedCount)];
@@ -48,6 +48,9 @@
 
 @end
 
+// Large enough that a burst of API requests arrives in one read rather than many small ones.
+static const size_t iTermHTTPConnectionReadBufferSize = 64 * 1024;
+
 @interface iTermHTTPConnection()
 @property (atomic) BOOL closing;
 @end
@@ -58,6 +61,8 @@
     NSTimeInterval _deadline;
     NSMutableData *_buffer;
     iTermStream *_stream;
+    // Reused for every read. Allocated on first use. Only used on the connection's queue.
+    char *_readBuffer;
 }
 
 - (instancetype)initWithFileDescriptor:(int)fd
@@ -76,6 +81,10 @@
     return self;
 }
 
+- (void)dealloc {
+    free(_readBuffer);
+}
+
 - (void)closeConnection {
     @synchronized (_lock) {
         _stream = nil;
@@ -280,10 +289,12 @@
         stream = _stream;
     }
 
-    char buffer[4096];
-    int rc;
+    if (!_readBuffer) {
+        _readBuffer = malloc(iTermHTTPConnectionReadBufferSize);
+    }
+    ssize_t rc;
     do {
-        rc = read(stream.fd, buffer, sizeof(buffer));
+        rc = read(stream.fd, _readBuffer, iTermHTTPConnectionReadBufferSize);
     } while (rc == -1 && (errno == EINTR || errno == EAGAIN));
     if (rc <= 0) {
         if (rc < 0) {
@@ -297,7 +308,7 @@
         return NO;
     }
 
-    [_buffer appendBytes:buffer length:rc];
+    [_buffer appendBytes:_readBuffer length:rc];
     return YES;
 }
 
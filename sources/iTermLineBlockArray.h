@@ -13,6 +13,21 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class LineBlock;
 @class iTermLineBlockArray;
+@class iTermScrollbackSpillFile;
+
+typedef struct {
+    // Spilled blocks use no memory for characters.
+    NSInteger spilledBlocks;
+    NSInteger spilledBytes;
+
+    NSInteger packedBlocks;
+    // Heap memory used by packed blocks' characters and how much they would use if unpacked.
+    NSInteger packedBytes;
+    NSInteger packedRawBytes;
+
+    NSInteger unpackedBlocks;
+    NSInteger unpackedBytes;
+} iTermLineBlockArrayMemoryUsage;
 
 @protocol iTermLineBlockArrayDelegate <NSObject>
 - (void)lineBlockArrayDidChange:(iTermLineBlockArray *)lineBlockArray;
@@ -72,6 +87,22 @@ NS_ASSUME_NONNULL_BEGIN
                           upToBlockAtIndex:(NSInteger)limit;
 - (NSInteger)numberOfRawLinesInRange:(NSRange)range width:(int)width;
 
+// Packs the characters of blocks that haven't been read in `idleTicks` ticks of
+// +[iTermCharacterBuffer accessClock], or spills them if `spillFile` is given. The last block is
+// never packed, and neither are the `keep` most recently read blocks so that scrolling and
+// searching nearby text doesn't keep unpacking and repacking it. Packs no more than `limit`
+// blocks. Returns the number packed.
+- (NSInteger)packBlocksIdleFor:(int)idleTicks
+              keepingMostRecent:(NSInteger)keep
+                          limit:(NSInteger)limit
+                      spillFile:(iTermScrollbackSpillFile * _Nullable)spillFile;
+
+// Switches to packed or spilled characters that copies of these blocks in another array already
+// made. Returns the number of blocks that changed.
+- (NSInteger)adoptCompactCharacterBuffers;
+
+- (iTermLineBlockArrayMemoryUsage)memoryUsage;
+
 @end
 
 NS_ASSUME_NONNULL_END
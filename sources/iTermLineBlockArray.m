@@ -8,13 +8,22 @@
 #import "iTermLineBlockArray.h"
 
 #import "DebugLogging.h"
+#import "iTermCharacterBuffer.h"
 #import "iTermCumulativeSumCache.h"
+#import "iTermMalloc.h"
 #import "iTermTuple.h"
 #import "LineBlock.h"
 #import "NSArray+iTerm.h"
 
 //#define DEBUG_LINEBUFFER_MERGE 1
 
+// Below this many blocks it's faster to count wrapped lines for a new width on one thread.
+static const NSInteger iTermLineBlockArrayMinimumBlocksForParallelCounting = 64;
+
+// Blocks counted by each task when counting in parallel. Keeps dispatch overhead small relative
+// to the work when most blocks take the fast path.
+static const NSInteger iTermLineBlockArrayBlocksPerCountingTask = 16;
+
 typedef struct {
     BOOL tailIsEmpty;
 } LineBlockArrayCacheHint;
@@ -279,9 +288,30 @@ static NSUInteger iTermLineBlockArrayNextUniqueID;
     }
 
     numLinesCache = [[iTermCumulativeSumCache alloc] init];
-    for (LineBlock *block in _blocks) {
-        const int block_lines = [block getNumLinesWithWrapWidth:width];
-        [numLinesCache appendValue:block_lines];
+    const NSInteger count = _blocks.count;
+    if (count < iTermLineBlockArrayMinimumBlocksForParallelCounting) {
+        for (LineBlock *block in _blocks) {
+            const int block_lines = [block getNumLinesWithWrapWidth:width];
+            [numLinesCache appendValue:block_lines];
+        }
+    } else {
+        // After a resize every block has to be counted at the new width, and blocks that may have
+        // double-width characters must be scanned character by character. Blocks are independent
+        // and each one is visited by exactly one thread, so their internal caches are safe to
+        // update. The caller is blocked until this finishes, so nothing else can touch them.
+        int *counts = iTermMalloc(count * sizeof(int));
+        NSArray<LineBlock *> *blocks = _blocks;
+        const NSInteger stride = iTermLineBlockArrayBlocksPerCountingTask;
+        dispatch_apply((count + stride - 1) / stride, DISPATCH_APPLY_AUTO, ^(size_t task) {
+            const NSInteger end = MIN(count, (NSInteger)(task + 1) * stride);
+            for (NSInteger i = task * stride; i < end; i++) {
+                counts[i] = [blocks[i] getNumLinesWithWrapWidth:width];
+            }
+        });
+        for (NSInteger i = 0; i < count; i++) {
+            [numLinesCache appendValue:counts[i]];
+        }
+        free(counts);
     }
     [_numLinesCaches setNumLinesCache:numLinesCache forWidth:width];
 }
@@ -922,6 +952,74 @@ static NSUInteger iTermLineBlockArrayNextUniqueID;
     }
 }
 
+#pragma mark - Packing
+
+- (NSInteger)packBlocksIdleFor:(int)idleTicks
+              keepingMostRecent:(NSInteger)keep
+                          limit:(NSInteger)limit
+                      spillFile:(iTermScrollbackSpillFile *)spillFile {
+    if (_blocks.count < 2 || limit <= 0) {
+        return 0;
+    }
+    NSMutableArray<LineBlock *> *candidates = [NSMutableArray array];
+    for (NSInteger i = 0; i + 1 < _blocks.count; i++) {
+        LineBlock *block = _blocks[i];
+        // When spilling, packed blocks are candidates too.
+        if (spillFile ? !block.characterBufferIsSpilled : !block.characterBufferIsPacked) {
+            [candidates addObject:block];
+        }
+    }
+    if (candidates.count <= keep) {
+        return 0;
+    }
+    // Most recently read first. The clock doesn't wrap in practice.
+    [candidates sortWithOptions:NSSortStable usingComparator:^NSComparisonResult(LineBlock *lhs, LineBlock *rhs) {
+        return [@(rhs.characterBufferLastAccess) compare:@(lhs.characterBufferLastAccess)];
+    }];
+    const int now = iTermCharacterBuffer.accessClock;
+    NSInteger count = 0;
+    for (NSInteger i = keep; i < candidates.count && count < limit; i++) {
+        LineBlock *block = candidates[i];
+        if (now - block.characterBufferLastAccess < idleTicks) {
+            // The rest were read even more recently.
+            break;
+        }
+        if (spillFile ? [block spillCharacterBufferToFile:spillFile] : [block packCharacterBuffer]) {
+            count += 1;
+        }
+    }
+    return count;
+}
+
+- (NSInteger)adoptCompactCharacterBuffers {
+    NSInteger count = 0;
+    for (NSInteger i = 0; i + 1 < _blocks.count; i++) {
+        LineBlock *block = _blocks[i];
+        if (!block.characterBufferIsPacked && [block adoptCompactCharacterBuffer]) {
+            count += 1;
+        }
+    }
+    return count;
+}
+
+- (iTermLineBlockArrayMemoryUsage)memoryUsage {
+    iTermLineBlockArrayMemoryUsage usage = { 0 };
+    for (LineBlock *block in _blocks) {
+        if (block.characterBufferIsSpilled) {
+            usage.spilledBlocks += 1;
+            usage.spilledBytes += (NSInteger)block.rawBufferSize * sizeof(screen_char_t);
+        } else if (block.characterBufferIsPacked) {
+            usage.packedBlocks += 1;
+            usage.packedBytes += block.characterBufferMemoryUsage;
+            usage.packedRawBytes += (NSInteger)block.rawBufferSize * sizeof(screen_char_t);
+        } else {
+            usage.unpackedBlocks += 1;
+            usage.unpackedBytes += block.characterBufferMemoryUsage;
+        }
+    }
+    return usage;
+}
+
 #pragma mark - NSCopying
 
 - (id)copyWithZone:(NSZone *)zone {
@@ -104,6 +104,7 @@ iTermImmutableMetadata iTermImmutableMetadataDefault(void);
 void iTermMetadataReset(iTermMetadata *obj);
 
 NSString *iTermMetadataShortDescription(iTermMetadata metadata, int length);
+NSString *iTermImmutableMetadataShortDescription(iTermImmutableMetadata metadata, int length);
 NSArray * _Nullable iTermMetadataArrayFromData(NSData *data);
 NSData *iTermMetadataEncodeToData(iTermMetadata metadata);
 NSData *iTermImmutableMetadataEncodeToData(iTermImmutableMetadata metadata);
@@ -216,6 +216,10 @@ NSString *iTermMetadataShortDescription(iTermMetadata metadata, int length) {
             @(metadata.rtlFound)];
 }
 
+NSString *iTermImmutableMetadataShortDescription(iTermImmutableMetadata metadata, int length) {
+    return iTermMetadataShortDescription(*(iTermMetadata *)&metadata, length);
+}
+
 NSArray *iTermMetadataArrayFromData(NSData *data) {
     iTermMetadata temp;
     memset(&temp, 0, sizeof(temp));
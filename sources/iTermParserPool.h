@@ -0,0 +1,38 @@
+//
+//  iTermParserPool.h
+//  iTerm2
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+@protocol iTermTask;
+
+NS_ASSUME_NONNULL_BEGIN
+
+// A fixed pool of threads, one per CPU core, that performs reads (and therefore parsing) for
+// tasks whose file descriptors TaskNotifier found to be readable. Each worker has its own queue
+// and idle workers steal from the others, so one session that's slow to parse doesn't hold up
+// the rest. A task never has more than one read in flight, which keeps each session's output in
+// order.
+@interface iTermParserPool : NSObject
+
+@property (nonatomic, readonly) int numberOfWorkers;
+
+// Fraction of worker time spent running reads since the last call, jobs run, and steals.
+@property (nonatomic, readonly) NSString *utilizationDescription;
+
++ (instancetype)sharedInstance;
+- (instancetype)init NS_UNAVAILABLE;
+
+// Schedules -processRead on a worker. Returns NO without doing anything if a read for `task` is
+// already in flight. `completion` is called on the worker thread after the read finishes.
+- (BOOL)scheduleReadForTask:(id<iTermTask>)task completion:(void (^)(void))completion;
+
+// Thread-safe.
+- (BOOL)taskHasReadInFlight:(id<iTermTask>)task;
+
+@end
+
+NS_ASSUME_NONNULL_END
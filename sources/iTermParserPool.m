@@ -0,0 +1,222 @@
+//
+//  iTermParserPool.m
+//  iTerm2
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermParserPool.h"
+
+#import "DebugLogging.h"
+#import "TaskNotifier.h"
+
+#include <mach/mach_time.h>
+#include <os/lock.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+@interface iTermParserPoolJob : NSObject
+@property (nonatomic, retain) id<iTermTask> task;
+@property (nonatomic, copy) void (^completion)(void);
+@end
+
+@implementation iTermParserPoolJob
+
+- (void)dealloc {
+    [_task release];
+    [_completion release];
+    [super dealloc];
+}
+
+@end
+
+typedef struct {
+    os_unfair_lock lock;
+    // Owner takes from the front. Thieves take from the back so they disturb the owner least.
+    NSMutableArray<iTermParserPoolJob *> *jobs;  // Guarded by lock
+
+    _Atomic uint64_t busyTime;  // mach_absolute_time units
+    _Atomic uint64_t jobsRun;
+    _Atomic uint64_t steals;
+} iTermParserPoolWorker;
+
+@implementation iTermParserPool {
+    int _numberOfWorkers;
+    iTermParserPoolWorker *_workers;
+
+    // Counts jobs that have been enqueued but not yet taken. Each signal wakes one worker, which
+    // is guaranteed to find a job in its own queue or someone else's.
+    dispatch_semaphore_t _pending;
+    _Atomic uint32_t _nextWorker;
+
+    // Tasks with a read in flight. Compared by pointer; the job retains the task.
+    os_unfair_lock _inFlightLock;
+    NSHashTable *_inFlight;  // Guarded by _inFlightLock
+
+    // For utilizationDescription
+    os_unfair_lock _statsLock;
+    uint64_t _lastStatsTime;  // Guarded by _statsLock
+    uint64_t _lastBusyTime;  // Guarded by _statsLock
+}
+
++ (instancetype)sharedInstance {
+    static id instance;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        instance = [[self alloc] initWithNumberOfWorkers:(int)[[NSProcessInfo processInfo] activeProcessorCount]];
+    });
+    return instance;
+}
+
+- (instancetype)initWithNumberOfWorkers:(int)numberOfWorkers {
+    self = [super init];
+    if (self) {
+        _numberOfWorkers = MAX(1, numberOfWorkers);
+        _workers = calloc(_numberOfWorkers, sizeof(*_workers));
+        for (int i = 0; i < _numberOfWorkers; i++) {
+            _workers[i].lock = OS_UNFAIR_LOCK_INIT;
+            _workers[i].jobs = [[NSMutableArray alloc] init];
+        }
+        _pending = dispatch_semaphore_create(0);
+        _inFlightLock = OS_UNFAIR_LOCK_INIT;
+        _inFlight = [[NSHashTable hashTableWithOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality] retain];
+        _statsLock = OS_UNFAIR_LOCK_INIT;
+        _lastStatsTime = mach_absolute_time();
+        for (int i = 0; i < _numberOfWorkers; i++) {
+            NSThread *thread = [[[NSThread alloc] initWithTarget:self
+                                                        selector:@selector(runWorker:)
+                                                          object:@(i)] autorelease];
+            thread.name = [NSString stringWithFormat:@"com.iterm2.parser-pool.%d", i];
+            thread.qualityOfService = NSQualityOfServiceUserInitiated;
+            [thread start];
+        }
+    }
+    return self;
+}
+
+// The shared instance is never deallocated because its threads retain it.
+- (void)dealloc {
+    for (int i = 0; i < _numberOfWorkers; i++) {
+        [_workers[i].jobs release];
+    }
+    free(_workers);
+    [_pending release];
+    [_inFlight release];
+    [super dealloc];
+}
+
+#pragma mark - APIs
+
+- (int)numberOfWorkers {
+    return _numberOfWorkers;
+}
+
+- (BOOL)scheduleReadForTask:(id<iTermTask>)task completion:(void (^)(void))completion {
+    os_unfair_lock_lock(&_inFlightLock);
+    if ([_inFlight containsObject:task]) {
+        os_unfair_lock_unlock(&_inFlightLock);
+        return NO;
+    }
+    [_inFlight addObject:task];
+    os_unfair_lock_unlock(&_inFlightLock);
+
+    iTermParserPoolJob *job = [[[iTermParserPoolJob alloc] init] autorelease];
+    job.task = task;
+    job.completion = completion;
+
+    const uint32_t index = atomic_fetch_add(&_nextWorker, 1) % _numberOfWorkers;
+    iTermParserPoolWorker *worker = &_workers[index];
+    os_unfair_lock_lock(&worker->lock);
+    [worker->jobs addObject:job];
+    os_unfair_lock_unlock(&worker->lock);
+
+    dispatch_semaphore_signal(_pending);
+    return YES;
+}
+
+- (BOOL)taskHasReadInFlight:(id<iTermTask>)task {
+    os_unfair_lock_lock(&_inFlightLock);
+    const BOOL result = [_inFlight containsObject:task];
+    os_unfair_lock_unlock(&_inFlightLock);
+    return result;
+}
+
+- (NSString *)utilizationDescription {
+    uint64_t busy = 0;
+    uint64_t jobsRun = 0;
+    uint64_t steals = 0;
+    for (int i = 0; i < _numberOfWorkers; i++) {
+        busy += atomic_load(&_workers[i].busyTime);
+        jobsRun += atomic_load(&_workers[i].jobsRun);
+        steals += atomic_load(&_workers[i].steals);
+    }
+    const uint64_t now = mach_absolute_time();
+    os_unfair_lock_lock(&_statsLock);
+    const uint64_t elapsed = (now - _lastStatsTime) * _numberOfWorkers;
+    const double utilization = elapsed > 0 ? (double)(busy - _lastBusyTime) / (double)elapsed : 0;
+    _lastStatsTime = now;
+    _lastBusyTime = busy;
+    os_unfair_lock_unlock(&_statsLock);
+    return [NSString stringWithFormat:@"workers=%d utilization=%.1f%% jobs=%llu steals=%llu",
+            _numberOfWorkers, utilization * 100.0, jobsRun, steals];
+}
+
+#pragma mark - Private
+
+- (iTermParserPoolJob *)dequeueJobForWorker:(int)index {
+    iTermParserPoolWorker *worker = &_workers[index];
+    os_unfair_lock_lock(&worker->lock);
+    iTermParserPoolJob *job = [[worker->jobs.firstObject retain] autorelease];
+    if (job) {
+        [worker->jobs removeObjectAtIndex:0];
+    }
+    os_unfair_lock_unlock(&worker->lock);
+    if (job) {
+        return job;
+    }
+
+    // Steal from the other workers, starting with the next one over so thieves spread out.
+    for (int i = 1; i < _numberOfWorkers; i++) {
+        iTermParserPoolWorker *victim = &_workers[(index + i) % _numberOfWorkers];
+        os_unfair_lock_lock(&victim->lock);
+        job = [[victim->jobs.lastObject retain] autorelease];
+        if (job) {
+            [victim->jobs removeLastObject];
+        }
+        os_unfair_lock_unlock(&victim->lock);
+        if (job) {
+            atomic_fetch_add(&worker->steals, 1);
+            return job;
+        }
+    }
+    return nil;
+}
+
+- (void)runWorker:(NSNumber *)indexNumber {
+    const int index = indexNumber.intValue;
+    iTermParserPoolWorker *worker = &_workers[index];
+    for (;;) {
+        dispatch_semaphore_wait(_pending, DISPATCH_TIME_FOREVER);
+        @autoreleasepool {
+            iTermParserPoolJob *job = [self dequeueJobForWorker:index];
+            ITAssertWithMessage(job != nil, @"Woken without a job");
+            if (!job) {
+                continue;
+            }
+            const uint64_t start = mach_absolute_time();
+            [job.task processRead];
+
+            os_unfair_lock_lock(&_inFlightLock);
+            [_inFlight removeObject:job.task];
+            os_unfair_lock_unlock(&_inFlightLock);
+
+            atomic_fetch_add(&worker->busyTime, mach_absolute_time() - start);
+            atomic_fetch_add(&worker->jobsRun, 1);
+            if (job.completion) {
+                job.completion();
+            }
+        }
+    }
+}
+
+@end
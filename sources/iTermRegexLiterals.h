@@ -0,0 +1,24 @@
+//
+//  iTermRegexLiterals.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Finds text that any match of a regular expression must contain, so callers can rule out a
+// string cheaply before running the regex.
+@interface iTermRegexLiterals : NSObject
+
+// Returns runs of printable ASCII that every match contains, with their case preserved. This is
+// deliberately conservative: only literals outside of groups and not followed by an optional
+// quantifier are used, anything it doesn't understand ends the current run, and alternation,
+// inline flags, or quoting give up. An empty array means nothing is required.
++ (NSArray<NSString *> *)requiredLiteralsInPattern:(NSString *)pattern;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,189 @@
+//
+//  iTermRegexLiterals.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermRegexLiterals.h"
+
+@implementation iTermRegexLiterals
+
++ (NSArray<NSString *> *)requiredLiteralsInPattern:(NSString *)pattern {
+    NSMutableArray<NSString *> *literals = [NSMutableArray array];
+    if ([pattern containsString:@"|"] ||
+        [pattern containsString:@"(?"] ||
+        [pattern containsString:@"\\Q"]) {
+        // Alternation, inline flags, and quoting could all make a run optional or change how it
+        // matches.
+        return literals;
+    }
+    NSMutableString *run = [NSMutableString string];
+    int depth = 0;
+    const NSInteger length = pattern.length;
+    for (NSInteger i = 0; i < length; i++) {
+        unichar c = [pattern characterAtIndex:i];
+        switch (c) {
+            case '\\': {
+                if (i + 1 >= length) {
+                    [self endRun:run literals:literals];
+                    break;
+                }
+                i += 1;
+                c = [pattern characterAtIndex:i];
+                if (c < 0x80 && ispunct(c)) {
+                    // An escaped metacharacter is a literal.
+                    [self appendLiteral:c depth:depth run:run literals:literals];
+                } else {
+                    // A character class, anchor, backreference, or encoded character.
+                    [self endRun:run literals:literals];
+                    i = [self indexOfLastCharacterOfEscape:c inPattern:pattern at:i];
+                }
+                break;
+            }
+            case '[':
+                [self endRun:run literals:literals];
+                i = [self indexOfEndOfSetInPattern:pattern at:i];
+                break;
+            case '(':
+                [self endRun:run literals:literals];
+                depth += 1;
+                break;
+            case ')':
+                [self endRun:run literals:literals];
+                depth -= 1;
+                break;
+            case '*':
+            case '?':
+            case '{':
+                // The preceding character is optional or repeated a variable number of times.
+                if (run.length > 0) {
+                    [run deleteCharactersInRange:NSMakeRange(run.length - 1, 1)];
+                }
+                [self endRun:run literals:literals];
+                if (c == '{') {
+                    const NSRange range = [pattern rangeOfString:@"}"
+                                                         options:0
+                                                           range:NSMakeRange(i, length - i)];
+                    i = (range.location == NSNotFound) ? length - 1 : range.location;
+                }
+                break;
+            case '+':
+            case '.':
+            case '^':
+            case '$':
+                [self endRun:run literals:literals];
+                break;
+            default:
+                [self appendLiteral:c depth:depth run:run literals:literals];
+                break;
+        }
+    }
+    [self endRun:run literals:literals];
+    return literals;
+}
+
++ (void)endRun:(NSMutableString *)run literals:(NSMutableArray<NSString *> *)literals {
+    if (run.length > 0) {
+        [literals addObject:[run copy]];
+        [run setString:@""];
+    }
+}
+
++ (void)appendLiteral:(unichar)c
+                depth:(int)depth
+                  run:(NSMutableString *)run
+             literals:(NSMutableArray<NSString *> *)literals {
+    if (depth != 0 || c < ' ' || c > '~') {
+        [self endRun:run literals:literals];
+        return;
+    }
+    [run appendFormat:@"%C", c];
+}
+
+// `i` is the index of the character after a backslash. Returns the index of the escape's last
+// character, so that arguments like the digits in \x41 or the name in \p{L} aren't taken for
+// literals.
++ (NSInteger)indexOfLastCharacterOfEscape:(unichar)c inPattern:(NSString *)pattern at:(NSInteger)i {
+    const NSInteger length = pattern.length;
+    NSInteger digits = 0;
+    switch (c) {
+        case 'x':
+        case 'N':
+        case 'p':
+        case 'P':
+            if (i + 1 < length && [pattern characterAtIndex:i + 1] == '{') {
+                const NSRange range = [pattern rangeOfString:@"}"
+                                                     options:0
+                                                       range:NSMakeRange(i + 1, length - i - 1)];
+                return range.location == NSNotFound ? length - 1 : range.location;
+            }
+            digits = (c == 'x') ? 2 : 1;
+            break;
+        case 'k':
+            if (i + 1 < length && [pattern characterAtIndex:i + 1] == '<') {
+                const NSRange range = [pattern rangeOfString:@">"
+                                                     options:0
+                                                       range:NSMakeRange(i + 1, length - i - 1)];
+                return range.location == NSNotFound ? length - 1 : range.location;
+            }
+            break;
+        case 'u':
+            digits = 4;
+            break;
+        case 'U':
+            digits = 8;
+            break;
+        case 'c':
+            digits = 1;
+            break;
+        case '0':
+            digits = 3;
+            break;
+        default:
+            if (c >= '1' && c <= '9') {
+                // A backreference may have more digits.
+                while (i + 1 < length && isdigit([pattern characterAtIndex:i + 1])) {
+                    i += 1;
+                }
+            }
+            break;
+    }
+    return MIN(length - 1, i + digits);
+}
+
+// `i` is the index of a [. Returns the index of the ] that closes it. Sets may be nested.
++ (NSInteger)indexOfEndOfSetInPattern:(NSString *)pattern at:(NSInteger)i {
+    const NSInteger length = pattern.length;
+    int depth = 0;
+    NSInteger j = i;
+    while (j < length) {
+        const unichar c = [pattern characterAtIndex:j];
+        if (c == '\\') {
+            j += 2;
+            continue;
+        }
+        if (c == '[') {
+            depth += 1;
+            j += 1;
+            // A ] right after [ or [^ is literal.
+            if (j < length && [pattern characterAtIndex:j] == '^') {
+                j += 1;
+            }
+            if (j < length && [pattern characterAtIndex:j] == ']') {
+                j += 1;
+            }
+            continue;
+        }
+        if (c == ']') {
+            depth -= 1;
+            if (depth == 0) {
+                return j;
+            }
+        }
+        j += 1;
+    }
+    return length - 1;
+}
+
+@end
@@ -0,0 +1,39 @@
+//
+//  iTermScreenUpdateSubscription.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "VT100GridTypes.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// What a screen update subscriber that asked for deltas already knows, so the next delta can
+// describe only what changed since the last one.
+@interface iTermScreenUpdateSubscription : NSObject
+
+@property (nonatomic, readonly) BOOL includeStyles;
+
+// The sequence number of the most recent delta, or 0 if none has been begun.
+@property (nonatomic, readonly) int64_t sequenceNumber;
+
+- (instancetype)initWithIncludeStyles:(BOOL)includeStyles NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+// The next delta will be a full refresh. Use this after skipping a delta or when the client asks
+// to resync.
+- (void)setNeedsFullRefresh;
+
+// Call before building each delta. Advances the sequence number. Returns YES if the delta must be
+// a full refresh because it's the first one, -setNeedsFullRefresh was called, or the screen was
+// resized or its first line number went backwards (as when the buffer is cleared) since the
+// previous delta.
+- (BOOL)beginDeltaWithSize:(VT100GridSize)size firstLineNumber:(long long)firstLineNumber
+NS_SWIFT_NAME(beginDelta(size:firstLineNumber:));
+
+@end
+
+NS_ASSUME_NONNULL_END
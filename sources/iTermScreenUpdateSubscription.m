@@ -0,0 +1,40 @@
+//
+//  iTermScreenUpdateSubscription.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermScreenUpdateSubscription.h"
+
+@implementation iTermScreenUpdateSubscription {
+    BOOL _needsFullRefresh;
+    VT100GridSize _size;
+    long long _firstLineNumber;
+}
+
+- (instancetype)initWithIncludeStyles:(BOOL)includeStyles {
+    self = [super init];
+    if (self) {
+        _includeStyles = includeStyles;
+        _needsFullRefresh = YES;
+    }
+    return self;
+}
+
+- (void)setNeedsFullRefresh {
+    _needsFullRefresh = YES;
+}
+
+- (BOOL)beginDeltaWithSize:(VT100GridSize)size firstLineNumber:(long long)firstLineNumber {
+    const BOOL full = (_needsFullRefresh ||
+                       !VT100GridSizeEquals(size, _size) ||
+                       firstLineNumber < _firstLineNumber);
+    _needsFullRefresh = NO;
+    _size = size;
+    _firstLineNumber = firstLineNumber;
+    _sequenceNumber += 1;
+    return full;
+}
+
+@end
@@ -0,0 +1,35 @@
+//
+//  iTermScrollbackCompactor.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@protocol iTermScrollbackCompactorClient<NSObject>
+// Called on the compactor's queue. Clients should dispatch to the queue that owns their line
+// buffer and pass these along to -[LineBuffer packBlocksIdleFor:keepingMostRecent:limit:].
+- (void)scrollbackCompactorDidRequestPackingBlocksIdleFor:(int)idleTicks
+                                        keepingMostRecent:(NSInteger)keep
+                                                    limit:(NSInteger)limit;
+@end
+
+// Scrollback is packed when it scrolls off (see -[LineBlock packCharacterBuffer]) but reading it
+// expands it again. This periodically asks clients to repack blocks that haven't been read in a
+// while, and asks them to pack everything they can when the system is low on memory.
+//
+// It also advances +[iTermCharacterBuffer accessClock], which is how idleness is measured.
+@interface iTermScrollbackCompactor : NSObject
+
++ (instancetype)sharedInstance;
+- (instancetype)init NS_UNAVAILABLE;
+
+// Thread-safe. Clients are not retained.
+- (void)addClient:(id<iTermScrollbackCompactorClient>)client;
+
+@end
+
+NS_ASSUME_NONNULL_END
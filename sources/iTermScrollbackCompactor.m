@@ -0,0 +1,122 @@
+//
+//  iTermScrollbackCompactor.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermScrollbackCompactor.h"
+
+#import "DebugLogging.h"
+#import "iTermAdvancedSettingsModel.h"
+#import "iTermCharacterBuffer.h"
+
+// Seconds per tick of the access clock.
+static const NSTimeInterval iTermScrollbackCompactorTickInterval = 5;
+
+// How many unpacked blocks to leave alone, most recently read first. This is enough for a few
+// screenfuls of scrolling or the neighborhood of a search result.
+static const NSInteger iTermScrollbackCompactorBlocksToKeep = 8;
+static const NSInteger iTermScrollbackCompactorBlocksToKeepUnderMemoryPressure = 2;
+
+// Limits the time spent on the mutation queue per tick. Anything left over gets packed on later
+// ticks.
+static const NSInteger iTermScrollbackCompactorBlocksPerTick = 64;
+
+@implementation iTermScrollbackCompactor {
+    dispatch_queue_t _queue;
+    dispatch_source_t _timer;
+    dispatch_source_t _memoryPressureSource;
+
+    // Access on _queue only.
+    NSHashTable<id<iTermScrollbackCompactorClient>> *_clients;
+}
+
++ (instancetype)sharedInstance {
+    static iTermScrollbackCompactor *instance;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        instance = [[self alloc] initPrivate];
+    });
+    return instance;
+}
+
+- (instancetype)initPrivate {
+    self = [super init];
+    if (self) {
+        _queue = dispatch_queue_create("com.iterm2.scrollback-compactor", DISPATCH_QUEUE_SERIAL);
+        _clients = [NSHashTable weakObjectsHashTable];
+        __weak __typeof(self) weakSelf = self;
+
+        _timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _queue);
+        const uint64_t interval = iTermScrollbackCompactorTickInterval * NSEC_PER_SEC;
+        // Generous leeway so the timer coalesces with other wakeups.
+        dispatch_source_set_timer(_timer, dispatch_time(DISPATCH_TIME_NOW, interval), interval, interval / 5);
+        dispatch_source_set_event_handler(_timer, ^{
+            [weakSelf tick];
+        });
+        dispatch_resume(_timer);
+
+        _memoryPressureSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE,
+                                                       0,
+                                                       DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL,
+                                                       _queue);
+        dispatch_source_set_event_handler(_memoryPressureSource, ^{
+            [weakSelf memoryPressureDidChange];
+        });
+        dispatch_resume(_memoryPressureSource);
+    }
+    return self;
+}
+
+- (void)addClient:(id<iTermScrollbackCompactorClient>)client {
+    dispatch_async(_queue, ^{
+        [self->_clients addObject:client];
+    });
+}
+
+#pragma mark - Private
+
+// Runs on _queue.
+- (void)tick {
+    [iTermCharacterBuffer advanceAccessClock];
+    if (![iTermAdvancedSettingsModel packScrollback]) {
+        return;
+    }
+    const double idleTime = [iTermAdvancedSettingsModel scrollbackIdleTimeBeforePacking];
+    if (idleTime <= 0) {
+        return;
+    }
+    const int idleTicks = MAX(1, (int)ceil(idleTime / iTermScrollbackCompactorTickInterval));
+    [self requestPackingBlocksIdleFor:idleTicks
+                    keepingMostRecent:iTermScrollbackCompactorBlocksToKeep
+                                limit:iTermScrollbackCompactorBlocksPerTick];
+}
+
+// Runs on _queue.
+- (void)memoryPressureDidChange {
+    const unsigned long level = dispatch_source_get_data(_memoryPressureSource);
+    DLog(@"Memory pressure level is now %@", @(level));
+    if (!(level & (DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL))) {
+        return;
+    }
+    if (![iTermAdvancedSettingsModel packScrollback]) {
+        return;
+    }
+    [self requestPackingBlocksIdleFor:0
+                    keepingMostRecent:iTermScrollbackCompactorBlocksToKeepUnderMemoryPressure
+                                limit:NSIntegerMax];
+}
+
+// Runs on _queue.
+- (void)requestPackingBlocksIdleFor:(int)idleTicks
+                  keepingMostRecent:(NSInteger)keep
+                              limit:(NSInteger)limit {
+    for (id<iTermScrollbackCompactorClient> client in _clients.allObjects) {
+        [client scrollbackCompactorDidRequestPackingBlocksIdleFor:idleTicks
+                                                keepingMostRecent:keep
+                                                            limit:limit];
+    }
+}
+
+@end
@@ -0,0 +1,32 @@
+//
+//  iTermScrollbackExporter.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "Api.pbobjc.h"
+#import "ScreenChar.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class LineBuffer;
+@class iTermExternalAttribute;
+
+// Converts a cell's attributes to the API's representation.
+typedef ITMCellStyle * _Nonnull (^iTermScrollbackExporterStyleProvider)(screen_char_t c,
+                                                                         iTermExternalAttribute * _Nullable ea);
+
+// Encodes chunks of scrollback history for ExportScrollbackRequest. Safe to use on any thread
+// provided the line buffer isn't being modified.
+@interface iTermScrollbackExporter : NSObject
+
++ (ITMExportScrollbackResponse *)responseForRequest:(ITMExportScrollbackRequest *)request
+                                         lineBuffer:(LineBuffer *)lineBuffer
+                                      styleProvider:(iTermScrollbackExporterStyleProvider)styleProvider;
+
+@end
+
+NS_ASSUME_NONNULL_END
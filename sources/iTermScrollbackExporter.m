@@ -0,0 +1,195 @@
+//
+//  iTermScrollbackExporter.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermScrollbackExporter.h"
+
+#import "LineBuffer.h"
+#import "NSObject+iTerm.h"
+#import "iTermExternalAttributeIndex.h"
+
+// Requests for more than this many cells get this many.
+static const int iTermScrollbackExporterMaximumCells = 1024 * 1024;
+
+@implementation iTermScrollbackExporter {
+    ITMExportScrollbackResponse *_response;
+    iTermScrollbackExporterStyleProvider _styleProvider;
+    NSMutableData *_characters;
+    int _numberOfCharacters;
+
+    ITMCodePointsPerCell *_cpps;
+
+    // Maps each style in the table to its index.
+    NSMutableDictionary<ITMCellStyle *, NSNumber *> *_styleIndexes;
+
+    // The style run being built. It has no cells if there is none.
+    int _styleRunLength;
+    int _styleRunIndex;
+    screen_char_t _styleRunCharacter;
+    iTermExternalAttribute *_styleRunAttribute;
+}
+
++ (ITMExportScrollbackResponse *)responseForRequest:(ITMExportScrollbackRequest *)request
+                                         lineBuffer:(LineBuffer *)lineBuffer
+                                      styleProvider:(iTermScrollbackExporterStyleProvider)styleProvider {
+    if (request.hasMaxCells && request.maxCells <= 0) {
+        ITMExportScrollbackResponse *response = [[ITMExportScrollbackResponse alloc] init];
+        response.status = ITMExportScrollbackResponse_Status_RequestMalformed;
+        return response;
+    }
+    iTermScrollbackExporter *exporter =
+        [[iTermScrollbackExporter alloc] initWithStyleProvider:request.includeStyles ? styleProvider : nil];
+    return [exporter responseForLineBuffer:lineBuffer
+                                  position:request.hasPosition ? request.position : nil
+                                  maxCells:MIN(request.maxCells, iTermScrollbackExporterMaximumCells)];
+}
+
+- (instancetype)initWithStyleProvider:(iTermScrollbackExporterStyleProvider)styleProvider {
+    self = [super init];
+    if (self) {
+        _response = [[ITMExportScrollbackResponse alloc] init];
+        _styleProvider = [styleProvider copy];
+        _characters = [NSMutableData data];
+        _styleIndexes = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (ITMExportScrollbackResponse *)responseForLineBuffer:(LineBuffer *)lineBuffer
+                                              position:(ITMScrollbackPosition *)requestedPosition
+                                              maxCells:(int)maxCells {
+    LineBufferPosition *start = [lineBuffer firstPosition];
+    if (requestedPosition.absolutePosition > start.absolutePosition) {
+        start.absolutePosition = requestedPosition.absolutePosition;
+        start.yOffset = requestedPosition.yOffset;
+    } else if (requestedPosition.absolutePosition == start.absolutePosition) {
+        start.yOffset = requestedPosition.yOffset;
+    }
+
+    __block int cellsPassed = 0;
+    __block BOOL first = YES;
+    LineBufferPosition *next = [lineBuffer enumerateRawLinesFromPosition:start
+                                                                maxCells:maxCells
+                                                                   block:^(ScreenCharArray *chars,
+                                                                           BOOL continuesLine,
+                                                                           BOOL endsLine) {
+        if (first) {
+            self->_response.continuesLine = continuesLine;
+            first = NO;
+        }
+        [self appendCells:chars];
+        if (endsLine) {
+            [self appendNewline];
+        }
+        cellsPassed += MAX(1, chars.length);
+    }];
+
+    if (_cpps.repeats > 0) {
+        [_response.codePointsPerCellArray addObject:_cpps];
+    }
+    [self endStyleRun];
+    _response.text = [[NSString alloc] initWithCharacters:_characters.bytes length:_numberOfCharacters];
+    _response.position = [self protoPosition:start];
+    _response.nextPosition = [self protoPosition:next];
+    _response.atEnd = (cellsPassed < maxCells);
+    _response.status = ITMExportScrollbackResponse_Status_Ok;
+    return _response;
+}
+
+- (ITMScrollbackPosition *)protoPosition:(LineBufferPosition *)position {
+    ITMScrollbackPosition *result = [[ITMScrollbackPosition alloc] init];
+    result.absolutePosition = position.absolutePosition;
+    result.yOffset = position.yOffset;
+    return result;
+}
+
+- (void)appendCells:(ScreenCharArray *)chars {
+    const int length = chars.length;
+    [_response.lineLengthsArray addValue:length];
+    if (length == 0) {
+        return;
+    }
+    [self ensureCapacity:_numberOfCharacters + length * kMaxParts];
+    unichar *characters = _characters.mutableBytes;
+    const screen_char_t *line = chars.line;
+    iTermExternalAttributeIndex *eaIndex = chars.eaIndex;
+    for (int i = 0; i < length; i++) {
+        int numCodePoints;
+        const unichar c = line[i].code;
+        if (!line[i].complexChar && c >= ITERM2_PRIVATE_BEGIN && c <= ITERM2_PRIVATE_END) {
+            numCodePoints = 0;
+        } else if (line[i].image) {
+            numCodePoints = 0;
+        } else {
+            numCodePoints = ExpandScreenChar(&line[i], characters + _numberOfCharacters);
+            _numberOfCharacters += numCodePoints;
+        }
+        [self appendCellWithCodePoints:numCodePoints];
+        if (_styleProvider) {
+            [self appendStyleOfCharacter:line[i] externalAttribute:eaIndex[i]];
+        }
+    }
+}
+
+- (void)appendNewline {
+    [self ensureCapacity:_numberOfCharacters + 1];
+    unichar *characters = _characters.mutableBytes;
+    characters[_numberOfCharacters++] = '\n';
+}
+
+- (void)ensureCapacity:(int)numberOfCharacters {
+    const NSUInteger length = numberOfCharacters * sizeof(unichar);
+    if (_characters.length < length) {
+        _characters.length = MAX(length, _characters.length * 2);
+    }
+}
+
+- (void)appendCellWithCodePoints:(int)numCodePoints {
+    if (_cpps && _cpps.numCodePoints == numCodePoints) {
+        _cpps.repeats = _cpps.repeats + 1;
+        return;
+    }
+    if (_cpps) {
+        [_response.codePointsPerCellArray addObject:_cpps];
+    }
+    _cpps = [[ITMCodePointsPerCell alloc] init];
+    _cpps.numCodePoints = numCodePoints;
+    _cpps.repeats = 1;
+}
+
+- (void)appendStyleOfCharacter:(screen_char_t)c externalAttribute:(iTermExternalAttribute *)ea {
+    if (_styleRunLength > 0 &&
+        ScreenCharacterAttributesEqual(c, _styleRunCharacter) &&
+        [NSObject object:ea isEqualToObject:_styleRunAttribute]) {
+        _styleRunLength += 1;
+        return;
+    }
+    [self endStyleRun];
+
+    ITMCellStyle *style = _styleProvider(c, ea);
+    style.hasRepeats = NO;
+    NSNumber *index = _styleIndexes[style];
+    if (!index) {
+        index = @(_response.styleTableArray.count);
+        [_response.styleTableArray addObject:style];
+        _styleIndexes[style] = index;
+    }
+    _styleRunLength = 1;
+    _styleRunIndex = index.intValue;
+    _styleRunCharacter = c;
+    _styleRunAttribute = ea;
+}
+
+- (void)endStyleRun {
+    if (_styleRunLength == 0) {
+        return;
+    }
+    [_response.styleRunLengthsArray addValue:_styleRunLength];
+    [_response.styleRunIndexesArray addValue:_styleRunIndex];
+    _styleRunLength = 0;
+}
+
+@end
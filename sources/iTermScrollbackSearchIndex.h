@@ -0,0 +1,76 @@
+//
+//  iTermScrollbackSearchIndex.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "FindContext.h"
+#import "iTermFindViewController.h"
+#import "ScreenChar.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// The set of trigrams that occur in a block, hashed into a fixed-size bitmap (1 KB per block,
+// about 1% of a typical block's characters). ASCII letters are folded to lowercase. Any other
+// non-ASCII character is recorded as a wildcard that may stand for any single character of a
+// query. Cells that don't appear in searchable text, such as the right half of a double-width
+// character, are skipped.
+@interface iTermTrigramSignature : NSObject
+
+// Set if any cell held something other than ASCII. Case-insensitive searches fold diacritics
+// and ligatures, so one such character may match several query characters.
+@property (nonatomic, readonly) BOOL hasNonASCII;
+
+// Trigrams never span calls.
+- (void)addCells:(const screen_char_t *)cells length:(int)length;
+
+@end
+
+// The trigrams that must occur in any line that matches a query.
+@interface iTermTrigramQuery : NSObject
+
+// Returns nil if the query has no required trigrams, so nothing can be skipped. For regular
+// expressions, only literal runs outside of groups and not followed by an optional quantifier are
+// used, and any alternation gives up.
++ (nullable instancetype)queryWithString:(NSString *)string
+                                 options:(FindOptions)options
+                                    mode:(iTermFindMode)mode;
+- (instancetype)init NS_UNAVAILABLE;
+
+// NO means that no line in a block with this signature can match.
+- (BOOL)mayMatchSignature:(iTermTrigramSignature *)signature;
+
+@end
+
+// Trigram signatures of a line buffer's sealed blocks, so a search can skip blocks that can't
+// contain a match. The line buffer adds blocks as they're sealed and removes them as they're
+// dropped. Its copies share the index and only read it.
+//
+// Signatures are keyed by absolute block number and tagged with the block's generation, so a
+// block that changes after it was indexed is simply searched. Thread-safe.
+@interface iTermScrollbackSearchIndex : NSObject
+
+@property (nonatomic, readonly) NSInteger count;
+
+- (void)setSignature:(iTermTrigramSignature *)signature
+      forBlockNumber:(long long)blockNumber
+          generation:(NSInteger)generation;
+
+// Returns nil if the block wasn't indexed or has changed since.
+- (nullable iTermTrigramSignature *)signatureForBlockNumber:(long long)blockNumber
+                                                 generation:(NSInteger)generation;
+
+- (void)removeSignaturesBeforeBlockNumber:(long long)blockNumber;
+
+// Like +[iTermTrigramQuery queryWithString:options:mode:] but remembers the last query, since a
+// search asks once per block.
+- (nullable iTermTrigramQuery *)queryWithString:(NSString *)string
+                                        options:(FindOptions)options
+                                           mode:(iTermFindMode)mode;
+
+@end
+
+NS_ASSUME_NONNULL_END
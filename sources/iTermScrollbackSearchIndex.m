@@ -0,0 +1,273 @@
+//
+//  iTermScrollbackSearchIndex.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermScrollbackSearchIndex.h"
+
+#import "DebugLogging.h"
+#import "iTermRegexLiterals.h"
+
+#import <os/lock.h>
+
+// Must be a power of two.
+static const uint32_t iTermTrigramSignatureBits = 8192;
+static const int iTermTrigramSignatureHashShift = 32 - 13;
+
+// Stands for any non-ASCII character. Folded ASCII characters are all below this.
+static const uint8_t iTermTrigramWildcard = 0x80;
+
+NS_INLINE uint32_t iTermTrigramHash(uint8_t a, uint8_t b, uint8_t c) {
+    const uint32_t key = ((uint32_t)a << 16) | ((uint32_t)b << 8) | c;
+    return (key * 2654435761u) >> iTermTrigramSignatureHashShift;
+}
+
+NS_INLINE uint8_t iTermTrigramFoldASCII(unichar c) {
+    if (c >= 'A' && c <= 'Z') {
+        return c + ('a' - 'A');
+    }
+    return c;
+}
+
+@implementation iTermTrigramSignature {
+    uint64_t _bits[iTermTrigramSignatureBits / 64];
+}
+
+- (void)addCells:(const screen_char_t *)cells length:(int)length {
+    uint8_t a = 0;
+    uint8_t b = 0;
+    int n = 0;
+    for (int i = 0; i < length; i++) {
+        const screen_char_t *cell = &cells[i];
+        if (cell->image ||
+            (!cell->complexChar && cell->code >= ITERM2_PRIVATE_BEGIN && cell->code <= ITERM2_PRIVATE_END)) {
+            // Not part of the searchable text. See ScreenCharArrayToString().
+            continue;
+        }
+        uint8_t c;
+        if (!cell->complexChar && cell->code < 0x80) {
+            c = iTermTrigramFoldASCII(cell->code);
+        } else {
+            c = iTermTrigramWildcard;
+            _hasNonASCII = YES;
+        }
+        if (++n >= 3) {
+            const uint32_t h = iTermTrigramHash(a, b, c);
+            _bits[h / 64] |= (1ULL << (h % 64));
+        }
+        a = b;
+        b = c;
+    }
+}
+
+- (BOOL)containsHash:(uint32_t)h {
+    return (_bits[h / 64] & (1ULL << (h % 64))) != 0;
+}
+
+@end
+
+@implementation iTermTrigramQuery {
+    NSData *_trigrams;  // Packed as three bytes each.
+    BOOL _caseInsensitive;
+}
+
++ (instancetype)queryWithString:(NSString *)string
+                        options:(FindOptions)options
+                           mode:(iTermFindMode)mode {
+    if (string.length < 3 || (options & FindOptMultiLine)) {
+        return nil;
+    }
+    NSMutableData *trigrams = [NSMutableData data];
+    BOOL caseInsensitive = NO;
+    switch (mode) {
+        case iTermFindModeSmartCaseSensitivity:
+            // Must agree with CoreSubstringSearch().
+            caseInsensitive = ([string rangeOfCharacterFromSet:[NSCharacterSet uppercaseLetterCharacterSet]].location == NSNotFound);
+            [self addTrigramsInLiteral:string to:trigrams];
+            break;
+        case iTermFindModeCaseSensitiveSubstring:
+            [self addTrigramsInLiteral:string to:trigrams];
+            break;
+        case iTermFindModeCaseInsensitiveSubstring:
+            caseInsensitive = YES;
+            [self addTrigramsInLiteral:string to:trigrams];
+            break;
+        case iTermFindModeCaseSensitiveRegex:
+            [self addTrigramsInRegex:string to:trigrams];
+            break;
+        case iTermFindModeCaseInsensitiveRegex:
+            caseInsensitive = YES;
+            [self addTrigramsInRegex:string to:trigrams];
+            break;
+    }
+    if (trigrams.length == 0) {
+        return nil;
+    }
+    return [[self alloc] initWithTrigrams:trigrams caseInsensitive:caseInsensitive];
+}
+
+- (instancetype)initWithTrigrams:(NSData *)trigrams caseInsensitive:(BOOL)caseInsensitive {
+    self = [super init];
+    if (self) {
+        _trigrams = trigrams;
+        _caseInsensitive = caseInsensitive;
+    }
+    return self;
+}
+
+// Only printable ASCII is indexed exactly. Anything else ends a run, since it may match a
+// different number of characters in the text.
++ (void)addTrigramsInLiteral:(NSString *)string to:(NSMutableData *)trigrams {
+    NSMutableData *run = [NSMutableData data];
+    const NSInteger length = string.length;
+    for (NSInteger i = 0; i < length; i++) {
+        const unichar c = [string characterAtIndex:i];
+        if (c < ' ' || c > '~') {
+            [self addTrigramsInRun:run to:trigrams];
+            continue;
+        }
+        const uint8_t folded = iTermTrigramFoldASCII(c);
+        [run appendBytes:&folded length:1];
+    }
+    [self addTrigramsInRun:run to:trigrams];
+}
+
++ (void)addTrigramsInRun:(NSMutableData *)run to:(NSMutableData *)trigrams {
+    const uint8_t *bytes = run.bytes;
+    for (NSInteger i = 0; i + 3 <= (NSInteger)run.length; i++) {
+        [trigrams appendBytes:bytes + i length:3];
+    }
+    run.length = 0;
+}
+
+// Only literal runs that every match must contain are used.
++ (void)addTrigramsInRegex:(NSString *)pattern to:(NSMutableData *)trigrams {
+    for (NSString *literal in [iTermRegexLiterals requiredLiteralsInPattern:pattern]) {
+        [self addTrigramsInLiteral:literal to:trigrams];
+    }
+}
+
+- (BOOL)mayMatchSignature:(iTermTrigramSignature *)signature {
+    const BOOL hasNonASCII = signature.hasNonASCII;
+    if (_caseInsensitive && hasNonASCII) {
+        return YES;
+    }
+    const uint8_t *bytes = _trigrams.bytes;
+    const NSInteger count = _trigrams.length / 3;
+    for (NSInteger i = 0; i < count; i++) {
+        const uint8_t *t = bytes + i * 3;
+        if ([signature containsHash:iTermTrigramHash(t[0], t[1], t[2])]) {
+            continue;
+        }
+        if (!hasNonASCII || ![self signature:signature containsTrigramWithWildcards:t]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+// Checks the trigram with each nonempty combination of its characters replaced by a wildcard.
+- (BOOL)signature:(iTermTrigramSignature *)signature containsTrigramWithWildcards:(const uint8_t *)t {
+    const uint8_t w = iTermTrigramWildcard;
+    for (int mask = 1; mask < 8; mask++) {
+        const uint32_t h = iTermTrigramHash((mask & 4) ? w : t[0],
+                                            (mask & 2) ? w : t[1],
+                                            (mask & 1) ? w : t[2]);
+        if ([signature containsHash:h]) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+@end
+
+@implementation iTermScrollbackSearchIndex {
+    os_unfair_lock _lock;
+    NSMutableDictionary<NSNumber *, iTermTrigramSignature *> *_signatures;
+    NSMutableDictionary<NSNumber *, NSNumber *> *_generations;
+
+    NSString *_lastQueryString;
+    FindOptions _lastQueryOptions;
+    iTermFindMode _lastQueryMode;
+    iTermTrigramQuery *_lastQuery;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _signatures = [NSMutableDictionary dictionary];
+        _generations = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (NSInteger)count {
+    os_unfair_lock_lock(&_lock);
+    const NSInteger count = _signatures.count;
+    os_unfair_lock_unlock(&_lock);
+    return count;
+}
+
+- (void)setSignature:(iTermTrigramSignature *)signature
+      forBlockNumber:(long long)blockNumber
+          generation:(NSInteger)generation {
+    os_unfair_lock_lock(&_lock);
+    _signatures[@(blockNumber)] = signature;
+    _generations[@(blockNumber)] = @(generation);
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (iTermTrigramSignature *)signatureForBlockNumber:(long long)blockNumber
+                                        generation:(NSInteger)generation {
+    os_unfair_lock_lock(&_lock);
+    iTermTrigramSignature *signature = nil;
+    if ([_generations[@(blockNumber)] integerValue] == generation) {
+        signature = _signatures[@(blockNumber)];
+    }
+    os_unfair_lock_unlock(&_lock);
+    return signature;
+}
+
+- (void)removeSignaturesBeforeBlockNumber:(long long)blockNumber {
+    os_unfair_lock_lock(&_lock);
+    NSArray<NSNumber *> *keys = [_signatures.allKeys filteredArrayUsingPredicate:
+                                 [NSPredicate predicateWithBlock:^BOOL(NSNumber *key, NSDictionary *bindings) {
+        return key.longLongValue < blockNumber;
+    }]];
+    [_signatures removeObjectsForKeys:keys];
+    [_generations removeObjectsForKeys:keys];
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (iTermTrigramQuery *)queryWithString:(NSString *)string
+                               options:(FindOptions)options
+                                  mode:(iTermFindMode)mode {
+    // Backwards and multiple-results options don't affect which trigrams are required.
+    const FindOptions relevantOptions = options & FindOptMultiLine;
+    os_unfair_lock_lock(&_lock);
+    if (_lastQueryString && [_lastQueryString isEqualToString:string] &&
+        _lastQueryOptions == relevantOptions &&
+        _lastQueryMode == mode) {
+        iTermTrigramQuery *query = _lastQuery;
+        os_unfair_lock_unlock(&_lock);
+        return query;
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    iTermTrigramQuery *query = [iTermTrigramQuery queryWithString:string options:options mode:mode];
+    DLog(@"Trigram query for %@ is %@", string, query);
+
+    os_unfair_lock_lock(&_lock);
+    _lastQueryString = [string copy];
+    _lastQueryOptions = relevantOptions;
+    _lastQueryMode = mode;
+    _lastQuery = query;
+    os_unfair_lock_unlock(&_lock);
+    return query;
+}
+
+@end
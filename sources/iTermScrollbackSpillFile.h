@@ -0,0 +1,40 @@
+//
+//  iTermScrollbackSpillFile.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// An append-only temporary file that holds scrollback characters moved out of memory. There is
+// one per session with unlimited scrollback. It's unlinked as soon as it's created, so nothing is
+// left behind if we crash; the space is reclaimed once the last object that references it goes
+// away.
+//
+// Records are never rewritten, so a record can be read or mapped at any time from any thread.
+@interface iTermScrollbackSpillFile : NSObject
+
+// Bytes appended so far, including alignment padding.
+@property (nonatomic, readonly) long long length;
+
+// Returns nil if the file couldn't be created.
++ (nullable instancetype)spillFile;
+- (instancetype)init NS_UNAVAILABLE;
+
+// Appends `length` bytes followed by `zeroPadding` bytes of zeros and returns the record's offset,
+// or -1 if writing failed (for example, because the disk is full). Thread-safe.
+- (long long)appendBytes:(const void *)bytes length:(size_t)length zeroPadding:(size_t)zeroPadding;
+
+// Maps a record's `length` bytes privately: pages are read on demand and writes to the mapping
+// don't reach the file. Release it with munmap(). Returns NULL on failure.
+- (void * _Nullable)mapRecordAtOffset:(long long)offset length:(size_t)length;
+
+// Copies a record without mapping it. Returns NO on failure.
+- (BOOL)readRecordAtOffset:(long long)offset length:(size_t)length into:(void *)destination;
+
+@end
+
+NS_ASSUME_NONNULL_END
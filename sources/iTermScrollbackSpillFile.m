@@ -0,0 +1,119 @@
+//
+//  iTermScrollbackSpillFile.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermScrollbackSpillFile.h"
+
+#import "DebugLogging.h"
+#import "iTermMalloc.h"
+
+#import <os/lock.h>
+#import <sys/mman.h>
+
+@implementation iTermScrollbackSpillFile {
+    int _fd;
+    os_unfair_lock _lock;
+    long long _length;
+}
+
++ (instancetype)spillFile {
+    NSString *template = [NSTemporaryDirectory() stringByAppendingPathComponent:@"iTerm2-scrollback-XXXXXX"];
+    const char *templateCString = [template fileSystemRepresentation];
+    char *path = (char *)iTermMalloc(strlen(templateCString) + 1);
+    strcpy(path, templateCString);
+    // mkstemp creates the file readable only by us.
+    const int fd = mkstemp(path);
+    if (fd == -1) {
+        XLog(@"mkstemp failed with template %s: %s", path, strerror(errno));
+        free(path);
+        return nil;
+    }
+    unlink(path);
+    free(path);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return [[self alloc] initWithFileDescriptor:fd];
+}
+
+- (instancetype)initWithFileDescriptor:(int)fd {
+    self = [super init];
+    if (self) {
+        _fd = fd;
+        _lock = OS_UNFAIR_LOCK_INIT;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    // Mappings made by -mapRecordAtOffset:length: remain valid after this.
+    close(_fd);
+}
+
+- (long long)length {
+    os_unfair_lock_lock(&_lock);
+    const long long length = _length;
+    os_unfair_lock_unlock(&_lock);
+    return length;
+}
+
+- (long long)appendBytes:(const void *)bytes length:(size_t)length zeroPadding:(size_t)zeroPadding {
+    os_unfair_lock_lock(&_lock);
+    // Records start on a page boundary so they can be mapped directly.
+    const long long pageSize = getpagesize();
+    const long long offset = (_length + pageSize - 1) / pageSize * pageSize;
+    const long long end = offset + (long long)length + (long long)zeroPadding;
+    size_t written = 0;
+    while (written < length) {
+        const ssize_t n = pwrite(_fd, (const char *)bytes + written, length - written, offset + written);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            DLog(@"pwrite failed: %s", strerror(errno));
+            os_unfair_lock_unlock(&_lock);
+            return -1;
+        }
+        written += n;
+    }
+    // Extending the file fills it with zeros without writing them.
+    if (zeroPadding > 0 && ftruncate(_fd, end) != 0) {
+        DLog(@"ftruncate failed: %s", strerror(errno));
+        os_unfair_lock_unlock(&_lock);
+        return -1;
+    }
+    _length = end;
+    os_unfair_lock_unlock(&_lock);
+    return offset;
+}
+
+- (void *)mapRecordAtOffset:(long long)offset length:(size_t)length {
+    if (length == 0) {
+        return NULL;
+    }
+    void *pointer = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, _fd, offset);
+    if (pointer == MAP_FAILED) {
+        DLog(@"mmap failed: %s", strerror(errno));
+        return NULL;
+    }
+    return pointer;
+}
+
+- (BOOL)readRecordAtOffset:(long long)offset length:(size_t)length into:(void *)destination {
+    size_t done = 0;
+    while (done < length) {
+        const ssize_t n = pread(_fd, (char *)destination + done, length - done, offset + done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            DLog(@"pread failed: %s", strerror(errno));
+            return NO;
+        }
+        done += n;
+    }
+    return YES;
+}
+
+@end
@@ -0,0 +1,42 @@
+//
+//  iTermTmuxOutputDecoder.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// The parts of a %output or %extended-output line:
+//   %output %<pane id> <data...>
+//   %extended-output %<pane id> <latency> [more args?] : <data...>
+typedef struct {
+    int windowPane;
+    // Only set for %extended-output.
+    long long latency;
+    // Location of the still-escaped payload in the line.
+    NSRange payload;
+} iTermTmuxOutputLine;
+
+// Parses the header of a %output (or %extended-output, when `extended` is set) line of `length`
+// bytes. The line need not be null terminated. Returns NO if it is malformed.
+BOOL iTermTmuxParseOutputLine(const unsigned char *bytes,
+                              NSInteger length,
+                              BOOL extended,
+                              iTermTmuxOutputLine *line);
+
+// Decodes tmux's escaping of pane output into `output`, which must have room for `length` bytes
+// since decoding never lengthens its input. Bytes below space and backslash arrive as exactly three
+// octal digits after a backslash (a malformed escape becomes '?'). Unescaped control characters are
+// dropped, since the line driver may add \r's anywhere, and a NUL ends the input. Returns the number
+// of bytes written.
+NSInteger iTermTmuxDecodeEscapedOutput(const unsigned char *bytes,
+                                       NSInteger length,
+                                       unsigned char *output);
+
+// Decodes `length` bytes of escaped output into a single new buffer.
+NSData *iTermTmuxDecodedOutput(const unsigned char *bytes, NSInteger length);
+
+NS_ASSUME_NONNULL_END
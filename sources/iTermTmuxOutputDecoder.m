@@ -0,0 +1,177 @@
+//
+//  iTermTmuxOutputDecoder.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermTmuxOutputDecoder.h"
+
+#if defined(__ARM_NEON)
+#import <arm_neon.h>
+#elif defined(__SSE2__)
+#import <emmintrin.h>
+#endif
+
+// Returns the length of the longest prefix of `bytes` that can be copied to the output as is: no
+// control characters and no backslashes. Almost all of a typical %output line is such a run.
+static inline NSInteger iTermTmuxCleanPrefixLength(const unsigned char *bytes, NSInteger length) {
+    NSInteger i = 0;
+#if defined(__ARM_NEON)
+    const uint8x16_t space = vdupq_n_u8(' ');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    while (i + 64 <= length) {
+        const uint8x16_t a = vld1q_u8(bytes + i);
+        const uint8x16_t b = vld1q_u8(bytes + i + 16);
+        const uint8x16_t c = vld1q_u8(bytes + i + 32);
+        const uint8x16_t d = vld1q_u8(bytes + i + 48);
+        const uint8x16_t ab = vandq_u8(vbicq_u8(vcgeq_u8(a, space), vceqq_u8(a, backslash)),
+                                       vbicq_u8(vcgeq_u8(b, space), vceqq_u8(b, backslash)));
+        const uint8x16_t cd = vandq_u8(vbicq_u8(vcgeq_u8(c, space), vceqq_u8(c, backslash)),
+                                       vbicq_u8(vcgeq_u8(d, space), vceqq_u8(d, backslash)));
+        if (vminvq_u8(vandq_u8(ab, cd)) != 0xff) {
+            break;
+        }
+        i += 64;
+    }
+    while (i + 16 <= length) {
+        const uint8x16_t v = vld1q_u8(bytes + i);
+        const uint8x16_t ok = vbicq_u8(vcgeq_u8(v, space), vceqq_u8(v, backslash));
+        // Narrow each byte of the mask to a nibble so the first failing lane can be found with ctz.
+        const uint64_t nibbles = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(ok), 4)), 0);
+        if (nibbles != UINT64_MAX) {
+            return i + (__builtin_ctzll(~nibbles) >> 2);
+        }
+        i += 16;
+    }
+#elif defined(__SSE2__)
+    // SSE2 has no unsigned comparison, but v >= ' ' exactly when max(v, ' ') == v.
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while (i + 16 <= length) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(bytes + i));
+        const __m128i ok = _mm_andnot_si128(_mm_cmpeq_epi8(v, backslash),
+                                            _mm_cmpeq_epi8(_mm_max_epu8(v, space), v));
+        const int mask = _mm_movemask_epi8(ok);
+        if (mask != 0xffff) {
+            return i + __builtin_ctz(~mask);
+        }
+        i += 16;
+    }
+#endif
+    while (i < length && bytes[i] >= ' ' && bytes[i] != '\\') {
+        i++;
+    }
+    return i;
+}
+
+NSInteger iTermTmuxDecodeEscapedOutput(const unsigned char *bytes,
+                                       NSInteger length,
+                                       unsigned char *output) {
+    NSInteger i = 0;
+    NSInteger o = 0;
+    while (i < length) {
+        const NSInteger span = iTermTmuxCleanPrefixLength(bytes + i, length - i);
+        memcpy(output + o, bytes + i, span);
+        i += span;
+        o += span;
+        if (i == length || bytes[i] == 0) {
+            break;
+        }
+        if (bytes[i++] != '\\') {
+            continue;
+        }
+        // Read exactly three bytes of octal values, or else produce '?' and leave the offending
+        // byte to be read again.
+        unsigned char c = 0;
+        for (int j = 0; j < 3; j++) {
+            if (i < length && bytes[i] == '\r') {
+                // Ignore \r's that the line driver sprinkles in at its pleasure.
+                i++;
+                continue;
+            }
+            if (i == length || bytes[i] < '0' || bytes[i] > '7') {
+                c = '?';
+                break;
+            }
+            c = c * 8 + (bytes[i++] - '0');
+        }
+        output[o++] = c;
+    }
+    return o;
+}
+
+NSData *iTermTmuxDecodedOutput(const unsigned char *bytes, NSInteger length) {
+    unsigned char *output = malloc(MAX(1, length));
+    const NSInteger decodedLength = iTermTmuxDecodeEscapedOutput(bytes, length, output);
+    return [NSData dataWithBytesNoCopy:output length:decodedLength freeWhenDone:YES];
+}
+
+// Parses a non-negative decimal number that ends just before `terminator`.
+static BOOL iTermTmuxParseNumber(const unsigned char *bytes,
+                                 const unsigned char *terminator,
+                                 long long max,
+                                 long long *value) {
+    if (bytes == terminator) {
+        return NO;
+    }
+    long long result = 0;
+    for (const unsigned char *p = bytes; p < terminator; p++) {
+        if (*p < '0' || *p > '9') {
+            return NO;
+        }
+        const int digit = *p - '0';
+        // Check before multiplying so the result can't overflow.
+        if (result > (max - digit) / 10) {
+            return NO;
+        }
+        result = result * 10 + digit;
+    }
+    *value = result;
+    return YES;
+}
+
+BOOL iTermTmuxParseOutputLine(const unsigned char *bytes,
+                              NSInteger length,
+                              BOOL extended,
+                              iTermTmuxOutputLine *line) {
+    const unsigned char *end = bytes + length;
+    const char *command = extended ? "%extended-output " : "%output ";
+    const size_t commandLength = strlen(command);
+    if ((size_t)length < commandLength || memcmp(bytes, command, commandLength)) {
+        return NO;
+    }
+
+    // Pane ID
+    const unsigned char *paneId = bytes + commandLength;
+    if (paneId == end || *paneId != '%') {
+        return NO;
+    }
+    paneId++;
+    const unsigned char *space = memchr(paneId, ' ', end - paneId);
+    long long windowPane = 0;
+    if (!space || !iTermTmuxParseNumber(paneId, space, INT_MAX, &windowPane)) {
+        return NO;
+    }
+    line->windowPane = (int)windowPane;
+    line->latency = 0;
+    if (!extended) {
+        line->payload = NSMakeRange(space + 1 - bytes, end - space - 1);
+        return YES;
+    }
+
+    // Latency
+    const unsigned char *latency = space + 1;
+    space = memchr(latency, ' ', end - latency);
+    if (!space || !iTermTmuxParseNumber(latency, space, LLONG_MAX, &line->latency)) {
+        return NO;
+    }
+
+    // Skip unknown params
+    const unsigned char *colon = memchr(space + 1, ':', end - space - 1);
+    if (!colon || colon + 1 == end || colon[1] != ' ') {
+        return NO;
+    }
+    line->payload = NSMakeRange(colon + 2 - bytes, end - colon - 2);
+    return YES;
+}
@@ -0,0 +1,31 @@
+//
+//  iTermTriggerPrefilter.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Decides which of a set of regular expressions might match a string with a single pass over it,
+// so only those need to be run. Each pattern contributes its longest required literal (see
+// iTermRegexLiterals) to an Aho-Corasick automaton. A pattern without one is always a candidate.
+// Immutable, so it may be used from any thread.
+@interface iTermTriggerPrefilter : NSObject
+
+@property (nonatomic, readonly) NSUInteger count;
+
+// The number of patterns that are always candidates.
+@property (nonatomic, readonly) NSUInteger numberOfUnfilteredPatterns;
+
+- (instancetype)initWithPatterns:(NSArray<NSString *> *)patterns NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+// Indexes into the patterns this was created with. Patterns not included can't match `string`.
+- (NSIndexSet *)indexesOfPatternsThatMayMatchString:(NSString * _Nullable)string;
+
+@end
+
+NS_ASSUME_NONNULL_END
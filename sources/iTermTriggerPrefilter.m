@@ -0,0 +1,185 @@
+//
+//  iTermTriggerPrefilter.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermTriggerPrefilter.h"
+
+#import "iTermRegexLiterals.h"
+
+// Required literals are printable ASCII, so any other character resets the automaton.
+static const NSUInteger iTermTriggerPrefilterAlphabetSize = 128;
+
+// Characters are copied out of the string this many at a time.
+static const NSUInteger iTermTriggerPrefilterChunkSize = 256;
+
+@implementation iTermTriggerPrefilter {
+    // Row s gives the next state for each character in state s. Missing edges have been filled in
+    // from failure links, so scanning never backtracks.
+    NSData *_transitions;
+
+    // The patterns whose literal ends at state s, including those reached by failure links, are
+    // _outputs[_outputStarts[s]] up to _outputs[_outputStarts[s + 1]].
+    NSData *_outputStarts;
+    NSData *_outputs;
+
+    int32_t _numberOfStates;
+    NSIndexSet *_unfiltered;
+}
+
+- (instancetype)initWithPatterns:(NSArray<NSString *> *)patterns {
+    self = [super init];
+    if (self) {
+        _count = patterns.count;
+        NSMutableIndexSet *unfiltered = [NSMutableIndexSet indexSet];
+        NSMutableData *transitions = [NSMutableData data];
+        NSMutableArray<NSMutableIndexSet *> *outputs = [NSMutableArray array];
+        [self addStateTo:transitions outputs:outputs];
+
+        [patterns enumerateObjectsUsingBlock:^(NSString *pattern, NSUInteger i, BOOL *stop) {
+            NSString *literal = [self longestRequiredLiteralInPattern:pattern];
+            if (!literal) {
+                [unfiltered addIndex:i];
+                return;
+            }
+            int32_t state = 0;
+            for (NSUInteger j = 0; j < literal.length; j++) {
+                const unichar c = [literal characterAtIndex:j];
+                const int32_t *table = transitions.mutableBytes;
+                int32_t next = table[state * iTermTriggerPrefilterAlphabetSize + c];
+                if (next < 0) {
+                    // Adding a state may move the table.
+                    next = [self addStateTo:transitions outputs:outputs];
+                    int32_t *mutableTable = transitions.mutableBytes;
+                    mutableTable[state * iTermTriggerPrefilterAlphabetSize + c] = next;
+                }
+                state = next;
+            }
+            [outputs[state] addIndex:i];
+        }];
+
+        _numberOfStates = (int32_t)outputs.count;
+        [self addFailureLinksTo:transitions outputs:outputs];
+        _transitions = transitions;
+        _unfiltered = unfiltered;
+        _numberOfUnfilteredPatterns = unfiltered.count;
+        [self flattenOutputs:outputs];
+    }
+    return self;
+}
+
+- (NSString *)longestRequiredLiteralInPattern:(NSString *)pattern {
+    NSString *longest = nil;
+    for (NSString *literal in [iTermRegexLiterals requiredLiteralsInPattern:pattern]) {
+        if (literal.length > longest.length) {
+            longest = literal;
+        }
+    }
+    return longest;
+}
+
+- (int32_t)addStateTo:(NSMutableData *)transitions outputs:(NSMutableArray<NSMutableIndexSet *> *)outputs {
+    const int32_t state = (int32_t)outputs.count;
+    int32_t row[iTermTriggerPrefilterAlphabetSize];
+    for (NSUInteger c = 0; c < iTermTriggerPrefilterAlphabetSize; c++) {
+        row[c] = -1;
+    }
+    [transitions appendBytes:row length:sizeof(row)];
+    [outputs addObject:[NSMutableIndexSet indexSet]];
+    return state;
+}
+
+// Visits states in breadth-first order so a state's failure link, which is always shallower, is
+// complete before the state itself.
+- (void)addFailureLinksTo:(NSMutableData *)transitions outputs:(NSArray<NSMutableIndexSet *> *)outputs {
+    int32_t *table = transitions.mutableBytes;
+    NSMutableData *failureData = [NSMutableData dataWithLength:_numberOfStates * sizeof(int32_t)];
+    int32_t *failure = failureData.mutableBytes;
+    NSMutableData *queueData = [NSMutableData dataWithLength:_numberOfStates * sizeof(int32_t)];
+    int32_t *queue = queueData.mutableBytes;
+    NSUInteger head = 0;
+    NSUInteger tail = 0;
+
+    for (NSUInteger c = 0; c < iTermTriggerPrefilterAlphabetSize; c++) {
+        const int32_t s = table[c];
+        if (s < 0) {
+            table[c] = 0;
+        } else {
+            failure[s] = 0;
+            queue[tail++] = s;
+        }
+    }
+    while (head < tail) {
+        const int32_t r = queue[head++];
+        int32_t *row = table + r * iTermTriggerPrefilterAlphabetSize;
+        const int32_t *failureRow = table + failure[r] * iTermTriggerPrefilterAlphabetSize;
+        for (NSUInteger c = 0; c < iTermTriggerPrefilterAlphabetSize; c++) {
+            const int32_t s = row[c];
+            if (s < 0) {
+                row[c] = failureRow[c];
+                continue;
+            }
+            failure[s] = failureRow[c];
+            [outputs[s] addIndexes:outputs[failure[s]]];
+            queue[tail++] = s;
+        }
+    }
+}
+
+- (void)flattenOutputs:(NSArray<NSIndexSet *> *)outputs {
+    NSMutableData *starts = [NSMutableData dataWithCapacity:(outputs.count + 1) * sizeof(int32_t)];
+    NSMutableData *flattened = [NSMutableData data];
+    for (NSIndexSet *indexes in outputs) {
+        const int32_t start = (int32_t)(flattened.length / sizeof(int32_t));
+        [starts appendBytes:&start length:sizeof(start)];
+        [indexes enumerateIndexesUsingBlock:^(NSUInteger i, BOOL *stop) {
+            const int32_t value = (int32_t)i;
+            [flattened appendBytes:&value length:sizeof(value)];
+        }];
+    }
+    const int32_t end = (int32_t)(flattened.length / sizeof(int32_t));
+    [starts appendBytes:&end length:sizeof(end)];
+    _outputStarts = starts;
+    _outputs = flattened;
+}
+
+- (NSIndexSet *)indexesOfPatternsThatMayMatchString:(NSString *)string {
+    NSMutableIndexSet *result = [_unfiltered mutableCopy];
+    const NSUInteger length = string.length;
+    NSUInteger remaining = _count - _numberOfUnfilteredPatterns;
+    if (remaining == 0 || length == 0) {
+        return result;
+    }
+    const int32_t *transitions = _transitions.bytes;
+    const int32_t *outputStarts = _outputStarts.bytes;
+    const int32_t *outputs = _outputs.bytes;
+    uint8_t found[_count];
+    memset(found, 0, sizeof(found));
+
+    unichar buffer[iTermTriggerPrefilterChunkSize];
+    int32_t state = 0;
+    for (NSUInteger offset = 0; offset < length; offset += iTermTriggerPrefilterChunkSize) {
+        const NSUInteger n = MIN(iTermTriggerPrefilterChunkSize, length - offset);
+        [string getCharacters:buffer range:NSMakeRange(offset, n)];
+        for (NSUInteger i = 0; i < n; i++) {
+            const unichar c = buffer[i];
+            state = (c < iTermTriggerPrefilterAlphabetSize) ? transitions[state * iTermTriggerPrefilterAlphabetSize + c] : 0;
+            for (int32_t j = outputStarts[state]; j < outputStarts[state + 1]; j++) {
+                const int32_t pattern = outputs[j];
+                if (found[pattern]) {
+                    continue;
+                }
+                found[pattern] = 1;
+                [result addIndex:pattern];
+                if (--remaining == 0) {
+                    return result;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+@end
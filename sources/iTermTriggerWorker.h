@@ -0,0 +1,42 @@
+//
+//  iTermTriggerWorker.h
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class Trigger;
+@class iTermStringLine;
+@class iTermTriggerPrefilter;
+
+// Runs triggers' regexes on a background queue so that the thread producing lines doesn't wait for
+// them. Performing actions is left to the caller.
+@interface iTermTriggerWorker : NSObject
+
+// How many lines may be waiting before the caller should stop adding more. The worker doesn't
+// enforce it, since it must never block the thread that adds lines.
+@property (nonatomic, readonly) NSInteger capacity;
+
+// Lines added but not yet matched. Safe to read on any thread.
+@property (nonatomic, readonly) NSInteger pendingCount;
+
+- (instancetype)initWithCapacity:(NSInteger)capacity NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+// Matches `stringLine` against each of `triggers`. Never blocks. `completion` is called on the
+// worker's queue, in the order lines were added, with one object per trigger: an iTermTriggerMatchResult, or NSNull if the trigger was
+// skipped because it is disabled, can't run on a partial line, or was ruled out by `prefilter`.
+- (void)addStringLine:(iTermStringLine *)stringLine
+             triggers:(NSArray<Trigger *> *)triggers
+            prefilter:(iTermTriggerPrefilter * _Nullable)prefilter
+          partialLine:(BOOL)partialLine
+           completion:(void (^)(NSArray *results))completion
+NS_SWIFT_NAME(add(_:triggers:prefilter:partialLine:completion:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,82 @@
+//
+//  iTermTriggerWorker.m
+//  iTerm2SharedARC
+//
+//  Created by agent on 10/16/26.
+//
+
+#import "iTermTriggerWorker.h"
+
+#import "AtomicHelpers.h"
+#import "DebugLogging.h"
+#import "Trigger.h"
+#import "iTermTriggerPrefilter.h"
+#import "iTerm2SharedARC-Swift.h"
+
+@implementation iTermTriggerWorker {
+    dispatch_queue_t _queue;
+    iTermAtomicInt64 *_pending;
+}
+
+- (instancetype)initWithCapacity:(NSInteger)capacity {
+    self = [super init];
+    if (self) {
+        _capacity = MAX(1, capacity);
+        // Token execution may be paused until the worker catches up, so don't let it run at a
+        // lower priority than the mutation queue.
+        dispatch_queue_attr_t attr = dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL,
+                                                                             QOS_CLASS_USER_INITIATED,
+                                                                             0);
+        _queue = dispatch_queue_create("com.iterm2.trigger-worker", attr);
+        _pending = iTermAtomicInt64Create();
+    }
+    return self;
+}
+
+- (void)dealloc {
+    iTermAtomicInt64Free(_pending);
+}
+
+- (NSInteger)pendingCount {
+    return iTermAtomicInt64Get(_pending);
+}
+
+- (void)addStringLine:(iTermStringLine *)stringLine
+             triggers:(NSArray<Trigger *> *)triggers
+            prefilter:(iTermTriggerPrefilter *)prefilter
+          partialLine:(BOOL)partialLine
+           completion:(void (^)(NSArray *results))completion {
+    if (iTermAtomicInt64Add(_pending, 1) > _capacity) {
+        DLog(@"%@ is over capacity with %@ lines pending", self, @(self.pendingCount));
+    }
+    dispatch_async(_queue, ^{
+        NSArray *results = [self resultsForStringLine:stringLine
+                                             triggers:triggers
+                                            prefilter:prefilter
+                                          partialLine:partialLine];
+        iTermAtomicInt64Add(self->_pending, -1);
+        completion(results);
+    });
+}
+
+- (NSArray *)resultsForStringLine:(iTermStringLine *)stringLine
+                         triggers:(NSArray<Trigger *> *)triggers
+                        prefilter:(iTermTriggerPrefilter *)prefilter
+                      partialLine:(BOOL)partialLine {
+    NSIndexSet *candidates = [prefilter indexesOfPatternsThatMayMatchString:stringLine.stringValue];
+    NSMutableArray *results = [NSMutableArray arrayWithCapacity:triggers.count];
+    NSUInteger i = 0;
+    for (Trigger *trigger in triggers) {
+        const NSUInteger index = i++;
+        if (trigger.disabled ||
+            (partialLine && !trigger.partialLine) ||
+            (candidates && ![candidates containsIndex:index])) {
+            [results addObject:[NSNull null]];
+            continue;
+        }
+        [results addObject:[trigger matchResultForString:stringLine]];
+    }
+    return results;
+}
+
+@end
@@ -15,9 +15,30 @@
 // Prefix of error message when connecting client is outdated.
 extern NSString *const iTermWebSocketConnectionLibraryVersionTooOldString;
 
+typedef struct {
+    uint64_t framesReceived;
+    uint64_t bytesReceived;
+    uint64_t framesSent;
+    uint64_t bytesSent;
+    // Frames sent while a write is in progress are combined into the next write, so this is at
+    // most framesSent.
+    uint64_t writes;
+} iTermWebSocketConnectionStatistics;
+
 @protocol iTermWebSocketConnectionDelegate<NSObject>
 - (void)webSocketConnectionDidTerminate:(iTermWebSocketConnection *)webSocketConnection;
-- (void)webSocketConnection:(iTermWebSocketConnection *)webSocketConnection didReadFrame:(iTermWebSocketFrame *)frame;
+// `decodedObject` is the result of -webSocketConnection:decodeFrame:, or nil if that isn't
+// implemented.
+- (void)webSocketConnection:(iTermWebSocketConnection *)webSocketConnection
+               didReadFrame:(iTermWebSocketFrame *)frame
+              decodedObject:(id)decodedObject;
+
+@optional
+// Called on the connection's own queue before the frame is passed along on the delegate queue.
+// Expensive decoding done here happens in parallel across connections instead of taking turns on
+// the delegate queue.
+- (id)webSocketConnection:(iTermWebSocketConnection *)webSocketConnection
+              decodeFrame:(iTermWebSocketFrame *)frame;
 @end
 
 @interface iTermWebSocketConnection : NSObject
@@ -28,6 +49,13 @@ extern NSString *const iTermWebSocketConnectionLibraryVersionTooOldString;
 @property(nonatomic, readonly) id key;
 @property(nonatomic, readonly) NSString *advisoryName;
 @property(nonatomic, readonly) NSString *guid;
+// Bytes given to the socket that haven't been written yet. A client that isn't reading makes this
+// grow. Any queue.
+@property(atomic, readonly) NSInteger unsentByteCount;
+// Any queue.
+@property(nonatomic, readonly) iTermWebSocketConnectionStatistics statistics;
+// The queue that sends and writes run on. Tests hold it to make sends pile up.
+@property(nonatomic, readonly) dispatch_queue_t testOnlyQueue;
 
 + (instancetype)newWebSocketConnectionForRequest:(NSURLRequest *)request
                                       connection:(iTermHTTPConnection *)connection
@@ -16,6 +16,7 @@
 #import "NSData+iTerm.h"
 
 #import <CommonCrypto/CommonDigest.h>
+#include <stdatomic.h>
 
 static NSString *const kProtocolName = @"api.iterm2.com";
 static const NSInteger kWebSocketVersion = 13;
@@ -37,6 +38,9 @@ typedef NS_ENUM(NSUInteger, iTermWebSocketConnectionState) {
     iTermWebSocketConnectionStateClosed
 };
 
+@interface iTermWebSocketConnection()
+@property(atomic, readwrite) NSInteger unsentByteCount;
+@end
 
 @implementation iTermWebSocketConnection {
     iTermHTTPConnection *_connection;
@@ -44,6 +48,16 @@ typedef NS_ENUM(NSUInteger, iTermWebSocketConnectionState) {
     iTermWebSocketFrame *_fragment;
     dispatch_queue_t _queue;
     iTermWebSocketFrameBuilder *_frameBuilder;
+
+    // Data to send once the write in progress finishes. Only valid while _writing is set.
+    dispatch_data_t _pendingWrite;  // _queue
+    BOOL _writing;  // _queue
+
+    _Atomic uint64_t _framesReceived;
+    _Atomic uint64_t _bytesReceived;
+    _Atomic uint64_t _framesSent;
+    _Atomic uint64_t _bytesSent;
+    _Atomic uint64_t _writes;
 }
 
 + (instancetype)newWebSocketConnectionForRequest:(NSURLRequest *)request
@@ -219,9 +233,25 @@ typedef NS_ENUM(NSUInteger, iTermWebSocketConnectionState) {
     });
 }
 
+// any queue
+- (iTermWebSocketConnectionStatistics)statistics {
+    return (iTermWebSocketConnectionStatistics) {
+        .framesReceived = atomic_load(&_framesReceived),
+        .bytesReceived = atomic_load(&_bytesReceived),
+        .framesSent = atomic_load(&_framesSent),
+        .bytesSent = atomic_load(&_bytesSent),
+        .writes = atomic_load(&_writes)
+    };
+}
+
+- (dispatch_queue_t)testOnlyQueue {
+    return _queue;
+}
+
 // queue
 - (BOOL)didReceiveData:(NSMutableData *)data {
     DLog(@"Read %@ bytes of data", @(data.length));
+    atomic_fetch_add(&_bytesReceived, data.length);
     __weak __typeof(self) weakSelf = self;
     [_frameBuilder addData:data
                      frame:^(iTermWebSocketFrame *frame, BOOL *stop) {
@@ -299,15 +329,47 @@ typedef NS_ENUM(NSUInteger, iTermWebSocketConnectionState) {
         [data length];  // Keep a reference to data
     });
 
+    self.unsentByteCount += data.length;
+    atomic_fetch_add(&_framesSent, 1);
+    atomic_fetch_add(&_bytesSent, data.length);
+    if (_writing) {
+        // Bursts of notifications go out in one write instead of one write apiece. Concatenating
+        // dispatch data doesn't copy it.
+        DLog(@"Write in progress. Append %@ bytes to the next write.", @(data.length));
+        _pendingWrite = _pendingWrite ? dispatch_data_create_concat(_pendingWrite, dispatchData) : dispatchData;
+        return;
+    }
+    [self write:dispatchData];
+}
+
+// queue
+- (void)write:(dispatch_data_t)dispatchData {
+    const NSInteger length = dispatch_data_get_size(dispatchData);
+    _writing = YES;
+    atomic_fetch_add(&_writes, 1);
     __weak __typeof(self) weakSelf = self;
     [_connection writeAsynchronously:dispatchData queue:_queue completion:^(bool done, dispatch_data_t  _Nullable data, int error) {
         DLog(@"Write progress: done=%d error=%d", (int)done, (int)error);
+        if (done) {
+            [weakSelf didFinishWriteOfLength:length];
+        }
         if (error) {
             [weakSelf reallyAbort];
         }
     }];
 }
 
+// queue
+- (void)didFinishWriteOfLength:(NSInteger)length {
+    self.unsentByteCount -= length;
+    _writing = NO;
+    dispatch_data_t pending = _pendingWrite;
+    _pendingWrite = nil;
+    if (pending) {
+        [self write:pending];
+    }
+}
+
 // any queue
 - (void)abortWithCompletion:(void (^)(void))completion {
     dispatch_async(_queue, ^{
@@ -348,9 +410,7 @@ typedef NS_ENUM(NSUInteger, iTermWebSocketConnectionState) {
             if (_state == iTermWebSocketConnectionStateOpen) {
                 if (frame.fin) {
                     DLog(@"Pass finished frame to delegate");
-                    dispatch_async(self.delegateQueue, ^{
-                        [self.delegate webSocketConnection:self didReadFrame:frame];
-                    });
+                    [self passFrameToDelegate:frame];
                 } else if (_fragment == nil) {
                     DLog(@"Begin fragmented frame");
                     _fragment = frame;
@@ -389,9 +449,7 @@ typedef NS_ENUM(NSUInteger, iTermWebSocketConnectionState) {
                     DLog(@"Fragmented frame finished. Sending to delegate");
                     iTermWebSocketFrame *fragment = _fragment;
                     _fragment = nil;
-                    dispatch_async(self.delegateQueue, ^{
-                        [self.delegate webSocketConnection:self didReadFrame:fragment];
-                    });
+                    [self passFrameToDelegate:fragment];
                 }
             } else {
                 [self reallyAbort];
@@ -421,6 +479,19 @@ typedef NS_ENUM(NSUInteger, iTermWebSocketConnectionState) {
     }
 }
 
+// queue
+- (void)passFrameToDelegate:(iTermWebSocketFrame *)frame {
+    atomic_fetch_add(&_framesReceived, 1);
+    id<iTermWebSocketConnectionDelegate> delegate = self.delegate;
+    id decodedObject = nil;
+    if ([delegate respondsToSelector:@selector(webSocketConnection:decodeFrame:)]) {
+        decodedObject = [delegate webSocketConnection:self decodeFrame:frame];
+    }
+    dispatch_async(self.delegateQueue, ^{
+        [self.delegate webSocketConnection:self didReadFrame:frame decodedObject:decodedObject];
+    });
+}
+
 // Any queue
 - (void)closeWithCompletion:(void (^)(void))completion {
     dispatch_async(_queue, ^{
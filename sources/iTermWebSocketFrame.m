@@ -85,6 +85,25 @@
     return frame;
 }
 
+// Clients mask every frame they send, so this runs over every byte received. Works eight bytes at
+// a time.
+static void iTermWebSocketFrameUnmask(unsigned char *data, NSInteger length, const unsigned char maskingKey[4]) {
+    uint64_t wideKey;
+    for (int i = 0; i < 8; i++) {
+        ((unsigned char *)&wideKey)[i] = maskingKey[i & 3];
+    }
+    NSInteger i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        word ^= wideKey;
+        memcpy(data + i, &word, sizeof(word));
+    }
+    for (; i < length; i++) {
+        data[i] ^= maskingKey[i & 3];
+    }
+}
+
 + (instancetype)frameWithDataSource:(unsigned char *(^)(int64_t))dataSource {
     DLog(@"Reading a frame...");
     iTermWebSocketFrame *frame = [[iTermWebSocketFrame alloc] init];
@@ -143,9 +162,7 @@
         return nil;
     }
     if (mask) {
-        for (int i = 0; i < payloadLength; i++) {
-            data[i] ^= maskingKey[i & 3];
-        }
+        iTermWebSocketFrameUnmask(data, payloadLength, maskingKey);
     }
     frame.payload = [NSData dataWithBytes:data length:payloadLength];
 
@@ -196,7 +213,8 @@
     }
     if (!_data) {
         DLog(@"Encoding frame %@", self);
-        NSMutableData *data = [NSMutableData data];
+        // Header is at most 10 bytes.
+        NSMutableData *data = [NSMutableData dataWithCapacity:self.payload.length + 10];
         uint8_t byte = 0;
         if (self.fin) {
             DLog(@"Set fin bit");
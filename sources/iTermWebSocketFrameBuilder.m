@@ -10,7 +10,10 @@
 #import "iTermWebSocketFrame.h"
 
 @implementation iTermWebSocketFrameBuilder {
+    // Bytes received but not yet consumed begin at _offset. The buffer is reused for the life of
+    // the connection so its storage is allocated only when it needs to grow.
     NSMutableData *_data;
+    NSUInteger _offset;
     iTermWebSocketFrame *_fragment;
 }
 
@@ -24,8 +27,12 @@
 
 - (void)addData:(NSData *)data frame:(void (^)(iTermWebSocketFrame *, BOOL *))frameBlock {
     [_data appendData:data];
+    [self parseFramesWithBlock:frameBlock];
+    [self discardConsumedBytes];
+}
 
-    __block int64_t offset = 0;
+- (void)parseFramesWithBlock:(void (^)(iTermWebSocketFrame *, BOOL *))frameBlock {
+    __block int64_t offset = _offset;
     __block BOOL eof = NO;
     while (!eof) {
         iTermWebSocketFrame *frame = [iTermWebSocketFrame frameWithDataSource:^unsigned char *(int64_t bytesWanted) {
@@ -39,8 +46,7 @@
             }
         }];
         if (!eof) {
-            [_data replaceBytesInRange:NSMakeRange(0, offset) withBytes:"" length:0];
-            offset = 0;
+            _offset = offset;
         }
         if (frame) {
             if (_fragment) {
@@ -72,4 +78,13 @@
     }
 }
 
+// Moves the unconsumed bytes to the front of the buffer once per read rather than once per frame.
+- (void)discardConsumedBytes {
+    if (_offset == 0) {
+        return;
+    }
+    [_data replaceBytesInRange:NSMakeRange(0, _offset) withBytes:"" length:0];
+    _offset = 0;
+}
+
 @end
@@ -51,6 +51,8 @@ CF_EXTERN_C_BEGIN
 @class ITMCreateTabRequest;
 @class ITMCreateTabResponse;
 @class ITMCustomEscapeSequenceNotification;
+@class ITMExportScrollbackRequest;
+@class ITMExportScrollbackResponse;
 @class ITMFocusChangedNotification;
 @class ITMFocusChangedNotification_Window;
 @class ITMFocusRequest;
@@ -141,7 +143,11 @@ CF_EXTERN_C_BEGIN
 @class ITMRestartSessionResponse;
 @class ITMSavedArrangementRequest;
 @class ITMSavedArrangementResponse;
+@class ITMScreenLineDelta;
+@class ITMScreenUpdateDelta;
+@class ITMScreenUpdateMonitorRequest;
 @class ITMScreenUpdateNotification;
+@class ITMScrollbackPosition;
 @class ITMSelection;
 @class ITMSelectionRequest;
 @class ITMSelectionRequest_GetSelectionRequest;
@@ -913,6 +919,22 @@ GPBEnumDescriptor *ITMListPromptsResponse_Status_EnumDescriptor(void);
  **/
 BOOL ITMListPromptsResponse_Status_IsValidValue(int32_t value);
 
+#pragma mark - Enum ITMExportScrollbackResponse_Status
+
+typedef GPB_ENUM(ITMExportScrollbackResponse_Status) {
+  ITMExportScrollbackResponse_Status_Ok = 0,
+  ITMExportScrollbackResponse_Status_SessionNotFound = 1,
+  ITMExportScrollbackResponse_Status_RequestMalformed = 2,
+};
+
+GPBEnumDescriptor *ITMExportScrollbackResponse_Status_EnumDescriptor(void);
+
+/**
+ * Checks to see if the given value is defined by the enum or was not known at
+ * the time this source was generated.
+ **/
+BOOL ITMExportScrollbackResponse_Status_IsValidValue(int32_t value);
+
 #pragma mark - Enum ITMGetProfilePropertyResponse_Status
 
 typedef GPB_ENUM(ITMGetProfilePropertyResponse_Status) {
@@ -1113,6 +1135,7 @@ typedef GPB_ENUM(ITMClientOriginatedMessage_FieldNumber) {
   ITMClientOriginatedMessage_FieldNumber_CloseRequest = 131,
   ITMClientOriginatedMessage_FieldNumber_InvokeFunctionRequest = 132,
   ITMClientOriginatedMessage_FieldNumber_ListPromptsRequest = 133,
+  ITMClientOriginatedMessage_FieldNumber_ExportScrollbackRequest = 134,
 };
 
 typedef GPB_ENUM(ITMClientOriginatedMessage_Submessage_OneOfCase) {
@@ -1151,6 +1174,7 @@ typedef GPB_ENUM(ITMClientOriginatedMessage_Submessage_OneOfCase) {
   ITMClientOriginatedMessage_Submessage_OneOfCase_CloseRequest = 131,
   ITMClientOriginatedMessage_Submessage_OneOfCase_InvokeFunctionRequest = 132,
   ITMClientOriginatedMessage_Submessage_OneOfCase_ListPromptsRequest = 133,
+  ITMClientOriginatedMessage_Submessage_OneOfCase_ExportScrollbackRequest = 134,
 };
 
 /**
@@ -1232,6 +1256,8 @@ GPB_FINAL @interface ITMClientOriginatedMessage : GPBMessage
 
 @property(nonatomic, readwrite, strong, null_resettable) ITMListPromptsRequest *listPromptsRequest;
 
+@property(nonatomic, readwrite, strong, null_resettable) ITMExportScrollbackRequest *exportScrollbackRequest;
+
 @end
 
 /**
@@ -1278,6 +1304,7 @@ typedef GPB_ENUM(ITMServerOriginatedMessage_FieldNumber) {
   ITMServerOriginatedMessage_FieldNumber_CloseResponse = 131,
   ITMServerOriginatedMessage_FieldNumber_InvokeFunctionResponse = 132,
   ITMServerOriginatedMessage_FieldNumber_ListPromptsResponse = 133,
+  ITMServerOriginatedMessage_FieldNumber_ExportScrollbackResponse = 134,
   ITMServerOriginatedMessage_FieldNumber_Notification = 1000,
 };
 
@@ -1318,6 +1345,7 @@ typedef GPB_ENUM(ITMServerOriginatedMessage_Submessage_OneOfCase) {
   ITMServerOriginatedMessage_Submessage_OneOfCase_CloseResponse = 131,
   ITMServerOriginatedMessage_Submessage_OneOfCase_InvokeFunctionResponse = 132,
   ITMServerOriginatedMessage_Submessage_OneOfCase_ListPromptsResponse = 133,
+  ITMServerOriginatedMessage_Submessage_OneOfCase_ExportScrollbackResponse = 134,
   ITMServerOriginatedMessage_Submessage_OneOfCase_Notification = 1000,
 };
 
@@ -1404,6 +1432,8 @@ GPB_FINAL @interface ITMServerOriginatedMessage : GPBMessage
 
 @property(nonatomic, readwrite, strong, null_resettable) ITMListPromptsResponse *listPromptsResponse;
 
+@property(nonatomic, readwrite, strong, null_resettable) ITMExportScrollbackResponse *exportScrollbackResponse;
+
 /** This is the only response that is sent spontaneously. The 'id' field will not be set. */
 @property(nonatomic, readwrite, strong, null_resettable) ITMNotification *notification;
 
@@ -3692,6 +3722,39 @@ GPB_FINAL @interface ITMPromptMonitorRequest : GPBMessage
 
 @end
 
+#pragma mark - ITMScreenUpdateMonitorRequest
+
+typedef GPB_ENUM(ITMScreenUpdateMonitorRequest_FieldNumber) {
+  ITMScreenUpdateMonitorRequest_FieldNumber_Deltas = 1,
+  ITMScreenUpdateMonitorRequest_FieldNumber_IncludeStyles = 2,
+  ITMScreenUpdateMonitorRequest_FieldNumber_Resync = 3,
+};
+
+/**
+ * Arguments for NOTIFY_ON_SCREEN_UPDATE.
+ **/
+GPB_FINAL @interface ITMScreenUpdateMonitorRequest : GPBMessage
+
+/**
+ * If set, each ScreenUpdateNotification carries a `delta` describing the lines and cells that
+ * changed since the previous one, so there's no need to follow up with a GetBufferRequest.
+ **/
+@property(nonatomic, readwrite) BOOL deltas;
+
+@property(nonatomic, readwrite) BOOL hasDeltas;
+/** Populate `style` field of the `LineContents` in deltas? */
+@property(nonatomic, readwrite) BOOL includeStyles;
+
+@property(nonatomic, readwrite) BOOL hasIncludeStyles;
+/**
+ * Send with subscribe=true for an existing subscription with deltas to have the next delta be a
+ * full refresh. Do this when a delta's `sequence_number` skips a value.
+ **/
+@property(nonatomic, readwrite) BOOL resync;
+
+@property(nonatomic, readwrite) BOOL hasResync;
+@end
+
 #pragma mark - ITMNotificationRequest
 
 typedef GPB_ENUM(ITMNotificationRequest_FieldNumber) {
@@ -3704,6 +3767,9 @@ typedef GPB_ENUM(ITMNotificationRequest_FieldNumber) {
   ITMNotificationRequest_FieldNumber_ProfileChangeRequest = 7,
   ITMNotificationRequest_FieldNumber_KeystrokeFilterRequest = 8,
   ITMNotificationRequest_FieldNumber_PromptMonitorRequest = 9,
+  ITMNotificationRequest_FieldNumber_ScreenUpdateMonitorRequest = 10,
+  ITMNotificationRequest_FieldNumber_CoalescingWindowMs = 11,
+  ITMNotificationRequest_FieldNumber_MaxRate = 12,
 };
 
 typedef GPB_ENUM(ITMNotificationRequest_Arguments_OneOfCase) {
@@ -3714,6 +3780,7 @@ typedef GPB_ENUM(ITMNotificationRequest_Arguments_OneOfCase) {
   ITMNotificationRequest_Arguments_OneOfCase_ProfileChangeRequest = 7,
   ITMNotificationRequest_Arguments_OneOfCase_KeystrokeFilterRequest = 8,
   ITMNotificationRequest_Arguments_OneOfCase_PromptMonitorRequest = 9,
+  ITMNotificationRequest_Arguments_OneOfCase_ScreenUpdateMonitorRequest = 10,
 };
 
 GPB_FINAL @interface ITMNotificationRequest : GPBMessage
@@ -3751,6 +3818,32 @@ GPB_FINAL @interface ITMNotificationRequest : GPBMessage
 
 @property(nonatomic, readwrite, strong, null_resettable) ITMPromptMonitorRequest *promptMonitorRequest;
 
+@property(nonatomic, readwrite, strong, null_resettable) ITMScreenUpdateMonitorRequest *screenUpdateMonitorRequest;
+
+/**
+ * Limits how often notifications that describe current state are delivered to this
+ * connection for this notification type. These are screen updates without deltas and
+ * variable, layout, broadcast domain, and profile changes. Other notifications describe events
+ * and are always delivered right away.
+ *
+ * A notification that comes less than coalescing_window_ms after the previous one with the
+ * same key (the same session's screen, the same variable, and so on) is held until the window
+ * ends. Newer ones with the same key replace it, so only the latest is delivered. Its
+ * coalesced_count says how many it replaced.
+ *
+ * The most recent subscription for a notification type sets the limit for all of the
+ * connection's subscriptions of that type. Subscribing without either field removes it.
+ **/
+@property(nonatomic, readwrite) uint32_t coalescingWindowMs;
+
+@property(nonatomic, readwrite) BOOL hasCoalescingWindowMs;
+/**
+ * Maximum number of notifications per second for each key. This is the same as a coalescing
+ * window of 1000 / max_rate milliseconds. If both are set, the longer window is used.
+ **/
+@property(nonatomic, readwrite) double maxRate;
+
+@property(nonatomic, readwrite) BOOL hasMaxRate;
 @end
 
 /**
@@ -3787,6 +3880,7 @@ typedef GPB_ENUM(ITMNotification_FieldNumber) {
   ITMNotification_FieldNumber_BroadcastDomainsChanged = 11,
   ITMNotification_FieldNumber_VariableChangedNotification = 12,
   ITMNotification_FieldNumber_ProfileChangedNotification = 13,
+  ITMNotification_FieldNumber_CoalescedCount = 14,
 };
 
 GPB_FINAL @interface ITMNotification : GPBMessage
@@ -3843,6 +3937,13 @@ GPB_FINAL @interface ITMNotification : GPBMessage
 /** Test to see if @c profileChangedNotification has been set. */
 @property(nonatomic, readwrite) BOOL hasProfileChangedNotification;
 
+/**
+ * Number of notifications with the same key that were dropped in favor of this one because of
+ * the subscription's coalescing_window_ms or max_rate. Unset if none were.
+ **/
+@property(nonatomic, readwrite) uint32_t coalescedCount;
+
+@property(nonatomic, readwrite) BOOL hasCoalescedCount;
 @end
 
 #pragma mark - ITMProfileChangedNotification
@@ -4006,6 +4107,7 @@ GPB_FINAL @interface ITMKeystrokeNotification : GPBMessage
 
 typedef GPB_ENUM(ITMScreenUpdateNotification_FieldNumber) {
   ITMScreenUpdateNotification_FieldNumber_Session = 1,
+  ITMScreenUpdateNotification_FieldNumber_Delta = 2,
 };
 
 GPB_FINAL @interface ITMScreenUpdateNotification : GPBMessage
@@ -4014,6 +4116,103 @@ GPB_FINAL @interface ITMScreenUpdateNotification : GPBMessage
 /** Test to see if @c session has been set. */
 @property(nonatomic, readwrite) BOOL hasSession;
 
+/** Set only for subscriptions that asked for deltas. */
+@property(nonatomic, readwrite, strong, null_resettable) ITMScreenUpdateDelta *delta;
+/** Test to see if @c delta has been set. */
+@property(nonatomic, readwrite) BOOL hasDelta;
+
+@end
+
+#pragma mark - ITMScreenUpdateDelta
+
+typedef GPB_ENUM(ITMScreenUpdateDelta_FieldNumber) {
+  ITMScreenUpdateDelta_FieldNumber_SequenceNumber = 1,
+  ITMScreenUpdateDelta_FieldNumber_FullRefresh = 2,
+  ITMScreenUpdateDelta_FieldNumber_Size = 3,
+  ITMScreenUpdateDelta_FieldNumber_FirstLineNumber = 4,
+  ITMScreenUpdateDelta_FieldNumber_LinesArray = 5,
+  ITMScreenUpdateDelta_FieldNumber_Cursor = 6,
+};
+
+/**
+ * How the screen changed since the previous delta sent for the same subscription.
+ **/
+GPB_FINAL @interface ITMScreenUpdateDelta : GPBMessage
+
+/**
+ * 1 for the first delta of a subscription and one more for each after that. If a value is
+ * skipped, a delta was lost and the client's copy of the screen is out of date. It should
+ * request a resync (see ScreenUpdateMonitorRequest).
+ **/
+@property(nonatomic, readwrite) int64_t sequenceNumber;
+
+@property(nonatomic, readwrite) BOOL hasSequenceNumber;
+/**
+ * If true, `lines` has every line of the screen in full and the client should discard its copy.
+ * This is the case for the first delta, after a resync, when the screen changed in a way a delta
+ * can't describe (e.g., it was resized or the buffer was cleared), and after iTerm2 skipped
+ * deltas because the client wasn't reading them fast enough.
+ **/
+@property(nonatomic, readwrite) BOOL fullRefresh;
+
+@property(nonatomic, readwrite) BOOL hasFullRefresh;
+@property(nonatomic, readwrite, strong, null_resettable) ITMSize *size;
+/** Test to see if @c size has been set. */
+@property(nonatomic, readwrite) BOOL hasSize;
+
+/**
+ * The number of lines (including lines lost from the head of scrollback history) that precede
+ * the screen. If this grew by n since the previous delta then the screen scrolled up by n lines:
+ * before applying `lines`, remove the top n lines and add n empty lines at the bottom.
+ **/
+@property(nonatomic, readwrite) int64_t firstLineNumber;
+
+@property(nonatomic, readwrite) BOOL hasFirstLineNumber;
+@property(nonatomic, readwrite, strong, null_resettable) NSMutableArray<ITMScreenLineDelta*> *linesArray;
+/** The number of items in @c linesArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger linesArray_Count;
+
+/** Uses the same coordinate system as GetBufferResponse.cursor. */
+@property(nonatomic, readwrite, strong, null_resettable) ITMCoord *cursor;
+/** Test to see if @c cursor has been set. */
+@property(nonatomic, readwrite) BOOL hasCursor;
+
+@end
+
+#pragma mark - ITMScreenLineDelta
+
+typedef GPB_ENUM(ITMScreenLineDelta_FieldNumber) {
+  ITMScreenLineDelta_FieldNumber_Y = 1,
+  ITMScreenLineDelta_FieldNumber_X = 2,
+  ITMScreenLineDelta_FieldNumber_Length = 3,
+  ITMScreenLineDelta_FieldNumber_Contents = 4,
+};
+
+/**
+ * Replaces some cells in one line of the screen.
+ **/
+GPB_FINAL @interface ITMScreenLineDelta : GPBMessage
+
+/** The line's position on the screen. 0 is the top line. */
+@property(nonatomic, readwrite) int32_t y;
+
+@property(nonatomic, readwrite) BOOL hasY;
+/** The first cell replaced. */
+@property(nonatomic, readwrite) int32_t x;
+
+@property(nonatomic, readwrite) BOOL hasX;
+/** The number of cells replaced, starting at `x`. */
+@property(nonatomic, readwrite) int32_t length;
+
+@property(nonatomic, readwrite) BOOL hasLength;
+/**
+ * The new contents of the replaced cells. `code_points_per_cell` covers exactly `length` cells,
+ * including uninitialized ones. `continuation` describes the whole line.
+ **/
+@property(nonatomic, readwrite, strong, null_resettable) ITMLineContents *contents;
+/** Test to see if @c contents has been set. */
+@property(nonatomic, readwrite) BOOL hasContents;
+
 @end
 
 #pragma mark - ITMPromptNotificationPrompt
@@ -4472,6 +4671,141 @@ GPB_FINAL @interface ITMListPromptsResponse : GPBMessage
 
 @end
 
+#pragma mark - ITMExportScrollbackRequest
+
+typedef GPB_ENUM(ITMExportScrollbackRequest_FieldNumber) {
+  ITMExportScrollbackRequest_FieldNumber_Session = 1,
+  ITMExportScrollbackRequest_FieldNumber_Position = 2,
+  ITMExportScrollbackRequest_FieldNumber_MaxCells = 3,
+  ITMExportScrollbackRequest_FieldNumber_IncludeStyles = 4,
+};
+
+/**
+ * Fetches scrollback history a chunk at a time. This is much cheaper than GetBufferRequest for
+ * large amounts of history because lines are not wrapped and styles are shared among lines. To
+ * export all of history, start with no position and then pass each response's `next_position`
+ * until `at_end` is set. Only lines that have scrolled off the screen are included.
+ **/
+GPB_FINAL @interface ITMExportScrollbackRequest : GPBMessage
+
+/** Must name a specific session. "all" not allowed. */
+@property(nonatomic, readwrite, copy, null_resettable) NSString *session;
+/** Test to see if @c session has been set. */
+@property(nonatomic, readwrite) BOOL hasSession;
+
+/** Where to begin. If unspecified, start at the oldest line. */
+@property(nonatomic, readwrite, strong, null_resettable) ITMScrollbackPosition *position;
+/** Test to see if @c position has been set. */
+@property(nonatomic, readwrite) BOOL hasPosition;
+
+/** About how many cells to return. Lines are split between chunks when they don't fit. */
+@property(nonatomic, readwrite) int32_t maxCells;
+
+@property(nonatomic, readwrite) BOOL hasMaxCells;
+/** Populate the style fields of the response? */
+@property(nonatomic, readwrite) BOOL includeStyles;
+
+@property(nonatomic, readwrite) BOOL hasIncludeStyles;
+@end
+
+#pragma mark - ITMScrollbackPosition
+
+typedef GPB_ENUM(ITMScrollbackPosition_FieldNumber) {
+  ITMScrollbackPosition_FieldNumber_AbsolutePosition = 1,
+  ITMScrollbackPosition_FieldNumber_YOffset = 2,
+};
+
+/**
+ * A location in scrollback history. Positions remain valid as old lines are lost.
+ **/
+GPB_FINAL @interface ITMScrollbackPosition : GPBMessage
+
+/** Number of cells preceding this position, including cells lost from the head of history. */
+@property(nonatomic, readwrite) int64_t absolutePosition;
+
+@property(nonatomic, readwrite) BOOL hasAbsolutePosition;
+/** Number of empty lines at `absolute_position` that precede this position. */
+@property(nonatomic, readwrite) int32_t yOffset;
+
+@property(nonatomic, readwrite) BOOL hasYOffset;
+@end
+
+#pragma mark - ITMExportScrollbackResponse
+
+typedef GPB_ENUM(ITMExportScrollbackResponse_FieldNumber) {
+  ITMExportScrollbackResponse_FieldNumber_Status = 1,
+  ITMExportScrollbackResponse_FieldNumber_Position = 2,
+  ITMExportScrollbackResponse_FieldNumber_NextPosition = 3,
+  ITMExportScrollbackResponse_FieldNumber_AtEnd = 4,
+  ITMExportScrollbackResponse_FieldNumber_ContinuesLine = 5,
+  ITMExportScrollbackResponse_FieldNumber_Text = 6,
+  ITMExportScrollbackResponse_FieldNumber_LineLengthsArray = 7,
+  ITMExportScrollbackResponse_FieldNumber_CodePointsPerCellArray = 8,
+  ITMExportScrollbackResponse_FieldNumber_StyleTableArray = 9,
+  ITMExportScrollbackResponse_FieldNumber_StyleRunLengthsArray = 10,
+  ITMExportScrollbackResponse_FieldNumber_StyleRunIndexesArray = 11,
+};
+
+GPB_FINAL @interface ITMExportScrollbackResponse : GPBMessage
+
+@property(nonatomic, readwrite) ITMExportScrollbackResponse_Status status;
+
+@property(nonatomic, readwrite) BOOL hasStatus;
+/** Where this chunk begins. This is after the requested position if the lines there were lost. */
+@property(nonatomic, readwrite, strong, null_resettable) ITMScrollbackPosition *position;
+/** Test to see if @c position has been set. */
+@property(nonatomic, readwrite) BOOL hasPosition;
+
+/** Pass this as `position` to get the next chunk. */
+@property(nonatomic, readwrite, strong, null_resettable) ITMScrollbackPosition *nextPosition;
+/** Test to see if @c nextPosition has been set. */
+@property(nonatomic, readwrite) BOOL hasNextPosition;
+
+/** Set if there was no more history after this chunk when it was made. */
+@property(nonatomic, readwrite) BOOL atEnd;
+
+@property(nonatomic, readwrite) BOOL hasAtEnd;
+/** Set if the first line of this chunk continues the last line of the previous chunk. */
+@property(nonatomic, readwrite) BOOL continuesLine;
+
+@property(nonatomic, readwrite) BOOL hasContinuesLine;
+/**
+ * The text of the lines in this chunk. Each line that ends within the chunk is followed by a
+ * newline. The last line lacks one if it continues in the next chunk or is still being written.
+ **/
+@property(nonatomic, readwrite, copy, null_resettable) NSString *text;
+/** Test to see if @c text has been set. */
+@property(nonatomic, readwrite) BOOL hasText;
+
+/** The number of cells in each line of `text`. */
+@property(nonatomic, readwrite, strong, null_resettable) GPBInt32Array *lineLengthsArray;
+/** The number of items in @c lineLengthsArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger lineLengthsArray_Count;
+
+/** Maps code points in `text`, excluding newlines, to cells. See LineContents. */
+@property(nonatomic, readwrite, strong, null_resettable) NSMutableArray<ITMCodePointsPerCell*> *codePointsPerCellArray;
+/** The number of items in @c codePointsPerCellArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger codePointsPerCellArray_Count;
+
+/** The distinct styles of cells in this chunk, if include_styles was set. `repeats` is unset. */
+@property(nonatomic, readwrite, strong, null_resettable) NSMutableArray<ITMCellStyle*> *styleTableArray;
+/** The number of items in @c styleTableArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger styleTableArray_Count;
+
+/**
+ * Run-length encoded cell styles. Run i covers the next style_run_lengths[i] cells and has the
+ * style style_table[style_run_indexes[i]]. Runs can span lines.
+ **/
+@property(nonatomic, readwrite, strong, null_resettable) GPBInt32Array *styleRunLengthsArray;
+/** The number of items in @c styleRunLengthsArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger styleRunLengthsArray_Count;
+
+@property(nonatomic, readwrite, strong, null_resettable) GPBInt32Array *styleRunIndexesArray;
+/** The number of items in @c styleRunIndexesArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger styleRunIndexesArray_Count;
+
+@end
+
 #pragma mark - ITMGetProfilePropertyRequest
 
 typedef GPB_ENUM(ITMGetProfilePropertyRequest_FieldNumber) {
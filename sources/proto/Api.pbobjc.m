@@ -51,6 +51,8 @@ GPBObjCClassDeclaration(ITMCoordRange);
 GPBObjCClassDeclaration(ITMCreateTabRequest);
 GPBObjCClassDeclaration(ITMCreateTabResponse);
 GPBObjCClassDeclaration(ITMCustomEscapeSequenceNotification);
+GPBObjCClassDeclaration(ITMExportScrollbackRequest);
+GPBObjCClassDeclaration(ITMExportScrollbackResponse);
 GPBObjCClassDeclaration(ITMFocusChangedNotification);
 GPBObjCClassDeclaration(ITMFocusChangedNotification_Window);
 GPBObjCClassDeclaration(ITMFocusRequest);
@@ -141,7 +143,11 @@ GPBObjCClassDeclaration(ITMRestartSessionRequest);
 GPBObjCClassDeclaration(ITMRestartSessionResponse);
 GPBObjCClassDeclaration(ITMSavedArrangementRequest);
 GPBObjCClassDeclaration(ITMSavedArrangementResponse);
+GPBObjCClassDeclaration(ITMScreenLineDelta);
+GPBObjCClassDeclaration(ITMScreenUpdateDelta);
+GPBObjCClassDeclaration(ITMScreenUpdateMonitorRequest);
 GPBObjCClassDeclaration(ITMScreenUpdateNotification);
+GPBObjCClassDeclaration(ITMScrollbackPosition);
 GPBObjCClassDeclaration(ITMSelection);
 GPBObjCClassDeclaration(ITMSelectionRequest);
 GPBObjCClassDeclaration(ITMSelectionRequest_GetSelectionRequest);
@@ -565,6 +571,7 @@ BOOL ITMImagePlaceholderType_IsValidValue(int32_t value__) {
 @dynamic closeRequest;
 @dynamic invokeFunctionRequest;
 @dynamic listPromptsRequest;
+@dynamic exportScrollbackRequest;
 
 typedef struct ITMClientOriginatedMessage__storage_ {
   uint32_t _has_storage_[2];
@@ -602,6 +609,7 @@ typedef struct ITMClientOriginatedMessage__storage_ {
   ITMCloseRequest *closeRequest;
   ITMInvokeFunctionRequest *invokeFunctionRequest;
   ITMListPromptsRequest *listPromptsRequest;
+  ITMExportScrollbackRequest *exportScrollbackRequest;
   int64_t id_p;
 } ITMClientOriginatedMessage__storage_;
 
@@ -926,6 +934,15 @@ typedef struct ITMClientOriginatedMessage__storage_ {
         .flags = GPBFieldOptional,
         .dataType = GPBDataTypeMessage,
       },
+      {
+        .name = "exportScrollbackRequest",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMExportScrollbackRequest),
+        .number = ITMClientOriginatedMessage_FieldNumber_ExportScrollbackRequest,
+        .hasIndex = -1,
+        .offset = (uint32_t)offsetof(ITMClientOriginatedMessage__storage_, exportScrollbackRequest),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
     };
     GPBDescriptor *localDescriptor =
         [GPBDescriptor allocDescriptorForClass:[ITMClientOriginatedMessage class]
@@ -997,6 +1014,7 @@ void ITMClientOriginatedMessage_ClearSubmessageOneOfCase(ITMClientOriginatedMess
 @dynamic closeResponse;
 @dynamic invokeFunctionResponse;
 @dynamic listPromptsResponse;
+@dynamic exportScrollbackResponse;
 @dynamic notification;
 
 typedef struct ITMServerOriginatedMessage__storage_ {
@@ -1036,6 +1054,7 @@ typedef struct ITMServerOriginatedMessage__storage_ {
   ITMCloseResponse *closeResponse;
   ITMInvokeFunctionResponse *invokeFunctionResponse;
   ITMListPromptsResponse *listPromptsResponse;
+  ITMExportScrollbackResponse *exportScrollbackResponse;
   ITMNotification *notification;
   int64_t id_p;
 } ITMServerOriginatedMessage__storage_;
@@ -1370,6 +1389,15 @@ typedef struct ITMServerOriginatedMessage__storage_ {
         .flags = GPBFieldOptional,
         .dataType = GPBDataTypeMessage,
       },
+      {
+        .name = "exportScrollbackResponse",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMExportScrollbackResponse),
+        .number = ITMServerOriginatedMessage_FieldNumber_ExportScrollbackResponse,
+        .hasIndex = -1,
+        .offset = (uint32_t)offsetof(ITMServerOriginatedMessage__storage_, exportScrollbackResponse),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
       {
         .name = "notification",
         .dataTypeSpecific.clazz = GPBObjCClass(ITMNotification),
@@ -8669,6 +8697,70 @@ typedef struct ITMPromptMonitorRequest__storage_ {
 
 @end
 
+#pragma mark - ITMScreenUpdateMonitorRequest
+
+@implementation ITMScreenUpdateMonitorRequest
+
+@dynamic hasDeltas, deltas;
+@dynamic hasIncludeStyles, includeStyles;
+@dynamic hasResync, resync;
+
+typedef struct ITMScreenUpdateMonitorRequest__storage_ {
+  uint32_t _has_storage_[1];
+} ITMScreenUpdateMonitorRequest__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescription fields[] = {
+      {
+        .name = "deltas",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenUpdateMonitorRequest_FieldNumber_Deltas,
+        .hasIndex = 0,
+        .offset = 1,  // Stored in _has_storage_ to save space.
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBool,
+      },
+      {
+        .name = "includeStyles",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenUpdateMonitorRequest_FieldNumber_IncludeStyles,
+        .hasIndex = 2,
+        .offset = 3,  // Stored in _has_storage_ to save space.
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBool,
+      },
+      {
+        .name = "resync",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenUpdateMonitorRequest_FieldNumber_Resync,
+        .hasIndex = 4,
+        .offset = 5,  // Stored in _has_storage_ to save space.
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBool,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[ITMScreenUpdateMonitorRequest class]
+                                     rootClass:[ITMApiRoot class]
+                                          file:ITMApiRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
+                                   storageSize:sizeof(ITMScreenUpdateMonitorRequest__storage_)
+                                         flags:(GPBDescriptorInitializationFlags)(GPBDescriptorInitializationFlag_UsesClassRefs | GPBDescriptorInitializationFlag_Proto3OptionalKnown)];
+    #if defined(DEBUG) && DEBUG
+      NSAssert(descriptor == nil, @"Startup recursed!");
+    #endif  // DEBUG
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
 #pragma mark - ITMNotificationRequest
 
 @implementation ITMNotificationRequest
@@ -8683,10 +8775,14 @@ typedef struct ITMPromptMonitorRequest__storage_ {
 @dynamic profileChangeRequest;
 @dynamic keystrokeFilterRequest;
 @dynamic promptMonitorRequest;
+@dynamic screenUpdateMonitorRequest;
+@dynamic hasCoalescingWindowMs, coalescingWindowMs;
+@dynamic hasMaxRate, maxRate;
 
 typedef struct ITMNotificationRequest__storage_ {
   uint32_t _has_storage_[2];
   ITMNotificationType notificationType;
+  uint32_t coalescingWindowMs;
   NSString *session;
   ITMRPCRegistrationRequest *rpcRegistrationRequest;
   ITMKeystrokeMonitorRequest *keystrokeMonitorRequest;
@@ -8694,6 +8790,8 @@ typedef struct ITMNotificationRequest__storage_ {
   ITMProfileChangeRequest *profileChangeRequest;
   ITMKeystrokeFilterRequest *keystrokeFilterRequest;
   ITMPromptMonitorRequest *promptMonitorRequest;
+  ITMScreenUpdateMonitorRequest *screenUpdateMonitorRequest;
+  double maxRate;
 } ITMNotificationRequest__storage_;
 
 // This method is threadsafe because it is initially called
@@ -8792,6 +8890,36 @@ typedef struct ITMNotificationRequest__storage_ {
         .core.flags = GPBFieldOptional,
         .core.dataType = GPBDataTypeMessage,
       },
+      {
+        .defaultValue.valueMessage = nil,
+        .core.name = "screenUpdateMonitorRequest",
+        .core.dataTypeSpecific.clazz = GPBObjCClass(ITMScreenUpdateMonitorRequest),
+        .core.number = ITMNotificationRequest_FieldNumber_ScreenUpdateMonitorRequest,
+        .core.hasIndex = -1,
+        .core.offset = (uint32_t)offsetof(ITMNotificationRequest__storage_, screenUpdateMonitorRequest),
+        .core.flags = GPBFieldOptional,
+        .core.dataType = GPBDataTypeMessage,
+      },
+      {
+        .defaultValue.valueUInt32 = 0U,
+        .core.name = "coalescingWindowMs",
+        .core.dataTypeSpecific.clazz = Nil,
+        .core.number = ITMNotificationRequest_FieldNumber_CoalescingWindowMs,
+        .core.hasIndex = 4,
+        .core.offset = (uint32_t)offsetof(ITMNotificationRequest__storage_, coalescingWindowMs),
+        .core.flags = GPBFieldOptional,
+        .core.dataType = GPBDataTypeUInt32,
+      },
+      {
+        .defaultValue.valueDouble = 0,
+        .core.name = "maxRate",
+        .core.dataTypeSpecific.clazz = Nil,
+        .core.number = ITMNotificationRequest_FieldNumber_MaxRate,
+        .core.hasIndex = 5,
+        .core.offset = (uint32_t)offsetof(ITMNotificationRequest__storage_, maxRate),
+        .core.flags = GPBFieldOptional,
+        .core.dataType = GPBDataTypeDouble,
+      },
     };
     GPBDescriptor *localDescriptor =
         [GPBDescriptor allocDescriptorForClass:[ITMNotificationRequest class]
@@ -8931,9 +9059,11 @@ BOOL ITMNotificationResponse_Status_IsValidValue(int32_t value__) {
 @dynamic hasBroadcastDomainsChanged, broadcastDomainsChanged;
 @dynamic hasVariableChangedNotification, variableChangedNotification;
 @dynamic hasProfileChangedNotification, profileChangedNotification;
+@dynamic hasCoalescedCount, coalescedCount;
 
 typedef struct ITMNotification__storage_ {
   uint32_t _has_storage_[1];
+  uint32_t coalescedCount;
   ITMKeystrokeNotification *keystrokeNotification;
   ITMScreenUpdateNotification *screenUpdateNotification;
   ITMPromptNotification *promptNotification;
@@ -9072,6 +9202,15 @@ typedef struct ITMNotification__storage_ {
         .flags = GPBFieldOptional,
         .dataType = GPBDataTypeMessage,
       },
+      {
+        .name = "coalescedCount",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMNotification_FieldNumber_CoalescedCount,
+        .hasIndex = 13,
+        .offset = (uint32_t)offsetof(ITMNotification__storage_, coalescedCount),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeUInt32,
+      },
     };
     GPBDescriptor *localDescriptor =
         [GPBDescriptor allocDescriptorForClass:[ITMNotification class]
@@ -9579,10 +9718,12 @@ BOOL ITMKeystrokeNotification_Action_IsValidValue(int32_t value__) {
 @implementation ITMScreenUpdateNotification
 
 @dynamic hasSession, session;
+@dynamic hasDelta, delta;
 
 typedef struct ITMScreenUpdateNotification__storage_ {
   uint32_t _has_storage_[1];
   NSString *session;
+  ITMScreenUpdateDelta *delta;
 } ITMScreenUpdateNotification__storage_;
 
 // This method is threadsafe because it is initially called
@@ -9600,6 +9741,15 @@ typedef struct ITMScreenUpdateNotification__storage_ {
         .flags = GPBFieldOptional,
         .dataType = GPBDataTypeString,
       },
+      {
+        .name = "delta",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMScreenUpdateDelta),
+        .number = ITMScreenUpdateNotification_FieldNumber_Delta,
+        .hasIndex = 1,
+        .offset = (uint32_t)offsetof(ITMScreenUpdateNotification__storage_, delta),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
     };
     GPBDescriptor *localDescriptor =
         [GPBDescriptor allocDescriptorForClass:[ITMScreenUpdateNotification class]
@@ -9619,6 +9769,183 @@ typedef struct ITMScreenUpdateNotification__storage_ {
 
 @end
 
+#pragma mark - ITMScreenUpdateDelta
+
+@implementation ITMScreenUpdateDelta
+
+@dynamic hasSequenceNumber, sequenceNumber;
+@dynamic hasFullRefresh, fullRefresh;
+@dynamic hasSize, size;
+@dynamic hasFirstLineNumber, firstLineNumber;
+@dynamic linesArray, linesArray_Count;
+@dynamic hasCursor, cursor;
+
+typedef struct ITMScreenUpdateDelta__storage_ {
+  uint32_t _has_storage_[1];
+  ITMSize *size;
+  NSMutableArray *linesArray;
+  ITMCoord *cursor;
+  int64_t sequenceNumber;
+  int64_t firstLineNumber;
+} ITMScreenUpdateDelta__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescription fields[] = {
+      {
+        .name = "sequenceNumber",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenUpdateDelta_FieldNumber_SequenceNumber,
+        .hasIndex = 0,
+        .offset = (uint32_t)offsetof(ITMScreenUpdateDelta__storage_, sequenceNumber),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt64,
+      },
+      {
+        .name = "fullRefresh",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenUpdateDelta_FieldNumber_FullRefresh,
+        .hasIndex = 1,
+        .offset = 2,  // Stored in _has_storage_ to save space.
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBool,
+      },
+      {
+        .name = "size",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMSize),
+        .number = ITMScreenUpdateDelta_FieldNumber_Size,
+        .hasIndex = 3,
+        .offset = (uint32_t)offsetof(ITMScreenUpdateDelta__storage_, size),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
+      {
+        .name = "firstLineNumber",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenUpdateDelta_FieldNumber_FirstLineNumber,
+        .hasIndex = 4,
+        .offset = (uint32_t)offsetof(ITMScreenUpdateDelta__storage_, firstLineNumber),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt64,
+      },
+      {
+        .name = "linesArray",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMScreenLineDelta),
+        .number = ITMScreenUpdateDelta_FieldNumber_LinesArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(ITMScreenUpdateDelta__storage_, linesArray),
+        .flags = GPBFieldRepeated,
+        .dataType = GPBDataTypeMessage,
+      },
+      {
+        .name = "cursor",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMCoord),
+        .number = ITMScreenUpdateDelta_FieldNumber_Cursor,
+        .hasIndex = 5,
+        .offset = (uint32_t)offsetof(ITMScreenUpdateDelta__storage_, cursor),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[ITMScreenUpdateDelta class]
+                                     rootClass:[ITMApiRoot class]
+                                          file:ITMApiRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
+                                   storageSize:sizeof(ITMScreenUpdateDelta__storage_)
+                                         flags:(GPBDescriptorInitializationFlags)(GPBDescriptorInitializationFlag_UsesClassRefs | GPBDescriptorInitializationFlag_Proto3OptionalKnown)];
+    #if defined(DEBUG) && DEBUG
+      NSAssert(descriptor == nil, @"Startup recursed!");
+    #endif  // DEBUG
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
+#pragma mark - ITMScreenLineDelta
+
+@implementation ITMScreenLineDelta
+
+@dynamic hasY, y;
+@dynamic hasX, x;
+@dynamic hasLength, length;
+@dynamic hasContents, contents;
+
+typedef struct ITMScreenLineDelta__storage_ {
+  uint32_t _has_storage_[1];
+  int32_t y;
+  int32_t x;
+  int32_t length;
+  ITMLineContents *contents;
+} ITMScreenLineDelta__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescription fields[] = {
+      {
+        .name = "y",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenLineDelta_FieldNumber_Y,
+        .hasIndex = 0,
+        .offset = (uint32_t)offsetof(ITMScreenLineDelta__storage_, y),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt32,
+      },
+      {
+        .name = "x",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenLineDelta_FieldNumber_X,
+        .hasIndex = 1,
+        .offset = (uint32_t)offsetof(ITMScreenLineDelta__storage_, x),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt32,
+      },
+      {
+        .name = "length",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScreenLineDelta_FieldNumber_Length,
+        .hasIndex = 2,
+        .offset = (uint32_t)offsetof(ITMScreenLineDelta__storage_, length),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt32,
+      },
+      {
+        .name = "contents",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMLineContents),
+        .number = ITMScreenLineDelta_FieldNumber_Contents,
+        .hasIndex = 3,
+        .offset = (uint32_t)offsetof(ITMScreenLineDelta__storage_, contents),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[ITMScreenLineDelta class]
+                                     rootClass:[ITMApiRoot class]
+                                          file:ITMApiRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
+                                   storageSize:sizeof(ITMScreenLineDelta__storage_)
+                                         flags:(GPBDescriptorInitializationFlags)(GPBDescriptorInitializationFlag_UsesClassRefs | GPBDescriptorInitializationFlag_Proto3OptionalKnown)];
+    #if defined(DEBUG) && DEBUG
+      NSAssert(descriptor == nil, @"Startup recursed!");
+    #endif  // DEBUG
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
 #pragma mark - ITMPromptNotificationPrompt
 
 @implementation ITMPromptNotificationPrompt
@@ -10960,6 +11287,333 @@ BOOL ITMListPromptsResponse_Status_IsValidValue(int32_t value__) {
   }
 }
 
+#pragma mark - ITMExportScrollbackRequest
+
+@implementation ITMExportScrollbackRequest
+
+@dynamic hasSession, session;
+@dynamic hasPosition, position;
+@dynamic hasMaxCells, maxCells;
+@dynamic hasIncludeStyles, includeStyles;
+
+typedef struct ITMExportScrollbackRequest__storage_ {
+  uint32_t _has_storage_[1];
+  int32_t maxCells;
+  NSString *session;
+  ITMScrollbackPosition *position;
+} ITMExportScrollbackRequest__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescriptionWithDefault fields[] = {
+      {
+        .defaultValue.valueString = nil,
+        .core.name = "session",
+        .core.dataTypeSpecific.clazz = Nil,
+        .core.number = ITMExportScrollbackRequest_FieldNumber_Session,
+        .core.hasIndex = 0,
+        .core.offset = (uint32_t)offsetof(ITMExportScrollbackRequest__storage_, session),
+        .core.flags = GPBFieldOptional,
+        .core.dataType = GPBDataTypeString,
+      },
+      {
+        .defaultValue.valueMessage = nil,
+        .core.name = "position",
+        .core.dataTypeSpecific.clazz = GPBObjCClass(ITMScrollbackPosition),
+        .core.number = ITMExportScrollbackRequest_FieldNumber_Position,
+        .core.hasIndex = 1,
+        .core.offset = (uint32_t)offsetof(ITMExportScrollbackRequest__storage_, position),
+        .core.flags = GPBFieldOptional,
+        .core.dataType = GPBDataTypeMessage,
+      },
+      {
+        .defaultValue.valueInt32 = 65536,
+        .core.name = "maxCells",
+        .core.dataTypeSpecific.clazz = Nil,
+        .core.number = ITMExportScrollbackRequest_FieldNumber_MaxCells,
+        .core.hasIndex = 2,
+        .core.offset = (uint32_t)offsetof(ITMExportScrollbackRequest__storage_, maxCells),
+        .core.flags = (GPBFieldFlags)(GPBFieldOptional | GPBFieldHasDefaultValue),
+        .core.dataType = GPBDataTypeInt32,
+      },
+      {
+        .defaultValue.valueBool = NO,
+        .core.name = "includeStyles",
+        .core.dataTypeSpecific.clazz = Nil,
+        .core.number = ITMExportScrollbackRequest_FieldNumber_IncludeStyles,
+        .core.hasIndex = 3,
+        .core.offset = 4,  // Stored in _has_storage_ to save space.
+        .core.flags = GPBFieldOptional,
+        .core.dataType = GPBDataTypeBool,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[ITMExportScrollbackRequest class]
+                                     rootClass:[ITMApiRoot class]
+                                          file:ITMApiRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescriptionWithDefault))
+                                   storageSize:sizeof(ITMExportScrollbackRequest__storage_)
+                                         flags:(GPBDescriptorInitializationFlags)(GPBDescriptorInitializationFlag_UsesClassRefs | GPBDescriptorInitializationFlag_Proto3OptionalKnown | GPBDescriptorInitializationFlag_FieldsWithDefault)];
+    #if defined(DEBUG) && DEBUG
+      NSAssert(descriptor == nil, @"Startup recursed!");
+    #endif  // DEBUG
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
+#pragma mark - ITMScrollbackPosition
+
+@implementation ITMScrollbackPosition
+
+@dynamic hasAbsolutePosition, absolutePosition;
+@dynamic hasYOffset, yOffset;
+
+typedef struct ITMScrollbackPosition__storage_ {
+  uint32_t _has_storage_[1];
+  int32_t yOffset;
+  int64_t absolutePosition;
+} ITMScrollbackPosition__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescription fields[] = {
+      {
+        .name = "absolutePosition",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScrollbackPosition_FieldNumber_AbsolutePosition,
+        .hasIndex = 0,
+        .offset = (uint32_t)offsetof(ITMScrollbackPosition__storage_, absolutePosition),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt64,
+      },
+      {
+        .name = "yOffset",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMScrollbackPosition_FieldNumber_YOffset,
+        .hasIndex = 1,
+        .offset = (uint32_t)offsetof(ITMScrollbackPosition__storage_, yOffset),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt32,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[ITMScrollbackPosition class]
+                                     rootClass:[ITMApiRoot class]
+                                          file:ITMApiRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
+                                   storageSize:sizeof(ITMScrollbackPosition__storage_)
+                                         flags:(GPBDescriptorInitializationFlags)(GPBDescriptorInitializationFlag_UsesClassRefs | GPBDescriptorInitializationFlag_Proto3OptionalKnown)];
+    #if defined(DEBUG) && DEBUG
+      NSAssert(descriptor == nil, @"Startup recursed!");
+    #endif  // DEBUG
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
+#pragma mark - ITMExportScrollbackResponse
+
+@implementation ITMExportScrollbackResponse
+
+@dynamic hasStatus, status;
+@dynamic hasPosition, position;
+@dynamic hasNextPosition, nextPosition;
+@dynamic hasAtEnd, atEnd;
+@dynamic hasContinuesLine, continuesLine;
+@dynamic hasText, text;
+@dynamic lineLengthsArray, lineLengthsArray_Count;
+@dynamic codePointsPerCellArray, codePointsPerCellArray_Count;
+@dynamic styleTableArray, styleTableArray_Count;
+@dynamic styleRunLengthsArray, styleRunLengthsArray_Count;
+@dynamic styleRunIndexesArray, styleRunIndexesArray_Count;
+
+typedef struct ITMExportScrollbackResponse__storage_ {
+  uint32_t _has_storage_[1];
+  ITMExportScrollbackResponse_Status status;
+  ITMScrollbackPosition *position;
+  ITMScrollbackPosition *nextPosition;
+  NSString *text;
+  GPBInt32Array *lineLengthsArray;
+  NSMutableArray *codePointsPerCellArray;
+  NSMutableArray *styleTableArray;
+  GPBInt32Array *styleRunLengthsArray;
+  GPBInt32Array *styleRunIndexesArray;
+} ITMExportScrollbackResponse__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescription fields[] = {
+      {
+        .name = "status",
+        .dataTypeSpecific.enumDescFunc = ITMExportScrollbackResponse_Status_EnumDescriptor,
+        .number = ITMExportScrollbackResponse_FieldNumber_Status,
+        .hasIndex = 0,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, status),
+        .flags = (GPBFieldFlags)(GPBFieldOptional | GPBFieldHasDefaultValue | GPBFieldHasEnumDescriptor),
+        .dataType = GPBDataTypeEnum,
+      },
+      {
+        .name = "position",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMScrollbackPosition),
+        .number = ITMExportScrollbackResponse_FieldNumber_Position,
+        .hasIndex = 1,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, position),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
+      {
+        .name = "nextPosition",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMScrollbackPosition),
+        .number = ITMExportScrollbackResponse_FieldNumber_NextPosition,
+        .hasIndex = 2,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, nextPosition),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
+      {
+        .name = "atEnd",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMExportScrollbackResponse_FieldNumber_AtEnd,
+        .hasIndex = 3,
+        .offset = 4,  // Stored in _has_storage_ to save space.
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBool,
+      },
+      {
+        .name = "continuesLine",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMExportScrollbackResponse_FieldNumber_ContinuesLine,
+        .hasIndex = 5,
+        .offset = 6,  // Stored in _has_storage_ to save space.
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBool,
+      },
+      {
+        .name = "text",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMExportScrollbackResponse_FieldNumber_Text,
+        .hasIndex = 7,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, text),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeString,
+      },
+      {
+        .name = "lineLengthsArray",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMExportScrollbackResponse_FieldNumber_LineLengthsArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, lineLengthsArray),
+        .flags = (GPBFieldFlags)(GPBFieldRepeated | GPBFieldPacked),
+        .dataType = GPBDataTypeInt32,
+      },
+      {
+        .name = "codePointsPerCellArray",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMCodePointsPerCell),
+        .number = ITMExportScrollbackResponse_FieldNumber_CodePointsPerCellArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, codePointsPerCellArray),
+        .flags = GPBFieldRepeated,
+        .dataType = GPBDataTypeMessage,
+      },
+      {
+        .name = "styleTableArray",
+        .dataTypeSpecific.clazz = GPBObjCClass(ITMCellStyle),
+        .number = ITMExportScrollbackResponse_FieldNumber_StyleTableArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, styleTableArray),
+        .flags = GPBFieldRepeated,
+        .dataType = GPBDataTypeMessage,
+      },
+      {
+        .name = "styleRunLengthsArray",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMExportScrollbackResponse_FieldNumber_StyleRunLengthsArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, styleRunLengthsArray),
+        .flags = (GPBFieldFlags)(GPBFieldRepeated | GPBFieldPacked),
+        .dataType = GPBDataTypeInt32,
+      },
+      {
+        .name = "styleRunIndexesArray",
+        .dataTypeSpecific.clazz = Nil,
+        .number = ITMExportScrollbackResponse_FieldNumber_StyleRunIndexesArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(ITMExportScrollbackResponse__storage_, styleRunIndexesArray),
+        .flags = (GPBFieldFlags)(GPBFieldRepeated | GPBFieldPacked),
+        .dataType = GPBDataTypeInt32,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[ITMExportScrollbackResponse class]
+                                     rootClass:[ITMApiRoot class]
+                                          file:ITMApiRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
+                                   storageSize:sizeof(ITMExportScrollbackResponse__storage_)
+                                         flags:(GPBDescriptorInitializationFlags)(GPBDescriptorInitializationFlag_UsesClassRefs | GPBDescriptorInitializationFlag_Proto3OptionalKnown)];
+    #if defined(DEBUG) && DEBUG
+      NSAssert(descriptor == nil, @"Startup recursed!");
+    #endif  // DEBUG
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
+#pragma mark - Enum ITMExportScrollbackResponse_Status
+
+GPBEnumDescriptor *ITMExportScrollbackResponse_Status_EnumDescriptor(void) {
+  static _Atomic(GPBEnumDescriptor*) descriptor = nil;
+  if (!descriptor) {
+    static const char *valueNames =
+        "Ok\000SessionNotFound\000RequestMalformed\000";
+    static const int32_t values[] = {
+        ITMExportScrollbackResponse_Status_Ok,
+        ITMExportScrollbackResponse_Status_SessionNotFound,
+        ITMExportScrollbackResponse_Status_RequestMalformed,
+    };
+    GPBEnumDescriptor *worker =
+        [GPBEnumDescriptor allocDescriptorForName:GPBNSStringifySymbol(ITMExportScrollbackResponse_Status)
+                                       valueNames:valueNames
+                                           values:values
+                                            count:(uint32_t)(sizeof(values) / sizeof(int32_t))
+                                     enumVerifier:ITMExportScrollbackResponse_Status_IsValidValue];
+    GPBEnumDescriptor *expected = nil;
+    if (!atomic_compare_exchange_strong(&descriptor, &expected, worker)) {
+      [worker release];
+    }
+  }
+  return descriptor;
+}
+
+BOOL ITMExportScrollbackResponse_Status_IsValidValue(int32_t value__) {
+  switch (value__) {
+    case ITMExportScrollbackResponse_Status_Ok:
+    case ITMExportScrollbackResponse_Status_SessionNotFound:
+    case ITMExportScrollbackResponse_Status_RequestMalformed:
+      return YES;
+    default:
+      return NO;
+  }
+}
+
 #pragma mark - ITMGetProfilePropertyRequest
 
 @implementation ITMGetProfilePropertyRequest